@@ -32,6 +32,7 @@
 #include "a_star.compat.inc"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 
 int64_t AStar3D::get_available_point_id() const {
 	if (points.has(last_free_id)) {
@@ -57,10 +58,13 @@ void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scal
 		pt->id = p_id;
 		pt->pos = p_pos;
 		pt->weight_scale = p_weight_scale;
-		pt->prev_point = nullptr;
-		pt->open_pass = 0;
-		pt->closed_pass = 0;
 		pt->enabled = true;
+		if (free_point_indices.is_empty()) {
+			pt->index = point_index_count++;
+		} else {
+			pt->index = free_point_indices[free_point_indices.size() - 1];
+			free_point_indices.remove_at(free_point_indices.size() - 1);
+		}
 		points.set(p_id, pt);
 	} else {
 		found_pt->pos = p_pos;
@@ -122,6 +126,7 @@ void AStar3D::remove_point(int64_t p_id) {
 		(*it.value)->unlinked_neighbours.remove(p->id);
 	}
 
+	free_point_indices.push_back(p->index);
 	memdelete(p);
 	points.remove(p_id);
 	last_free_id = p_id;
@@ -248,6 +253,10 @@ void AStar3D::clear() {
 	}
 	segments.clear();
 	points.clear();
+	free_point_indices.clear();
+	point_index_count = 0;
+	solve_context = SolveContext();
+	batch_contexts.clear();
 }
 
 int64_t AStar3D::get_point_count() const {
@@ -318,76 +327,236 @@ Vector3 AStar3D::get_closest_position_in_segment(const Vector3 &p_point) const {
 	return closest_point;
 }
 
-bool AStar3D::_solve(Point *begin_point, Point *end_point, bool p_allow_partial_path) {
-	last_closest_point = nullptr;
-	pass++;
+real_t AStar3D::_get_estimate_cost(const SolveContext &p_context, const Point *p_from_point, const Point *p_end_point) {
+	if (p_context.use_virtual_costs) {
+		return _estimate_cost(p_from_point->id, p_end_point->id);
+	}
+	return p_from_point->pos.distance_to(p_end_point->pos);
+}
 
-	if (!end_point->enabled && !p_allow_partial_path) {
-		return false;
+real_t AStar3D::_get_compute_cost(const SolveContext &p_context, const Point *p_from_point, const Point *p_to_point) {
+	if (p_context.use_virtual_costs) {
+		return _compute_cost(p_from_point->id, p_to_point->id);
 	}
+	return p_from_point->pos.distance_to(p_to_point->pos);
+}
 
-	bool found_route = false;
+void AStar3D::_prepare_frontier(SolveContext::Frontier &r_frontier, bool p_reset) const {
+	if (p_reset || r_frontier.passes.size() != point_index_count) {
+		r_frontier.g_scores.resize(point_index_count);
+		r_frontier.prev_points.resize(point_index_count);
+		r_frontier.passes.resize(point_index_count);
+		for (uint32_t &point_pass : r_frontier.passes) {
+			point_pass = 0;
+		}
+	}
+	r_frontier.open_list.clear();
+}
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
+void AStar3D::_begin_solve(SolveContext &r_context, bool p_bidirectional) const {
+	const bool reset = r_context.pass >= (UINT32_MAX >> 1);
+	if (reset) {
+		r_context.pass = 0;
+		if (!p_bidirectional) {
+			r_context.backward = SolveContext::Frontier(); // Resized and cleared on its next use.
+		}
+	}
 
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	begin_point->abs_g_score = 0;
-	begin_point->abs_f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
+	r_context.pass++;
+	r_context.last_closest_point = nullptr;
+
+	_prepare_frontier(r_context.forward, reset);
+	if (p_bidirectional) {
+		_prepare_frontier(r_context.backward, reset);
+	}
+}
+
+AStar3D::Point *AStar3D::_pop_open_point(SolveContext::Frontier &r_frontier, uint32_t p_open_pass, real_t &r_g_score, real_t &r_f_score) const {
+	LocalVector<SolveContext::OpenPoint> &open_list = r_frontier.open_list;
+	SortArray<SolveContext::OpenPoint, SortOpenPoints> sorter;
 
 	while (!open_list.is_empty()) {
-		Point *p = open_list[0]; // The currently processed point.
+		const SolveContext::OpenPoint p = open_list[0];
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
+		open_list.remove_at(open_list.size() - 1);
+
+		// Points are pushed again when their score improves, skip the outdated entries.
+		if (r_frontier.passes[p.point->index] != p_open_pass || p.g_score != r_frontier.g_scores[p.point->index]) {
+			continue;
+		}
+
+		r_g_score = p.g_score;
+		r_f_score = p.f_score;
+		return p.point;
+	}
 
+	return nullptr;
+}
+
+bool AStar3D::_solve(SolveContext &r_context, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path) {
+	_begin_solve(r_context, false);
+
+	if (!p_end_point->enabled && !p_allow_partial_path) {
+		return false;
+	}
+
+	const uint32_t open_pass = r_context.pass << 1;
+	const uint32_t closed_pass = open_pass | 1;
+
+	SolveContext::Frontier &frontier = r_context.forward;
+	SortArray<SolveContext::OpenPoint, SortOpenPoints> sorter;
+
+	frontier.g_scores[p_begin_point->index] = 0;
+	frontier.prev_points[p_begin_point->index] = p_begin_point;
+	frontier.passes[p_begin_point->index] = open_pass;
+	frontier.open_list.push_back({ p_begin_point, 0, _get_estimate_cost(r_context, p_begin_point, p_end_point) });
+
+	real_t g_score = 0;
+	real_t f_score = 0;
+	Point *p = nullptr; // The currently processed point.
+
+	while ((p = _pop_open_point(frontier, open_pass, g_score, f_score))) {
 		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (last_closest_point == nullptr || last_closest_point->abs_f_score > p->abs_f_score || (last_closest_point->abs_f_score >= p->abs_f_score && last_closest_point->abs_g_score > p->abs_g_score)) {
-			last_closest_point = p;
+		const real_t abs_f_score = f_score - g_score;
+		if (r_context.last_closest_point == nullptr || r_context.last_closest_abs_f_score > abs_f_score || (r_context.last_closest_abs_f_score >= abs_f_score && r_context.last_closest_abs_g_score > g_score)) {
+			r_context.last_closest_point = p;
+			r_context.last_closest_abs_f_score = abs_f_score;
+			r_context.last_closest_abs_g_score = g_score;
 		}
 
-		if (p == end_point) {
-			found_route = true;
-			break;
+		if (p == p_end_point) {
+			return true;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = pass; // Mark the point as closed.
+		frontier.passes[p->index] = closed_pass; // Mark the point as closed.
 
 		for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
 			Point *e = *(it.value); // The neighbor point.
 
-			if (!e->enabled || e->closed_pass == pass) {
+			if (!e->enabled || frontier.passes[e->index] == closed_pass) {
 				continue;
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
+			real_t tentative_g_score = g_score + _get_compute_cost(r_context, p, e) * e->weight_scale;
 
-			bool new_point = false;
+			if (tentative_g_score > max_search_cost) { // The point is beyond the search bound.
+				continue;
+			}
 
-			if (e->open_pass != pass) { // The point wasn't inside the open list.
-				e->open_pass = pass;
-				open_list.push_back(e);
-				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			if (frontier.passes[e->index] == open_pass && tentative_g_score >= frontier.g_scores[e->index]) { // The new path is worse than the previous.
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
+			frontier.passes[e->index] = open_pass;
+			frontier.prev_points[e->index] = p;
+			frontier.g_scores[e->index] = tentative_g_score;
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+			frontier.open_list.push_back({ e, tentative_g_score, tentative_g_score + _get_estimate_cost(r_context, e, p_end_point) });
+			sorter.push_heap(0, frontier.open_list.size() - 1, 0, frontier.open_list[frontier.open_list.size() - 1], frontier.open_list.ptr());
+		}
+	}
+
+	return false;
+}
+
+AStar3D::Point *AStar3D::_solve_bidirectional(SolveContext &r_context, Point *p_begin_point, Point *p_end_point) {
+	_begin_solve(r_context, true);
+
+	const uint32_t open_pass = r_context.pass << 1;
+	const uint32_t closed_pass = open_pass | 1;
+
+	SortArray<SolveContext::OpenPoint, SortOpenPoints> sorter;
+
+	// The forward search estimates the cost to the end point, the backward one the cost from the begin point.
+	const real_t begin_estimate = _get_estimate_cost(r_context, p_begin_point, p_end_point);
+
+	r_context.forward.g_scores[p_begin_point->index] = 0;
+	r_context.forward.prev_points[p_begin_point->index] = p_begin_point;
+	r_context.forward.passes[p_begin_point->index] = open_pass;
+	r_context.forward.open_list.push_back({ p_begin_point, 0, begin_estimate });
+
+	r_context.backward.g_scores[p_end_point->index] = 0;
+	r_context.backward.prev_points[p_end_point->index] = p_end_point;
+	r_context.backward.passes[p_end_point->index] = open_pass;
+	r_context.backward.open_list.push_back({ p_end_point, 0, begin_estimate });
+
+	Point *meeting_point = nullptr;
+	real_t meeting_cost = INFINITY;
+
+	while (!r_context.forward.open_list.is_empty() && !r_context.backward.open_list.is_empty()) {
+		// The lowest f_score of either frontier bounds the cost of every path not found yet.
+		if (meeting_point && (meeting_cost <= r_context.forward.open_list[0].f_score || meeting_cost <= r_context.backward.open_list[0].f_score)) {
+			break;
+		}
+
+		// Expand the smaller frontier.
+		const bool backward = r_context.backward.open_list.size() < r_context.forward.open_list.size();
+		SolveContext::Frontier &frontier = backward ? r_context.backward : r_context.forward;
+		const SolveContext::Frontier &other = backward ? r_context.forward : r_context.backward;
+
+		real_t g_score = 0;
+		real_t f_score = 0;
+		Point *p = _pop_open_point(frontier, open_pass, g_score, f_score);
+		if (!p) {
+			continue;
+		}
+
+		frontier.passes[p->index] = closed_pass; // Mark the point as closed.
+
+		// Going backward follows the connections into the point, those are its unlinked neighbors and the neighbors connected both ways.
+		for (int i = 0; i < (backward ? 2 : 1); i++) {
+			const OAHashMap<int64_t, Point *> &connections = i == 0 ? p->neighbors : p->unlinked_neighbours;
+
+			for (OAHashMap<int64_t, Point *>::Iterator it = connections.iter(); it.valid; it = connections.next_iter(it)) {
+				Point *e = *(it.value); // The neighbor point.
+
+				if ((!e->enabled && e != p_begin_point) || frontier.passes[e->index] == closed_pass) {
+					continue;
+				}
+
+				if (backward && i == 0 && !e->neighbors.has(p->id)) {
+					continue;
+				}
+
+				real_t tentative_g_score = g_score;
+				real_t estimate = 0;
+				if (backward) {
+					tentative_g_score += _get_compute_cost(r_context, e, p) * p->weight_scale;
+					estimate = _get_estimate_cost(r_context, p_begin_point, e);
+				} else {
+					tentative_g_score += _get_compute_cost(r_context, p, e) * e->weight_scale;
+					estimate = _get_estimate_cost(r_context, e, p_end_point);
+				}
+
+				if (tentative_g_score > max_search_cost) { // The point is beyond the search bound.
+					continue;
+				}
+
+				if (frontier.passes[e->index] == open_pass && tentative_g_score >= frontier.g_scores[e->index]) { // The new path is worse than the previous.
+					continue;
+				}
+
+				frontier.passes[e->index] = open_pass;
+				frontier.prev_points[e->index] = p;
+				frontier.g_scores[e->index] = tentative_g_score;
+
+				frontier.open_list.push_back({ e, tentative_g_score, tentative_g_score + estimate });
+				sorter.push_heap(0, frontier.open_list.size() - 1, 0, frontier.open_list[frontier.open_list.size() - 1], frontier.open_list.ptr());
+
+				// The other search reached this point already, the frontiers meet here.
+				if (other.passes[e->index] >= open_pass) {
+					const real_t cost = tentative_g_score + other.g_scores[e->index];
+					if (cost < meeting_cost && cost <= max_search_cost) {
+						meeting_cost = cost;
+						meeting_point = e;
+					}
+				}
 			}
 		}
 	}
 
-	return found_route;
+	return meeting_point;
 }
 
 real_t AStar3D::_estimate_cost(int64_t p_from_id, int64_t p_end_id) {
@@ -424,55 +593,94 @@ real_t AStar3D::_compute_cost(int64_t p_from_id, int64_t p_to_id) {
 	return from_point->pos.distance_to(to_point->pos);
 }
 
-Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path) {
-	Point *a = nullptr;
-	bool from_exists = points.lookup(p_from_id, a);
-	ERR_FAIL_COND_V_MSG(!from_exists, Vector<Vector3>(), vformat("Can't get point path. Point with id: %d doesn't exist.", p_from_id));
+bool AStar3D::_find_path(SolveContext &r_context, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path, LocalVector<Point *> &r_path) {
+	r_path.clear();
 
-	Point *b = nullptr;
-	bool to_exists = points.lookup(p_to_id, b);
-	ERR_FAIL_COND_V_MSG(!to_exists, Vector<Vector3>(), vformat("Can't get point path. Point with id: %d doesn't exist.", p_to_id));
-
-	if (a == b) {
-		Vector<Vector3> ret;
-		ret.push_back(a->pos);
-		return ret;
+	if (p_begin_point == p_end_point) {
+		r_path.push_back(p_begin_point);
+		return true;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
+	Point *end_point = p_end_point;
+	Point *meeting_point = nullptr;
+
+	const bool bidirectional = bidirectional_search_enabled && p_end_point->enabled;
+	if (bidirectional) {
+		meeting_point = _solve_bidirectional(r_context, p_begin_point, p_end_point);
+	}
 
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
-			return Vector<Vector3>();
+	if (meeting_point == nullptr) {
+		// The bidirectional search doesn't track the closest point, partial paths come from a regular search.
+		if (bidirectional && !p_allow_partial_path) {
+			return false;
 		}
 
-		// Use closest point instead.
-		end_point = last_closest_point;
+		bool found_route = _solve(r_context, p_begin_point, p_end_point, p_allow_partial_path);
+		if (!found_route) {
+			if (!p_allow_partial_path || r_context.last_closest_point == nullptr) {
+				return false;
+			}
+
+			// Use closest point instead.
+			end_point = r_context.last_closest_point;
+		}
+		meeting_point = end_point;
 	}
 
-	Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
+	Point *p = meeting_point;
+	while (p != p_begin_point) {
+		r_path.push_back(p);
+		p = r_context.forward.prev_points[p->index];
+	}
+	r_path.push_back(p_begin_point);
+	r_path.invert();
+
+	// Continue along the backward search when both searches met.
+	p = meeting_point;
+	while (p != end_point) {
+		p = r_context.backward.prev_points[p->index];
+		r_path.push_back(p);
 	}
 
-	Vector<Vector3> path;
-	path.resize(pc);
+	return true;
+}
 
-	{
-		Vector3 *w = path.ptrw();
+void AStar3D::set_bidirectional_search_enabled(bool p_enabled) {
+	bidirectional_search_enabled = p_enabled;
+}
 
-		Point *p2 = end_point;
-		int64_t idx = pc - 1;
-		while (p2 != begin_point) {
-			w[idx--] = p2->pos;
-			p2 = p2->prev_point;
-		}
+bool AStar3D::is_bidirectional_search_enabled() const {
+	return bidirectional_search_enabled;
+}
+
+void AStar3D::set_max_search_cost(real_t p_max_cost) {
+	ERR_FAIL_COND_MSG(p_max_cost < 0.0, vformat("Can't set max search cost less than 0.0: %f.", p_max_cost));
+	max_search_cost = p_max_cost;
+}
+
+real_t AStar3D::get_max_search_cost() const {
+	return max_search_cost;
+}
+
+Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path) {
+	Point *a = nullptr;
+	bool from_exists = points.lookup(p_from_id, a);
+	ERR_FAIL_COND_V_MSG(!from_exists, Vector<Vector3>(), vformat("Can't get point path. Point with id: %d doesn't exist.", p_from_id));
+
+	Point *b = nullptr;
+	bool to_exists = points.lookup(p_to_id, b);
+	ERR_FAIL_COND_V_MSG(!to_exists, Vector<Vector3>(), vformat("Can't get point path. Point with id: %d doesn't exist.", p_to_id));
 
-		w[0] = p2->pos; // Assign first
+	LocalVector<Point *> point_path;
+	if (!_find_path(solve_context, a, b, p_allow_partial_path, point_path)) {
+		return Vector<Vector3>();
+	}
+
+	Vector<Vector3> path;
+	path.resize(point_path.size());
+	Vector3 *w = path.ptrw();
+	for (uint32_t i = 0; i < point_path.size(); i++) {
+		w[i] = point_path[i]->pos;
 	}
 
 	return path;
@@ -487,49 +695,82 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 	bool to_exists = points.lookup(p_to_id, b);
 	ERR_FAIL_COND_V_MSG(!to_exists, Vector<int64_t>(), vformat("Can't get id path. Point with id: %d doesn't exist.", p_to_id));
 
-	if (a == b) {
-		Vector<int64_t> ret;
-		ret.push_back(a->id);
-		return ret;
+	LocalVector<Point *> point_path;
+	if (!_find_path(solve_context, a, b, p_allow_partial_path, point_path)) {
+		return Vector<int64_t>();
+	}
+
+	Vector<int64_t> path;
+	path.resize(point_path.size());
+	int64_t *w = path.ptrw();
+	for (uint32_t i = 0; i < point_path.size(); i++) {
+		w[i] = point_path[i]->id;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
+	return path;
+}
+
+void AStar3D::_solve_batch_lane(uint32_t p_lane, BatchSolve *p_batch) {
+	SolveContext &context = batch_contexts[p_lane];
+	LocalVector<Point *> point_path;
 
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
-			return Vector<int64_t>();
+	for (uint32_t i = p_lane; i < p_batch->from_points.size(); i += p_batch->lane_count) {
+		if (!_find_path(context, p_batch->from_points[i], p_batch->to_points[i], p_batch->allow_partial_path, point_path)) {
+			continue;
 		}
 
-		// Use closest point instead.
-		end_point = last_closest_point;
+		Vector<int64_t> &path = p_batch->paths[i];
+		path.resize(point_path.size());
+		int64_t *w = path.ptrw();
+		for (uint32_t j = 0; j < point_path.size(); j++) {
+			w[j] = point_path[j]->id;
+		}
 	}
+}
 
-	Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
+TypedArray<PackedInt64Array> AStar3D::_get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path, bool p_use_virtual_costs) {
+	ERR_FAIL_COND_V_MSG(p_from_ids.size() != p_to_ids.size(), TypedArray<PackedInt64Array>(), vformat("Can't get id paths. The number of start points %d and end points %d differ.", p_from_ids.size(), p_to_ids.size()));
+
+	BatchSolve batch;
+	batch.allow_partial_path = p_allow_partial_path;
+	batch.from_points.resize(p_from_ids.size());
+	batch.to_points.resize(p_to_ids.size());
+	batch.paths.resize(p_from_ids.size());
+	for (int i = 0; i < p_from_ids.size(); i++) {
+		bool from_exists = points.lookup(p_from_ids[i], batch.from_points[i]);
+		ERR_FAIL_COND_V_MSG(!from_exists, TypedArray<PackedInt64Array>(), vformat("Can't get id paths. Point with id: %d doesn't exist.", p_from_ids[i]));
+		bool to_exists = points.lookup(p_to_ids[i], batch.to_points[i]);
+		ERR_FAIL_COND_V_MSG(!to_exists, TypedArray<PackedInt64Array>(), vformat("Can't get id paths. Point with id: %d doesn't exist.", p_to_ids[i]));
 	}
 
-	Vector<int64_t> path;
-	path.resize(pc);
+	// Scripted costs can't be called from other threads, those batches are solved on the calling thread.
+	batch.lane_count = p_use_virtual_costs ? 1 : CLAMP((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), 1u, MAX(batch.from_points.size(), 1u));
 
-	{
-		int64_t *w = path.ptrw();
+	if (batch_contexts.size() < batch.lane_count) {
+		batch_contexts.resize(batch.lane_count);
+	}
+	for (uint32_t i = 0; i < batch.lane_count; i++) {
+		batch_contexts[i].use_virtual_costs = p_use_virtual_costs;
+	}
 
-		p = end_point;
-		int64_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->id;
-			p = p->prev_point;
-		}
+	if (batch.lane_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AStar3D::_solve_batch_lane, &batch, batch.lane_count, -1, true, SNAME("AStar3DSolvePaths"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_solve_batch_lane(0, &batch);
+	}
 
-		w[0] = p->id; // Assign first
+	TypedArray<PackedInt64Array> paths;
+	paths.resize(batch.paths.size());
+	for (uint32_t i = 0; i < batch.paths.size(); i++) {
+		paths[i] = PackedInt64Array(batch.paths[i]);
 	}
 
-	return path;
+	return paths;
+}
+
+TypedArray<PackedInt64Array> AStar3D::get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path) {
+	return _get_id_paths(p_from_ids, p_to_ids, p_allow_partial_path, GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) || GDVIRTUAL_IS_OVERRIDDEN(_compute_cost));
 }
 
 void AStar3D::set_point_disabled(int64_t p_id, bool p_disabled) {
@@ -575,8 +816,17 @@ void AStar3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar3D::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar3D::get_closest_position_in_segment);
 
+	ClassDB::bind_method(D_METHOD("set_bidirectional_search_enabled", "enabled"), &AStar3D::set_bidirectional_search_enabled);
+	ClassDB::bind_method(D_METHOD("is_bidirectional_search_enabled"), &AStar3D::is_bidirectional_search_enabled);
+	ClassDB::bind_method(D_METHOD("set_max_search_cost", "max_cost"), &AStar3D::set_max_search_cost);
+	ClassDB::bind_method(D_METHOD("get_max_search_cost"), &AStar3D::get_max_search_cost);
+
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStar3D::get_point_path, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStar3D::get_id_path, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_ids", "to_ids", "allow_partial_path"), &AStar3D::get_id_paths, DEFVAL(false));
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "bidirectional_search_enabled"), "set_bidirectional_search_enabled", "is_bidirectional_search_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "max_search_cost", PROPERTY_HINT_RANGE, "0,10000,0.01,or_greater"), "set_max_search_cost", "get_max_search_cost");
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
@@ -708,6 +958,22 @@ real_t AStar2D::_compute_cost(int64_t p_from_id, int64_t p_to_id) {
 	return from_point->pos.distance_to(to_point->pos);
 }
 
+void AStar2D::set_bidirectional_search_enabled(bool p_enabled) {
+	astar.set_bidirectional_search_enabled(p_enabled);
+}
+
+bool AStar2D::is_bidirectional_search_enabled() const {
+	return astar.is_bidirectional_search_enabled();
+}
+
+void AStar2D::set_max_search_cost(real_t p_max_cost) {
+	astar.set_max_search_cost(p_max_cost);
+}
+
+real_t AStar2D::get_max_search_cost() const {
+	return astar.get_max_search_cost();
+}
+
 Vector<Vector2> AStar2D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path) {
 	AStar3D::Point *a = nullptr;
 	bool from_exists = astar.points.lookup(p_from_id, a);
@@ -717,45 +983,16 @@ Vector<Vector2> AStar2D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 	bool to_exists = astar.points.lookup(p_to_id, b);
 	ERR_FAIL_COND_V_MSG(!to_exists, Vector<Vector2>(), vformat("Can't get point path. Point with id: %d doesn't exist.", p_to_id));
 
-	if (a == b) {
-		Vector<Vector2> ret = { Vector2(a->pos.x, a->pos.y) };
-		return ret;
-	}
-
-	AStar3D::Point *begin_point = a;
-	AStar3D::Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || astar.last_closest_point == nullptr) {
-			return Vector<Vector2>();
-		}
-
-		// Use closest point instead.
-		end_point = astar.last_closest_point;
-	}
-
-	AStar3D::Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
+	LocalVector<AStar3D::Point *> point_path;
+	if (!astar._find_path(astar.solve_context, a, b, p_allow_partial_path, point_path)) {
+		return Vector<Vector2>();
 	}
 
 	Vector<Vector2> path;
-	path.resize(pc);
-
-	{
-		Vector2 *w = path.ptrw();
-
-		AStar3D::Point *p2 = end_point;
-		int64_t idx = pc - 1;
-		while (p2 != begin_point) {
-			w[idx--] = Vector2(p2->pos.x, p2->pos.y);
-			p2 = p2->prev_point;
-		}
-
-		w[0] = Vector2(p2->pos.x, p2->pos.y); // Assign first
+	path.resize(point_path.size());
+	Vector2 *w = path.ptrw();
+	for (uint32_t i = 0; i < point_path.size(); i++) {
+		w[i] = Vector2(point_path[i]->pos.x, point_path[i]->pos.y);
 	}
 
 	return path;
@@ -770,121 +1007,23 @@ Vector<int64_t> AStar2D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 	bool to_exists = astar.points.lookup(p_to_id, b);
 	ERR_FAIL_COND_V_MSG(!to_exists, Vector<int64_t>(), vformat("Can't get id path. Point with id: %d doesn't exist.", p_to_id));
 
-	if (a == b) {
-		Vector<int64_t> ret;
-		ret.push_back(a->id);
-		return ret;
-	}
-
-	AStar3D::Point *begin_point = a;
-	AStar3D::Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || astar.last_closest_point == nullptr) {
-			return Vector<int64_t>();
-		}
-
-		// Use closest point instead.
-		end_point = astar.last_closest_point;
-	}
-
-	AStar3D::Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
+	LocalVector<AStar3D::Point *> point_path;
+	if (!astar._find_path(astar.solve_context, a, b, p_allow_partial_path, point_path)) {
+		return Vector<int64_t>();
 	}
 
 	Vector<int64_t> path;
-	path.resize(pc);
-
-	{
-		int64_t *w = path.ptrw();
-
-		p = end_point;
-		int64_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->id;
-			p = p->prev_point;
-		}
-
-		w[0] = p->id; // Assign first
+	path.resize(point_path.size());
+	int64_t *w = path.ptrw();
+	for (uint32_t i = 0; i < point_path.size(); i++) {
+		w[i] = point_path[i]->id;
 	}
 
 	return path;
 }
 
-bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, bool p_allow_partial_path) {
-	astar.last_closest_point = nullptr;
-	astar.pass++;
-
-	if (!end_point->enabled && !p_allow_partial_path) {
-		return false;
-	}
-
-	bool found_route = false;
-
-	LocalVector<AStar3D::Point *> open_list;
-	SortArray<AStar3D::Point *, AStar3D::SortPoints> sorter;
-
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	begin_point->abs_g_score = 0;
-	begin_point->abs_f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
-
-	while (!open_list.is_empty()) {
-		AStar3D::Point *p = open_list[0]; // The currently processed point.
-
-		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (astar.last_closest_point == nullptr || astar.last_closest_point->abs_f_score > p->abs_f_score || (astar.last_closest_point->abs_f_score >= p->abs_f_score && astar.last_closest_point->abs_g_score > p->abs_g_score)) {
-			astar.last_closest_point = p;
-		}
-
-		if (p == end_point) {
-			found_route = true;
-			break;
-		}
-
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = astar.pass; // Mark the point as closed.
-
-		for (OAHashMap<int64_t, AStar3D::Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
-			AStar3D::Point *e = *(it.value); // The neighbor point.
-
-			if (!e->enabled || e->closed_pass == astar.pass) {
-				continue;
-			}
-
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
-
-			bool new_point = false;
-
-			if (e->open_pass != astar.pass) { // The point wasn't inside the open list.
-				e->open_pass = astar.pass;
-				open_list.push_back(e);
-				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
-				continue;
-			}
-
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
-
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
-			}
-		}
-	}
-
-	return found_route;
+TypedArray<PackedInt64Array> AStar2D::get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path) {
+	return astar._get_id_paths(p_from_ids, p_to_ids, p_allow_partial_path, GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) || GDVIRTUAL_IS_OVERRIDDEN(_compute_cost));
 }
 
 void AStar2D::_bind_methods() {
@@ -914,8 +1053,17 @@ void AStar2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar2D::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar2D::get_closest_position_in_segment);
 
+	ClassDB::bind_method(D_METHOD("set_bidirectional_search_enabled", "enabled"), &AStar2D::set_bidirectional_search_enabled);
+	ClassDB::bind_method(D_METHOD("is_bidirectional_search_enabled"), &AStar2D::is_bidirectional_search_enabled);
+	ClassDB::bind_method(D_METHOD("set_max_search_cost", "max_cost"), &AStar2D::set_max_search_cost);
+	ClassDB::bind_method(D_METHOD("get_max_search_cost"), &AStar2D::get_max_search_cost);
+
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStar2D::get_point_path, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStar2D::get_id_path, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_ids", "to_ids", "allow_partial_path"), &AStar2D::get_id_paths, DEFVAL(false));
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "bidirectional_search_enabled"), "set_bidirectional_search_enabled", "is_bidirectional_search_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "max_search_cost", PROPERTY_HINT_RANGE, "0,10000,0.01,or_greater"), "set_max_search_cost", "get_max_search_cost");
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
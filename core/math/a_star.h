@@ -33,7 +33,9 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
+#include "core/variant/typed_array.h"
 
 /**
 	A* pathfinding algorithm.
@@ -47,37 +49,61 @@ class AStar3D : public RefCounted {
 		Point() {}
 
 		int64_t id = 0;
+		uint32_t index = 0; // Slot of the point in the search state of a SolveContext.
 		Vector3 pos;
 		real_t weight_scale = 0;
 		bool enabled = false;
 
 		OAHashMap<int64_t, Point *> neighbors = 4u;
 		OAHashMap<int64_t, Point *> unlinked_neighbours = 4u;
+	};
+
+	// Search state of a single query, indexed by Point::index. Each thread of a batch solve uses its own.
+	struct SolveContext {
+		struct OpenPoint {
+			Point *point = nullptr;
+			real_t g_score = 0;
+			real_t f_score = 0;
+		};
+
+		struct Frontier {
+			LocalVector<real_t> g_scores;
+			LocalVector<Point *> prev_points; // Toward the start point going forward, toward the end point going backward.
+			LocalVector<uint32_t> passes; // The pass shifted left by one while open, with the lowest bit set once closed.
+			LocalVector<OpenPoint> open_list;
+		};
 
-		// Used for pathfinding.
-		Point *prev_point = nullptr;
-		real_t g_score = 0;
-		real_t f_score = 0;
-		uint64_t open_pass = 0;
-		uint64_t closed_pass = 0;
+		Frontier forward;
+		Frontier backward; // Only used by bidirectional searches.
+		uint32_t pass = 0;
+		bool use_virtual_costs = true;
 
-		// Used for getting closest_point_of_last_pathing_call.
-		real_t abs_g_score = 0;
-		real_t abs_f_score = 0;
+		// Used for getting last_closest_point.
+		Point *last_closest_point = nullptr;
+		real_t last_closest_abs_g_score = 0;
+		real_t last_closest_abs_f_score = 0;
 	};
 
-	struct SortPoints {
-		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
-			if (A->f_score > B->f_score) {
+	struct SortOpenPoints {
+		_FORCE_INLINE_ bool operator()(const SolveContext::OpenPoint &A, const SolveContext::OpenPoint &B) const { // Returns true when the point A is worse than point B.
+			if (A.f_score > B.f_score) {
 				return true;
-			} else if (A->f_score < B->f_score) {
+			} else if (A.f_score < B.f_score) {
 				return false;
 			} else {
-				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
+				return A.g_score < B.g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
 			}
 		}
 	};
 
+	struct BatchSolve {
+		LocalVector<Point *> from_points;
+		LocalVector<Point *> to_points;
+		LocalVector<Vector<int64_t>> paths;
+		bool allow_partial_path = false;
+		uint32_t lane_count = 1;
+	};
+
 	struct Segment {
 		Pair<int64_t, int64_t> key;
 
@@ -109,13 +135,29 @@ class AStar3D : public RefCounted {
 	};
 
 	mutable int64_t last_free_id = 0;
-	uint64_t pass = 1;
 
 	OAHashMap<int64_t, Point *> points;
 	HashSet<Segment, Segment> segments;
-	Point *last_closest_point = nullptr;
 
-	bool _solve(Point *begin_point, Point *end_point, bool p_allow_partial_path);
+	LocalVector<uint32_t> free_point_indices;
+	uint32_t point_index_count = 0;
+
+	bool bidirectional_search_enabled = false;
+	real_t max_search_cost = INFINITY;
+
+	SolveContext solve_context;
+	LocalVector<SolveContext> batch_contexts;
+
+	real_t _get_estimate_cost(const SolveContext &p_context, const Point *p_from_point, const Point *p_end_point);
+	real_t _get_compute_cost(const SolveContext &p_context, const Point *p_from_point, const Point *p_to_point);
+	void _prepare_frontier(SolveContext::Frontier &r_frontier, bool p_reset) const;
+	void _begin_solve(SolveContext &r_context, bool p_bidirectional) const;
+	Point *_pop_open_point(SolveContext::Frontier &r_frontier, uint32_t p_open_pass, real_t &r_g_score, real_t &r_f_score) const;
+	bool _solve(SolveContext &r_context, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
+	Point *_solve_bidirectional(SolveContext &r_context, Point *p_begin_point, Point *p_end_point);
+	bool _find_path(SolveContext &r_context, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path, LocalVector<Point *> &r_path);
+	void _solve_batch_lane(uint32_t p_lane, BatchSolve *p_batch);
+	TypedArray<PackedInt64Array> _get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path, bool p_use_virtual_costs);
 
 protected:
 	static void _bind_methods();
@@ -160,8 +202,14 @@ public:
 	int64_t get_closest_point(const Vector3 &p_point, bool p_include_disabled = false) const;
 	Vector3 get_closest_position_in_segment(const Vector3 &p_point) const;
 
+	void set_bidirectional_search_enabled(bool p_enabled);
+	bool is_bidirectional_search_enabled() const;
+	void set_max_search_cost(real_t p_max_cost);
+	real_t get_max_search_cost() const;
+
 	Vector<Vector3> get_point_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
 	Vector<int64_t> get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
+	TypedArray<PackedInt64Array> get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path = false);
 
 	AStar3D() {}
 	~AStar3D();
@@ -169,9 +217,17 @@ public:
 
 class AStar2D : public RefCounted {
 	GDCLASS(AStar2D, RefCounted);
-	AStar3D astar;
 
-	bool _solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, bool p_allow_partial_path);
+	// The wrapped graph, with its costs routed through the overridable methods of this class.
+	class Graph : public AStar3D {
+	public:
+		AStar2D *owner = nullptr;
+
+		virtual real_t _estimate_cost(int64_t p_from_id, int64_t p_end_id) override { return owner->_estimate_cost(p_from_id, p_end_id); }
+		virtual real_t _compute_cost(int64_t p_from_id, int64_t p_to_id) override { return owner->_compute_cost(p_from_id, p_to_id); }
+	};
+
+	Graph astar;
 
 protected:
 	static void _bind_methods();
@@ -216,10 +272,16 @@ public:
 	int64_t get_closest_point(const Vector2 &p_point, bool p_include_disabled = false) const;
 	Vector2 get_closest_position_in_segment(const Vector2 &p_point) const;
 
+	void set_bidirectional_search_enabled(bool p_enabled);
+	bool is_bidirectional_search_enabled() const;
+	void set_max_search_cost(real_t p_max_cost);
+	real_t get_max_search_cost() const;
+
 	Vector<Vector2> get_point_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
 	Vector<int64_t> get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
+	TypedArray<PackedInt64Array> get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path = false);
 
-	AStar2D() {}
+	AStar2D() { astar.owner = this; }
 	~AStar2D() {}
 };
 
@@ -31,6 +31,7 @@
 #include "a_star_grid_2d.h"
 #include "a_star_grid_2d.compat.inc"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/variant/typed_array.h"
 
 static real_t heuristic_euclidean(const Vector2i &p_from, const Vector2i &p_to) {
@@ -60,6 +61,21 @@ static real_t heuristic_chebyshev(const Vector2i &p_from, const Vector2i &p_to)
 
 static real_t (*heuristics[AStarGrid2D::HEURISTIC_MAX])(const Vector2i &, const Vector2i &) = { heuristic_euclidean, heuristic_manhattan, heuristic_octile, heuristic_chebyshev };
 
+// Directions of the JPS+ jump distances, clockwise from the top. Even directions are straight, odd ones diagonal.
+static const int32_t jump_direction_x[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+static const int32_t jump_direction_y[8] = { -1, -1, 0, 1, 1, 1, 0, -1 };
+
+static int jump_direction_from_delta(int32_t p_dx, int32_t p_dy) {
+	const int32_t dx = SIGN(p_dx);
+	const int32_t dy = SIGN(p_dy);
+	for (int i = 0; i < 8; i++) {
+		if (jump_direction_x[i] == dx && jump_direction_y[i] == dy) {
+			return i;
+		}
+	}
+	return -1;
+}
+
 void AStarGrid2D::set_region(const Rect2i &p_region) {
 	ERR_FAIL_COND(p_region.size.x < 0 || p_region.size.y < 0);
 	if (p_region != region) {
@@ -126,48 +142,58 @@ void AStarGrid2D::update() {
 		return;
 	}
 
-	points.clear();
+	const uint32_t mask_width = region.size.x + 2;
+	const uint32_t mask_height = region.size.y + 2;
 	solid_mask.clear();
+	solid_mask.resize((mask_width * mask_height + 63) / 64);
+	for (uint64_t &mask_bits : solid_mask) {
+		mask_bits = 0;
+	}
 
-	const int32_t end_x = region.get_end().x;
-	const int32_t end_y = region.get_end().y;
-	const Vector2 half_cell_size = cell_size / 2;
-	for (int32_t x = region.position.x; x < end_x + 2; x++) {
-		solid_mask.push_back(true);
-	}
-
-	for (int32_t y = region.position.y; y < end_y; y++) {
-		LocalVector<Point> line;
-		solid_mask.push_back(true);
-		for (int32_t x = region.position.x; x < end_x; x++) {
-			Vector2 v = offset;
-			switch (cell_shape) {
-				case CELL_SHAPE_ISOMETRIC_RIGHT:
-					v += half_cell_size + Vector2(x + y, y - x) * half_cell_size;
-					break;
-				case CELL_SHAPE_ISOMETRIC_DOWN:
-					v += half_cell_size + Vector2(x - y, x + y) * half_cell_size;
-					break;
-				case CELL_SHAPE_SQUARE:
-					v += Vector2(x, y) * cell_size;
-					break;
-				default:
-					break;
-			}
-			line.push_back(Point(Vector2i(x, y), v));
-			solid_mask.push_back(false);
-		}
-		solid_mask.push_back(true);
-		points.push_back(line);
+	// The border around the region is solid, so neighbors never need bounds checks.
+	for (int32_t x = region.position.x - 1; x < region.get_end().x + 1; x++) {
+		_set_solid_unchecked(x, region.position.y - 1, true);
+		_set_solid_unchecked(x, region.get_end().y, true);
+	}
+	for (int32_t y = region.position.y; y < region.get_end().y; y++) {
+		_set_solid_unchecked(region.position.x - 1, y, true);
+		_set_solid_unchecked(region.get_end().x, y, true);
 	}
 
-	for (int32_t x = region.position.x; x < end_x + 2; x++) {
-		solid_mask.push_back(true);
+	weight_scales.clear();
+	weight_scales.resize(region.size.x * region.size.y);
+	for (real_t &weight_scale : weight_scales) {
+		weight_scale = 1.0;
 	}
 
+	solve_context = SolveContext();
+	batch_contexts.clear();
+
+	jump_distances.clear();
+	jump_distances_dirty = true;
+	jump_distances_dirty_region = Rect2i();
+
 	dirty = false;
 }
 
+Vector2 AStarGrid2D::_get_point_position_unchecked(const Vector2i &p_id) const {
+	Vector2 v = offset;
+	switch (cell_shape) {
+		case CELL_SHAPE_ISOMETRIC_RIGHT:
+			v += cell_size / 2 + Vector2(p_id.x + p_id.y, p_id.y - p_id.x) * (cell_size / 2);
+			break;
+		case CELL_SHAPE_ISOMETRIC_DOWN:
+			v += cell_size / 2 + Vector2(p_id.x - p_id.y, p_id.x + p_id.y) * (cell_size / 2);
+			break;
+		case CELL_SHAPE_SQUARE:
+			v += Vector2(p_id) * cell_size;
+			break;
+		default:
+			break;
+	}
+	return v;
+}
+
 bool AStarGrid2D::is_in_bounds(int32_t p_x, int32_t p_y) const {
 	return region.has_point(Vector2i(p_x, p_y));
 }
@@ -218,7 +244,11 @@ AStarGrid2D::Heuristic AStarGrid2D::get_default_estimate_heuristic() const {
 void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point %s out of bounds %s.", p_id, region));
+	if (_get_solid_unchecked(p_id) == p_solid) {
+		return;
+	}
 	_set_solid_unchecked(p_id, p_solid);
+	_mark_jump_distances_dirty(Rect2i(p_id, Vector2i(1, 1)));
 }
 
 bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
@@ -231,13 +261,13 @@ void AStarGrid2D::set_point_weight_scale(const Vector2i &p_id, real_t p_weight_s
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set point's weight scale. Point %s out of bounds %s.", p_id, region));
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
-	_get_point_unchecked(p_id)->weight_scale = p_weight_scale;
+	weight_scales[_to_point_index(p_id)] = p_weight_scale;
 }
 
 real_t AStarGrid2D::get_point_weight_scale(const Vector2i &p_id) const {
 	ERR_FAIL_COND_V_MSG(dirty, 0, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), 0, vformat("Can't get point's weight scale. Point %s out of bounds %s.", p_id, region));
-	return _get_point_unchecked(p_id)->weight_scale;
+	return weight_scales[_to_point_index(p_id)];
 }
 
 void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
@@ -252,6 +282,7 @@ void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
 			_set_solid_unchecked(x, y, p_solid);
 		}
 	}
+	_mark_jump_distances_dirty(safe_region);
 }
 
 void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weight_scale) {
@@ -264,37 +295,40 @@ void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weig
 
 	for (int32_t y = safe_region.position.y; y < end_y; y++) {
 		for (int32_t x = safe_region.position.x; x < end_x; x++) {
-			_get_point_unchecked(x, y)->weight_scale = p_weight_scale;
+			weight_scales[_to_point_index(x, y)] = p_weight_scale;
 		}
 	}
 }
 
-AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
-	int32_t from_x = p_from->id.x;
-	int32_t from_y = p_from->id.y;
+bool AStarGrid2D::_jump(const Vector2i &p_from, const Vector2i &p_to, const Vector2i &p_end, Vector2i &r_point) const {
+	int32_t from_x = p_from.x;
+	int32_t from_y = p_from.y;
 
-	int32_t to_x = p_to->id.x;
-	int32_t to_y = p_to->id.y;
+	int32_t to_x = p_to.x;
+	int32_t to_y = p_to.y;
 
 	int32_t dx = to_x - from_x;
 	int32_t dy = to_y - from_y;
 
 	if (diagonal_mode == DIAGONAL_MODE_ALWAYS || diagonal_mode == DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE) {
 		if (dx == 0 || dy == 0) {
-			return _forced_successor(to_x, to_y, dx, dy);
+			return _forced_successor(to_x, to_y, dx, dy, p_end, r_point);
 		}
 
 		while (_is_walkable(to_x, to_y) && (diagonal_mode == DIAGONAL_MODE_ALWAYS || _is_walkable(to_x, to_y - dy) || _is_walkable(to_x - dx, to_y))) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_end.x == to_x && p_end.y == to_y) {
+				r_point = p_end;
+				return true;
 			}
 
 			if ((_is_walkable(to_x - dx, to_y + dy) && !_is_walkable(to_x - dx, to_y)) || (_is_walkable(to_x + dx, to_y - dy) && !_is_walkable(to_x, to_y - dy))) {
-				return _get_point_unchecked(to_x, to_y);
+				r_point = Vector2i(to_x, to_y);
+				return true;
 			}
 
-			if (_forced_successor(to_x + dx, to_y, dx, 0) != nullptr || _forced_successor(to_x, to_y + dy, 0, dy) != nullptr) {
-				return _get_point_unchecked(to_x, to_y);
+			if (_forced_successor(to_x + dx, to_y, dx, 0, p_end, r_point) || _forced_successor(to_x, to_y + dy, 0, dy, p_end, r_point)) {
+				r_point = Vector2i(to_x, to_y);
+				return true;
 			}
 
 			to_x += dx;
@@ -303,20 +337,23 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 
 	} else if (diagonal_mode == DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES) {
 		if (dx == 0 || dy == 0) {
-			return _forced_successor(from_x, from_y, dx, dy, true);
+			return _forced_successor(from_x, from_y, dx, dy, p_end, r_point, true);
 		}
 
 		while (_is_walkable(to_x, to_y) && _is_walkable(to_x, to_y - dy) && _is_walkable(to_x - dx, to_y)) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_end.x == to_x && p_end.y == to_y) {
+				r_point = p_end;
+				return true;
 			}
 
 			if ((_is_walkable(to_x + dx, to_y + dy) && !_is_walkable(to_x, to_y + dy)) || !_is_walkable(to_x + dx, to_y)) {
-				return _get_point_unchecked(to_x, to_y);
+				r_point = Vector2i(to_x, to_y);
+				return true;
 			}
 
-			if (_forced_successor(to_x, to_y, dx, 0) != nullptr || _forced_successor(to_x, to_y, 0, dy) != nullptr) {
-				return _get_point_unchecked(to_x, to_y);
+			if (_forced_successor(to_x, to_y, dx, 0, p_end, r_point) || _forced_successor(to_x, to_y, 0, dy, p_end, r_point)) {
+				r_point = Vector2i(to_x, to_y);
+				return true;
 			}
 
 			to_x += dx;
@@ -325,30 +362,33 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 
 	} else { // DIAGONAL_MODE_NEVER
 		if (dy == 0) {
-			return _forced_successor(from_x, from_y, dx, 0, true);
+			return _forced_successor(from_x, from_y, dx, 0, p_end, r_point, true);
 		}
 
 		while (_is_walkable(to_x, to_y)) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_end.x == to_x && p_end.y == to_y) {
+				r_point = p_end;
+				return true;
 			}
 
 			if ((_is_walkable(to_x - 1, to_y) && !_is_walkable(to_x - 1, to_y - dy)) || (_is_walkable(to_x + 1, to_y) && !_is_walkable(to_x + 1, to_y - dy))) {
-				return _get_point_unchecked(to_x, to_y);
+				r_point = Vector2i(to_x, to_y);
+				return true;
 			}
 
-			if (_forced_successor(to_x, to_y, 1, 0, true) != nullptr || _forced_successor(to_x, to_y, -1, 0, true) != nullptr) {
-				return _get_point_unchecked(to_x, to_y);
+			if (_forced_successor(to_x, to_y, 1, 0, p_end, r_point, true) || _forced_successor(to_x, to_y, -1, 0, p_end, r_point, true)) {
+				r_point = Vector2i(to_x, to_y);
+				return true;
 			}
 
 			to_y += dy;
 		}
 	}
 
-	return nullptr;
+	return false;
 }
 
-AStarGrid2D::Point *AStarGrid2D::_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive) {
+bool AStarGrid2D::_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, const Vector2i &p_end, Vector2i &r_point, bool p_inclusive) const {
 	// Remembering previous results can improve performance.
 	bool l_prev = false, r_prev = false, l = false, r = false;
 
@@ -362,8 +402,9 @@ AStarGrid2D::Point *AStarGrid2D::_forced_successor(int32_t p_x, int32_t p_y, int
 	int32_t r_x = p_x + p_dy, r_y = p_y + p_dx;
 
 	while (_is_walkable(o_x, o_y)) {
-		if (end->id.x == o_x && end->id.y == o_y) {
-			return end;
+		if (p_end.x == o_x && p_end.y == o_y) {
+			r_point = p_end;
+			return true;
 		}
 
 		l_prev = l || _is_walkable(l_x, l_y);
@@ -378,80 +419,45 @@ AStarGrid2D::Point *AStarGrid2D::_forced_successor(int32_t p_x, int32_t p_y, int
 		r = _is_walkable(r_x, r_y);
 
 		if ((l && !l_prev) || (r && !r_prev)) {
-			return _get_point_unchecked(o_x, o_y);
+			r_point = Vector2i(o_x, o_y);
+			return true;
 		}
 
 		o_x += p_dx;
 		o_y += p_dy;
 	}
-	return nullptr;
+	return false;
 }
 
-void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
-	bool ts0 = false, td0 = false,
-		 ts1 = false, td1 = false,
-		 ts2 = false, td2 = false,
-		 ts3 = false, td3 = false;
-
-	Point *left = nullptr;
-	Point *right = nullptr;
-	Point *top = nullptr;
-	Point *bottom = nullptr;
-
-	Point *top_left = nullptr;
-	Point *top_right = nullptr;
-	Point *bottom_left = nullptr;
-	Point *bottom_right = nullptr;
+uint32_t AStarGrid2D::_get_nbors(const Vector2i &p_id, Vector2i *r_nbors) const {
+	uint32_t count = 0;
 
-	{
-		bool has_left = false;
-		bool has_right = false;
+	// The solid border around the region keeps the neighbors of any point inside the mask.
+	const Vector2i top = p_id + Vector2i(0, -1);
+	const Vector2i right = p_id + Vector2i(1, 0);
+	const Vector2i bottom = p_id + Vector2i(0, 1);
+	const Vector2i left = p_id + Vector2i(-1, 0);
 
-		if (p_point->id.x - 1 >= region.position.x) {
-			left = _get_point_unchecked(p_point->id.x - 1, p_point->id.y);
-			has_left = true;
-		}
-		if (p_point->id.x + 1 < region.position.x + region.size.width) {
-			right = _get_point_unchecked(p_point->id.x + 1, p_point->id.y);
-			has_right = true;
-		}
-		if (p_point->id.y - 1 >= region.position.y) {
-			top = _get_point_unchecked(p_point->id.x, p_point->id.y - 1);
-			if (has_left) {
-				top_left = _get_point_unchecked(p_point->id.x - 1, p_point->id.y - 1);
-			}
-			if (has_right) {
-				top_right = _get_point_unchecked(p_point->id.x + 1, p_point->id.y - 1);
-			}
-		}
-		if (p_point->id.y + 1 < region.position.y + region.size.height) {
-			bottom = _get_point_unchecked(p_point->id.x, p_point->id.y + 1);
-			if (has_left) {
-				bottom_left = _get_point_unchecked(p_point->id.x - 1, p_point->id.y + 1);
-			}
-			if (has_right) {
-				bottom_right = _get_point_unchecked(p_point->id.x + 1, p_point->id.y + 1);
-			}
-		}
-	}
+	const bool ts0 = _is_walkable(top.x, top.y);
+	const bool ts1 = _is_walkable(right.x, right.y);
+	const bool ts2 = _is_walkable(bottom.x, bottom.y);
+	const bool ts3 = _is_walkable(left.x, left.y);
 
-	if (top && !_get_solid_unchecked(top->id)) {
-		r_nbors.push_back(top);
-		ts0 = true;
+	if (ts0) {
+		r_nbors[count++] = top;
 	}
-	if (right && !_get_solid_unchecked(right->id)) {
-		r_nbors.push_back(right);
-		ts1 = true;
+	if (ts1) {
+		r_nbors[count++] = right;
 	}
-	if (bottom && !_get_solid_unchecked(bottom->id)) {
-		r_nbors.push_back(bottom);
-		ts2 = true;
+	if (ts2) {
+		r_nbors[count++] = bottom;
 	}
-	if (left && !_get_solid_unchecked(left->id)) {
-		r_nbors.push_back(left);
-		ts3 = true;
+	if (ts3) {
+		r_nbors[count++] = left;
 	}
 
+	bool td0 = false, td1 = false, td2 = false, td3 = false;
+
 	switch (diagonal_mode) {
 		case DIAGONAL_MODE_ALWAYS: {
 			td0 = true;
@@ -477,99 +483,348 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 			break;
 	}
 
-	if (td0 && (top_left && !_get_solid_unchecked(top_left->id))) {
-		r_nbors.push_back(top_left);
+	if (td0 && _is_walkable(p_id.x - 1, p_id.y - 1)) {
+		r_nbors[count++] = p_id + Vector2i(-1, -1);
+	}
+	if (td1 && _is_walkable(p_id.x + 1, p_id.y - 1)) {
+		r_nbors[count++] = p_id + Vector2i(1, -1);
 	}
-	if (td1 && (top_right && !_get_solid_unchecked(top_right->id))) {
-		r_nbors.push_back(top_right);
+	if (td2 && _is_walkable(p_id.x + 1, p_id.y + 1)) {
+		r_nbors[count++] = p_id + Vector2i(1, 1);
+	}
+	if (td3 && _is_walkable(p_id.x - 1, p_id.y + 1)) {
+		r_nbors[count++] = p_id + Vector2i(-1, 1);
+	}
+
+	return count;
+}
+
+// A point entered in a straight direction is a jump point when it has a forced neighbor,
+// one that can't be reached diagonally from the previous point without cutting a corner.
+bool AStarGrid2D::_is_jump_point(int32_t p_x, int32_t p_y, int p_direction) const {
+	const int32_t dx = jump_direction_x[p_direction];
+	const int32_t dy = jump_direction_y[p_direction];
+	return (!_is_walkable(p_x - dx - dy, p_y - dy - dx) && _is_walkable(p_x - dy, p_y - dx)) ||
+			(!_is_walkable(p_x - dx + dy, p_y - dy + dx) && _is_walkable(p_x + dy, p_y + dx));
+}
+
+int32_t AStarGrid2D::_compute_jump_distance(int32_t p_x, int32_t p_y, int p_direction) const {
+	const int32_t dx = jump_direction_x[p_direction];
+	const int32_t dy = jump_direction_y[p_direction];
+	const int32_t next_x = p_x + dx;
+	const int32_t next_y = p_y + dy;
+
+	if (p_direction % 2 == 0) {
+		if (!_is_walkable(next_x, next_y)) {
+			return 0;
+		}
+		if (_is_jump_point(next_x, next_y, p_direction)) {
+			return 1;
+		}
+	} else {
+		if (!_is_walkable(next_x, next_y) || !_is_walkable(p_x + dx, p_y) || !_is_walkable(p_x, p_y + dy)) {
+			return 0;
+		}
+		// Diagonal moves stop where a straight move along one of their components reaches a jump point.
+		const uint32_t next_index = _to_point_index(next_x, next_y) * 8;
+		if (jump_distances[next_index + jump_direction_from_delta(dx, 0)] > 0 || jump_distances[next_index + jump_direction_from_delta(0, dy)] > 0) {
+			return 1;
+		}
 	}
-	if (td2 && (bottom_right && !_get_solid_unchecked(bottom_right->id))) {
-		r_nbors.push_back(bottom_right);
+
+	const int32_t next_distance = jump_distances[_to_point_index(next_x, next_y) * 8 + p_direction];
+	return next_distance > 0 ? next_distance + 1 : next_distance - 1;
+}
+
+void AStarGrid2D::_propagate_jump_distance(int32_t p_x, int32_t p_y, int p_direction) {
+	// Points only depend on the next point in their direction, so walk back until a distance stays the same.
+	while (region.has_point(Vector2i(p_x, p_y))) {
+		int32_t &jump_distance = jump_distances[_to_point_index(p_x, p_y) * 8 + p_direction];
+		const int32_t new_jump_distance = _compute_jump_distance(p_x, p_y, p_direction);
+		if (new_jump_distance == jump_distance) {
+			break;
+		}
+		jump_distance = new_jump_distance;
+		p_x -= jump_direction_x[p_direction];
+		p_y -= jump_direction_y[p_direction];
 	}
-	if (td3 && (bottom_left && !_get_solid_unchecked(bottom_left->id))) {
-		r_nbors.push_back(bottom_left);
+}
+
+void AStarGrid2D::_mark_jump_distances_dirty(const Rect2i &p_region) {
+	if (jump_distances_dirty || !p_region.has_area()) {
+		return;
 	}
+	jump_distances_dirty_region = jump_distances_dirty_region.has_area() ? jump_distances_dirty_region.merge(p_region) : p_region;
 }
 
-bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path) {
-	last_closest_point = nullptr;
-	pass++;
+void AStarGrid2D::_update_jump_distances() {
+	const int32_t begin_x = region.position.x;
+	const int32_t begin_y = region.position.y;
+	const int32_t end_x = region.get_end().x;
+	const int32_t end_y = region.get_end().y;
+
+	if (jump_distances_dirty) {
+		jump_distances.resize(region.size.x * region.size.y * 8);
+
+		// Each direction is swept against itself, so the next point in that direction is always done.
+		for (int32_t y = begin_y; y < end_y; y++) {
+			for (int32_t x = end_x - 1; x >= begin_x; x--) {
+				jump_distances[_to_point_index(x, y) * 8 + 2] = _compute_jump_distance(x, y, 2);
+			}
+			for (int32_t x = begin_x; x < end_x; x++) {
+				jump_distances[_to_point_index(x, y) * 8 + 6] = _compute_jump_distance(x, y, 6);
+			}
+		}
+		for (int32_t x = begin_x; x < end_x; x++) {
+			for (int32_t y = end_y - 1; y >= begin_y; y--) {
+				jump_distances[_to_point_index(x, y) * 8 + 4] = _compute_jump_distance(x, y, 4);
+			}
+			for (int32_t y = begin_y; y < end_y; y++) {
+				jump_distances[_to_point_index(x, y) * 8 + 0] = _compute_jump_distance(x, y, 0);
+			}
+		}
+		for (int32_t y = begin_y; y < end_y; y++) {
+			for (int32_t x = begin_x; x < end_x; x++) {
+				jump_distances[_to_point_index(x, y) * 8 + 1] = _compute_jump_distance(x, y, 1);
+				jump_distances[_to_point_index(x, y) * 8 + 7] = _compute_jump_distance(x, y, 7);
+			}
+		}
+		for (int32_t y = end_y - 1; y >= begin_y; y--) {
+			for (int32_t x = begin_x; x < end_x; x++) {
+				jump_distances[_to_point_index(x, y) * 8 + 3] = _compute_jump_distance(x, y, 3);
+				jump_distances[_to_point_index(x, y) * 8 + 5] = _compute_jump_distance(x, y, 5);
+			}
+		}
+
+		jump_distances_dirty = false;
+		jump_distances_dirty_region = Rect2i();
+		return;
+	}
+
+	if (!jump_distances_dirty_region.has_area()) {
+		return;
+	}
+
+	// Solid changes move the walls of their rows and columns, and the jump points of the neighboring ones.
+	const Rect2i changed_region = jump_distances_dirty_region.grow(1).intersection(region);
+	jump_distances_dirty_region = Rect2i();
+
+	LocalVector<Vector2i> diagonal_seeds[4];
+	auto update_straight_distance = [&](int32_t p_x, int32_t p_y, int p_direction) {
+		int32_t &jump_distance = jump_distances[_to_point_index(p_x, p_y) * 8 + p_direction];
+		const int32_t new_jump_distance = _compute_jump_distance(p_x, p_y, p_direction);
+		if (new_jump_distance == jump_distance) {
+			return;
+		}
+		jump_distance = new_jump_distance;
+		// The diagonals sharing this direction stop at the point or pass it now.
+		for (int diagonal = 1; diagonal < 8; diagonal += 2) {
+			if ((jump_direction_x[p_direction] != 0 && jump_direction_x[diagonal] == jump_direction_x[p_direction]) || (jump_direction_y[p_direction] != 0 && jump_direction_y[diagonal] == jump_direction_y[p_direction])) {
+				diagonal_seeds[diagonal / 2].push_back(Vector2i(p_x - jump_direction_x[diagonal], p_y - jump_direction_y[diagonal]));
+			}
+		}
+	};
+
+	for (int32_t y = changed_region.position.y; y < changed_region.get_end().y; y++) {
+		for (int32_t x = end_x - 1; x >= begin_x; x--) {
+			update_straight_distance(x, y, 2);
+		}
+		for (int32_t x = begin_x; x < end_x; x++) {
+			update_straight_distance(x, y, 6);
+		}
+	}
+	for (int32_t x = changed_region.position.x; x < changed_region.get_end().x; x++) {
+		for (int32_t y = end_y - 1; y >= begin_y; y--) {
+			update_straight_distance(x, y, 4);
+		}
+		for (int32_t y = begin_y; y < end_y; y++) {
+			update_straight_distance(x, y, 0);
+		}
+	}
 
-	if (_get_solid_unchecked(p_end_point->id) && !p_allow_partial_path) {
+	for (int diagonal = 1; diagonal < 8; diagonal += 2) {
+		for (const Vector2i &seed : diagonal_seeds[diagonal / 2]) {
+			_propagate_jump_distance(seed.x, seed.y, diagonal);
+		}
+		// Diagonal moves are also blocked by the changed points themselves.
+		for (int32_t y = changed_region.position.y; y < changed_region.get_end().y; y++) {
+			for (int32_t x = changed_region.position.x; x < changed_region.get_end().x; x++) {
+				_propagate_jump_distance(x, y, diagonal);
+			}
+		}
+	}
+}
+
+uint32_t AStarGrid2D::_get_jump_point_successors(const Vector2i &p_id, const Vector2i &p_prev_id, const Vector2i &p_end, Vector2i *r_successors) const {
+	// Only the directions that can't be reached better through the previous point are searched.
+	int directions[8];
+	int direction_count = 0;
+	if (p_prev_id == p_id) {
+		for (int i = 0; i < 8; i++) {
+			directions[direction_count++] = i;
+		}
+	} else {
+		const int travel_direction = jump_direction_from_delta(p_id.x - p_prev_id.x, p_id.y - p_prev_id.y);
+		directions[direction_count++] = travel_direction;
+		directions[direction_count++] = (travel_direction + 1) % 8;
+		directions[direction_count++] = (travel_direction + 7) % 8;
+		if (travel_direction % 2 == 0) {
+			directions[direction_count++] = (travel_direction + 2) % 8;
+			directions[direction_count++] = (travel_direction + 6) % 8;
+		}
+	}
+
+	const uint32_t point_index = _to_point_index(p_id) * 8;
+	const Vector2i to_end = p_end - p_id;
+
+	uint32_t count = 0;
+	for (int i = 0; i < direction_count; i++) {
+		const int direction = directions[i];
+		const Vector2i step = Vector2i(jump_direction_x[direction], jump_direction_y[direction]);
+		const int32_t jump_distance = jump_distances[point_index + direction];
+		const int32_t free_distance = ABS(jump_distance);
+
+		if (direction % 2 == 0) {
+			// The end is straight ahead and closer than the next wall or jump point.
+			const bool end_ahead = step.x == 0 ? (to_end.x == 0 && SIGN(to_end.y) == step.y) : (to_end.y == 0 && SIGN(to_end.x) == step.x);
+			if (end_ahead && ABS(to_end.x + to_end.y) <= free_distance) {
+				r_successors[count++] = p_end;
+				continue;
+			}
+		} else if (SIGN(to_end.x) == step.x && SIGN(to_end.y) == step.y && (ABS(to_end.x) <= free_distance || ABS(to_end.y) <= free_distance)) {
+			// The end is in this quadrant, stop on the diagonal where it is straight ahead.
+			r_successors[count++] = p_id + step * MIN(ABS(to_end.x), ABS(to_end.y));
+			continue;
+		}
+
+		if (jump_distance > 0) {
+			r_successors[count++] = p_id + step * jump_distance;
+		}
+	}
+	return count;
+}
+
+real_t AStarGrid2D::_get_estimate_cost(const SolveContext &p_context, const Vector2i &p_from_id, const Vector2i &p_end_id) {
+	if (p_context.use_virtual_costs) {
+		return _estimate_cost(p_from_id, p_end_id);
+	}
+	return heuristics[default_estimate_heuristic](p_from_id, p_end_id);
+}
+
+real_t AStarGrid2D::_get_compute_cost(const SolveContext &p_context, const Vector2i &p_from_id, const Vector2i &p_to_id) {
+	if (p_context.use_virtual_costs) {
+		return _compute_cost(p_from_id, p_to_id);
+	}
+	return heuristics[default_compute_heuristic](p_from_id, p_to_id);
+}
+
+bool AStarGrid2D::_solve(SolveContext &r_context, uint32_t p_begin_point, uint32_t p_end_point, bool p_allow_partial_path) {
+	const uint32_t point_count = region.size.x * region.size.y;
+	if (r_context.passes.size() != point_count || r_context.pass >= (UINT32_MAX >> 1)) {
+		r_context.g_scores.resize(point_count);
+		r_context.prev_points.resize(point_count);
+		r_context.passes.resize(point_count);
+		for (uint32_t &point_pass : r_context.passes) {
+			point_pass = 0;
+		}
+		r_context.pass = 0;
+	}
+
+	r_context.pass++;
+	r_context.last_closest_point = UINT32_MAX;
+	r_context.open_list.clear();
+
+	const uint32_t open_pass = r_context.pass << 1;
+	const uint32_t closed_pass = open_pass | 1;
+
+	const Vector2i end_id = _get_point_id(p_end_point);
+	if (_get_solid_unchecked(end_id) && !p_allow_partial_path) {
 		return false;
 	}
 
 	bool found_route = false;
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
+	LocalVector<SolveContext::OpenPoint> &open_list = r_context.open_list;
+	SortArray<SolveContext::OpenPoint, SortOpenPoints> sorter;
 
-	p_begin_point->g_score = 0;
-	p_begin_point->f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
-	p_begin_point->abs_g_score = 0;
-	p_begin_point->abs_f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
-	open_list.push_back(p_begin_point);
-	end = p_end_point;
+	const Vector2i begin_id = _get_point_id(p_begin_point);
+	r_context.g_scores[p_begin_point] = 0;
+	r_context.prev_points[p_begin_point] = p_begin_point;
+	r_context.passes[p_begin_point] = open_pass;
+	open_list.push_back({ p_begin_point, 0, _get_estimate_cost(r_context, begin_id, end_id) });
+
+	const bool use_jump_distances = _is_using_jump_distances();
+	Vector2i nbors[8];
 
 	while (!open_list.is_empty()) {
-		Point *p = open_list[0]; // The currently processed point.
+		const SolveContext::OpenPoint p = open_list[0]; // The currently processed point.
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
+		open_list.remove_at(open_list.size() - 1);
+
+		// Points are pushed again when their score improves, skip the outdated entries.
+		if (r_context.passes[p.index] != open_pass || p.g_score != r_context.g_scores[p.index]) {
+			continue;
+		}
 
 		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (last_closest_point == nullptr || last_closest_point->abs_f_score > p->abs_f_score || (last_closest_point->abs_f_score >= p->abs_f_score && last_closest_point->abs_g_score > p->abs_g_score)) {
-			last_closest_point = p;
+		const real_t abs_f_score = p.f_score - p.g_score;
+		if (r_context.last_closest_point == UINT32_MAX || r_context.last_closest_abs_f_score > abs_f_score || (r_context.last_closest_abs_f_score >= abs_f_score && r_context.last_closest_abs_g_score > p.g_score)) {
+			r_context.last_closest_point = p.index;
+			r_context.last_closest_abs_f_score = abs_f_score;
+			r_context.last_closest_abs_g_score = p.g_score;
 		}
 
-		if (p == p_end_point) {
+		if (p.index == p_end_point) {
 			found_route = true;
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = pass; // Mark the point as closed.
+		r_context.passes[p.index] = closed_pass; // Mark the point as closed.
 
-		LocalVector<Point *> nbors;
-		_get_nbors(p, nbors);
+		const Vector2i p_id = _get_point_id(p.index);
+		uint32_t nbor_count = 0;
+		if (use_jump_distances) {
+			nbor_count = _get_jump_point_successors(p_id, _get_point_id(r_context.prev_points[p.index]), end_id, nbors);
+		} else {
+			nbor_count = _get_nbors(p_id, nbors);
+		}
 
-		for (Point *e : nbors) {
+		for (uint32_t i = 0; i < nbor_count; i++) {
+			Vector2i e_id = nbors[i];
 			real_t weight_scale = 1.0;
 
 			if (jumping_enabled) {
 				// TODO: Make it works with weight_scale.
-				e = _jump(p, e);
-				if (!e || e->closed_pass == pass) {
-					continue;
+				// The successors from the JPS+ jump distances are jump points already.
+				if (!use_jump_distances) {
+					Vector2i jump_point;
+					if (!_jump(p_id, e_id, end_id, jump_point)) {
+						continue;
+					}
+					e_id = jump_point;
 				}
 			} else {
-				if (_get_solid_unchecked(e->id) || e->closed_pass == pass) {
-					continue;
-				}
-				weight_scale = e->weight_scale;
+				weight_scale = weight_scales[_to_point_index(e_id)];
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * weight_scale;
-			bool new_point = false;
-
-			if (e->open_pass != pass) { // The point wasn't inside the open list.
-				e->open_pass = pass;
-				open_list.push_back(e);
-				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			const uint32_t e = _to_point_index(e_id);
+			if (r_context.passes[e] == closed_pass) {
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, p_end_point->id);
+			real_t tentative_g_score = p.g_score + _get_compute_cost(r_context, p_id, e_id) * weight_scale;
 
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
-
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+			if (r_context.passes[e] == open_pass && tentative_g_score >= r_context.g_scores[e]) { // The new path is worse than the previous.
+				continue;
 			}
+
+			r_context.passes[e] = open_pass;
+			r_context.prev_points[e] = p.index;
+			r_context.g_scores[e] = tentative_g_score;
+
+			open_list.push_back({ e, tentative_g_score, tentative_g_score + _get_estimate_cost(r_context, e_id, end_id) });
+			sorter.push_heap(0, open_list.size() - 1, 0, open_list[open_list.size() - 1], open_list.ptr());
 		}
 	}
 
@@ -593,36 +848,39 @@ real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_t
 }
 
 void AStarGrid2D::clear() {
-	points.clear();
+	solid_mask.clear();
+	weight_scales.clear();
+	solve_context = SolveContext();
+	batch_contexts.clear();
+	jump_distances.clear();
+	jump_distances_dirty = true;
 	region = Rect2i();
 }
 
 Vector2 AStarGrid2D::get_point_position(const Vector2i &p_id) const {
 	ERR_FAIL_COND_V_MSG(dirty, Vector2(), "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), Vector2(), vformat("Can't get point's position. Point %s out of bounds %s.", p_id, region));
-	return _get_point_unchecked(p_id)->pos;
+	return _get_point_position_unchecked(p_id);
 }
 
 TypedArray<Dictionary> AStarGrid2D::get_point_data_in_region(const Rect2i &p_region) const {
 	ERR_FAIL_COND_V_MSG(dirty, TypedArray<Dictionary>(), "Grid is not initialized. Call the update method.");
 	const Rect2i inter_region = region.intersection(p_region);
 
-	const int32_t start_x = inter_region.position.x - region.position.x;
-	const int32_t start_y = inter_region.position.y - region.position.y;
-	const int32_t end_x = inter_region.get_end().x - region.position.x;
-	const int32_t end_y = inter_region.get_end().y - region.position.y;
+	const int32_t end_x = inter_region.get_end().x;
+	const int32_t end_y = inter_region.get_end().y;
 
 	TypedArray<Dictionary> data;
 
-	for (int32_t y = start_y; y < end_y; y++) {
-		for (int32_t x = start_x; x < end_x; x++) {
-			const Point &p = points[y][x];
+	for (int32_t y = inter_region.position.y; y < end_y; y++) {
+		for (int32_t x = inter_region.position.x; x < end_x; x++) {
+			const Vector2i id = Vector2i(x, y);
 
 			Dictionary dict;
-			dict["id"] = p.id;
-			dict["position"] = p.pos;
-			dict["solid"] = _get_solid_unchecked(p.id);
-			dict["weight_scale"] = p.weight_scale;
+			dict["id"] = id;
+			dict["position"] = _get_point_position_unchecked(id);
+			dict["solid"] = _get_solid_unchecked(id);
+			dict["weight_scale"] = weight_scales[_to_point_index(id)];
 			data.push_back(dict);
 		}
 	}
@@ -630,54 +888,57 @@ TypedArray<Dictionary> AStarGrid2D::get_point_data_in_region(const Rect2i &p_reg
 	return data;
 }
 
-Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path) {
-	ERR_FAIL_COND_V_MSG(dirty, Vector<Vector2>(), "Grid is not initialized. Call the update method.");
-	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), Vector<Vector2>(), vformat("Can't get id path. Point %s out of bounds %s.", p_from_id, region));
-	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), Vector<Vector2>(), vformat("Can't get id path. Point %s out of bounds %s.", p_to_id, region));
+bool AStarGrid2D::_find_path(SolveContext &r_context, const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path, LocalVector<uint32_t> &r_path) {
+	r_path.clear();
 
-	Point *a = _get_point(p_from_id.x, p_from_id.y);
-	Point *b = _get_point(p_to_id.x, p_to_id.y);
+	const uint32_t begin_point = _to_point_index(p_from_id);
+	uint32_t end_point = _to_point_index(p_to_id);
 
-	if (a == b) {
-		Vector<Vector2> ret;
-		ret.push_back(a->pos);
-		return ret;
+	if (begin_point == end_point) {
+		r_path.push_back(begin_point);
+		return true;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
+	bool found_route = _solve(r_context, begin_point, end_point, p_allow_partial_path);
 	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
-			return Vector<Vector2>();
+		if (!p_allow_partial_path || r_context.last_closest_point == UINT32_MAX) {
+			return false;
 		}
 
 		// Use closest point instead.
-		end_point = last_closest_point;
+		end_point = r_context.last_closest_point;
 	}
 
-	Point *p = end_point;
-	int32_t pc = 1;
+	uint32_t p = end_point;
 	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
+		r_path.push_back(p);
+		p = r_context.prev_points[p];
 	}
+	r_path.push_back(begin_point);
+	r_path.invert();
 
-	Vector<Vector2> path;
-	path.resize(pc);
+	return true;
+}
 
-	{
-		Vector2 *w = path.ptrw();
+Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path) {
+	ERR_FAIL_COND_V_MSG(dirty, Vector<Vector2>(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), Vector<Vector2>(), vformat("Can't get id path. Point %s out of bounds %s.", p_from_id, region));
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), Vector<Vector2>(), vformat("Can't get id path. Point %s out of bounds %s.", p_to_id, region));
 
-		p = end_point;
-		int32_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->pos;
-			p = p->prev_point;
-		}
+	if (_is_using_jump_distances()) {
+		_update_jump_distances();
+	}
 
-		w[0] = p->pos;
+	LocalVector<uint32_t> point_path;
+	if (!_find_path(solve_context, p_from_id, p_to_id, p_allow_partial_path, point_path)) {
+		return Vector<Vector2>();
+	}
+
+	Vector<Vector2> path;
+	path.resize(point_path.size());
+	Vector2 *w = path.ptrw();
+	for (uint32_t i = 0; i < point_path.size(); i++) {
+		w[i] = _get_point_position_unchecked(_get_point_id(point_path[i]));
 	}
 
 	return path;
@@ -688,50 +949,87 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), TypedArray<Vector2i>(), vformat("Can't get id path. Point %s out of bounds %s.", p_from_id, region));
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), TypedArray<Vector2i>(), vformat("Can't get id path. Point %s out of bounds %s.", p_to_id, region));
 
-	Point *a = _get_point(p_from_id.x, p_from_id.y);
-	Point *b = _get_point(p_to_id.x, p_to_id.y);
+	if (_is_using_jump_distances()) {
+		_update_jump_distances();
+	}
 
-	if (a == b) {
-		TypedArray<Vector2i> ret;
-		ret.push_back(a->id);
-		return ret;
+	LocalVector<uint32_t> point_path;
+	if (!_find_path(solve_context, p_from_id, p_to_id, p_allow_partial_path, point_path)) {
+		return TypedArray<Vector2i>();
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
+	TypedArray<Vector2i> path;
+	path.resize(point_path.size());
+	for (uint32_t i = 0; i < point_path.size(); i++) {
+		path[i] = _get_point_id(point_path[i]);
+	}
 
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
-			return TypedArray<Vector2i>();
+	return path;
+}
+
+void AStarGrid2D::_solve_batch_lane(uint32_t p_lane, BatchSolve *p_batch) {
+	SolveContext &context = batch_contexts[p_lane];
+	LocalVector<uint32_t> point_path;
+
+	for (uint32_t i = p_lane; i < p_batch->from_ids.size(); i += p_batch->lane_count) {
+		if (!_find_path(context, p_batch->from_ids[i], p_batch->to_ids[i], p_batch->allow_partial_path, point_path)) {
+			continue;
 		}
 
-		// Use closest point instead.
-		end_point = last_closest_point;
+		Vector<Vector2> &path = p_batch->paths[i];
+		path.resize(point_path.size());
+		Vector2 *w = path.ptrw();
+		for (uint32_t j = 0; j < point_path.size(); j++) {
+			w[j] = _get_point_position_unchecked(_get_point_id(point_path[j]));
+		}
 	}
+}
 
-	Point *p = end_point;
-	int32_t pc = 1;
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
+TypedArray<PackedVector2Array> AStarGrid2D::get_point_paths(const TypedArray<Vector2i> &p_from_ids, const TypedArray<Vector2i> &p_to_ids, bool p_allow_partial_path) {
+	ERR_FAIL_COND_V_MSG(dirty, TypedArray<PackedVector2Array>(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(p_from_ids.size() != p_to_ids.size(), TypedArray<PackedVector2Array>(), vformat("Can't get point paths. The number of start points %d and end points %d differ.", p_from_ids.size(), p_to_ids.size()));
+
+	BatchSolve batch;
+	batch.allow_partial_path = p_allow_partial_path;
+	batch.from_ids.resize(p_from_ids.size());
+	batch.to_ids.resize(p_to_ids.size());
+	batch.paths.resize(p_from_ids.size());
+	for (int i = 0; i < p_from_ids.size(); i++) {
+		batch.from_ids[i] = p_from_ids[i];
+		batch.to_ids[i] = p_to_ids[i];
+		ERR_FAIL_COND_V_MSG(!is_in_boundsv(batch.from_ids[i]), TypedArray<PackedVector2Array>(), vformat("Can't get point paths. Point %s out of bounds %s.", batch.from_ids[i], region));
+		ERR_FAIL_COND_V_MSG(!is_in_boundsv(batch.to_ids[i]), TypedArray<PackedVector2Array>(), vformat("Can't get point paths. Point %s out of bounds %s.", batch.to_ids[i], region));
 	}
 
-	TypedArray<Vector2i> path;
-	path.resize(pc);
+	if (_is_using_jump_distances()) {
+		_update_jump_distances();
+	}
 
-	{
-		p = end_point;
-		int32_t idx = pc - 1;
-		while (p != begin_point) {
-			path[idx--] = p->id;
-			p = p->prev_point;
-		}
+	// Scripted costs can't be called from other threads, those batches are solved on the calling thread.
+	const bool use_virtual_costs = GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) || GDVIRTUAL_IS_OVERRIDDEN(_compute_cost);
+	batch.lane_count = use_virtual_costs ? 1 : CLAMP((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), 1u, MAX(batch.from_ids.size(), 1u));
+
+	if (batch_contexts.size() < batch.lane_count) {
+		batch_contexts.resize(batch.lane_count);
+	}
+	for (uint32_t i = 0; i < batch.lane_count; i++) {
+		batch_contexts[i].use_virtual_costs = use_virtual_costs;
+	}
 
-		path[0] = p->id;
+	if (batch.lane_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AStarGrid2D::_solve_batch_lane, &batch, batch.lane_count, -1, true, SNAME("AStarGrid2DSolvePaths"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_solve_batch_lane(0, &batch);
 	}
 
-	return path;
+	TypedArray<PackedVector2Array> paths;
+	paths.resize(batch.paths.size());
+	for (uint32_t i = 0; i < batch.paths.size(); i++) {
+		paths[i] = batch.paths[i];
+	}
+
+	return paths;
 }
 
 void AStarGrid2D::_bind_methods() {
@@ -769,6 +1067,7 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_data_in_region", "region"), &AStarGrid2D::get_point_data_in_region);
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_point_path, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_id_path, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_point_paths", "from_ids", "to_ids", "allow_partial_path"), &AStarGrid2D::get_point_paths, DEFVAL(false));
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
@@ -74,47 +74,58 @@ private:
 	Heuristic default_compute_heuristic = HEURISTIC_EUCLIDEAN;
 	Heuristic default_estimate_heuristic = HEURISTIC_EUCLIDEAN;
 
-	struct Point {
-		Vector2i id;
-
-		Vector2 pos;
-		real_t weight_scale = 1.0;
-
-		// Used for pathfinding.
-		Point *prev_point = nullptr;
-		real_t g_score = 0;
-		real_t f_score = 0;
-		uint64_t open_pass = 0;
-		uint64_t closed_pass = 0;
+	// Search state of a single query, indexed by point. Each thread of a batch solve uses its own.
+	struct SolveContext {
+		struct OpenPoint {
+			uint32_t index = 0;
+			real_t g_score = 0;
+			real_t f_score = 0;
+		};
+
+		LocalVector<real_t> g_scores;
+		LocalVector<uint32_t> prev_points;
+		LocalVector<uint32_t> passes; // The pass shifted left by one while open, with the lowest bit set once closed.
+		uint32_t pass = 0;
+		LocalVector<OpenPoint> open_list;
+		bool use_virtual_costs = true;
 
 		// Used for getting last_closest_point.
-		real_t abs_g_score = 0;
-		real_t abs_f_score = 0;
-
-		Point() {}
-
-		Point(const Vector2i &p_id, const Vector2 &p_pos) :
-				id(p_id), pos(p_pos) {}
+		uint32_t last_closest_point = UINT32_MAX;
+		real_t last_closest_abs_g_score = 0;
+		real_t last_closest_abs_f_score = 0;
 	};
 
-	struct SortPoints {
-		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
-			if (A->f_score > B->f_score) {
+	struct SortOpenPoints {
+		_FORCE_INLINE_ bool operator()(const SolveContext::OpenPoint &A, const SolveContext::OpenPoint &B) const { // Returns true when the point A is worse than point B.
+			if (A.f_score > B.f_score) {
 				return true;
-			} else if (A->f_score < B->f_score) {
+			} else if (A.f_score < B.f_score) {
 				return false;
 			} else {
-				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
+				return A.g_score < B.g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
 			}
 		}
 	};
 
-	LocalVector<bool> solid_mask;
-	LocalVector<LocalVector<Point>> points;
-	Point *end = nullptr;
-	Point *last_closest_point = nullptr;
+	struct BatchSolve {
+		LocalVector<Vector2i> from_ids;
+		LocalVector<Vector2i> to_ids;
+		LocalVector<Vector<Vector2>> paths;
+		bool allow_partial_path = false;
+		uint32_t lane_count = 1;
+	};
+
+	LocalVector<uint64_t> solid_mask; // One bit per point, with a solid border around the region.
+	LocalVector<real_t> weight_scales;
 
-	uint64_t pass = 1;
+	SolveContext solve_context;
+	LocalVector<SolveContext> batch_contexts;
+
+	// JPS+ jump distances, eight per point in the order of jump_direction_x/y.
+	// Positive values reach a jump point after that many points, the others are the number of walkable points before a wall.
+	LocalVector<int32_t> jump_distances;
+	bool jump_distances_dirty = true;
+	Rect2i jump_distances_dirty_region;
 
 private: // Internal routines.
 	_FORCE_INLINE_ size_t _to_mask_index(int32_t p_x, int32_t p_y) const {
@@ -122,44 +133,61 @@ private: // Internal routines.
 	}
 
 	_FORCE_INLINE_ bool _is_walkable(int32_t p_x, int32_t p_y) const {
-		return !solid_mask[_to_mask_index(p_x, p_y)];
-	}
-
-	_FORCE_INLINE_ Point *_get_point(int32_t p_x, int32_t p_y) {
-		if (region.has_point(Vector2i(p_x, p_y))) {
-			return &points[p_y - region.position.y][p_x - region.position.x];
-		}
-		return nullptr;
+		const size_t index = _to_mask_index(p_x, p_y);
+		return !(solid_mask[index >> 6] & (uint64_t(1) << (index & 63)));
 	}
 
 	_FORCE_INLINE_ void _set_solid_unchecked(int32_t p_x, int32_t p_y, bool p_solid) {
-		solid_mask[_to_mask_index(p_x, p_y)] = p_solid;
+		const size_t index = _to_mask_index(p_x, p_y);
+		if (p_solid) {
+			solid_mask[index >> 6] |= uint64_t(1) << (index & 63);
+		} else {
+			solid_mask[index >> 6] &= ~(uint64_t(1) << (index & 63));
+		}
 	}
 
 	_FORCE_INLINE_ void _set_solid_unchecked(const Vector2i &p_id, bool p_solid) {
-		solid_mask[_to_mask_index(p_id.x, p_id.y)] = p_solid;
+		_set_solid_unchecked(p_id.x, p_id.y, p_solid);
 	}
 
 	_FORCE_INLINE_ bool _get_solid_unchecked(const Vector2i &p_id) const {
-		return solid_mask[_to_mask_index(p_id.x, p_id.y)];
+		return !_is_walkable(p_id.x, p_id.y);
+	}
+
+	_FORCE_INLINE_ uint32_t _to_point_index(int32_t p_x, int32_t p_y) const {
+		return (p_y - region.position.y) * region.size.x + p_x - region.position.x;
 	}
 
-	_FORCE_INLINE_ Point *_get_point_unchecked(int32_t p_x, int32_t p_y) {
-		return &points[p_y - region.position.y][p_x - region.position.x];
+	_FORCE_INLINE_ uint32_t _to_point_index(const Vector2i &p_id) const {
+		return _to_point_index(p_id.x, p_id.y);
 	}
 
-	_FORCE_INLINE_ Point *_get_point_unchecked(const Vector2i &p_id) {
-		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
+	_FORCE_INLINE_ Vector2i _get_point_id(uint32_t p_index) const {
+		return Vector2i(region.position.x + p_index % region.size.x, region.position.y + p_index / region.size.x);
 	}
 
-	_FORCE_INLINE_ const Point *_get_point_unchecked(const Vector2i &p_id) const {
-		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
+	_FORCE_INLINE_ bool _is_using_jump_distances() const {
+		return jumping_enabled && diagonal_mode == DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES;
 	}
 
-	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
-	Point *_jump(Point *p_from, Point *p_to);
-	bool _solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
-	Point *_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive = false);
+	Vector2 _get_point_position_unchecked(const Vector2i &p_id) const;
+
+	uint32_t _get_nbors(const Vector2i &p_id, Vector2i *r_nbors) const;
+	bool _jump(const Vector2i &p_from, const Vector2i &p_to, const Vector2i &p_end, Vector2i &r_point) const;
+	bool _forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, const Vector2i &p_end, Vector2i &r_point, bool p_inclusive = false) const;
+
+	bool _is_jump_point(int32_t p_x, int32_t p_y, int p_direction) const;
+	int32_t _compute_jump_distance(int32_t p_x, int32_t p_y, int p_direction) const;
+	void _propagate_jump_distance(int32_t p_x, int32_t p_y, int p_direction);
+	void _update_jump_distances();
+	void _mark_jump_distances_dirty(const Rect2i &p_region);
+	uint32_t _get_jump_point_successors(const Vector2i &p_id, const Vector2i &p_prev_id, const Vector2i &p_end, Vector2i *r_successors) const;
+
+	real_t _get_estimate_cost(const SolveContext &p_context, const Vector2i &p_from_id, const Vector2i &p_end_id);
+	real_t _get_compute_cost(const SolveContext &p_context, const Vector2i &p_from_id, const Vector2i &p_to_id);
+	bool _solve(SolveContext &r_context, uint32_t p_begin_point, uint32_t p_end_point, bool p_allow_partial_path);
+	bool _find_path(SolveContext &r_context, const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path, LocalVector<uint32_t> &r_path);
+	void _solve_batch_lane(uint32_t p_lane, BatchSolve *p_batch);
 
 protected:
 	static void _bind_methods();
@@ -225,6 +253,7 @@ public:
 	TypedArray<Dictionary> get_point_data_in_region(const Rect2i &p_region) const;
 	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
 	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
+	TypedArray<PackedVector2Array> get_point_paths(const TypedArray<Vector2i> &p_from_ids, const TypedArray<Vector2i> &p_to_ids, bool p_allow_partial_path = false);
 };
 
 VARIANT_ENUM_CAST(AStarGrid2D::DiagonalMode);
@@ -4157,6 +4157,9 @@ int Main::start() {
 			bool snap_controls = GLOBAL_GET("gui/common/snap_controls_to_pixels");
 			sml->get_root()->set_snap_controls_to_pixels(snap_controls);
 
+			bool incremental_layout = GLOBAL_GET("gui/common/incremental_layout");
+			sml->get_root()->set_gui_incremental_layout(incremental_layout);
+
 			bool font_oversampling = GLOBAL_GET("gui/fonts/dynamic_fonts/use_oversampling");
 			sml->get_root()->set_use_font_oversampling(font_oversampling);
 
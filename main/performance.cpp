@@ -97,6 +97,16 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SURFACE);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_DRAW);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SPECIALIZATION);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_SLEEPING_OBJECTS);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_LARGEST_ISLAND);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_NARROWPHASE_TESTS);
+	BIND_ENUM_CONSTANT(NAVIGATION_MAP_SYNC_TIME);
+	BIND_ENUM_CONSTANT(NAVIGATION_MAP_BUILD_TIME);
+	BIND_ENUM_CONSTANT(NAVIGATION_AVOIDANCE_TIME);
+	BIND_ENUM_CONSTANT(NAVIGATION_PATH_QUERY_COUNT);
+	BIND_ENUM_CONSTANT(NAVIGATION_PATH_QUERY_TIME);
+	BIND_ENUM_CONSTANT(NAVIGATION_PATH_QUERY_MAX_TIME);
+	BIND_ENUM_CONSTANT(NAVIGATION_PATH_QUERY_POLYGON_COUNT);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -151,6 +161,16 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("pipeline/compilations_surface"),
 		PNAME("pipeline/compilations_draw"),
 		PNAME("pipeline/compilations_specialization"),
+		PNAME("physics_3d/sleeping_objects"),
+		PNAME("physics_3d/largest_island"),
+		PNAME("physics_3d/narrowphase_tests"),
+		PNAME("navigation/map_sync_time"),
+		PNAME("navigation/map_build_time"),
+		PNAME("navigation/avoidance_time"),
+		PNAME("navigation/path_queries"),
+		PNAME("navigation/path_query_time"),
+		PNAME("navigation/path_query_max_time"),
+		PNAME("navigation/path_query_polygons"),
 	};
 	static_assert((sizeof(names) / sizeof(const char *)) == MONITOR_MAX);
 
@@ -216,6 +236,12 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return 0;
 		case PHYSICS_3D_ISLAND_COUNT:
 			return 0;
+		case PHYSICS_3D_SLEEPING_OBJECTS:
+			return 0;
+		case PHYSICS_3D_LARGEST_ISLAND:
+			return 0;
+		case PHYSICS_3D_NARROWPHASE_TESTS:
+			return 0;
 #else
 		case PHYSICS_3D_ACTIVE_OBJECTS:
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ACTIVE_OBJECTS);
@@ -223,6 +249,12 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_COLLISION_PAIRS);
 		case PHYSICS_3D_ISLAND_COUNT:
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
+		case PHYSICS_3D_SLEEPING_OBJECTS:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_SLEEPING_OBJECTS);
+		case PHYSICS_3D_LARGEST_ISLAND:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_LARGEST_ISLAND);
+		case PHYSICS_3D_NARROWPHASE_TESTS:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_NARROWPHASE_TESTS);
 #endif // _3D_DISABLED
 
 		case AUDIO_OUTPUT_LATENCY:
@@ -247,6 +279,20 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
 		case NAVIGATION_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
+		case NAVIGATION_MAP_SYNC_TIME:
+			return USEC_TO_SEC(NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_MAP_SYNC_TIME));
+		case NAVIGATION_MAP_BUILD_TIME:
+			return USEC_TO_SEC(NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_MAP_BUILD_TIME));
+		case NAVIGATION_AVOIDANCE_TIME:
+			return USEC_TO_SEC(NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_AVOIDANCE_TIME));
+		case NAVIGATION_PATH_QUERY_COUNT:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_QUERY_COUNT);
+		case NAVIGATION_PATH_QUERY_TIME:
+			return USEC_TO_SEC(NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_QUERY_TIME));
+		case NAVIGATION_PATH_QUERY_MAX_TIME:
+			return USEC_TO_SEC(NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_QUERY_MAX_TIME));
+		case NAVIGATION_PATH_QUERY_POLYGON_COUNT:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_QUERY_POLYGON_COUNT);
 
 		default: {
 		}
@@ -298,6 +344,16 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
@@ -106,6 +106,16 @@ public:
 		PIPELINE_COMPILATIONS_SURFACE,
 		PIPELINE_COMPILATIONS_DRAW,
 		PIPELINE_COMPILATIONS_SPECIALIZATION,
+		PHYSICS_3D_SLEEPING_OBJECTS,
+		PHYSICS_3D_LARGEST_ISLAND,
+		PHYSICS_3D_NARROWPHASE_TESTS,
+		NAVIGATION_MAP_SYNC_TIME,
+		NAVIGATION_MAP_BUILD_TIME,
+		NAVIGATION_AVOIDANCE_TIME,
+		NAVIGATION_PATH_QUERY_COUNT,
+		NAVIGATION_PATH_QUERY_TIME,
+		NAVIGATION_PATH_QUERY_MAX_TIME,
+		NAVIGATION_PATH_QUERY_POLYGON_COUNT,
 		MONITOR_MAX
 	};
 
@@ -619,7 +619,7 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 
 	ERR_FAIL_NULL(get_space());
 
-	if (fi_callback_data || body_state_callback.is_valid()) {
+	if (fi_callback_data || body_state_callback.is_valid() || state_sync_bulk) {
 		get_space()->body_add_to_state_query_list(&direct_state_query_list);
 	}
 
@@ -676,13 +676,12 @@ void GodotBody2D::wakeup_neighbours() {
 	}
 }
 
-void GodotBody2D::call_queries() {
-	Variant direct_state_variant = get_direct_state();
-
+void GodotBody2D::call_queries(LocalVector<PhysicsServer2D::BodyStateSync> *r_bulk_states) {
 	if (fi_callback_data) {
 		if (!fi_callback_data->callable.is_valid()) {
 			set_force_integration_callback(Callable());
 		} else {
+			Variant direct_state_variant = get_direct_state();
 			const Variant *vp[2] = { &direct_state_variant, &fi_callback_data->udata };
 
 			Callable::CallError ce;
@@ -696,8 +695,17 @@ void GodotBody2D::call_queries() {
 		}
 	}
 
-	if (body_state_callback.is_valid()) {
-		body_state_callback.call(direct_state_variant);
+	if (r_bulk_states) {
+		PhysicsServer2D::BodyStateSync state;
+		state.instance_id = get_instance_id();
+		state.transform = get_transform();
+		state.linear_velocity = linear_velocity;
+		state.angular_velocity = angular_velocity;
+		state.contact_count = contact_count;
+		state.sleeping = !is_active();
+		r_bulk_states->push_back(state);
+	} else if (body_state_callback.is_valid()) {
+		body_state_callback.call(get_direct_state());
 	}
 }
 
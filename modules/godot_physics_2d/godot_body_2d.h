@@ -35,6 +35,7 @@
 #include "godot_collision_object_2d.h"
 
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
 #include "core/templates/vset.h"
 
@@ -140,6 +141,7 @@ class GodotBody2D : public GodotCollisionObject2D {
 	int contact_count = 0;
 
 	Callable body_state_callback;
+	bool state_sync_bulk = false;
 
 	struct ForceIntegrationCallbackData {
 		Callable callable;
@@ -158,6 +160,8 @@ class GodotBody2D : public GodotCollisionObject2D {
 
 public:
 	void set_state_sync_callback(const Callable &p_callable);
+	void set_state_sync_bulk(bool p_enable) { state_sync_bulk = p_enable; }
+	_FORCE_INLINE_ bool is_state_sync_bulk() const { return state_sync_bulk; }
 	void set_force_integration_callback(const Callable &p_callable, const Variant &p_udata = Variant());
 
 	GodotPhysicsDirectBodyState2D *get_direct_state();
@@ -331,7 +335,7 @@ public:
 		return Vector2();
 	}
 
-	void call_queries();
+	void call_queries(LocalVector<PhysicsServer2D::BodyStateSync> *r_bulk_states = nullptr);
 	void wakeup_neighbours();
 
 	bool sleep_test(real_t p_step);
@@ -1118,10 +1118,18 @@ const SelfList<GodotArea2D>::List &GodotSpace2D::get_moved_area_list() const {
 }
 
 void GodotSpace2D::call_queries() {
+	PhysicsServer2D::BodyStateSyncBulkCallback bulk_callback = PhysicsServer2D::get_body_state_sync_bulk_callback();
+
 	while (state_query_list.first()) {
 		GodotBody2D *b = state_query_list.first()->self();
 		state_query_list.remove(state_query_list.first());
-		b->call_queries();
+		b->call_queries((bulk_callback && b->is_state_sync_bulk()) ? &bulk_state_sync_buffer : nullptr);
+	}
+
+	if (!bulk_state_sync_buffer.is_empty()) {
+		// Sleeping bodies never reach the query list, so this only holds what moved this step.
+		bulk_callback(bulk_state_sync_buffer.ptr(), bulk_state_sync_buffer.size());
+		bulk_state_sync_buffer.clear();
 	}
 
 	while (monitor_query_list.first()) {
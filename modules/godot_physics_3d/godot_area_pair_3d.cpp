@@ -32,9 +32,19 @@
 
 #include "godot_collision_solver_3d.h"
 
+bool GodotAreaPair3D::get_narrowphase_shape_types(PhysicsServer3D::ShapeType &r_type_A, PhysicsServer3D::ShapeType &r_type_B) const {
+	if (!narrowphase_tested) {
+		return false;
+	}
+	r_type_A = body->get_shape(body_shape)->get_type();
+	r_type_B = area->get_shape(area_shape)->get_type();
+	return true;
+}
+
 bool GodotAreaPair3D::setup(real_t p_step) {
 	bool result = false;
-	if (area->collides_with(body) && GodotCollisionSolver3D::solve_static(body->get_shape(body_shape), body->get_transform() * body->get_shape_transform(body_shape), area->get_shape(area_shape), area->get_transform() * area->get_shape_transform(area_shape), nullptr, this)) {
+	narrowphase_tested = area->collides_with(body);
+	if (narrowphase_tested && GodotCollisionSolver3D::solve_static(body->get_shape(body_shape), body->get_transform() * body->get_shape_transform(body_shape), area->get_shape(area_shape), area->get_transform() * area->get_shape_transform(area_shape), nullptr, this)) {
 		result = true;
 	}
 
@@ -120,10 +130,20 @@ GodotAreaPair3D::~GodotAreaPair3D() {
 
 ////////////////////////////////////////////////////
 
+bool GodotArea2Pair3D::get_narrowphase_shape_types(PhysicsServer3D::ShapeType &r_type_A, PhysicsServer3D::ShapeType &r_type_B) const {
+	if (!narrowphase_tested) {
+		return false;
+	}
+	r_type_A = area_a->get_shape(shape_a)->get_type();
+	r_type_B = area_b->get_shape(shape_b)->get_type();
+	return true;
+}
+
 bool GodotArea2Pair3D::setup(real_t p_step) {
 	bool result_a = area_a->collides_with(area_b);
 	bool result_b = area_b->collides_with(area_a);
-	if ((result_a || result_b) && !GodotCollisionSolver3D::solve_static(area_a->get_shape(shape_a), area_a->get_transform() * area_a->get_shape_transform(shape_a), area_b->get_shape(shape_b), area_b->get_transform() * area_b->get_shape_transform(shape_b), nullptr, this)) {
+	narrowphase_tested = result_a || result_b;
+	if (narrowphase_tested && !GodotCollisionSolver3D::solve_static(area_a->get_shape(shape_a), area_a->get_transform() * area_a->get_shape_transform(shape_a), area_b->get_shape(shape_b), area_b->get_transform() * area_b->get_shape_transform(shape_b), nullptr, this)) {
 		result_a = false;
 		result_b = false;
 	}
@@ -45,8 +45,11 @@ class GodotAreaPair3D : public GodotConstraint3D {
 	bool process_collision = false;
 	bool has_space_override = false;
 	bool body_has_attached_area = false;
+	bool narrowphase_tested = false;
 
 public:
+	virtual bool get_narrowphase_shape_types(PhysicsServer3D::ShapeType &r_type_A, PhysicsServer3D::ShapeType &r_type_B) const override;
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
@@ -66,8 +69,11 @@ class GodotArea2Pair3D : public GodotConstraint3D {
 	bool process_collision_b = false;
 	bool area_a_monitorable;
 	bool area_b_monitorable;
+	bool narrowphase_tested = false;
 
 public:
+	virtual bool get_narrowphase_shape_types(PhysicsServer3D::ShapeType &r_type_A, PhysicsServer3D::ShapeType &r_type_B) const override;
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
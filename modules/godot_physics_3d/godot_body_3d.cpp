@@ -171,11 +171,19 @@ void GodotBody3D::reset_mass_properties() {
 	_mass_properties_changed();
 }
 
+void GodotBody3D::_update_sleeping_count(bool p_was_sleeping) {
+	const bool sleeping = _is_sleeping();
+	if (get_space() && sleeping != p_was_sleeping) {
+		get_space()->add_sleeping_body_count(sleeping ? 1 : -1);
+	}
+}
+
 void GodotBody3D::set_active(bool p_active) {
 	if (active == p_active) {
 		return;
 	}
 
+	const bool was_sleeping = _is_sleeping();
 	active = p_active;
 
 	if (active) {
@@ -188,6 +196,8 @@ void GodotBody3D::set_active(bool p_active) {
 	} else if (get_space()) {
 		get_space()->body_remove_from_active_list(&active_list);
 	}
+
+	_update_sleeping_count(was_sleeping);
 }
 
 void GodotBody3D::set_param(PhysicsServer3D::BodyParameter p_param, const Variant &p_value) {
@@ -298,6 +308,7 @@ Variant GodotBody3D::get_param(PhysicsServer3D::BodyParameter p_param) const {
 
 void GodotBody3D::set_mode(PhysicsServer3D::BodyMode p_mode) {
 	PhysicsServer3D::BodyMode prev = mode;
+	const bool was_sleeping = _is_sleeping();
 	mode = p_mode;
 
 	switch (p_mode) {
@@ -337,6 +348,8 @@ void GodotBody3D::set_mode(PhysicsServer3D::BodyMode p_mode) {
 			set_active(true);
 		}
 	}
+
+	_update_sleeping_count(was_sleeping);
 }
 
 PhysicsServer3D::BodyMode GodotBody3D::get_mode() const {
@@ -449,6 +462,9 @@ void GodotBody3D::set_space(GodotSpace3D *p_space) {
 		if (direct_state_query_list.in_list()) {
 			get_space()->body_remove_from_state_query_list(&direct_state_query_list);
 		}
+		if (_is_sleeping()) {
+			get_space()->add_sleeping_body_count(-1);
+		}
 	}
 
 	_set_space(p_space);
@@ -456,6 +472,10 @@ void GodotBody3D::set_space(GodotSpace3D *p_space) {
 	if (get_space()) {
 		_mass_properties_changed();
 
+		if (_is_sleeping()) {
+			get_space()->add_sleeping_body_count(1);
+		}
+
 		if (active && !active_list.in_list()) {
 			get_space()->body_add_to_active_list(&active_list);
 		}
@@ -678,7 +698,7 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	ERR_FAIL_NULL(get_space());
 
-	if (fi_callback_data || body_state_callback.is_valid()) {
+	if (fi_callback_data || body_state_callback.is_valid() || state_sync_bulk) {
 		get_space()->body_add_to_state_query_list(&direct_state_query_list);
 	}
 
@@ -759,13 +779,12 @@ void GodotBody3D::wakeup_neighbours() {
 	}
 }
 
-void GodotBody3D::call_queries() {
-	Variant direct_state_variant = get_direct_state();
-
+void GodotBody3D::call_queries(LocalVector<PhysicsServer3D::BodyStateSync> *r_bulk_states) {
 	if (fi_callback_data) {
 		if (!fi_callback_data->callable.is_valid()) {
 			set_force_integration_callback(Callable());
 		} else {
+			Variant direct_state_variant = get_direct_state();
 			const Variant *vp[2] = { &direct_state_variant, &fi_callback_data->udata };
 
 			Callable::CallError ce;
@@ -775,8 +794,18 @@ void GodotBody3D::call_queries() {
 		}
 	}
 
-	if (body_state_callback.is_valid()) {
-		body_state_callback.call(direct_state_variant);
+	if (r_bulk_states) {
+		PhysicsServer3D::BodyStateSync state;
+		state.instance_id = get_instance_id();
+		state.transform = get_transform();
+		state.linear_velocity = linear_velocity;
+		state.angular_velocity = angular_velocity;
+		state.inverse_inertia_tensor = _inv_inertia_tensor;
+		state.contact_count = contact_count;
+		state.sleeping = !is_active();
+		r_bulk_states->push_back(state);
+	} else if (body_state_callback.is_valid()) {
+		body_state_callback.call(get_direct_state());
 	}
 }
 
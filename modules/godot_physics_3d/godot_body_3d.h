@@ -34,6 +34,7 @@
 #include "godot_area_3d.h"
 #include "godot_collision_object_3d.h"
 
+#include "core/templates/local_vector.h"
 #include "core/templates/vset.h"
 
 class GodotConstraint3D;
@@ -134,6 +135,7 @@ class GodotBody3D : public GodotCollisionObject3D {
 	int contact_count = 0;
 
 	Callable body_state_callback;
+	bool state_sync_bulk = false;
 
 	struct ForceIntegrationCallbackData {
 		Callable callable;
@@ -148,10 +150,15 @@ class GodotBody3D : public GodotCollisionObject3D {
 
 	void _update_transform_dependent();
 
+	_FORCE_INLINE_ bool _is_sleeping() const { return mode >= PhysicsServer3D::BODY_MODE_KINEMATIC && !active; }
+	void _update_sleeping_count(bool p_was_sleeping);
+
 	friend class GodotPhysicsDirectBodyState3D; // i give up, too many functions to expose
 
 public:
 	void set_state_sync_callback(const Callable &p_callable);
+	void set_state_sync_bulk(bool p_enable) { state_sync_bulk = p_enable; }
+	_FORCE_INLINE_ bool is_state_sync_bulk() const { return state_sync_bulk; }
 	void set_force_integration_callback(const Callable &p_callable, const Variant &p_udata = Variant());
 
 	GodotPhysicsDirectBodyState3D *get_direct_state();
@@ -338,7 +345,7 @@ public:
 	}
 
 	//void simulate_motion(const Transform3D& p_xform,real_t p_step);
-	void call_queries();
+	void call_queries(LocalVector<PhysicsServer3D::BodyStateSync> *r_bulk_states = nullptr);
 	void wakeup_neighbours();
 
 	bool sleep_test(real_t p_step);
@@ -91,6 +91,7 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	bool collide_B = false;
 
 	bool report_contacts_only = false;
+	bool narrowphase_tested = false;
 
 	Vector3 offset_B; //use local A coordinates to avoid numerical issues on collision detection
 
@@ -105,6 +106,8 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
 public:
+	virtual bool get_narrowphase_shape_types(PhysicsServer3D::ShapeType &r_type_A, PhysicsServer3D::ShapeType &r_type_B) const override;
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
@@ -31,6 +31,8 @@
 #ifndef GODOT_CONSTRAINT_3D_H
 #define GODOT_CONSTRAINT_3D_H
 
+#include "servers/physics_server_3d.h"
+
 class GodotBody3D;
 class GodotSoftBody3D;
 
@@ -71,6 +73,9 @@ public:
 	_FORCE_INLINE_ void disable_collisions_between_bodies(const bool p_disabled) { disabled_collisions_between_bodies = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled_collisions_between_bodies() const { return disabled_collisions_between_bodies; }
 
+	// Shape types tested by the narrowphase during the last `setup()`, used for profiling.
+	virtual bool get_narrowphase_shape_types(PhysicsServer3D::ShapeType &r_type_A, PhysicsServer3D::ShapeType &r_type_B) const { return false; }
+
 	virtual bool setup(real_t p_step) = 0;
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
@@ -105,6 +105,8 @@ RID GodotPhysicsServer3D::custom_shape_create() {
 void GodotPhysicsServer3D::shape_set_data(RID p_shape, const Variant &p_data) {
 	GodotShape3D *shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
+
+	RWLockWrite write_lock(concurrent_query_lock);
 	shape->set_data(p_data);
 }
 
@@ -196,6 +198,15 @@ PhysicsDirectSpaceState3D *GodotPhysicsServer3D::space_get_direct_state(RID p_sp
 	return space->get_direct_state();
 }
 
+PhysicsDirectSpaceState3D *GodotPhysicsServer3D::space_get_concurrent_direct_state(RID p_space) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, nullptr);
+
+	// The snapshot is only kept up to date from the first request onward.
+	space->get_concurrent_state()->set_enabled(true);
+	return space->get_concurrent_state();
+}
+
 void GodotPhysicsServer3D::space_set_debug_contacts(RID p_space, int p_max_contacts) {
 	GodotSpace3D *space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL(space);
@@ -903,6 +914,12 @@ void GodotPhysicsServer3D::body_set_force_integration_callback(RID p_body, const
 	body->set_force_integration_callback(p_callable, p_udata);
 }
 
+void GodotPhysicsServer3D::body_set_state_sync_bulk(RID p_body, bool p_enable) {
+	GodotBody3D *body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+	body->set_state_sync_bulk(p_enable);
+}
+
 void GodotPhysicsServer3D::body_set_ray_pickable(RID p_body, bool p_enable) {
 	GodotBody3D *body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
@@ -1564,6 +1581,9 @@ void GodotPhysicsServer3D::free(RID p_rid) {
 			so->remove_shape(shape);
 		}
 
+		RWLockWrite write_lock(concurrent_query_lock);
+		_remove_shape_from_concurrent_states(shape);
+
 		shape_owner.free(p_rid);
 		memdelete(shape);
 	} else if (body_owner.owns(p_rid)) {
@@ -1607,6 +1627,7 @@ void GodotPhysicsServer3D::free(RID p_rid) {
 		free(space->get_default_area()->get_self());
 		free(space->get_static_global_body());
 
+		RWLockWrite write_lock(concurrent_query_lock);
 		space_owner.free(p_rid);
 		memdelete(space);
 	} else if (joint_owner.owns(p_rid)) {
@@ -1639,10 +1660,20 @@ void GodotPhysicsServer3D::step(real_t p_step) {
 	active_objects = 0;
 	collision_pairs = 0;
 	for (GodotSpace3D *E : active_spaces) {
-		stepper->step(E, p_step);
+		E->reset_step_statistics();
+
+		const int substeps = E->get_solver_substeps();
+		const real_t substep = p_step / substeps;
+		for (int i = 0; i < substeps; i++) {
+			stepper->step(E, substep);
+		}
 		island_count += E->get_island_count();
 		active_objects += E->get_active_objects();
 		collision_pairs += E->get_collision_pairs();
+
+		if (E->get_concurrent_state()->is_enabled()) {
+			E->get_concurrent_state()->update();
+		}
 	}
 }
 
@@ -1650,6 +1681,15 @@ void GodotPhysicsServer3D::sync() {
 	doing_sync = true;
 }
 
+static const char *elapsed_time_name[GodotSpace3D::ELAPSED_TIME_MAX] = {
+	"integrate_forces",
+	"broadphase",
+	"generate_islands",
+	"setup_constraints",
+	"solve_constraints",
+	"integrate_velocities"
+};
+
 void GodotPhysicsServer3D::flush_queries() {
 	if (!active) {
 		return;
@@ -1668,14 +1708,6 @@ void GodotPhysicsServer3D::flush_queries() {
 
 	if (EngineDebugger::is_profiling("servers")) {
 		uint64_t total_time[GodotSpace3D::ELAPSED_TIME_MAX];
-		static const char *time_name[GodotSpace3D::ELAPSED_TIME_MAX] = {
-			"integrate_forces",
-			"generate_islands",
-			"setup_constraints",
-			"solve_constraints",
-			"integrate_velocities"
-		};
-
 		for (int i = 0; i < GodotSpace3D::ELAPSED_TIME_MAX; i++) {
 			total_time[i] = 0;
 		}
@@ -1689,7 +1721,7 @@ void GodotPhysicsServer3D::flush_queries() {
 		Array values;
 		values.resize(GodotSpace3D::ELAPSED_TIME_MAX * 2);
 		for (int i = 0; i < GodotSpace3D::ELAPSED_TIME_MAX; i++) {
-			values[i * 2 + 0] = time_name[i];
+			values[i * 2 + 0] = elapsed_time_name[i];
 			values[i * 2 + 1] = USEC_TO_SEC(total_time[i]);
 		}
 		values.push_back("flush_queries");
@@ -1698,6 +1730,69 @@ void GodotPhysicsServer3D::flush_queries() {
 		values.push_front("physics_3d");
 		EngineDebugger::profiler_add_frame_data("servers", values);
 	}
+
+	if (EngineDebugger::is_profiling("physics_3d")) {
+		_add_profiler_frame();
+	}
+}
+
+void GodotPhysicsServer3D::_add_profiler_frame() {
+	static const char *shape_type_name[GodotSpace3D::NARROWPHASE_SHAPE_TYPES] = {
+		"world_boundary",
+		"separation_ray",
+		"sphere",
+		"box",
+		"capsule",
+		"cylinder",
+		"convex_polygon",
+		"concave_polygon",
+		"heightmap",
+		"soft_body",
+	};
+
+	Dictionary times;
+	for (int i = 0; i < GodotSpace3D::ELAPSED_TIME_MAX; i++) {
+		uint64_t total_time = 0;
+		for (const GodotSpace3D *E : active_spaces) {
+			total_time += E->get_elapsed_time(GodotSpace3D::ElapsedTime(i));
+		}
+		times[elapsed_time_name[i]] = USEC_TO_SEC(total_time);
+	}
+
+	Dictionary narrowphase_tests;
+	int narrowphase_test_count = 0;
+	for (int a = 0; a < GodotSpace3D::NARROWPHASE_SHAPE_TYPES; a++) {
+		for (int b = a; b < GodotSpace3D::NARROWPHASE_SHAPE_TYPES; b++) {
+			uint32_t count = 0;
+			for (const GodotSpace3D *E : active_spaces) {
+				count += E->get_narrowphase_tests(PhysicsServer3D::ShapeType(a), PhysicsServer3D::ShapeType(b));
+			}
+			if (count > 0) {
+				narrowphase_tests[String(shape_type_name[a]) + "/" + shape_type_name[b]] = count;
+				narrowphase_test_count += count;
+			}
+		}
+	}
+
+	int solver_iterations = 0;
+	for (const GodotSpace3D *E : active_spaces) {
+		solver_iterations = MAX(solver_iterations, E->get_solver_iterations() * E->get_solver_substeps());
+	}
+
+	Dictionary frame;
+	frame["times"] = times;
+	frame["collision_pairs"] = collision_pairs;
+	frame["narrowphase_tests"] = narrowphase_test_count;
+	frame["narrowphase_tests_by_shape"] = narrowphase_tests;
+	frame["islands"] = island_count;
+	frame["largest_island"] = get_process_info(INFO_LARGEST_ISLAND);
+	frame["solver_iterations"] = solver_iterations;
+	frame["active_objects"] = active_objects;
+	frame["sleeping_objects"] = get_process_info(INFO_SLEEPING_OBJECTS);
+
+	Array values;
+	values.push_back(frame);
+	EngineDebugger::profiler_add_frame_data("physics_3d", values);
 }
 
 void GodotPhysicsServer3D::end_sync() {
@@ -1719,11 +1814,47 @@ int GodotPhysicsServer3D::get_process_info(ProcessInfo p_info) {
 		case INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case INFO_SLEEPING_OBJECTS: {
+			int sleeping_objects = 0;
+			for (const GodotSpace3D *E : active_spaces) {
+				sleeping_objects += E->get_sleeping_body_count();
+			}
+			return sleeping_objects;
+		} break;
+		case INFO_LARGEST_ISLAND: {
+			int largest_island = 0;
+			for (const GodotSpace3D *E : active_spaces) {
+				largest_island = MAX(largest_island, E->get_largest_island());
+			}
+			return largest_island;
+		} break;
+		case INFO_NARROWPHASE_TESTS: {
+			int narrowphase_tests = 0;
+			for (const GodotSpace3D *E : active_spaces) {
+				for (int a = 0; a < GodotSpace3D::NARROWPHASE_SHAPE_TYPES; a++) {
+					for (int b = a; b < GodotSpace3D::NARROWPHASE_SHAPE_TYPES; b++) {
+						narrowphase_tests += E->get_narrowphase_tests(PhysicsServer3D::ShapeType(a), PhysicsServer3D::ShapeType(b));
+					}
+				}
+			}
+			return narrowphase_tests;
+		} break;
 	}
 
 	return 0;
 }
 
+void GodotPhysicsServer3D::_remove_shape_from_concurrent_states(const GodotShape3D *p_shape) {
+	List<RID> spaces;
+	space_owner.get_owned_list(&spaces);
+	for (const RID &E : spaces) {
+		GodotSpace3D *space = space_owner.get_or_null(E);
+		if (space->get_concurrent_state()->is_enabled()) {
+			space->get_concurrent_state()->remove_shape(p_shape);
+		}
+	}
+}
+
 void GodotPhysicsServer3D::_update_shapes() {
 	while (pending_shape_update_list.first()) {
 		pending_shape_update_list.first()->self()->_shape_changed();
@@ -36,6 +36,7 @@
 #include "godot_space_3d.h"
 #include "godot_step_3d.h"
 
+#include "core/os/rw_lock.h"
 #include "core/templates/rid_owner.h"
 #include "servers/physics_server_3d.h"
 
@@ -43,6 +44,7 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	GDCLASS(GodotPhysicsServer3D, PhysicsServer3D);
 
 	friend class GodotPhysicsDirectSpaceState3D;
+	friend class GodotPhysicsConcurrentSpaceState3D;
 	bool active = true;
 
 	int island_count = 0;
@@ -68,6 +70,12 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	SelfList<GodotCollisionObject3D>::List pending_shape_update_list;
 	void _update_shapes();
 
+	// Held for reading by concurrent space state queries, and for writing whenever
+	// the data they may be looking at (snapshots, shapes) is swapped out or changed.
+	RWLock concurrent_query_lock;
+	void _remove_shape_from_concurrent_states(const GodotShape3D *p_shape);
+	void _add_profiler_frame();
+
 	static GodotPhysicsServer3D *godot_singleton;
 
 public:
@@ -112,6 +120,7 @@ public:
 
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override;
+	virtual PhysicsDirectSpaceState3D *space_get_concurrent_direct_state(RID p_space) override;
 
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override;
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override;
@@ -247,6 +256,7 @@ public:
 
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) override;
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) override;
+	virtual void body_set_state_sync_bulk(RID p_body, bool p_enable) override;
 
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override;
 
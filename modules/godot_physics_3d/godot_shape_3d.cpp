@@ -1349,12 +1349,12 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
 	const BVH *params_bvh = &p_params->bvh[p_idx];
 
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
+	if (!_dequantize(*params_bvh).intersects_segment(p_params->from, p_params->to)) {
 		return;
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
+	if (params_bvh->is_leaf()) {
+		const Face *f = &p_params->faces[params_bvh->get_face_index()];
 		GodotFaceShape3D *face = p_params->face;
 		face->normal = f->normal;
 		face->vertex[0] = p_params->vertices[f->indices[0]];
@@ -1363,7 +1363,7 @@ void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_
 
 		Vector3 res;
 		Vector3 normal;
-		int face_index = params_bvh->face_index;
+		int face_index = params_bvh->get_face_index();
 		if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
 			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
 			if ((d > 0) && (d < p_params->min_d)) {
@@ -1375,12 +1375,8 @@ void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_
 			}
 		}
 	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
-		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
-		}
+		_cull_segment(p_idx + 1, p_params);
+		_cull_segment(params_bvh->get_right(), p_params);
 	}
 }
 
@@ -1432,12 +1428,14 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
 	const BVH *params_bvh = &p_params->bvh[p_idx];
 
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
-		return false;
+	for (int i = 0; i < 3; i++) {
+		if (p_params->min[i] > params_bvh->max[i] || p_params->max[i] < params_bvh->min[i]) {
+			return false;
+		}
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
+	if (params_bvh->is_leaf()) {
+		const Face *f = &p_params->faces[params_bvh->get_face_index()];
 		GodotFaceShape3D *face = p_params->face;
 		face->normal = f->normal;
 		face->vertex[0] = p_params->vertices[f->indices[0]];
@@ -1447,16 +1445,12 @@ bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
 			return true;
 		}
 	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
-				return true;
-			}
+		if (_cull(p_idx + 1, p_params)) {
+			return true;
 		}
 
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
-			}
+		if (_cull(params_bvh->get_right(), p_params)) {
+			return true;
 		}
 	}
 
@@ -1469,7 +1463,10 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 		return;
 	}
 
-	AABB local_aabb = p_local_aabb;
+	// Queries outside of the shape would be clamped onto its boundary nodes once quantized.
+	if (!p_local_aabb.intersects(get_aabb())) {
+		return;
+	}
 
 	// unlock data
 	const Face *fr = faces.ptr();
@@ -1481,7 +1478,8 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	face.invert_backface_collision = p_invert_backface_collision;
 
 	_CullParams params;
-	params.aabb = local_aabb;
+	_quantize_min(p_local_aabb.position, params.min);
+	_quantize_max(p_local_aabb.position + p_local_aabb.size, params.max);
 	params.face = &face;
 	params.faces = fr;
 	params.vertices = vr;
@@ -1584,27 +1582,27 @@ _Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int
 	return bvh;
 }
 
-void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
+void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) const {
 	int idx = p_idx;
 
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
-
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
+	// Round outwards and pad by one step, so the quantized bounds always contain the original ones.
+	BVH &node = p_bvh_array[idx];
+	_quantize_min(p_bvh_tree->aabb.position, node.min);
+	_quantize_max(p_bvh_tree->aabb.position + p_bvh_tree->aabb.size, node.max);
+	for (int i = 0; i < 3; i++) {
+		node.min[i] = node.min[i] > 0 ? node.min[i] - 1 : 0;
+		node.max[i] = node.max[i] < UINT16_MAX ? node.max[i] + 1 : UINT16_MAX;
+	}
 
+	if (p_bvh_tree->face_index >= 0) {
+		node.data = ~p_bvh_tree->face_index;
 	} else {
-		p_bvh_array[p_idx].left = -1;
-	}
+		// Branches always have both children, the left one is stored right after its parent.
+		++p_idx;
+		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
 
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
+		node.data = ++p_idx;
 		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].right = -1;
 	}
 
 	memdelete(p_bvh_tree);
@@ -1658,7 +1656,19 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 	int count = 0;
 	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
 
-	bvh.resize(count + 1);
+	bvh_origin = _aabb.position;
+	for (int i = 0; i < 3; i++) {
+		if (_aabb.size[i] > CMP_EPSILON) {
+			bvh_quantize_scale[i] = UINT16_MAX / _aabb.size[i];
+			bvh_dequantize_scale[i] = _aabb.size[i] / UINT16_MAX;
+		} else {
+			// Flat along this axis, every node shares the same bounds.
+			bvh_quantize_scale[i] = 0.0;
+			bvh_dequantize_scale[i] = 0.0;
+		}
+	}
+
+	bvh.resize(count);
 
 	BVH *bvh_arrayw2 = bvh.ptrw();
 
@@ -1982,7 +1992,7 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			r_normal = params.normal;
 			return true;
 		}
-	} else if (bounds_grid.is_empty()) {
+	} else if (bounds_pyramid.is_empty()) {
 		// Process all cells intersecting the flat projection of the ray.
 		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 	} else {
@@ -1998,8 +2008,8 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			Vector3 bounds_offset = local_origin / BOUNDS_CHUNK_SIZE;
 			// Plus 1 here to width and depth of the chunk because _intersect_grid_segment() is used by cell level as well,
 			// and in _intersect_grid_segment() the loop will exit 1 early because for cell point triangle lookup, it dose x + 1, z + 1 etc for the vertex.
-			int bounds_width = bounds_grid_width + 1;
-			int bounds_depth = bounds_grid_depth + 1;
+			int bounds_width = bounds_pyramid[0].width + 1;
+			int bounds_depth = bounds_pyramid[0].depth + 1;
 			return _intersect_grid_segment(_heightmap_chunk_cull_segment, bounds_from, bounds_to, bounds_width, bounds_depth, bounds_offset, r_point, r_normal);
 		}
 	}
@@ -2058,26 +2068,77 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
+	if (bounds_pyramid.is_empty()) {
+		_cull_cells(start_x, end_x, start_z, end_z, face, p_callback, p_userdata);
+		return;
+	}
+
+	// Skip whole regions of the terrain that are above or below the query.
+	Range height_range;
+	height_range.min = local_aabb.position.y;
+	height_range.max = local_aabb.position.y + local_aabb.size.y;
+	_cull_bounds_node(bounds_pyramid.size() - 1, 0, 0, start_x, end_x, start_z, end_z, height_range, face, p_callback, p_userdata);
+}
+
+bool GodotHeightMapShape3D::_cull_cells(int p_start_x, int p_end_x, int p_start_z, int p_end_z, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const {
+	for (int z = p_start_z; z < p_end_z; z++) {
+		for (int x = p_start_x; x < p_end_x; x++) {
 			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			_get_point(x, z, p_face.vertex[0]);
+			_get_point(x + 1, z, p_face.vertex[1]);
+			_get_point(x, z + 1, p_face.vertex[2]);
+			p_face.normal = Plane(p_face.vertex[0], p_face.vertex[1], p_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &p_face)) {
+				return true;
 			}
 
 			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			p_face.vertex[0] = p_face.vertex[1];
+			_get_point(x + 1, z + 1, p_face.vertex[1]);
+			p_face.normal = Plane(p_face.vertex[0], p_face.vertex[1], p_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &p_face)) {
+				return true;
 			}
 		}
 	}
+
+	return false;
+}
+
+bool GodotHeightMapShape3D::_cull_bounds_node(int p_level, int p_x, int p_z, int p_start_x, int p_end_x, int p_start_z, int p_end_z, const Range &p_height_range, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const {
+	const BoundsLevel &level = bounds_pyramid[p_level];
+	if (p_x >= level.width || p_z >= level.depth) {
+		return false;
+	}
+
+	const Range &range = level.ranges[p_z * level.width + p_x];
+	if (range.min > p_height_range.max || range.max < p_height_range.min) {
+		return false;
+	}
+
+	// Cells covered by this node.
+	int node_size = BOUNDS_CHUNK_SIZE << p_level;
+	int start_x = MAX(p_start_x, p_x * node_size);
+	int end_x = MIN(p_end_x, (p_x + 1) * node_size);
+	int start_z = MAX(p_start_z, p_z * node_size);
+	int end_z = MIN(p_end_z, (p_z + 1) * node_size);
+	if (start_x >= end_x || start_z >= end_z) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		return _cull_cells(start_x, end_x, start_z, end_z, p_face, p_callback, p_userdata);
+	}
+
+	for (int z = 0; z < 2; z++) {
+		for (int x = 0; x < 2; x++) {
+			if (_cull_bounds_node(p_level - 1, p_x * 2 + x, p_z * 2 + z, start_x, end_x, start_z, end_z, p_height_range, p_face, p_callback, p_userdata)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
 }
 
 Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -2090,11 +2151,73 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 			(p_mass / 3.0) * (extents.x * extents.x + extents.y * extents.y));
 }
 
+GodotHeightMapShape3D::Range GodotHeightMapShape3D::_compute_bounds_chunk(int p_chunk_x, int p_chunk_z) const {
+	int x0 = p_chunk_x * BOUNDS_CHUNK_SIZE;
+	int z0 = p_chunk_z * BOUNDS_CHUNK_SIZE;
+
+	Range r;
+
+	r.min = _get_height(x0, z0);
+	r.max = r.min;
+
+	// Compute min and max height for this chunk.
+	// We have to include one extra cell to account for neighbors.
+	// Here is why:
+	// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
+	//
+	//   Left        Right
+	// 0---0---0---1---1---1
+	// |   |   |   |   |   |
+	// 0---0---0---1---1---1
+	// |   |   |   |   |   |
+	// 0---0---0---1---1---1
+	//           x
+	//
+	// If the AABB for the Left chunk did not share vertices with the Right,
+	// then we would fail collision tests at x due to a gap.
+	//
+	int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
+	int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
+	for (int z = z0; z < z_max; ++z) {
+		for (int x = x0; x < x_max; ++x) {
+			real_t height = _get_height(x, z);
+			if (height < r.min) {
+				r.min = height;
+			} else if (height > r.max) {
+				r.max = height;
+			}
+		}
+	}
+
+	return r;
+}
+
+GodotHeightMapShape3D::Range GodotHeightMapShape3D::_compute_bounds_node(int p_level, int p_x, int p_z) const {
+	const BoundsLevel &child_level = bounds_pyramid[p_level - 1];
+
+	Range r;
+	bool first = true;
+	for (int z = p_z * 2; z < MIN(p_z * 2 + 2, child_level.depth); z++) {
+		for (int x = p_x * 2; x < MIN(p_x * 2 + 2, child_level.width); x++) {
+			const Range &child = child_level.ranges[z * child_level.width + x];
+			if (first) {
+				r = child;
+				first = false;
+			} else {
+				r.min = MIN(r.min, child.min);
+				r.max = MAX(r.max, child.max);
+			}
+		}
+	}
+
+	return r;
+}
+
 void GodotHeightMapShape3D::_build_accelerator() {
-	bounds_grid.clear();
+	bounds_pyramid.clear();
 
-	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
-	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
+	int bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
+	int bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
 
 	if (width % BOUNDS_CHUNK_SIZE > 0) {
 		++bounds_grid_width; // In case terrain size isn't dividable by chunk size.
@@ -2104,62 +2227,81 @@ void GodotHeightMapShape3D::_build_accelerator() {
 		++bounds_grid_depth;
 	}
 
-	uint32_t bound_grid_size = (uint32_t)(bounds_grid_width * bounds_grid_depth);
-
-	if (bound_grid_size < 2) {
+	if (bounds_grid_width * bounds_grid_depth < 2) {
 		// Grid is empty or just one chunk.
 		return;
 	}
 
-	bounds_grid.resize(bound_grid_size);
-
 	// Compute min and max height for all chunks.
+	BoundsLevel chunks;
+	chunks.width = bounds_grid_width;
+	chunks.depth = bounds_grid_depth;
+	chunks.ranges.resize(bounds_grid_width * bounds_grid_depth);
 	for (int cz = 0; cz < bounds_grid_depth; ++cz) {
-		int z0 = cz * BOUNDS_CHUNK_SIZE;
-
 		for (int cx = 0; cx < bounds_grid_width; ++cx) {
-			int x0 = cx * BOUNDS_CHUNK_SIZE;
-
-			Range r;
-
-			r.min = _get_height(x0, z0);
-			r.max = r.min;
-
-			// Compute min and max height for this chunk.
-			// We have to include one extra cell to account for neighbors.
-			// Here is why:
-			// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
-			//
-			//   Left        Right
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			//           x
-			//
-			// If the AABB for the Left chunk did not share vertices with the Right,
-			// then we would fail collision tests at x due to a gap.
-			//
-			int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
-			int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
-			for (int z = z0; z < z_max; ++z) {
-				for (int x = x0; x < x_max; ++x) {
-					real_t height = _get_height(x, z);
-					if (height < r.min) {
-						r.min = height;
-					} else if (height > r.max) {
-						r.max = height;
-					}
-				}
+			chunks.ranges[cx + cz * bounds_grid_width] = _compute_bounds_chunk(cx, cz);
+		}
+	}
+	bounds_pyramid.push_back(chunks);
+
+	// Merge levels until a single range covers the whole terrain.
+	while (bounds_pyramid[bounds_pyramid.size() - 1].width > 1 || bounds_pyramid[bounds_pyramid.size() - 1].depth > 1) {
+		const BoundsLevel &previous = bounds_pyramid[bounds_pyramid.size() - 1];
+
+		BoundsLevel level;
+		level.width = (previous.width + 1) / 2;
+		level.depth = (previous.depth + 1) / 2;
+		level.ranges.resize(level.width * level.depth);
+		bounds_pyramid.push_back(level);
+
+		int level_index = bounds_pyramid.size() - 1;
+		BoundsLevel &current = bounds_pyramid[level_index];
+		for (int z = 0; z < current.depth; z++) {
+			for (int x = 0; x < current.width; x++) {
+				current.ranges[z * current.width + x] = _compute_bounds_node(level_index, x, z);
 			}
+		}
+	}
+}
+
+void GodotHeightMapShape3D::_update_accelerator(const Rect2i &p_region) {
+	if (bounds_pyramid.is_empty()) {
+		return;
+	}
+
+	// Chunks share their border vertices with the previous chunk, see `_compute_bounds_chunk()`.
+	BoundsLevel &chunks = bounds_pyramid[0];
+	int begin_x = CLAMP((p_region.position.x - 1) / BOUNDS_CHUNK_SIZE, 0, chunks.width - 1);
+	int begin_z = CLAMP((p_region.position.y - 1) / BOUNDS_CHUNK_SIZE, 0, chunks.depth - 1);
+	int end_x = CLAMP((p_region.position.x + p_region.size.x - 1) / BOUNDS_CHUNK_SIZE, 0, chunks.width - 1);
+	int end_z = CLAMP((p_region.position.y + p_region.size.y - 1) / BOUNDS_CHUNK_SIZE, 0, chunks.depth - 1);
+
+	for (int cz = begin_z; cz <= end_z; ++cz) {
+		for (int cx = begin_x; cx <= end_x; ++cx) {
+			chunks.ranges[cx + cz * chunks.width] = _compute_bounds_chunk(cx, cz);
+		}
+	}
+
+	// Propagate the change up the pyramid.
+	for (uint32_t level_index = 1; level_index < bounds_pyramid.size(); level_index++) {
+		begin_x /= 2;
+		begin_z /= 2;
+		end_x /= 2;
+		end_z /= 2;
 
-			bounds_grid[cx + cz * bounds_grid_width] = r;
+		BoundsLevel &level = bounds_pyramid[level_index];
+		for (int z = begin_z; z <= end_z; z++) {
+			for (int x = begin_x; x <= end_x; x++) {
+				level.ranges[z * level.width + x] = _compute_bounds_node(level_index, x, z);
+			}
 		}
 	}
 }
 
-void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
+void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height, const Rect2i &p_region) {
+	// Only the bounds touching the changed region need to be recomputed when the size stays the same.
+	bool incremental = p_region.has_area() && p_width == width && p_depth == depth;
+
 	heights = p_heights;
 	width = p_width;
 	depth = p_depth;
@@ -2175,7 +2317,11 @@ void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width,
 
 	aabb_new.position -= local_origin;
 
-	_build_accelerator();
+	if (incremental) {
+		_update_accelerator(p_region);
+	} else {
+		_build_accelerator();
+	}
 
 	configure(aabb_new);
 }
@@ -2248,8 +2394,14 @@ void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 
 	ERR_FAIL_COND(heights_buffer.size() != (width_new * depth_new));
 
+	// If specified, only the bounds around the changed region of the heights are updated.
+	Rect2i region;
+	if (d.has("region")) {
+		region = d["region"];
+	}
+
 	// If specified, min and max height will be used as precomputed values.
-	_setup(heights_buffer, width_new, depth_new, min_height, max_height);
+	_setup(heights_buffer, width_new, depth_new, min_height, max_height, region);
 }
 
 Variant GodotHeightMapShape3D::get_data() const {
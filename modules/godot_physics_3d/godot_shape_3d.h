@@ -316,18 +316,46 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
 
+	// Nodes are stored depth-first, so the left child of a branch always follows it.
+	// Bounds are quantized to 16 bits per axis relative to the shape AABB, which keeps
+	// a node at 16 bytes (four nodes per cache line).
 	struct BVH {
-		AABB aabb;
-		int left = 0;
-		int right = 0;
-
-		int face_index = 0;
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
+		// Leaves store the bitwise complement of their face index, branches the index of their right child.
+		int32_t data = 0;
+
+		_FORCE_INLINE_ bool is_leaf() const { return data < 0; }
+		_FORCE_INLINE_ int get_face_index() const { return ~data; }
+		_FORCE_INLINE_ int get_right() const { return data; }
 	};
 
 	Vector<BVH> bvh;
+	Vector3 bvh_origin;
+	Vector3 bvh_quantize_scale;
+	Vector3 bvh_dequantize_scale;
+
+	_FORCE_INLINE_ void _quantize_min(const Vector3 &p_point, uint16_t *r_quantized) const {
+		for (int i = 0; i < 3; i++) {
+			r_quantized[i] = (uint16_t)CLAMP(Math::floor((p_point[i] - bvh_origin[i]) * bvh_quantize_scale[i]), 0, UINT16_MAX);
+		}
+	}
+
+	_FORCE_INLINE_ void _quantize_max(const Vector3 &p_point, uint16_t *r_quantized) const {
+		for (int i = 0; i < 3; i++) {
+			r_quantized[i] = (uint16_t)CLAMP(Math::ceil((p_point[i] - bvh_origin[i]) * bvh_quantize_scale[i]), 0, UINT16_MAX);
+		}
+	}
+
+	_FORCE_INLINE_ AABB _dequantize(const BVH &p_node) const {
+		Vector3 min = bvh_origin + Vector3(p_node.min[0], p_node.min[1], p_node.min[2]) * bvh_dequantize_scale;
+		Vector3 max = bvh_origin + Vector3(p_node.max[0], p_node.max[1], p_node.max[2]) * bvh_dequantize_scale;
+		return AABB(min, max - min);
+	}
 
 	struct _CullParams {
-		AABB aabb;
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
 		QueryCallback callback = nullptr;
 		void *userdata = nullptr;
 		const Face *faces = nullptr;
@@ -357,7 +385,7 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
 	bool _cull(int p_idx, _CullParams *p_params) const;
 
-	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
+	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) const;
 
 	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision);
 
@@ -394,14 +422,21 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 		real_t min = 0.0;
 		real_t max = 0.0;
 	};
-	LocalVector<Range> bounds_grid;
-	int bounds_grid_width = 0;
-	int bounds_grid_depth = 0;
+
+	// Min/max height pyramid. Level 0 holds one range per chunk of BOUNDS_CHUNK_SIZE cells,
+	// every following level merges 2x2 ranges of the previous one, down to a single range.
+	struct BoundsLevel {
+		LocalVector<Range> ranges;
+		int width = 0;
+		int depth = 0;
+	};
+	LocalVector<BoundsLevel> bounds_pyramid;
 
 	static const int BOUNDS_CHUNK_SIZE = 16;
 
 	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_x, int p_z) const {
-		return bounds_grid[(p_z * bounds_grid_width) + p_x];
+		const BoundsLevel &level = bounds_pyramid[0];
+		return level.ranges[(p_z * level.width) + p_x];
 	}
 
 	_FORCE_INLINE_ real_t _get_height(int p_x, int p_z) const {
@@ -416,12 +451,18 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 
 	void _get_cell(const Vector3 &p_point, int &r_x, int &r_y, int &r_z) const;
 
+	Range _compute_bounds_chunk(int p_chunk_x, int p_chunk_z) const;
+	Range _compute_bounds_node(int p_level, int p_x, int p_z) const;
+	bool _cull_cells(int p_start_x, int p_end_x, int p_start_z, int p_end_z, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const;
+	bool _cull_bounds_node(int p_level, int p_x, int p_z, int p_start_x, int p_end_x, int p_start_z, int p_end_z, const Range &p_height_range, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const;
+
 	void _build_accelerator();
+	void _update_accelerator(const Rect2i &p_region);
 
 	template <typename ProcessFunction>
 	bool _intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const;
 
-	void _setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height);
+	void _setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height, const Rect2i &p_region = Rect2i());
 
 public:
 	Vector<real_t> get_heights() const;
@@ -617,6 +617,277 @@ GodotPhysicsDirectSpaceState3D::GodotPhysicsDirectSpaceState3D() {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+bool GodotPhysicsConcurrentSpaceState3D::_can_collide_with(const Entry &p_entry, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) const {
+	if (!p_entry.shape || !(p_entry.collision_layer & p_collision_mask)) {
+		return false;
+	}
+
+	if (p_entry.type == GodotCollisionObject3D::TYPE_AREA) {
+		return p_collide_with_areas;
+	}
+
+	return p_collide_with_bodies;
+}
+
+void GodotPhysicsConcurrentSpaceState3D::update() {
+	back->entries.clear();
+	back->bvh.clear();
+
+	for (const GodotCollisionObject3D *col_obj : space->get_objects()) {
+		if (col_obj->get_type() == GodotCollisionObject3D::TYPE_SOFT_BODY) {
+			continue;
+		}
+
+		for (int i = 0; i < col_obj->get_shape_count(); i++) {
+			if (col_obj->is_shape_disabled(i)) {
+				continue;
+			}
+
+			Entry entry;
+			entry.rid = col_obj->get_self();
+			entry.instance_id = col_obj->get_instance_id();
+			entry.shape = col_obj->get_shape(i);
+			entry.transform = col_obj->get_transform() * col_obj->get_shape_transform(i);
+			entry.inv_transform = col_obj->get_shape_inv_transform(i) * col_obj->get_inv_transform();
+			entry.collision_layer = col_obj->get_collision_layer();
+			entry.shape_index = i;
+			entry.type = col_obj->get_type();
+			entry.ray_pickable = col_obj->is_ray_pickable();
+
+			back->bvh.insert(col_obj->get_shape_aabb(i), (void *)(uintptr_t)back->entries.size());
+			back->entries.push_back(entry);
+		}
+	}
+
+	RWLockWrite write_lock(GodotPhysicsServer3D::godot_singleton->concurrent_query_lock);
+	SWAP(front, back);
+}
+
+void GodotPhysicsConcurrentSpaceState3D::remove_shape(const GodotShape3D *p_shape) {
+	// Entries are referenced by index from the BVH, so they are only cleared.
+	for (Entry &entry : front->entries) {
+		if (entry.shape == p_shape) {
+			entry.shape = nullptr;
+		}
+	}
+}
+
+int GodotPhysicsConcurrentSpaceState3D::intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
+	RWLockRead read_lock(GodotPhysicsServer3D::godot_singleton->concurrent_query_lock);
+
+	struct Cull {
+		const Snapshot *snapshot = nullptr;
+		GodotPhysicsConcurrentSpaceState3D *state = nullptr;
+		const PointParameters *parameters = nullptr;
+		ShapeResult *results = nullptr;
+		int result_max = 0;
+		int count = 0;
+
+		bool operator()(void *p_data) {
+			const Entry &entry = snapshot->entries[(uint32_t)(uintptr_t)p_data];
+
+			if (!state->_can_collide_with(entry, parameters->collision_mask, parameters->collide_with_bodies, parameters->collide_with_areas)) {
+				return false;
+			}
+
+			if (parameters->exclude.has(entry.rid)) {
+				return false;
+			}
+
+			if (!entry.shape->intersect_point(entry.inv_transform.xform(parameters->position))) {
+				return false;
+			}
+
+			results[count].collider_id = entry.instance_id;
+			results[count].collider = entry.instance_id.is_valid() ? ObjectDB::get_instance(entry.instance_id) : nullptr;
+			results[count].rid = entry.rid;
+			results[count].shape = entry.shape_index;
+			count++;
+
+			return count >= result_max;
+		}
+	};
+
+	if (p_result_max <= 0) {
+		return 0;
+	}
+
+	Cull cull;
+	cull.snapshot = front;
+	cull.state = this;
+	cull.parameters = &p_parameters;
+	cull.results = r_results;
+	cull.result_max = p_result_max;
+	front->bvh.aabb_query(AABB(p_parameters.position, Vector3()), cull);
+
+	return cull.count;
+}
+
+bool GodotPhysicsConcurrentSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	RWLockRead read_lock(GodotPhysicsServer3D::godot_singleton->concurrent_query_lock);
+
+	struct Cull {
+		const Snapshot *snapshot = nullptr;
+		GodotPhysicsConcurrentSpaceState3D *state = nullptr;
+		const RayParameters *parameters = nullptr;
+		Vector3 normal;
+		real_t min_d = 1e10;
+		const Entry *res_entry = nullptr;
+		Vector3 res_point;
+		Vector3 res_normal;
+		int res_face_index = -1;
+
+		bool operator()(void *p_data) {
+			const Entry &entry = snapshot->entries[(uint32_t)(uintptr_t)p_data];
+
+			if (!state->_can_collide_with(entry, parameters->collision_mask, parameters->collide_with_bodies, parameters->collide_with_areas)) {
+				return false;
+			}
+
+			if (parameters->pick_ray && !entry.ray_pickable) {
+				return false;
+			}
+
+			if (parameters->exclude.has(entry.rid)) {
+				return false;
+			}
+
+			Vector3 local_from = entry.inv_transform.xform(parameters->from);
+			Vector3 local_to = entry.inv_transform.xform(parameters->to);
+
+			if (entry.shape->intersect_point(local_from)) {
+				if (parameters->hit_from_inside) {
+					// Hit shape at starting point.
+					min_d = 0;
+					res_point = parameters->from;
+					res_normal = Vector3();
+					res_face_index = -1;
+					res_entry = &entry;
+					return true;
+				}
+				// Ignore shape when starting inside.
+				return false;
+			}
+
+			Vector3 shape_point, shape_normal;
+			int shape_face_index = -1;
+
+			if (entry.shape->intersect_segment(local_from, local_to, shape_point, shape_normal, shape_face_index, parameters->hit_back_faces)) {
+				shape_point = entry.transform.xform(shape_point);
+
+				real_t ld = normal.dot(shape_point);
+
+				if (ld < min_d) {
+					min_d = ld;
+					res_point = shape_point;
+					res_normal = entry.inv_transform.basis.xform_inv(shape_normal).normalized();
+					res_face_index = shape_face_index;
+					res_entry = &entry;
+				}
+			}
+
+			return false;
+		}
+	};
+
+	Cull cull;
+	cull.snapshot = front;
+	cull.state = this;
+	cull.parameters = &p_parameters;
+	cull.normal = (p_parameters.to - p_parameters.from).normalized();
+	front->bvh.ray_query(p_parameters.from, p_parameters.to, cull);
+
+	if (!cull.res_entry) {
+		return false;
+	}
+
+	r_result.collider_id = cull.res_entry->instance_id;
+	r_result.collider = r_result.collider_id.is_valid() ? ObjectDB::get_instance(r_result.collider_id) : nullptr;
+	r_result.normal = cull.res_normal;
+	r_result.face_index = cull.res_face_index;
+	r_result.position = cull.res_point;
+	r_result.rid = cull.res_entry->rid;
+	r_result.shape = cull.res_entry->shape_index;
+
+	return true;
+}
+
+int GodotPhysicsConcurrentSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
+	if (p_result_max <= 0) {
+		return 0;
+	}
+
+	RWLockRead read_lock(GodotPhysicsServer3D::godot_singleton->concurrent_query_lock);
+
+	const GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL_V(shape, 0);
+
+	struct Cull {
+		const Snapshot *snapshot = nullptr;
+		GodotPhysicsConcurrentSpaceState3D *state = nullptr;
+		const ShapeParameters *parameters = nullptr;
+		const GodotShape3D *shape = nullptr;
+		ShapeResult *results = nullptr;
+		int result_max = 0;
+		int count = 0;
+
+		bool operator()(void *p_data) {
+			const Entry &entry = snapshot->entries[(uint32_t)(uintptr_t)p_data];
+
+			if (!state->_can_collide_with(entry, parameters->collision_mask, parameters->collide_with_bodies, parameters->collide_with_areas)) {
+				return false;
+			}
+
+			if (parameters->exclude.has(entry.rid)) {
+				return false;
+			}
+
+			if (!GodotCollisionSolver3D::solve_static(shape, parameters->transform, entry.shape, entry.transform, nullptr, nullptr, nullptr, parameters->margin, 0)) {
+				return false;
+			}
+
+			if (results) {
+				results[count].collider_id = entry.instance_id;
+				results[count].collider = entry.instance_id.is_valid() ? ObjectDB::get_instance(entry.instance_id) : nullptr;
+				results[count].rid = entry.rid;
+				results[count].shape = entry.shape_index;
+			}
+			count++;
+
+			return count >= result_max;
+		}
+	};
+
+	Cull cull;
+	cull.snapshot = front;
+	cull.state = this;
+	cull.parameters = &p_parameters;
+	cull.shape = shape;
+	cull.results = r_results;
+	cull.result_max = p_result_max;
+	front->bvh.aabb_query(p_parameters.transform.xform(shape->get_aabb()).grow(p_parameters.margin), cull);
+
+	return cull.count;
+}
+
+bool GodotPhysicsConcurrentSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
+	ERR_FAIL_V_MSG(false, "cast_motion() is not supported on concurrent space states, use the direct space state instead.");
+}
+
+bool GodotPhysicsConcurrentSpaceState3D::collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) {
+	ERR_FAIL_V_MSG(false, "collide_shape() is not supported on concurrent space states, use the direct space state instead.");
+}
+
+bool GodotPhysicsConcurrentSpaceState3D::rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) {
+	ERR_FAIL_V_MSG(false, "rest_info() is not supported on concurrent space states, use the direct space state instead.");
+}
+
+Vector3 GodotPhysicsConcurrentSpaceState3D::get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const {
+	ERR_FAIL_V_MSG(Vector3(), "get_closest_point_to_object_volume() is not supported on concurrent space states, use the direct space state instead.");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 int GodotSpace3D::_cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb) {
 	int amount = broadphase->cull_aabb(p_aabb, intersection_query_results, INTERSECTION_QUERY_MAX, intersection_query_subindex_results);
 
@@ -1164,10 +1435,18 @@ void GodotSpace3D::soft_body_remove_from_active_list(SelfList<GodotSoftBody3D> *
 }
 
 void GodotSpace3D::call_queries() {
+	PhysicsServer3D::BodyStateSyncBulkCallback bulk_callback = PhysicsServer3D::get_body_state_sync_bulk_callback();
+
 	while (state_query_list.first()) {
 		GodotBody3D *b = state_query_list.first()->self();
 		state_query_list.remove(state_query_list.first());
-		b->call_queries();
+		b->call_queries((bulk_callback && b->is_state_sync_bulk()) ? &bulk_state_sync_buffer : nullptr);
+	}
+
+	if (!bulk_state_sync_buffer.is_empty()) {
+		// Sleeping bodies never reach the query list, so this only holds what moved this step.
+		bulk_callback(bulk_state_sync_buffer.ptr(), bulk_state_sync_buffer.size());
+		bulk_state_sync_buffer.clear();
 	}
 
 	while (monitor_query_list.first()) {
@@ -1215,6 +1494,9 @@ void GodotSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, real_t p_v
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS:
 			solver_iterations = p_value;
 			break;
+		case PhysicsServer3D::SPACE_PARAM_SOLVER_SUBSTEPS:
+			solver_substeps = MAX(1, (int)p_value);
+			break;
 	}
 }
 
@@ -1236,10 +1518,18 @@ real_t GodotSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
 			return body_time_to_sleep;
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS:
 			return solver_iterations;
+		case PhysicsServer3D::SPACE_PARAM_SOLVER_SUBSTEPS:
+			return solver_substeps;
 	}
 	return 0;
 }
 
+void GodotSpace3D::reset_step_statistics() {
+	memset(elapsed_time, 0, sizeof(elapsed_time));
+	memset(narrowphase_tests, 0, sizeof(narrowphase_tests));
+	largest_island = 0;
+}
+
 void GodotSpace3D::lock() {
 	locked = true;
 }
@@ -1261,6 +1551,7 @@ GodotSpace3D::GodotSpace3D() {
 	body_angular_velocity_sleep_threshold = GLOBAL_GET("physics/3d/sleep_threshold_angular");
 	body_time_to_sleep = GLOBAL_GET("physics/3d/time_before_sleep");
 	solver_iterations = GLOBAL_GET("physics/3d/solver/solver_iterations");
+	solver_substeps = MAX(1, (int)GLOBAL_GET("physics/3d/solver/solver_substeps"));
 	contact_recycle_radius = GLOBAL_GET("physics/3d/solver/contact_recycle_radius");
 	contact_max_separation = GLOBAL_GET("physics/3d/solver/contact_max_separation");
 	contact_max_allowed_penetration = GLOBAL_GET("physics/3d/solver/contact_max_allowed_penetration");
@@ -1272,9 +1563,13 @@ GodotSpace3D::GodotSpace3D() {
 
 	direct_access = memnew(GodotPhysicsDirectSpaceState3D);
 	direct_access->space = this;
+
+	concurrent_access = memnew(GodotPhysicsConcurrentSpaceState3D);
+	concurrent_access->space = this;
 }
 
 GodotSpace3D::~GodotSpace3D() {
 	memdelete(broadphase);
 	memdelete(direct_access);
+	memdelete(concurrent_access);
 }
@@ -37,6 +37,9 @@
 #include "godot_collision_object_3d.h"
 #include "godot_soft_body_3d.h"
 
+#include "core/math/dynamic_bvh.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "core/typedefs.h"
 
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
@@ -56,10 +59,63 @@ public:
 	GodotPhysicsDirectSpaceState3D();
 };
 
+// Read-only view of the space as it was at the end of the last step, which can be
+// queried from any thread while the next step is being simulated. Shapes are double
+// buffered into a private BVH, so queries never touch the live broadphase.
+// Soft bodies are not part of the snapshot, since their shape is rewritten every step.
+class GodotPhysicsConcurrentSpaceState3D : public PhysicsDirectSpaceState3D {
+	GDCLASS(GodotPhysicsConcurrentSpaceState3D, PhysicsDirectSpaceState3D);
+
+	struct Entry {
+		RID rid;
+		ObjectID instance_id;
+		const GodotShape3D *shape = nullptr;
+		Transform3D transform;
+		Transform3D inv_transform;
+		uint32_t collision_layer = 0;
+		int shape_index = 0;
+		GodotCollisionObject3D::Type type = GodotCollisionObject3D::TYPE_BODY;
+		bool ray_pickable = false;
+	};
+
+	struct Snapshot {
+		LocalVector<Entry> entries;
+		DynamicBVH bvh;
+	};
+
+	Snapshot snapshots[2];
+	Snapshot *front = &snapshots[0];
+	Snapshot *back = &snapshots[1];
+
+	SafeFlag enabled;
+
+	_FORCE_INLINE_ bool _can_collide_with(const Entry &p_entry, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) const;
+
+public:
+	GodotSpace3D *space = nullptr;
+
+	void set_enabled(bool p_enabled) { enabled.set_to(p_enabled); }
+	bool is_enabled() const { return enabled.is_set(); }
+
+	// Called from the physics thread, after the space has been stepped.
+	void update();
+	// Drops the entries of a freed shape from the current snapshot. Callers must hold the server's concurrent query lock for writing.
+	void remove_shape(const GodotShape3D *p_shape);
+
+	virtual int intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
+	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) override;
+	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
+	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info = nullptr) override;
+	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) override;
+	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
+	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const override;
+};
+
 class GodotSpace3D {
 public:
 	enum ElapsedTime {
 		ELAPSED_TIME_INTEGRATE_FORCES,
+		ELAPSED_TIME_BROADPHASE,
 		ELAPSED_TIME_GENERATE_ISLANDS,
 		ELAPSED_TIME_SETUP_CONSTRAINTS,
 		ELAPSED_TIME_SOLVE_CONSTRAINTS,
@@ -68,10 +124,18 @@ public:
 
 	};
 
+	// Custom shapes are not supported, so they can be used as the size.
+	static const int NARROWPHASE_SHAPE_TYPES = PhysicsServer3D::SHAPE_CUSTOM;
+
 private:
+	// Step statistics, accumulated over the sub-steps of a physics tick.
 	uint64_t elapsed_time[ELAPSED_TIME_MAX] = {};
+	uint32_t narrowphase_tests[NARROWPHASE_SHAPE_TYPES][NARROWPHASE_SHAPE_TYPES] = {};
+	int largest_island = 0;
+	int sleeping_body_count = 0;
 
 	GodotPhysicsDirectSpaceState3D *direct_access = nullptr;
+	GodotPhysicsConcurrentSpaceState3D *concurrent_access = nullptr;
 	RID self;
 
 	GodotBroadPhase3D *broadphase = nullptr;
@@ -82,6 +146,8 @@ private:
 	SelfList<GodotArea3D>::List area_moved_list;
 	SelfList<GodotSoftBody3D>::List active_soft_body_list;
 
+	LocalVector<PhysicsServer3D::BodyStateSync> bulk_state_sync_buffer;
+
 	static void *_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_data, void *p_self);
 
@@ -90,6 +156,7 @@ private:
 	GodotArea3D *area = nullptr;
 
 	int solver_iterations = 0;
+	int solver_substeps = 1;
 
 	real_t contact_recycle_radius = 0.0;
 	real_t contact_max_separation = 0.0;
@@ -157,6 +224,7 @@ public:
 	const HashSet<GodotCollisionObject3D *> &get_objects() const;
 
 	_FORCE_INLINE_ int get_solver_iterations() const { return solver_iterations; }
+	_FORCE_INLINE_ int get_solver_substeps() const { return solver_substeps; }
 	_FORCE_INLINE_ real_t get_contact_recycle_radius() const { return contact_recycle_radius; }
 	_FORCE_INLINE_ real_t get_contact_max_separation() const { return contact_max_separation; }
 	_FORCE_INLINE_ real_t get_contact_max_allowed_penetration() const { return contact_max_allowed_penetration; }
@@ -188,6 +256,7 @@ public:
 	int get_collision_pairs() const { return collision_pairs; }
 
 	GodotPhysicsDirectSpaceState3D *get_direct_state();
+	GodotPhysicsConcurrentSpaceState3D *get_concurrent_state() const { return concurrent_access; }
 
 	void set_debug_contacts(int p_amount) { contact_debug.resize(p_amount); }
 	_FORCE_INLINE_ bool is_debugging_contacts() const { return !contact_debug.is_empty(); }
@@ -202,9 +271,26 @@ public:
 	void set_static_global_body(RID p_body) { static_global_body = p_body; }
 	RID get_static_global_body() { return static_global_body; }
 
-	void set_elapsed_time(ElapsedTime p_time, uint64_t p_msec) { elapsed_time[p_time] = p_msec; }
+	void add_elapsed_time(ElapsedTime p_time, uint64_t p_usec) { elapsed_time[p_time] += p_usec; }
 	uint64_t get_elapsed_time(ElapsedTime p_time) const { return elapsed_time[p_time]; }
 
+	void add_narrowphase_test(PhysicsServer3D::ShapeType p_type_A, PhysicsServer3D::ShapeType p_type_B) {
+		// Count both orders in the same bucket.
+		if (p_type_A > p_type_B) {
+			SWAP(p_type_A, p_type_B);
+		}
+		narrowphase_tests[p_type_A][p_type_B]++;
+	}
+	uint32_t get_narrowphase_tests(PhysicsServer3D::ShapeType p_type_A, PhysicsServer3D::ShapeType p_type_B) const { return narrowphase_tests[p_type_A][p_type_B]; }
+
+	void set_largest_island(int p_size) { largest_island = MAX(largest_island, p_size); }
+	int get_largest_island() const { return largest_island; }
+
+	void add_sleeping_body_count(int p_delta) { sleeping_body_count += p_delta; }
+	int get_sleeping_body_count() const { return sleeping_body_count; }
+
+	void reset_step_statistics();
+
 	bool test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result);
 
 	GodotSpace3D();
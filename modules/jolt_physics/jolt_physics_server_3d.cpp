@@ -36,6 +36,7 @@
 #include "joints/jolt_joint_3d.h"
 #include "joints/jolt_pin_joint_3d.h"
 #include "joints/jolt_slider_joint_3d.h"
+#include "jolt_project_settings.h"
 #include "objects/jolt_area_3d.h"
 #include "objects/jolt_body_3d.h"
 #include "objects/jolt_soft_body_3d.h"
@@ -53,6 +54,9 @@
 #include "spaces/jolt_physics_direct_space_state_3d.h"
 #include "spaces/jolt_space_3d.h"
 
+#include "core/debugger/engine_debugger.h"
+#include "core/os/os.h"
+
 JoltPhysicsServer3D::JoltPhysicsServer3D(bool p_on_separate_thread) :
 		on_separate_thread(p_on_separate_thread) {
 	singleton = this;
@@ -236,6 +240,12 @@ PhysicsDirectSpaceState3D *JoltPhysicsServer3D::space_get_direct_state(RID p_spa
 	return space->get_direct_state();
 }
 
+PhysicsDirectSpaceState3D *JoltPhysicsServer3D::space_get_concurrent_direct_state(RID p_space) {
+	// Jolt doesn't allow narrow phase queries while `PhysicsSystem::Update` is running.
+	WARN_PRINT_ONCE("Concurrent space states are not supported by Jolt Physics. Use the direct space state instead.");
+	return nullptr;
+}
+
 void JoltPhysicsServer3D::space_set_debug_contacts(RID p_space, int p_max_contacts) {
 #ifdef DEBUG_ENABLED
 	JoltSpace3D *space = space_owner.get_or_null(p_space);
@@ -920,6 +930,13 @@ void JoltPhysicsServer3D::body_set_force_integration_callback(RID p_body, const
 	body->set_custom_integration_callback(p_callable, p_userdata);
 }
 
+void JoltPhysicsServer3D::body_set_state_sync_bulk(RID p_body, bool p_enable) {
+	JoltBody3D *body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+
+	body->set_state_sync_bulk(p_enable);
+}
+
 void JoltPhysicsServer3D::body_set_ray_pickable(RID p_body, bool p_enable) {
 	JoltBody3D *body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
@@ -1600,12 +1617,18 @@ void JoltPhysicsServer3D::flush_queries() {
 
 	flushing_queries = true;
 
+	uint64_t time_beg = OS::get_singleton()->get_ticks_usec();
+
 	for (JoltSpace3D *space : active_spaces) {
 		space->call_queries();
 	}
 
 	flushing_queries = false;
 
+	if (EngineDebugger::is_profiling("servers") || EngineDebugger::is_profiling("physics_3d")) {
+		_add_profiler_frame(OS::get_singleton()->get_ticks_usec() - time_beg);
+	}
+
 #ifdef DEBUG_ENABLED
 	job_system->flush_timings();
 #endif
@@ -1616,7 +1639,75 @@ bool JoltPhysicsServer3D::is_flushing_queries() const {
 }
 
 int JoltPhysicsServer3D::get_process_info(ProcessInfo p_process_info) {
-	return 0;
+	int result = 0;
+
+	for (const JoltSpace3D *space : active_spaces) {
+		switch (p_process_info) {
+			case INFO_ACTIVE_OBJECTS: {
+				const JPH::BodyManager::BodyStats stats = space->get_body_stats();
+				result += stats.mNumActiveBodiesDynamic + stats.mNumActiveBodiesKinematic;
+			} break;
+			case INFO_COLLISION_PAIRS: {
+				result += space->get_contact_pair_count();
+			} break;
+			case INFO_SLEEPING_OBJECTS: {
+				const JPH::BodyManager::BodyStats stats = space->get_body_stats();
+				result += (stats.mNumBodiesDynamic - stats.mNumActiveBodiesDynamic) + (stats.mNumBodiesKinematic - stats.mNumActiveBodiesKinematic);
+			} break;
+			default: {
+				// Islands and narrowphase tests are internal to Jolt and not reported.
+			} break;
+		}
+	}
+
+	return result;
+}
+
+void JoltPhysicsServer3D::_add_profiler_frame(uint64_t p_flush_queries_time) {
+	uint64_t pre_step_time = 0;
+	uint64_t simulation_time = 0;
+	uint64_t post_step_time = 0;
+	int solver_iterations = 0;
+
+	for (const JoltSpace3D *space : active_spaces) {
+		pre_step_time += space->get_pre_step_time();
+		simulation_time += space->get_simulation_time();
+		post_step_time += space->get_post_step_time();
+		solver_iterations = MAX(solver_iterations, JoltProjectSettings::get_simulation_velocity_steps() * space->get_collision_steps());
+	}
+
+	if (EngineDebugger::is_profiling("servers")) {
+		Array values;
+		values.push_back("physics_3d");
+		values.push_back("pre_step");
+		values.push_back(USEC_TO_SEC(pre_step_time));
+		values.push_back("simulation");
+		values.push_back(USEC_TO_SEC(simulation_time));
+		values.push_back("post_step");
+		values.push_back(USEC_TO_SEC(post_step_time));
+		values.push_back("flush_queries");
+		values.push_back(USEC_TO_SEC(p_flush_queries_time));
+		EngineDebugger::profiler_add_frame_data("servers", values);
+	}
+
+	if (EngineDebugger::is_profiling("physics_3d")) {
+		Dictionary times;
+		times["pre_step"] = USEC_TO_SEC(pre_step_time);
+		times["simulation"] = USEC_TO_SEC(simulation_time);
+		times["post_step"] = USEC_TO_SEC(post_step_time);
+
+		// Jolt does not expose its broadphase, narrowphase and island statistics outside of its own profiler.
+		Dictionary frame;
+		frame["times"] = times;
+		frame["collision_pairs"] = get_process_info(INFO_COLLISION_PAIRS);
+		frame["solver_iterations"] = solver_iterations;
+		frame["active_objects"] = get_process_info(INFO_ACTIVE_OBJECTS);
+		frame["sleeping_objects"] = get_process_info(INFO_SLEEPING_OBJECTS);
+
+		Array values;
+		values.push_back(frame);
+		EngineDebugger::profiler_add_frame_data("physics_3d", values);
+	}
 }
 
 void JoltPhysicsServer3D::free_space(JoltSpace3D *p_space) {
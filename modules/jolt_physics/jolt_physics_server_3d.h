@@ -63,6 +63,8 @@ class JoltPhysicsServer3D final : public PhysicsServer3D {
 	bool flushing_queries = false;
 	bool doing_sync = false;
 
+	void _add_profiler_frame(uint64_t p_flush_queries_time);
+
 public:
 	enum HingeJointParamJolt {
 		HINGE_JOINT_LIMIT_SPRING_FREQUENCY = 100,
@@ -158,6 +160,7 @@ public:
 	virtual real_t space_get_param(RID p_space, PhysicsServer3D::SpaceParameter p_param) const override;
 
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override;
+	virtual PhysicsDirectSpaceState3D *space_get_concurrent_direct_state(RID p_space) override;
 
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override;
 	virtual PackedVector3Array space_get_contacts(RID p_space) const override;
@@ -292,6 +295,7 @@ public:
 
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) override;
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_userdata) override;
+	virtual void body_set_state_sync_bulk(RID p_body, bool p_enable) override;
 
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override;
 
@@ -1185,7 +1185,7 @@ void JoltBody3D::remove_joint(JoltJoint3D *p_joint) {
 	_joints_changed();
 }
 
-void JoltBody3D::call_queries() {
+void JoltBody3D::call_queries(LocalVector<PhysicsServer3D::BodyStateSync> *r_bulk_states) {
 	if (custom_integration_callback.is_valid()) {
 		const Variant direct_state_variant = get_direct_state();
 		const Variant *args[2] = { &direct_state_variant, &custom_integration_userdata };
@@ -1200,7 +1200,17 @@ void JoltBody3D::call_queries() {
 		}
 	}
 
-	if (state_sync_callback.is_valid()) {
+	if (r_bulk_states != nullptr) {
+		PhysicsServer3D::BodyStateSync state;
+		state.instance_id = get_instance_id();
+		state.transform = get_transform_scaled();
+		state.linear_velocity = get_linear_velocity();
+		state.angular_velocity = get_angular_velocity();
+		state.inverse_inertia_tensor = get_inverse_inertia_tensor();
+		state.contact_count = get_contact_count();
+		state.sleeping = is_sleeping();
+		r_bulk_states->push_back(state);
+	} else if (state_sync_callback.is_valid()) {
 		const Variant direct_state_variant = get_direct_state();
 		const Variant *args[1] = { &direct_state_variant };
 
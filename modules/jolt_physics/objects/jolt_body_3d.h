@@ -102,6 +102,7 @@ private:
 	bool sleep_initially = false;
 	bool custom_center_of_mass = false;
 	bool custom_integrator = false;
+	bool state_sync_bulk = false;
 
 	virtual JPH::BroadPhaseLayer _get_broad_phase_layer() const override;
 	virtual JPH::ObjectLayer _get_object_layer() const override;
@@ -110,7 +111,7 @@ private:
 
 	virtual void _add_to_space() override;
 
-	bool _should_call_queries() const { return state_sync_callback.is_valid() || custom_integration_callback.is_valid(); }
+	bool _should_call_queries() const { return state_sync_bulk || state_sync_callback.is_valid() || custom_integration_callback.is_valid(); }
 	void _enqueue_call_queries();
 	void _dequeue_call_queries();
 
@@ -164,6 +165,9 @@ public:
 	bool has_state_sync_callback() const { return state_sync_callback.is_valid(); }
 	void set_state_sync_callback(const Callable &p_callback) { state_sync_callback = p_callback; }
 
+	bool is_state_sync_bulk() const { return state_sync_bulk; }
+	void set_state_sync_bulk(bool p_enable) { state_sync_bulk = p_enable; }
+
 	bool has_custom_integration_callback() const { return custom_integration_callback.is_valid(); }
 	void set_custom_integration_callback(const Callable &p_callback, const Variant &p_userdata) {
 		custom_integration_callback = p_callback;
@@ -243,7 +247,7 @@ public:
 	void add_joint(JoltJoint3D *p_joint);
 	void remove_joint(JoltJoint3D *p_joint);
 
-	void call_queries();
+	void call_queries(LocalVector<PhysicsServer3D::BodyStateSync> *r_bulk_states = nullptr);
 
 	virtual void pre_step(float p_step, JPH::Body &p_jolt_body) override;
 
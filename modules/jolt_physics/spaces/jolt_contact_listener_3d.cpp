@@ -41,6 +41,8 @@
 #include "Jolt/Physics/SoftBody/SoftBodyManifold.h"
 
 void JoltContactListener3D::OnContactAdded(const JPH::Body &p_body1, const JPH::Body &p_body2, const JPH::ContactManifold &p_manifold, JPH::ContactSettings &p_settings) {
+	contact_pair_count.fetch_add(1, std::memory_order_relaxed);
+
 	_try_override_collision_response(p_body1, p_body2, p_settings);
 	_try_apply_surface_velocities(p_body1, p_body2, p_settings);
 	_try_add_contacts(p_body1, p_body2, p_manifold, p_settings);
@@ -52,6 +54,8 @@ void JoltContactListener3D::OnContactAdded(const JPH::Body &p_body1, const JPH::
 }
 
 void JoltContactListener3D::OnContactPersisted(const JPH::Body &p_body1, const JPH::Body &p_body2, const JPH::ContactManifold &p_manifold, JPH::ContactSettings &p_settings) {
+	contact_pair_count.fetch_add(1, std::memory_order_relaxed);
+
 	_try_override_collision_response(p_body1, p_body2, p_settings);
 	_try_apply_surface_velocities(p_body1, p_body2, p_settings);
 	_try_add_contacts(p_body1, p_body2, p_manifold, p_settings);
@@ -72,6 +76,11 @@ void JoltContactListener3D::OnContactRemoved(const JPH::SubShapeIDPair &p_shape_
 	}
 }
 
+void JoltContactListener3D::OnStep(const JPH::PhysicsStepListenerContext &p_context) {
+	// Contacts are reported again for every collision step, so only the pairs of the last step are counted.
+	contact_pair_count.store(0, std::memory_order_relaxed);
+}
+
 JPH::SoftBodyValidateResult JoltContactListener3D::OnSoftBodyContactValidate(const JPH::Body &p_soft_body, const JPH::Body &p_other_body, JPH::SoftBodyContactSettings &p_settings) {
 	_try_override_collision_response(p_soft_body, p_other_body, p_settings);
 
@@ -527,6 +536,8 @@ void JoltContactListener3D::_flush_area_exits() {
 }
 
 void JoltContactListener3D::pre_step() {
+	contact_pair_count.store(0, std::memory_order_relaxed);
+
 #ifdef DEBUG_ENABLED
 	debug_contact_count = 0;
 #endif
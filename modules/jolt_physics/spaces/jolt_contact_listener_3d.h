@@ -42,6 +42,7 @@
 
 #include "Jolt/Physics/Body/Body.h"
 #include "Jolt/Physics/Collision/ContactListener.h"
+#include "Jolt/Physics/PhysicsStepListener.h"
 #include "Jolt/Physics/SoftBody/SoftBodyContactListener.h"
 
 #include <stdint.h>
@@ -52,7 +53,8 @@ class JoltSpace3D;
 
 class JoltContactListener3D final
 		: public JPH::ContactListener,
-		  public JPH::SoftBodyContactListener {
+		  public JPH::SoftBodyContactListener,
+		  public JPH::PhysicsStepListener {
 	struct BodyIDHasher {
 		static uint32_t hash(const JPH::BodyID &p_id) { return hash_fmix32(p_id.GetIndexAndSequenceNumber()); }
 	};
@@ -91,6 +93,8 @@ class JoltContactListener3D final
 	Mutex write_mutex;
 	JoltSpace3D *space = nullptr;
 
+	std::atomic_int contact_pair_count = 0;
+
 #ifdef DEBUG_ENABLED
 	PackedVector3Array debug_contacts;
 	std::atomic_int debug_contact_count = 0;
@@ -100,6 +104,8 @@ class JoltContactListener3D final
 	virtual void OnContactPersisted(const JPH::Body &p_body1, const JPH::Body &p_body2, const JPH::ContactManifold &p_manifold, JPH::ContactSettings &p_settings) override;
 	virtual void OnContactRemoved(const JPH::SubShapeIDPair &p_shape_pair) override;
 
+	virtual void OnStep(const JPH::PhysicsStepListenerContext &p_context) override;
+
 	virtual JPH::SoftBodyValidateResult OnSoftBodyContactValidate(const JPH::Body &p_soft_body, const JPH::Body &p_other_body, JPH::SoftBodyContactSettings &p_settings) override;
 
 #ifdef DEBUG_ENABLED
@@ -131,6 +137,8 @@ public:
 	void pre_step();
 	void post_step();
 
+	int get_contact_pair_count() const { return contact_pair_count.load(std::memory_order_relaxed); }
+
 #ifdef DEBUG_ENABLED
 	const PackedVector3Array &get_debug_contacts() const { return debug_contacts; }
 	int get_debug_contact_count() const { return debug_contact_count.load(std::memory_order_acquire); }
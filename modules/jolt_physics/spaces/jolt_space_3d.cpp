@@ -43,7 +43,9 @@
 #include "jolt_physics_direct_space_state_3d.h"
 #include "jolt_temp_allocator.h"
 
+#include "core/config/project_settings.h"
 #include "core/io/file_access.h"
+#include "core/os/os.h"
 #include "core/os/time.h"
 #include "core/string/print_string.h"
 #include "core/variant/variant_utility.h"
@@ -118,8 +120,11 @@ JoltSpace3D::JoltSpace3D(JPH::JobSystem *p_job_system) :
 
 	physics_system->SetPhysicsSettings(settings);
 	physics_system->SetGravity(JPH::Vec3::sZero());
+
+	collision_steps = MAX(1, (int)GLOBAL_GET("physics/3d/solver/solver_substeps"));
 	physics_system->SetContactListener(contact_listener);
 	physics_system->SetSoftBodyContactListener(contact_listener);
+	physics_system->AddStepListener(contact_listener);
 
 	physics_system->SetCombineFriction([](const JPH::Body &p_body1, const JPH::SubShapeID &p_sub_shape_id1, const JPH::Body &p_body2, const JPH::SubShapeID &p_sub_shape_id2) {
 		return ABS(MIN(p_body1.GetFriction(), p_body2.GetFriction()));
@@ -161,9 +166,19 @@ void JoltSpace3D::step(float p_step) {
 	stepping = true;
 	last_step = p_step;
 
+	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
+
 	_pre_step(p_step);
 
-	const JPH::EPhysicsUpdateError update_error = physics_system->Update(p_step, 1, temp_allocator, job_system);
+	uint64_t profile_endtime = OS::get_singleton()->get_ticks_usec();
+	pre_step_time = profile_endtime - profile_begtime;
+	profile_begtime = profile_endtime;
+
+	const JPH::EPhysicsUpdateError update_error = physics_system->Update(p_step, collision_steps, temp_allocator, job_system);
+
+	profile_endtime = OS::get_singleton()->get_ticks_usec();
+	simulation_time = profile_endtime - profile_begtime;
+	profile_begtime = profile_endtime;
 
 	if ((update_error & JPH::EPhysicsUpdateError::ManifoldCacheFull) != JPH::EPhysicsUpdateError::None) {
 		WARN_PRINT_ONCE(vformat("Jolt Physics manifold cache exceeded capacity and contacts were ignored. "
@@ -188,15 +203,33 @@ void JoltSpace3D::step(float p_step) {
 
 	_post_step(p_step);
 
+	post_step_time = OS::get_singleton()->get_ticks_usec() - profile_begtime;
+
 	bodies_added_since_optimizing = 0;
 	stepping = false;
 }
 
+int JoltSpace3D::get_contact_pair_count() const {
+	return contact_listener->get_contact_pair_count();
+}
+
+JPH::BodyManager::BodyStats JoltSpace3D::get_body_stats() const {
+	return physics_system->GetBodyStats();
+}
+
 void JoltSpace3D::call_queries() {
+	const PhysicsServer3D::BodyStateSyncBulkCallback bulk_callback = PhysicsServer3D::get_body_state_sync_bulk_callback();
+
 	while (body_call_queries_list.first()) {
 		JoltBody3D *body = body_call_queries_list.first()->self();
 		body_call_queries_list.remove(body_call_queries_list.first());
-		body->call_queries();
+		body->call_queries((bulk_callback != nullptr && body->is_state_sync_bulk()) ? &bulk_state_sync_buffer : nullptr);
+	}
+
+	if (!bulk_state_sync_buffer.is_empty()) {
+		// Only active bodies get queued in `_pre_step`, so sleeping islands are never part of this.
+		bulk_callback(bulk_state_sync_buffer.ptr(), bulk_state_sync_buffer.size());
+		bulk_state_sync_buffer.clear();
 	}
 
 	while (area_call_queries_list.first()) {
@@ -232,6 +265,9 @@ double JoltSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS: {
 			return DEFAULT_SOLVER_ITERATIONS;
 		}
+		case PhysicsServer3D::SPACE_PARAM_SOLVER_SUBSTEPS: {
+			return collision_steps;
+		}
 		default: {
 			ERR_FAIL_V_MSG(0.0, vformat("Unhandled space parameter: '%d'. This should not happen. Please report this.", p_param));
 		}
@@ -264,6 +300,9 @@ void JoltSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, double p_va
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS: {
 			WARN_PRINT("Space-specific solver iterations is not supported when using Jolt Physics. Any such value will be ignored.");
 		} break;
+		case PhysicsServer3D::SPACE_PARAM_SOLVER_SUBSTEPS: {
+			collision_steps = MAX(1, (int)p_value);
+		} break;
 		default: {
 			ERR_FAIL_MSG(vformat("Unhandled space parameter: '%d'. This should not happen. Please report this.", p_param));
 		} break;
@@ -33,6 +33,7 @@
 
 #include "jolt_body_accessor_3d.h"
 
+#include "core/templates/local_vector.h"
 #include "servers/physics_server_3d.h"
 
 #include "Jolt/Jolt.h"
@@ -62,6 +63,8 @@ class JoltSpace3D {
 	SelfList<JoltShapedObject3D>::List shapes_changed_list;
 	SelfList<JoltShapedObject3D>::List needs_optimization_list;
 
+	LocalVector<PhysicsServer3D::BodyStateSync> bulk_state_sync_buffer;
+
 	RID rid;
 
 	JPH::JobSystem *job_system = nullptr;
@@ -75,6 +78,11 @@ class JoltSpace3D {
 	float last_step = 0.0f;
 
 	int bodies_added_since_optimizing = 0;
+	int collision_steps = 1;
+
+	uint64_t pre_step_time = 0;
+	uint64_t simulation_time = 0;
+	uint64_t post_step_time = 0;
 
 	bool active = false;
 	bool stepping = false;
@@ -131,6 +139,15 @@ public:
 
 	float get_last_step() const { return last_step; }
 
+	// Timings of the last step, in microseconds.
+	uint64_t get_pre_step_time() const { return pre_step_time; }
+	uint64_t get_simulation_time() const { return simulation_time; }
+	uint64_t get_post_step_time() const { return post_step_time; }
+
+	int get_collision_steps() const { return collision_steps; }
+	int get_contact_pair_count() const;
+	JPH::BodyManager::BodyStats get_body_stats() const;
+
 	JPH::BodyID add_rigid_body(const JoltObject3D &p_object, const JPH::BodyCreationSettings &p_settings, bool p_sleeping = false);
 	JPH::BodyID add_soft_body(const JoltObject3D &p_object, const JPH::SoftBodyCreationSettings &p_settings, bool p_sleeping = false);
 
@@ -481,6 +481,25 @@ Vector<Vector2> GodotNavigationServer2D::obstacle_get_vertices(RID p_obstacle) c
 	return vector_v3_to_v2(NavigationServer3D::get_singleton()->obstacle_get_vertices(p_obstacle));
 }
 
+RID FORWARD_0(flow_field_create);
+void FORWARD_2(flow_field_set_map, RID, p_flow_field, RID, p_map, rid_to_rid, rid_to_rid);
+RID FORWARD_1_C(flow_field_get_map, RID, p_flow_field, rid_to_rid);
+void GodotNavigationServer2D::flow_field_set_targets(RID p_flow_field, const Vector<Vector2> &p_targets) {
+	NavigationServer3D::get_singleton()->flow_field_set_targets(p_flow_field, vector_v2_to_v3(p_targets));
+}
+Vector<Vector2> GodotNavigationServer2D::flow_field_get_targets(RID p_flow_field) const {
+	return vector_v3_to_v2(NavigationServer3D::get_singleton()->flow_field_get_targets(p_flow_field));
+}
+void FORWARD_2(flow_field_set_navigation_layers, RID, p_flow_field, uint32_t, p_navigation_layers, rid_to_rid, uint32_to_uint32);
+uint32_t FORWARD_1_C(flow_field_get_navigation_layers, RID, p_flow_field, rid_to_rid);
+Vector2 GodotNavigationServer2D::flow_field_get_direction(RID p_flow_field, const Vector2 &p_position) const {
+	return v3_to_v2(NavigationServer3D::get_singleton()->flow_field_get_direction(p_flow_field, v2_to_v3(p_position)));
+}
+real_t GodotNavigationServer2D::flow_field_get_distance(RID p_flow_field, const Vector2 &p_position) const {
+	return NavigationServer3D::get_singleton()->flow_field_get_distance(p_flow_field, v2_to_v3(p_position));
+}
+uint32_t FORWARD_1_C(flow_field_get_iteration_id, RID, p_flow_field, rid_to_rid);
+
 void GodotNavigationServer2D::query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback) {
 	ERR_FAIL_COND(p_query_parameters.is_null());
 	ERR_FAIL_COND(p_query_result.is_null());
@@ -245,6 +245,17 @@ public:
 	virtual void obstacle_set_avoidance_layers(RID p_obstacle, uint32_t p_layers) override;
 	virtual uint32_t obstacle_get_avoidance_layers(RID p_obstacle) const override;
 
+	virtual RID flow_field_create() override;
+	virtual void flow_field_set_map(RID p_flow_field, RID p_map) override;
+	virtual RID flow_field_get_map(RID p_flow_field) const override;
+	virtual void flow_field_set_targets(RID p_flow_field, const Vector<Vector2> &p_targets) override;
+	virtual Vector<Vector2> flow_field_get_targets(RID p_flow_field) const override;
+	virtual void flow_field_set_navigation_layers(RID p_flow_field, uint32_t p_navigation_layers) override;
+	virtual uint32_t flow_field_get_navigation_layers(RID p_flow_field) const override;
+	virtual Vector2 flow_field_get_direction(RID p_flow_field, const Vector2 &p_position) const override;
+	virtual real_t flow_field_get_distance(RID p_flow_field, const Vector2 &p_position) const override;
+	virtual uint32_t flow_field_get_iteration_id(RID p_flow_field) const override;
+
 	virtual void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback) override;
 
 	virtual void init() override;
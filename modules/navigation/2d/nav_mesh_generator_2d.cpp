@@ -301,6 +301,415 @@ bool NavMeshGenerator2D::generator_emit_callback(const Callable &p_callback) {
 	return ce.error == Callable::CallError::CALL_OK;
 }
 
+// Merges the traversable paths, subtracts the obstructions and erodes the result by the agent radius.
+static Clipper2Lib::PathsD generator_clip_paths(const Clipper2Lib::PathsD &p_traversable_paths, const Clipper2Lib::PathsD &p_obstruction_paths, const Clipper2Lib::PathsD &p_carve_paths, real_t p_agent_radius) {
+	using namespace Clipper2Lib;
+
+	// first merge all traversable polygons according to user specified fill rule
+	PathsD dummy_clip_path;
+	PathsD traversable_polygon_paths = Union(p_traversable_paths, dummy_clip_path, FillRule::NonZero);
+	// merge all obstruction polygons, don't allow holes for what is considered "solid" 2D geometry
+	PathsD obstruction_polygon_paths = Union(p_obstruction_paths, dummy_clip_path, FillRule::NonZero);
+
+	PathsD path_solution = Difference(traversable_polygon_paths, obstruction_polygon_paths, FillRule::NonZero);
+
+	if (p_agent_radius > 0.0) {
+		path_solution = InflatePaths(path_solution, -p_agent_radius, JoinType::Miter, EndType::Polygon);
+	}
+
+	// Apply obstructions that are not affected by agent radius, the ones with carve enabled.
+	if (p_carve_paths.size() > 0) {
+		path_solution = Difference(path_solution, p_carve_paths, FillRule::NonZero);
+	}
+
+	//path_solution = RamerDouglasPeucker(path_solution, 0.025); //
+
+	return path_solution;
+}
+
+// Partitions the paths into navigation mesh polygons and welds their shared vertices.
+static bool generator_partition_paths(const Clipper2Lib::PathsD &p_path_solution, NavigationPolygon::SamplePartitionType p_sample_partition_type, Vector<Vector2> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	using namespace Clipper2Lib;
+
+	ClipType clipper_cliptype = ClipType::Union;
+
+	List<TPPLPoly> tppl_in_polygon, tppl_out_polygon;
+
+	PolyTreeD polytree;
+	ClipperD clipper_D;
+
+	clipper_D.AddSubject(p_path_solution);
+	clipper_D.Execute(clipper_cliptype, FillRule::NonZero, polytree);
+
+	for (size_t i = 0; i < polytree.Count(); i++) {
+		const PolyPathD *polypath_item = polytree[i];
+		generator_recursive_process_polytree_items(tppl_in_polygon, polypath_item);
+	}
+
+	TPPLPartition tpart;
+
+	switch (p_sample_partition_type) {
+		case NavigationPolygon::SamplePartitionType::SAMPLE_PARTITION_CONVEX_PARTITION:
+			if (tpart.ConvexPartition_HM(&tppl_in_polygon, &tppl_out_polygon) == 0) {
+				ERR_PRINT("NavigationPolygon polygon convex partition failed. Unable to create a valid navigation mesh polygon layout from provided source geometry.");
+				return false;
+			}
+			break;
+		case NavigationPolygon::SamplePartitionType::SAMPLE_PARTITION_TRIANGULATE:
+			if (tpart.Triangulate_EC(&tppl_in_polygon, &tppl_out_polygon) == 0) {
+				ERR_PRINT("NavigationPolygon polygon triangulation failed. Unable to create a valid navigation mesh polygon layout from provided source geometry.");
+				return false;
+			}
+			break;
+		default: {
+			ERR_PRINT("NavigationPolygon polygon partitioning failed. Unrecognized partition type.");
+			return false;
+		}
+	}
+
+	HashMap<Vector2, int> points;
+	for (List<TPPLPoly>::Element *I = tppl_out_polygon.front(); I; I = I->next()) {
+		TPPLPoly &tp = I->get();
+
+		Vector<int> new_polygon;
+
+		for (int64_t i = 0; i < tp.GetNumPoints(); i++) {
+			HashMap<Vector2, int>::Iterator E = points.find(tp[i]);
+			if (!E) {
+				E = points.insert(tp[i], r_vertices.size());
+				r_vertices.push_back(tp[i]);
+			}
+			new_polygon.push_back(E->value);
+		}
+
+		r_polygons.push_back(new_polygon);
+	}
+
+	return true;
+}
+
+struct NavMeshGeneratorTile2D {
+	Vector2i coords;
+	// Source paths overlapping the tile and its margin.
+	LocalVector<uint32_t> traversable_paths;
+	LocalVector<uint32_t> obstruction_paths;
+	LocalVector<uint32_t> carve_paths;
+	bool failed = false;
+	Vector<Vector2> vertices;
+	Vector<Vector<int>> polygons;
+};
+
+struct NavMeshGeneratorTiledBake2D {
+	const Clipper2Lib::PathsD *traversable_paths = nullptr;
+	const Clipper2Lib::PathsD *obstruction_paths = nullptr;
+	const Clipper2Lib::PathsD *carve_paths = nullptr;
+	real_t tile_size = 0.0;
+	real_t tile_margin = 0.0;
+	real_t agent_radius = 0.0;
+	bool use_border_rect = false;
+	Clipper2Lib::RectD border_rect;
+	NavigationPolygon::SamplePartitionType sample_partition_type = NavigationPolygon::SAMPLE_PARTITION_CONVEX_PARTITION;
+	LocalVector<NavMeshGeneratorTile2D> tiles;
+};
+
+static void generator_bake_polygon_tile(void *p_arg, uint32_t p_index) {
+	using namespace Clipper2Lib;
+
+	NavMeshGeneratorTiledBake2D *tiled_bake = static_cast<NavMeshGeneratorTiledBake2D *>(p_arg);
+	NavMeshGeneratorTile2D &tile = tiled_bake->tiles[p_index];
+
+	RectD tile_rect = RectD(tile.coords.x * tiled_bake->tile_size, tile.coords.y * tiled_bake->tile_size, (tile.coords.x + 1) * tiled_bake->tile_size, (tile.coords.y + 1) * tiled_bake->tile_size);
+	const RectD margin_rect = RectD(tile_rect.left - tiled_bake->tile_margin, tile_rect.top - tiled_bake->tile_margin, tile_rect.right + tiled_bake->tile_margin, tile_rect.bottom + tiled_bake->tile_margin);
+
+	if (tiled_bake->use_border_rect) {
+		tile_rect = RectD(MAX(tile_rect.left, tiled_bake->border_rect.left), MAX(tile_rect.top, tiled_bake->border_rect.top), MIN(tile_rect.right, tiled_bake->border_rect.right), MIN(tile_rect.bottom, tiled_bake->border_rect.bottom));
+		if (tile_rect.left >= tile_rect.right || tile_rect.top >= tile_rect.bottom) {
+			return;
+		}
+	}
+
+	auto clip_tile_paths = [&margin_rect](const PathsD &p_paths, const LocalVector<uint32_t> &p_path_indices) {
+		PathsD tile_paths;
+		tile_paths.reserve(p_path_indices.size());
+		for (uint32_t path_index : p_path_indices) {
+			tile_paths.push_back(p_paths[path_index]);
+		}
+		return RectClip(margin_rect, tile_paths);
+	};
+
+	// The margin keeps the erosion at the tile border the same as in a single bake, it is cut off afterwards.
+	PathsD path_solution = generator_clip_paths(
+			clip_tile_paths(*tiled_bake->traversable_paths, tile.traversable_paths),
+			clip_tile_paths(*tiled_bake->obstruction_paths, tile.obstruction_paths),
+			clip_tile_paths(*tiled_bake->carve_paths, tile.carve_paths),
+			tiled_bake->agent_radius);
+
+	path_solution = RectClip(tile_rect, path_solution);
+	if (path_solution.size() == 0) {
+		return;
+	}
+
+	tile.failed = !generator_partition_paths(path_solution, tiled_bake->sample_partition_type, tile.vertices, tile.polygons);
+}
+
+static uint32_t generator_find_welded_vertex(LocalVector<int> &p_welded_vertices, int p_index) {
+	while (p_welded_vertices[p_index] != p_index) {
+		p_welded_vertices[p_index] = p_welded_vertices[p_welded_vertices[p_index]];
+		p_index = p_welded_vertices[p_index];
+	}
+	return p_index;
+}
+
+// Tiles are partitioned independently, so the polygons on both sides of a tile border can end at different vertices.
+// Welds the border vertices and splits the border edges at the vertices of the other side,
+// so that the polygons of neighboring tiles share their edges and get connected by the region.
+static void generator_stitch_polygon_tiles(const LocalVector<NavMeshGeneratorTile2D> &p_tiles, real_t p_tile_size, Vector<Vector2> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	LocalVector<Vector2> vertices;
+	LocalVector<LocalVector<int>> polygons;
+	for (const NavMeshGeneratorTile2D &tile : p_tiles) {
+		const int vertex_offset = vertices.size();
+		for (const Vector2 &vertex : tile.vertices) {
+			vertices.push_back(vertex);
+		}
+		for (const Vector<int> &tile_polygon : tile.polygons) {
+			LocalVector<int> polygon;
+			for (int index : tile_polygon) {
+				polygon.push_back(index + vertex_offset);
+			}
+			polygons.push_back(polygon);
+		}
+	}
+
+	struct BorderVertex {
+		real_t along = 0.0;
+		int index = 0;
+
+		bool operator<(const BorderVertex &p_other) const {
+			return along < p_other.along;
+		}
+	};
+
+	// Clipper works with a precision of two decimals.
+	const real_t tolerance = 0.01;
+
+	// Snap the vertices close to a tile border onto it.
+	for (Vector2 &vertex : vertices) {
+		for (int axis = 0; axis < 2; axis++) {
+			const real_t border = Math::round(vertex[axis] / p_tile_size) * p_tile_size;
+			if (Math::abs(vertex[axis] - border) <= tolerance) {
+				vertex[axis] = border;
+			}
+		}
+	}
+
+	// Border lines are keyed by (axis, line index) and hold their vertices sorted along the line.
+	HashMap<Vector2i, LocalVector<BorderVertex>> borders;
+	for (uint32_t i = 0; i < vertices.size(); i++) {
+		const Vector2 &vertex = vertices[i];
+		for (int axis = 0; axis < 2; axis++) {
+			const int line = (int)Math::round(vertex[axis] / p_tile_size);
+			if (vertex[axis] != line * p_tile_size) {
+				continue;
+			}
+			borders[Vector2i(axis, line)].push_back({ vertex[1 - axis], (int)i });
+		}
+	}
+
+	LocalVector<int> welded_vertices;
+	welded_vertices.resize(vertices.size());
+	for (uint32_t i = 0; i < vertices.size(); i++) {
+		welded_vertices[i] = i;
+	}
+
+	for (KeyValue<Vector2i, LocalVector<BorderVertex>> &E : borders) {
+		LocalVector<BorderVertex> &border_vertices = E.value;
+		border_vertices.sort();
+
+		// Keep one vertex per welded group.
+		LocalVector<BorderVertex> kept_vertices;
+		for (const BorderVertex &border_vertex : border_vertices) {
+			if (!kept_vertices.is_empty() && kept_vertices[kept_vertices.size() - 1].along >= border_vertex.along - tolerance) {
+				const uint32_t a = generator_find_welded_vertex(welded_vertices, border_vertex.index);
+				const uint32_t b = generator_find_welded_vertex(welded_vertices, kept_vertices[kept_vertices.size() - 1].index);
+				if (a != b) {
+					welded_vertices[a] = b;
+				}
+			} else {
+				kept_vertices.push_back(border_vertex);
+			}
+		}
+		border_vertices = kept_vertices;
+	}
+
+	LocalVector<int> vertex_remap;
+	vertex_remap.resize(vertices.size());
+	r_vertices.clear();
+	for (uint32_t i = 0; i < vertices.size(); i++) {
+		if (generator_find_welded_vertex(welded_vertices, i) == i) {
+			vertex_remap[i] = r_vertices.size();
+			r_vertices.push_back(vertices[i]);
+		}
+	}
+
+	r_polygons.clear();
+	for (const LocalVector<int> &polygon : polygons) {
+		LocalVector<int> welded_polygon;
+		for (int index : polygon) {
+			const int welded_index = generator_find_welded_vertex(welded_vertices, index);
+			if (welded_polygon.is_empty() || welded_polygon[welded_polygon.size() - 1] != welded_index) {
+				welded_polygon.push_back(welded_index);
+			}
+		}
+		if (welded_polygon.size() > 1 && welded_polygon[0] == welded_polygon[welded_polygon.size() - 1]) {
+			welded_polygon.remove_at(welded_polygon.size() - 1);
+		}
+		if (welded_polygon.size() < 3) {
+			continue;
+		}
+
+		Vector<int> stitched_polygon;
+		for (uint32_t i = 0; i < welded_polygon.size(); i++) {
+			const int index_a = welded_polygon[i];
+			const int index_b = welded_polygon[(i + 1) % welded_polygon.size()];
+			stitched_polygon.push_back(vertex_remap[index_a]);
+
+			const Vector2 &vertex_a = vertices[index_a];
+			const Vector2 &vertex_b = vertices[index_b];
+			for (int axis = 0; axis < 2; axis++) {
+				const int line = (int)Math::round(vertex_a[axis] / p_tile_size);
+				if (vertex_a[axis] != line * p_tile_size || vertex_a[axis] != vertex_b[axis]) {
+					continue;
+				}
+				const LocalVector<BorderVertex> *border_vertices = borders.getptr(Vector2i(axis, line));
+				if (border_vertices == nullptr) {
+					continue;
+				}
+
+				const real_t along_a = vertex_a[1 - axis];
+				const real_t along_b = vertex_b[1 - axis];
+				const real_t along_min = MIN(along_a, along_b) + tolerance;
+				const real_t along_max = MAX(along_a, along_b) - tolerance;
+
+				// Border lines can span the whole level, find the first vertex on the edge by bisection.
+				uint32_t first = 0;
+				uint32_t last = border_vertices->size();
+				while (first < last) {
+					const uint32_t middle = (first + last) / 2;
+					if ((*border_vertices)[middle].along <= along_min) {
+						first = middle + 1;
+					} else {
+						last = middle;
+					}
+				}
+
+				const uint32_t split_start = stitched_polygon.size();
+				for (uint32_t j = first; j < border_vertices->size() && (*border_vertices)[j].along < along_max; j++) {
+					stitched_polygon.push_back(vertex_remap[generator_find_welded_vertex(welded_vertices, (*border_vertices)[j].index)]);
+				}
+				// The border vertices are sorted along the line, flip them when the edge runs the other way.
+				if (along_b < along_a && stitched_polygon.size() > split_start) {
+					for (uint32_t j = split_start, k = stitched_polygon.size() - 1; j < k; j++, k--) {
+						SWAP(stitched_polygon.write[j], stitched_polygon.write[k]);
+					}
+				}
+				break;
+			}
+		}
+		r_polygons.push_back(stitched_polygon);
+	}
+}
+
+static void generator_bake_tiles(const Ref<NavigationPolygon> &p_navigation_mesh, const Clipper2Lib::PathsD &p_traversable_paths, const Clipper2Lib::PathsD &p_obstruction_paths, const Clipper2Lib::PathsD &p_carve_paths, bool p_use_border_rect, const Clipper2Lib::RectD &p_border_rect, bool p_use_threads, bool p_high_priority) {
+	using namespace Clipper2Lib;
+
+	NavMeshGeneratorTiledBake2D tiled_bake;
+	tiled_bake.traversable_paths = &p_traversable_paths;
+	tiled_bake.obstruction_paths = &p_obstruction_paths;
+	tiled_bake.carve_paths = &p_carve_paths;
+	tiled_bake.tile_size = p_navigation_mesh->get_tile_size();
+	tiled_bake.agent_radius = p_navigation_mesh->get_agent_radius();
+	// Miter joins can reach up to twice the agent radius into the tile from the margin edge.
+	tiled_bake.tile_margin = tiled_bake.agent_radius * 2.0 + 1.0;
+	tiled_bake.use_border_rect = p_use_border_rect;
+	tiled_bake.border_rect = p_border_rect;
+	tiled_bake.sample_partition_type = p_navigation_mesh->get_sample_partition_type();
+
+	HashMap<Vector2i, uint32_t> tile_indices;
+
+	auto for_each_overlapped_tile = [&](const PathD &p_path, real_t p_margin, const auto &p_callback) {
+		const RectD path_bounds = GetBounds(p_path);
+		const int begin_x = (int)Math::floor((path_bounds.left - p_margin) / tiled_bake.tile_size);
+		const int begin_y = (int)Math::floor((path_bounds.top - p_margin) / tiled_bake.tile_size);
+		const int end_x = (int)Math::floor((path_bounds.right + p_margin) / tiled_bake.tile_size);
+		const int end_y = (int)Math::floor((path_bounds.bottom + p_margin) / tiled_bake.tile_size);
+		for (int y = begin_y; y <= end_y; y++) {
+			for (int x = begin_x; x <= end_x; x++) {
+				p_callback(Vector2i(x, y));
+			}
+		}
+	};
+
+	// Only tiles overlapped by traversable geometry can have polygons.
+	for (const PathD &traversable_path : p_traversable_paths) {
+		if (traversable_path.size() < 3) {
+			continue;
+		}
+		for_each_overlapped_tile(traversable_path, 0.0, [&](const Vector2i &p_coords) {
+			if (!tile_indices.has(p_coords)) {
+				tile_indices.insert(p_coords, tiled_bake.tiles.size());
+				NavMeshGeneratorTile2D tile;
+				tile.coords = p_coords;
+				tiled_bake.tiles.push_back(tile);
+			}
+		});
+	}
+
+	auto assign_paths = [&](const PathsD &p_paths, LocalVector<uint32_t> NavMeshGeneratorTile2D::*p_tile_paths) {
+		for (uint32_t i = 0; i < p_paths.size(); i++) {
+			if (p_paths[i].size() < 3) {
+				continue;
+			}
+			for_each_overlapped_tile(p_paths[i], tiled_bake.tile_margin, [&](const Vector2i &p_coords) {
+				const uint32_t *tile_index = tile_indices.getptr(p_coords);
+				if (tile_index) {
+					(tiled_bake.tiles[*tile_index].*p_tile_paths).push_back(i);
+				}
+			});
+		}
+	};
+	assign_paths(p_traversable_paths, &NavMeshGeneratorTile2D::traversable_paths);
+	assign_paths(p_obstruction_paths, &NavMeshGeneratorTile2D::obstruction_paths);
+	assign_paths(p_carve_paths, &NavMeshGeneratorTile2D::carve_paths);
+
+	if (p_use_threads && tiled_bake.tiles.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&generator_bake_polygon_tile, &tiled_bake, tiled_bake.tiles.size(), -1, p_high_priority, SNAME("NavMeshGeneratorBakeTiles2D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < tiled_bake.tiles.size(); i++) {
+			generator_bake_polygon_tile(&tiled_bake, i);
+		}
+	}
+
+	for (const NavMeshGeneratorTile2D &tile : tiled_bake.tiles) {
+		if (tile.failed) {
+			p_navigation_mesh->set_vertices(Vector<Vector2>());
+			p_navigation_mesh->clear_polygons();
+			return;
+		}
+	}
+
+	Vector<Vector2> new_vertices;
+	Vector<Vector<int>> new_polygons;
+	generator_stitch_polygon_tiles(tiled_bake.tiles, tiled_bake.tile_size, new_vertices, new_polygons);
+
+	if (new_polygons.is_empty()) {
+		p_navigation_mesh->clear();
+		return;
+	}
+
+	p_navigation_mesh->set_data(new_vertices, new_polygons);
+}
+
 void NavMeshGenerator2D::generator_bake_from_source_geometry_data(Ref<NavigationPolygon> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData2D> p_source_geometry_data) {
 	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
 		return;
@@ -309,7 +718,7 @@ void NavMeshGenerator2D::generator_bake_from_source_geometry_data(Ref<Navigation
 	using namespace Clipper2Lib;
 	PathsD traversable_polygon_paths;
 	PathsD obstruction_polygon_paths;
-	bool empty_projected_obstructions = true;
+	PathsD carve_polygon_paths;
 	{
 		RWLockRead read_lock(p_source_geometry_data->geometry_rwlock);
 
@@ -345,24 +754,23 @@ void NavMeshGenerator2D::generator_bake_from_source_geometry_data(Ref<Navigation
 			traversable_polygon_paths.push_back(std::move(subject_path));
 		}
 
-		empty_projected_obstructions = projected_obstructions.is_empty();
-		if (!empty_projected_obstructions) {
-			for (const NavigationMeshSourceGeometryData2D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
-				if (projected_obstruction.carve) {
-					continue;
-				}
-				if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 2 != 0) {
-					continue;
-				}
+		for (const NavigationMeshSourceGeometryData2D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+			if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 2 != 0) {
+				continue;
+			}
 
-				PathD clip_path;
-				clip_path.reserve(projected_obstruction.vertices.size() / 2);
-				for (int i = 0; i < projected_obstruction.vertices.size() / 2; i++) {
-					clip_path.emplace_back(projected_obstruction.vertices[i * 2], projected_obstruction.vertices[i * 2 + 1]);
-				}
-				if (!IsPositive(clip_path)) {
-					std::reverse(clip_path.begin(), clip_path.end());
-				}
+			PathD clip_path;
+			clip_path.reserve(projected_obstruction.vertices.size() / 2);
+			for (int i = 0; i < projected_obstruction.vertices.size() / 2; i++) {
+				clip_path.emplace_back(projected_obstruction.vertices[i * 2], projected_obstruction.vertices[i * 2 + 1]);
+			}
+			if (!IsPositive(clip_path)) {
+				std::reverse(clip_path.begin(), clip_path.end());
+			}
+			// Carved obstructions are not affected by the agent radius and get applied after the erosion.
+			if (projected_obstruction.carve) {
+				carve_polygon_paths.push_back(std::move(clip_path));
+			} else {
 				obstruction_polygon_paths.push_back(std::move(clip_path));
 			}
 		}
@@ -392,51 +800,10 @@ void NavMeshGenerator2D::generator_bake_from_source_geometry_data(Ref<Navigation
 		obstruction_polygon_paths = RectClip(clipper_rect, obstruction_polygon_paths);
 	}
 
-	// first merge all traversable polygons according to user specified fill rule
-	PathsD dummy_clip_path;
-	traversable_polygon_paths = Union(traversable_polygon_paths, dummy_clip_path, FillRule::NonZero);
-	// merge all obstruction polygons, don't allow holes for what is considered "solid" 2D geometry
-	obstruction_polygon_paths = Union(obstruction_polygon_paths, dummy_clip_path, FillRule::NonZero);
-
-	PathsD path_solution = Difference(traversable_polygon_paths, obstruction_polygon_paths, FillRule::NonZero);
-
-	real_t agent_radius_offset = p_navigation_mesh->get_agent_radius();
-	if (agent_radius_offset > 0.0) {
-		path_solution = InflatePaths(path_solution, -agent_radius_offset, JoinType::Miter, EndType::Polygon);
-	}
-
-	// Apply obstructions that are not affected by agent radius, the ones with carve enabled.
-	if (!empty_projected_obstructions) {
-		RWLockRead read_lock(p_source_geometry_data->geometry_rwlock);
-		const Vector<NavigationMeshSourceGeometryData2D::ProjectedObstruction> &projected_obstructions = p_source_geometry_data->_projected_obstructions;
-		obstruction_polygon_paths.resize(0);
-		for (const NavigationMeshSourceGeometryData2D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
-			if (!projected_obstruction.carve) {
-				continue;
-			}
-			if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 2 != 0) {
-				continue;
-			}
-
-			PathD clip_path;
-			clip_path.reserve(projected_obstruction.vertices.size() / 2);
-			for (int i = 0; i < projected_obstruction.vertices.size() / 2; i++) {
-				clip_path.emplace_back(projected_obstruction.vertices[i * 2], projected_obstruction.vertices[i * 2 + 1]);
-			}
-			if (!IsPositive(clip_path)) {
-				std::reverse(clip_path.begin(), clip_path.end());
-			}
-			obstruction_polygon_paths.push_back(std::move(clip_path));
-		}
-		if (obstruction_polygon_paths.size() > 0) {
-			path_solution = Difference(path_solution, obstruction_polygon_paths, FillRule::NonZero);
-		}
-	}
-
-	//path_solution = RamerDouglasPeucker(path_solution, 0.025); //
-
+	RectD border_rect;
 	real_t border_size = p_navigation_mesh->get_border_size();
-	if (baking_rect.has_area() && border_size > 0.0) {
+	bool use_border_rect = baking_rect.has_area() && border_size > 0.0;
+	if (use_border_rect) {
 		Vector2 baking_rect_offset = p_navigation_mesh->get_baking_rect_offset();
 
 		const int rect_begin_x = baking_rect.position[0] + baking_rect_offset.x + border_size;
@@ -444,79 +811,32 @@ void NavMeshGenerator2D::generator_bake_from_source_geometry_data(Ref<Navigation
 		const int rect_end_x = baking_rect.position[0] + baking_rect.size[0] + baking_rect_offset.x - border_size;
 		const int rect_end_y = baking_rect.position[1] + baking_rect.size[1] + baking_rect_offset.y - border_size;
 
-		RectD clipper_rect = RectD(rect_begin_x, rect_begin_y, rect_end_x, rect_end_y);
-
-		path_solution = RectClip(clipper_rect, path_solution);
+		border_rect = RectD(rect_begin_x, rect_begin_y, rect_end_x, rect_end_y);
 	}
 
-	if (path_solution.size() == 0) {
-		p_navigation_mesh->clear();
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		generator_bake_tiles(p_navigation_mesh, traversable_polygon_paths, obstruction_polygon_paths, carve_polygon_paths, use_border_rect, border_rect, use_threads, baking_use_high_priority_threads);
 		return;
 	}
 
-	ClipType clipper_cliptype = ClipType::Union;
-
-	List<TPPLPoly> tppl_in_polygon, tppl_out_polygon;
-
-	PolyTreeD polytree;
-	ClipperD clipper_D;
+	PathsD path_solution = generator_clip_paths(traversable_polygon_paths, obstruction_polygon_paths, carve_polygon_paths, p_navigation_mesh->get_agent_radius());
 
-	clipper_D.AddSubject(path_solution);
-	clipper_D.Execute(clipper_cliptype, FillRule::NonZero, polytree);
-
-	for (size_t i = 0; i < polytree.Count(); i++) {
-		const PolyPathD *polypath_item = polytree[i];
-		generator_recursive_process_polytree_items(tppl_in_polygon, polypath_item);
+	if (use_border_rect) {
+		path_solution = RectClip(border_rect, path_solution);
 	}
 
-	TPPLPartition tpart;
-
-	NavigationPolygon::SamplePartitionType sample_partition_type = p_navigation_mesh->get_sample_partition_type();
-
-	switch (sample_partition_type) {
-		case NavigationPolygon::SamplePartitionType::SAMPLE_PARTITION_CONVEX_PARTITION:
-			if (tpart.ConvexPartition_HM(&tppl_in_polygon, &tppl_out_polygon) == 0) {
-				ERR_PRINT("NavigationPolygon polygon convex partition failed. Unable to create a valid navigation mesh polygon layout from provided source geometry.");
-				p_navigation_mesh->set_vertices(Vector<Vector2>());
-				p_navigation_mesh->clear_polygons();
-				return;
-			}
-			break;
-		case NavigationPolygon::SamplePartitionType::SAMPLE_PARTITION_TRIANGULATE:
-			if (tpart.Triangulate_EC(&tppl_in_polygon, &tppl_out_polygon) == 0) {
-				ERR_PRINT("NavigationPolygon polygon triangulation failed. Unable to create a valid navigation mesh polygon layout from provided source geometry.");
-				p_navigation_mesh->set_vertices(Vector<Vector2>());
-				p_navigation_mesh->clear_polygons();
-				return;
-			}
-			break;
-		default: {
-			ERR_PRINT("NavigationPolygon polygon partitioning failed. Unrecognized partition type.");
-			p_navigation_mesh->set_vertices(Vector<Vector2>());
-			p_navigation_mesh->clear_polygons();
-			return;
-		}
+	if (path_solution.size() == 0) {
+		p_navigation_mesh->clear();
+		return;
 	}
 
 	Vector<Vector2> new_vertices;
 	Vector<Vector<int>> new_polygons;
 
-	HashMap<Vector2, int> points;
-	for (List<TPPLPoly>::Element *I = tppl_out_polygon.front(); I; I = I->next()) {
-		TPPLPoly &tp = I->get();
-
-		Vector<int> new_polygon;
-
-		for (int64_t i = 0; i < tp.GetNumPoints(); i++) {
-			HashMap<Vector2, int>::Iterator E = points.find(tp[i]);
-			if (!E) {
-				E = points.insert(tp[i], new_vertices.size());
-				new_vertices.push_back(tp[i]);
-			}
-			new_polygon.push_back(E->value);
-		}
-
-		new_polygons.push_back(new_polygon);
+	if (!generator_partition_paths(path_solution, p_navigation_mesh->get_sample_partition_type(), new_vertices, new_polygons)) {
+		p_navigation_mesh->set_vertices(Vector<Vector2>());
+		p_navigation_mesh->clear_polygons();
+		return;
 	}
 
 	p_navigation_mesh->set_data(new_vertices, new_polygons);
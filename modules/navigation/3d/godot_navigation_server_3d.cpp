@@ -30,7 +30,9 @@
 
 #include "godot_navigation_server_3d.h"
 
+#include "core/debugger/engine_debugger.h"
 #include "core/os/mutex.h"
+#include "core/os/os.h"
 #include "scene/main/node.h"
 
 #ifndef _3D_DISABLED
@@ -1167,6 +1169,80 @@ uint32_t GodotNavigationServer3D::obstacle_get_avoidance_layers(RID p_obstacle)
 	return obstacle->get_avoidance_layers();
 }
 
+RID GodotNavigationServer3D::flow_field_create() {
+	MutexLock lock(operations_mutex);
+
+	RID rid = flow_field_owner.make_rid();
+	NavFlowField *flow_field = flow_field_owner.get_or_null(rid);
+	flow_field->set_self(rid);
+	return rid;
+}
+
+COMMAND_2(flow_field_set_map, RID, p_flow_field, RID, p_map) {
+	NavFlowField *flow_field = flow_field_owner.get_or_null(p_flow_field);
+	ERR_FAIL_NULL(flow_field);
+
+	NavMap *map = map_owner.get_or_null(p_map);
+
+	flow_field->set_map(map);
+}
+
+RID GodotNavigationServer3D::flow_field_get_map(RID p_flow_field) const {
+	NavFlowField *flow_field = flow_field_owner.get_or_null(p_flow_field);
+	ERR_FAIL_NULL_V(flow_field, RID());
+	if (flow_field->get_map()) {
+		return flow_field->get_map()->get_self();
+	}
+	return RID();
+}
+
+COMMAND_2(flow_field_set_targets, RID, p_flow_field, Vector<Vector3>, p_targets) {
+	NavFlowField *flow_field = flow_field_owner.get_or_null(p_flow_field);
+	ERR_FAIL_NULL(flow_field);
+	flow_field->set_targets(p_targets);
+}
+
+Vector<Vector3> GodotNavigationServer3D::flow_field_get_targets(RID p_flow_field) const {
+	NavFlowField *flow_field = flow_field_owner.get_or_null(p_flow_field);
+	ERR_FAIL_NULL_V(flow_field, Vector<Vector3>());
+
+	return flow_field->get_targets();
+}
+
+COMMAND_2(flow_field_set_navigation_layers, RID, p_flow_field, uint32_t, p_navigation_layers) {
+	NavFlowField *flow_field = flow_field_owner.get_or_null(p_flow_field);
+	ERR_FAIL_NULL(flow_field);
+	flow_field->set_navigation_layers(p_navigation_layers);
+}
+
+uint32_t GodotNavigationServer3D::flow_field_get_navigation_layers(RID p_flow_field) const {
+	NavFlowField *flow_field = flow_field_owner.get_or_null(p_flow_field);
+	ERR_FAIL_NULL_V(flow_field, 0);
+
+	return flow_field->get_navigation_layers();
+}
+
+Vector3 GodotNavigationServer3D::flow_field_get_direction(RID p_flow_field, const Vector3 &p_position) const {
+	NavFlowField *flow_field = flow_field_owner.get_or_null(p_flow_field);
+	ERR_FAIL_NULL_V(flow_field, Vector3());
+
+	return flow_field->get_direction(p_position);
+}
+
+real_t GodotNavigationServer3D::flow_field_get_distance(RID p_flow_field, const Vector3 &p_position) const {
+	NavFlowField *flow_field = flow_field_owner.get_or_null(p_flow_field);
+	ERR_FAIL_NULL_V(flow_field, INFINITY);
+
+	return flow_field->get_distance(p_position);
+}
+
+uint32_t GodotNavigationServer3D::flow_field_get_iteration_id(RID p_flow_field) const {
+	NavFlowField *flow_field = flow_field_owner.get_or_null(p_flow_field);
+	ERR_FAIL_NULL_V(flow_field, 0);
+
+	return flow_field->get_iteration_id();
+}
+
 void GodotNavigationServer3D::parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback) {
 #ifndef _3D_DISABLED
 	ERR_FAIL_COND_MSG(!Thread::is_main_thread(), "The SceneTree can only be parsed on the main thread. Call this function from the main thread or use call_deferred().");
@@ -1235,6 +1311,12 @@ COMMAND_1(free, RID, p_object) {
 			obstacle->set_map(nullptr);
 		}
 
+		// Remove any assigned flow fields
+		const LocalVector<NavFlowField *> flow_fields = map->get_flow_fields();
+		for (NavFlowField *flow_field : flow_fields) {
+			flow_field->set_map(nullptr);
+		}
+
 		int map_index = active_maps.find(map);
 		if (map_index >= 0) {
 			active_maps.remove_at(map_index);
@@ -1270,6 +1352,16 @@ COMMAND_1(free, RID, p_object) {
 	} else if (obstacle_owner.owns(p_object)) {
 		internal_free_obstacle(p_object);
 
+	} else if (flow_field_owner.owns(p_object)) {
+		NavFlowField *flow_field = flow_field_owner.get_or_null(p_object);
+
+		// Removes this flow field from the map if assigned
+		if (flow_field->get_map() != nullptr) {
+			flow_field->set_map(nullptr);
+		}
+
+		flow_field_owner.free(p_object);
+
 	} else if (geometry_parser_owner.owns(p_object)) {
 		RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -1374,6 +1466,13 @@ void GodotNavigationServer3D::process(real_t p_delta_time) {
 	int _new_pm_edge_connection_count = 0;
 	int _new_pm_edge_free_count = 0;
 	int _new_pm_obstacle_count = 0;
+	uint64_t _new_pm_map_sync_usec = 0;
+	uint64_t _new_pm_map_build_usec = 0;
+	uint64_t _new_pm_avoidance_usec = 0;
+	int _new_pm_path_query_count = 0;
+	uint64_t _new_pm_path_query_usec = 0;
+	uint64_t _new_pm_path_query_max_usec = 0;
+	int _new_pm_path_query_polygon_count = 0;
 
 	// In c++ we can't be sure that this is performed in the main thread
 	// even with mutable functions.
@@ -1393,6 +1492,15 @@ void GodotNavigationServer3D::process(real_t p_delta_time) {
 		_new_pm_edge_free_count += active_maps[i]->get_pm_edge_free_count();
 		_new_pm_obstacle_count += active_maps[i]->get_pm_obstacle_count();
 
+		const gd::PerformanceData &map_performance_data = active_maps[i]->get_performance_data();
+		_new_pm_map_sync_usec += map_performance_data.pm_map_sync_usec;
+		_new_pm_map_build_usec += map_performance_data.get_build_usec();
+		_new_pm_avoidance_usec += map_performance_data.pm_avoidance_usec;
+		_new_pm_path_query_count += map_performance_data.pm_path_query_count;
+		_new_pm_path_query_usec += map_performance_data.pm_path_query_usec;
+		_new_pm_path_query_max_usec = MAX(_new_pm_path_query_max_usec, map_performance_data.pm_path_query_max_usec);
+		_new_pm_path_query_polygon_count += map_performance_data.pm_path_query_polygon_count;
+
 		// Emit a signal if a map changed.
 		const uint32_t new_map_iteration_id = active_maps[i]->get_iteration_id();
 		if (new_map_iteration_id != active_maps_iteration_id[i]) {
@@ -1410,6 +1518,81 @@ void GodotNavigationServer3D::process(real_t p_delta_time) {
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
 	pm_obstacle_count = _new_pm_obstacle_count;
+	pm_map_sync_usec = _new_pm_map_sync_usec;
+	pm_map_build_usec = _new_pm_map_build_usec;
+	pm_avoidance_usec = _new_pm_avoidance_usec;
+	pm_path_query_count = _new_pm_path_query_count;
+	pm_path_query_usec = _new_pm_path_query_usec;
+	pm_path_query_max_usec = _new_pm_path_query_max_usec;
+	pm_path_query_polygon_count = _new_pm_path_query_polygon_count;
+
+	if (EngineDebugger::is_profiling("servers")) {
+		Array values;
+		values.push_back("map_sync");
+		values.push_back(USEC_TO_SEC(pm_map_sync_usec));
+		values.push_back("avoidance");
+		values.push_back(USEC_TO_SEC(pm_avoidance_usec));
+		values.push_back("path_queries");
+		values.push_back(USEC_TO_SEC(pm_path_query_usec));
+
+		values.push_front("navigation_3d");
+		EngineDebugger::profiler_add_frame_data("servers", values);
+	}
+
+	if (EngineDebugger::is_profiling("navigation")) {
+		_add_profiler_frame();
+	}
+}
+
+void GodotNavigationServer3D::_add_profiler_frame() {
+	static const char *build_step_name[gd::PerformanceData::BUILD_STEP_MAX] = {
+		"gather_region_polygons",
+		"update_edge_keys",
+		"merge_edge_connection_pairs",
+		"edge_connection_margin_connections",
+		"navlink_connections",
+		"cluster_graph",
+		"update_map_iteration",
+	};
+
+	uint64_t build_step_usec[gd::PerformanceData::BUILD_STEP_MAX] = {};
+	int latency_histogram[gd::PerformanceData::PATH_QUERY_LATENCY_BUCKETS] = {};
+	for (const NavMap *map : active_maps) {
+		const gd::PerformanceData &map_performance_data = map->get_performance_data();
+		for (int i = 0; i < gd::PerformanceData::BUILD_STEP_MAX; i++) {
+			build_step_usec[i] += map_performance_data.pm_build_step_usec[i];
+		}
+		for (int i = 0; i < gd::PerformanceData::PATH_QUERY_LATENCY_BUCKETS; i++) {
+			latency_histogram[i] += map_performance_data.pm_path_query_latency_histogram[i];
+		}
+	}
+
+	Dictionary build_steps;
+	for (int i = 0; i < gd::PerformanceData::BUILD_STEP_MAX; i++) {
+		build_steps[build_step_name[i]] = USEC_TO_SEC(build_step_usec[i]);
+	}
+
+	// Keyed by the upper bound of each bucket in seconds, the last bucket by INF.
+	Dictionary path_query_latencies;
+	for (int i = 0; i < gd::PerformanceData::PATH_QUERY_LATENCY_BUCKETS; i++) {
+		const double bound = i < gd::PerformanceData::PATH_QUERY_LATENCY_BUCKETS - 1 ? USEC_TO_SEC(gd::PerformanceData::path_query_latency_bounds[i]) : INFINITY;
+		path_query_latencies[bound] = latency_histogram[i];
+	}
+
+	Dictionary frame;
+	frame["map_sync_time"] = USEC_TO_SEC(pm_map_sync_usec);
+	frame["map_build_time"] = USEC_TO_SEC(pm_map_build_usec);
+	frame["map_build_steps"] = build_steps;
+	frame["avoidance_time"] = USEC_TO_SEC(pm_avoidance_usec);
+	frame["path_queries"] = pm_path_query_count;
+	frame["path_query_time"] = USEC_TO_SEC(pm_path_query_usec);
+	frame["path_query_max_time"] = USEC_TO_SEC(pm_path_query_max_usec);
+	frame["path_query_polygons"] = pm_path_query_polygon_count;
+	frame["path_query_latencies"] = path_query_latencies;
+
+	Array values;
+	values.push_back(frame);
+	EngineDebugger::profiler_add_frame_data("navigation", values);
 }
 
 void GodotNavigationServer3D::init() {
@@ -1441,6 +1624,44 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer3D::query_paths(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_query_parameters.size() != p_query_results.size(), "The number of query parameters and query results must match.");
+
+	// Resolve the maps up front, the RID owner is not meant to be accessed from the worker threads.
+	PathQueryBatch batch;
+	batch.maps.reserve(p_query_parameters.size());
+	batch.parameters.reserve(p_query_parameters.size());
+	batch.results.reserve(p_query_parameters.size());
+	for (int i = 0; i < p_query_parameters.size(); i++) {
+		Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[i];
+		Ref<NavigationPathQueryResult3D> query_result = p_query_results[i];
+		ERR_CONTINUE(query_parameters.is_null());
+		ERR_CONTINUE(query_result.is_null());
+
+		NavMap *map = map_owner.get_or_null(query_parameters->get_map());
+		ERR_CONTINUE(map == nullptr);
+
+		batch.maps.push_back(map);
+		batch.parameters.push_back(query_parameters);
+		batch.results.push_back(query_result);
+	}
+
+	if (batch.maps.size() == 1) {
+		_query_paths_threaded(0, &batch);
+	} else if (batch.maps.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer3D::_query_paths_threaded, &batch, batch.maps.size(), -1, true, SNAME("NavigationServerPathQueries"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	if (p_callback.is_valid()) {
+		NavMeshQueries3D::emit_callback(p_callback);
+	}
+}
+
+void GodotNavigationServer3D::_query_paths_threaded(uint32_t p_index, PathQueryBatch *p_batch) {
+	NavMeshQueries3D::map_query_path(p_batch->maps[p_index], p_batch->parameters[p_index], p_batch->results[p_index], Callable());
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -1530,6 +1751,27 @@ int GodotNavigationServer3D::get_process_info(ProcessInfo p_info) const {
 		case INFO_OBSTACLE_COUNT: {
 			return pm_obstacle_count;
 		} break;
+		case INFO_MAP_SYNC_TIME: {
+			return pm_map_sync_usec;
+		} break;
+		case INFO_MAP_BUILD_TIME: {
+			return pm_map_build_usec;
+		} break;
+		case INFO_AVOIDANCE_TIME: {
+			return pm_avoidance_usec;
+		} break;
+		case INFO_PATH_QUERY_COUNT: {
+			return pm_path_query_count;
+		} break;
+		case INFO_PATH_QUERY_TIME: {
+			return pm_path_query_usec;
+		} break;
+		case INFO_PATH_QUERY_MAX_TIME: {
+			return pm_path_query_max_usec;
+		} break;
+		case INFO_PATH_QUERY_POLYGON_COUNT: {
+			return pm_path_query_polygon_count;
+		} break;
 	}
 
 	return 0;
@@ -32,6 +32,7 @@
 #define GODOT_NAVIGATION_SERVER_3D_H
 
 #include "../nav_agent.h"
+#include "../nav_flow_field.h"
 #include "../nav_link.h"
 #include "../nav_map.h"
 #include "../nav_obstacle.h"
@@ -79,6 +80,7 @@ class GodotNavigationServer3D : public NavigationServer3D {
 	mutable RID_Owner<NavRegion> region_owner;
 	mutable RID_Owner<NavAgent> agent_owner;
 	mutable RID_Owner<NavObstacle> obstacle_owner;
+	mutable RID_Owner<NavFlowField> flow_field_owner;
 
 	bool active = true;
 	LocalVector<NavMap *> active_maps;
@@ -98,6 +100,15 @@ class GodotNavigationServer3D : public NavigationServer3D {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	uint64_t pm_map_sync_usec = 0;
+	uint64_t pm_map_build_usec = 0;
+	uint64_t pm_avoidance_usec = 0;
+	int pm_path_query_count = 0;
+	uint64_t pm_path_query_usec = 0;
+	uint64_t pm_path_query_max_usec = 0;
+	int pm_path_query_polygon_count = 0;
+
+	void _add_profiler_frame();
 
 public:
 	GodotNavigationServer3D();
@@ -269,6 +280,17 @@ public:
 	COMMAND_2(obstacle_set_avoidance_layers, RID, p_obstacle, uint32_t, p_layers);
 	virtual uint32_t obstacle_get_avoidance_layers(RID p_obstacle) const override;
 
+	virtual RID flow_field_create() override;
+	COMMAND_2(flow_field_set_map, RID, p_flow_field, RID, p_map);
+	virtual RID flow_field_get_map(RID p_flow_field) const override;
+	COMMAND_2(flow_field_set_targets, RID, p_flow_field, Vector<Vector3>, p_targets);
+	virtual Vector<Vector3> flow_field_get_targets(RID p_flow_field) const override;
+	COMMAND_2(flow_field_set_navigation_layers, RID, p_flow_field, uint32_t, p_navigation_layers);
+	virtual uint32_t flow_field_get_navigation_layers(RID p_flow_field) const override;
+	virtual Vector3 flow_field_get_direction(RID p_flow_field, const Vector3 &p_position) const override;
+	virtual real_t flow_field_get_distance(RID p_flow_field, const Vector3 &p_position) const override;
+	virtual uint32_t flow_field_get_iteration_id(RID p_flow_field) const override;
+
 	virtual void parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) override;
 	virtual void bake_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) override;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) override;
@@ -291,10 +313,18 @@ public:
 	virtual void finish() override;
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override;
+	virtual void query_paths(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback = Callable()) override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
 private:
+	struct PathQueryBatch {
+		LocalVector<NavMap *> maps;
+		LocalVector<Ref<NavigationPathQueryParameters3D>> parameters;
+		LocalVector<Ref<NavigationPathQueryResult3D>> results;
+	};
+	void _query_paths_threaded(uint32_t p_index, PathQueryBatch *p_batch);
+
 	void internal_free_agent(RID p_object);
 	void internal_free_obstacle(RID p_object);
 };
@@ -38,6 +38,8 @@
 #include "nav_map_iteration_3d.h"
 #include "nav_region_iteration_3d.h"
 
+#include "core/os/os.h"
+
 gd::PointKey NavMapBuilder3D::get_point_key(const Vector3 &p_pos, const Vector3 &p_cell_size) {
 	const int x = static_cast<int>(Math::floor(p_pos.x / p_cell_size.x));
 	const int y = static_cast<int>(Math::floor(p_pos.y / p_cell_size.y));
@@ -60,17 +62,33 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild &r_build) {
 	performance_data.pm_edge_connection_count = 0;
 	performance_data.pm_edge_free_count = 0;
 
+	uint64_t step_begin = OS::get_singleton()->get_ticks_usec();
+	const auto end_step = [&](gd::PerformanceData::BuildStep p_step) {
+		const uint64_t step_end = OS::get_singleton()->get_ticks_usec();
+		performance_data.pm_build_step_usec[p_step] = step_end - step_begin;
+		step_begin = step_end;
+	};
+
 	_build_step_gather_region_polygons(r_build);
+	end_step(gd::PerformanceData::BUILD_STEP_GATHER_REGION_POLYGONS);
 
-	_build_step_find_edge_connection_pairs(r_build);
+	_build_step_update_edge_keys(r_build);
+	end_step(gd::PerformanceData::BUILD_STEP_UPDATE_EDGE_KEYS);
 
 	_build_step_merge_edge_connection_pairs(r_build);
+	end_step(gd::PerformanceData::BUILD_STEP_MERGE_EDGE_CONNECTION_PAIRS);
 
 	_build_step_edge_connection_margin_connections(r_build);
+	end_step(gd::PerformanceData::BUILD_STEP_EDGE_CONNECTION_MARGIN_CONNECTIONS);
 
 	_build_step_navlink_connections(r_build);
+	end_step(gd::PerformanceData::BUILD_STEP_NAVLINK_CONNECTIONS);
+
+	_build_step_cluster_graph(r_build);
+	end_step(gd::PerformanceData::BUILD_STEP_CLUSTER_GRAPH);
 
 	_build_update_map_iteration(r_build);
+	end_step(gd::PerformanceData::BUILD_STEP_UPDATE_MAP_ITERATION);
 }
 
 void NavMapBuilder3D::_build_step_gather_region_polygons(NavMapIterationBuild &r_build) {
@@ -103,85 +121,190 @@ void NavMapBuilder3D::_build_step_gather_region_polygons(NavMapIterationBuild &r
 	r_build.polygon_count = polygon_count;
 }
 
-void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuild &r_build) {
-	gd::PerformanceData &performance_data = r_build.performance_data;
+void NavMapBuilder3D::_build_step_update_edge_keys(NavMapIterationBuild &r_build) {
 	NavMapIteration *map_iteration = r_build.map_iteration;
-	int polygon_count = r_build.polygon_count;
 
-	HashMap<gd::EdgeKey, gd::EdgeConnectionPair, gd::EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
+	HashMap<RID, NavMapIterationBuild::RegionEdges> &region_edges_cache = r_build.region_edges_cache;
+	LocalVector<NavMapIterationBuild::RegionEdges *> &iter_region_edges = r_build.iter_region_edges;
+	LocalVector<NavRegionIteration> &regions = map_iteration->region_iterations;
 
-	// Group all edges per key.
-	connection_pairs_map.clear();
-	connection_pairs_map.reserve(polygon_count);
-	int free_edges_count = 0; // How many ConnectionPairs have only one Connection.
+	// The map settings affect every connection, so a change starts over with an empty state.
+	if (r_build.cached_merge_rasterizer_cell_size != r_build.merge_rasterizer_cell_size || r_build.cached_use_edge_connections != r_build.use_edge_connections || r_build.cached_edge_connection_margin != r_build.edge_connection_margin) {
+		region_edges_cache.clear();
+		r_build.edge_key_pairs.clear();
+		r_build.edge_margin_connections.clear();
+		r_build.link_connections_cache.clear();
+		r_build.cached_merge_rasterizer_cell_size = r_build.merge_rasterizer_cell_size;
+		r_build.cached_use_edge_connections = r_build.use_edge_connections;
+		r_build.cached_edge_connection_margin = r_build.edge_connection_margin;
+	}
 
-	for (NavRegionIteration &region : map_iteration->region_iterations) {
+	const uint32_t build_pass = ++r_build.edge_build_pass;
+	for (KeyValue<RID, NavMapIterationBuild::RegionEdges> &region_edges_it : region_edges_cache) {
+		region_edges_it.value.dirty = false;
+	}
+
+	// Find the regions that are new or changed their polygons since the last build.
+	LocalVector<NavMapIterationBuild::RegionEdges *> changed_regions;
+	iter_region_edges.resize(regions.size());
+	for (NavRegionIteration &region : regions) {
+		iter_region_edges[region.id] = nullptr;
 		if (!region.get_enabled()) {
 			continue;
 		}
 
-		for (gd::Polygon &poly : region.navmesh_polygons) {
-			for (uint32_t p = 0; p < poly.points.size(); p++) {
-				const int next_point = (p + 1) % poly.points.size();
-				const gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+		NavMapIterationBuild::RegionEdges *region_edges = region_edges_cache.getptr(region.get_self());
+		if (region_edges == nullptr) {
+			region_edges = &region_edges_cache.insert(region.get_self(), NavMapIterationBuild::RegionEdges())->value;
+		}
+		if (region_edges->build_pass == 0 || region_edges->region_iteration_id != region.get_iteration_id()) {
+			changed_regions.push_back(region_edges);
+		}
+		region_edges->build_pass = build_pass;
+		region_edges->region = &region;
+		iter_region_edges[region.id] = region_edges;
+	}
 
-				HashMap<gd::EdgeKey, gd::EdgeConnectionPair, gd::EdgeKey>::Iterator pair_it = connection_pairs_map.find(ek);
-				if (!pair_it) {
-					pair_it = connection_pairs_map.insert(ek, gd::EdgeConnectionPair());
-					performance_data.pm_edge_count += 1;
-					++free_edges_count;
-				}
-				gd::EdgeConnectionPair &pair = pair_it->value;
-				if (pair.size < 2) {
-					// Add the polygon/edge tuple to this key.
-					gd::Edge::Connection new_connection;
-					new_connection.polygon = &poly;
-					new_connection.edge = p;
-					new_connection.pathway_start = poly.points[p].pos;
-					new_connection.pathway_end = poly.points[next_point].pos;
-
-					pair.connections[pair.size] = new_connection;
-					++pair.size;
-					if (pair.size == 2) {
-						--free_edges_count;
-					}
+	LocalVector<RID> removed_regions;
+	for (KeyValue<RID, NavMapIterationBuild::RegionEdges> &region_edges_it : region_edges_cache) {
+		if (region_edges_it.value.build_pass != build_pass) {
+			_remove_region_edge_keys(r_build, region_edges_it.value);
+			removed_regions.push_back(region_edges_it.key);
+		}
+	}
+
+	// Remove all outdated keys first so the new keys of a region never pair with stale keys of another.
+	for (NavMapIterationBuild::RegionEdges *region_edges : changed_regions) {
+		_remove_region_edge_keys(r_build, *region_edges);
+	}
+	for (NavMapIterationBuild::RegionEdges *region_edges : changed_regions) {
+		_add_region_edge_keys(r_build, *region_edges);
+		region_edges->region_iteration_id = region_edges->region->get_iteration_id();
+	}
+
+	r_build.iter_regions_changed = !changed_regions.is_empty() || !removed_regions.is_empty();
+
+	// Edge margin connections of regions whose edge pairs changed are searched again.
+	LocalVector<NavMapIterationBuild::EdgeMarginConnection> &edge_margin_connections = r_build.edge_margin_connections;
+	if (r_build.iter_regions_changed) {
+		uint32_t kept_count = 0;
+		for (uint32_t i = 0; i < edge_margin_connections.size(); i++) {
+			const NavMapIterationBuild::EdgeMarginConnection &margin_connection = edge_margin_connections[i];
+			if (margin_connection.from.region->dirty || margin_connection.to.region->dirty) {
+				continue;
+			}
+			edge_margin_connections[kept_count++] = margin_connection;
+		}
+		edge_margin_connections.resize(kept_count);
+	}
 
-				} else {
-					// The edge is already connected with another edge, skip.
-					ERR_PRINT_ONCE("Navigation map synchronization error. Attempted to merge a navigation mesh polygon edge with another already-merged edge. This is usually caused by crossing edges, overlapping polygons, or a mismatch of the NavigationMesh / NavigationPolygon baked 'cell_size' and navigation map 'cell_size'. If you're certain none of above is the case, change 'navigation/3d/merge_rasterizer_cell_scale' to 0.001.");
+	for (const RID &region_rid : removed_regions) {
+		region_edges_cache.erase(region_rid);
+	}
+}
+
+void NavMapBuilder3D::_add_region_edge_keys(NavMapIterationBuild &r_build, NavMapIterationBuild::RegionEdges &r_region_edges) {
+	HashMap<gd::EdgeKey, NavMapIterationBuild::EdgeKeyPair, gd::EdgeKey> &edge_key_pairs = r_build.edge_key_pairs;
+	const LocalVector<gd::Polygon> &polygons = r_region_edges.region->navmesh_polygons;
+
+	r_region_edges.dirty = true;
+	r_region_edges.edge_keys.clear();
+
+	for (uint32_t polygon_index = 0; polygon_index < polygons.size(); polygon_index++) {
+		const gd::Polygon &poly = polygons[polygon_index];
+		for (uint32_t p = 0; p < poly.points.size(); p++) {
+			const int next_point = (p + 1) % poly.points.size();
+			const gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+			r_region_edges.edge_keys.push_back(ek);
+
+			HashMap<gd::EdgeKey, NavMapIterationBuild::EdgeKeyPair, gd::EdgeKey>::Iterator pair_it = edge_key_pairs.find(ek);
+			if (!pair_it) {
+				pair_it = edge_key_pairs.insert(ek, NavMapIterationBuild::EdgeKeyPair());
+			}
+			NavMapIterationBuild::EdgeKeyPair &pair = pair_it->value;
+			if (pair.size < 2) {
+				// Add the polygon/edge tuple to this key.
+				for (int i = 0; i < pair.size; i++) {
+					pair.owners[i].region->dirty = true;
 				}
+				NavMapIterationBuild::EdgeKeyOwner &owner = pair.owners[pair.size];
+				owner.region = &r_region_edges;
+				owner.polygon = polygon_index;
+				owner.edge = p;
+				++pair.size;
+			} else {
+				// The edge is already connected with another edge, skip.
+				ERR_PRINT_ONCE("Navigation map synchronization error. Attempted to merge a navigation mesh polygon edge with another already-merged edge. This is usually caused by crossing edges, overlapping polygons, or a mismatch of the NavigationMesh / NavigationPolygon baked 'cell_size' and navigation map 'cell_size'. If you're certain none of above is the case, change 'navigation/3d/merge_rasterizer_cell_scale' to 0.001.");
 			}
 		}
 	}
+}
+
+void NavMapBuilder3D::_remove_region_edge_keys(NavMapIterationBuild &r_build, NavMapIterationBuild::RegionEdges &r_region_edges) {
+	HashMap<gd::EdgeKey, NavMapIterationBuild::EdgeKeyPair, gd::EdgeKey> &edge_key_pairs = r_build.edge_key_pairs;
+
+	r_region_edges.dirty = true;
 
-	r_build.free_edge_count = free_edges_count;
+	for (const gd::EdgeKey &ek : r_region_edges.edge_keys) {
+		NavMapIterationBuild::EdgeKeyPair *pair = edge_key_pairs.getptr(ek);
+		if (pair == nullptr) {
+			// Both edges of this key belonged to the region and were already removed.
+			continue;
+		}
+
+		int i = 0;
+		while (i < pair->size) {
+			if (pair->owners[i].region == &r_region_edges) {
+				pair->owners[i] = pair->owners[pair->size - 1];
+				--pair->size;
+			} else {
+				pair->owners[i].region->dirty = true;
+				i++;
+			}
+		}
+		if (pair->size == 0) {
+			edge_key_pairs.erase(ek);
+		}
+	}
+	r_region_edges.edge_keys.clear();
+}
+
+gd::Edge::Connection NavMapBuilder3D::_get_edge_key_owner_connection(const NavMapIterationBuild::EdgeKeyOwner &p_owner) {
+	gd::Polygon &poly = p_owner.region->region->navmesh_polygons[p_owner.polygon];
+
+	gd::Edge::Connection connection;
+	connection.polygon = &poly;
+	connection.edge = p_owner.edge;
+	connection.pathway_start = poly.points[p_owner.edge].pos;
+	connection.pathway_end = poly.points[(p_owner.edge + 1) % poly.points.size()].pos;
+	return connection;
 }
 
 void NavMapBuilder3D::_build_step_merge_edge_connection_pairs(NavMapIterationBuild &r_build) {
 	gd::PerformanceData &performance_data = r_build.performance_data;
 
-	HashMap<gd::EdgeKey, gd::EdgeConnectionPair, gd::EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
+	const HashMap<gd::EdgeKey, NavMapIterationBuild::EdgeKeyPair, gd::EdgeKey> &edge_key_pairs = r_build.edge_key_pairs;
 	LocalVector<gd::Edge::Connection> &free_edges = r_build.iter_free_edges;
-	int free_edges_count = r_build.free_edge_count;
 	bool use_edge_connections = r_build.use_edge_connections;
 
 	free_edges.clear();
-	free_edges.reserve(free_edges_count);
 
-	for (const KeyValue<gd::EdgeKey, gd::EdgeConnectionPair> &pair_it : connection_pairs_map) {
-		const gd::EdgeConnectionPair &pair = pair_it.value;
+	// The pairs are already grouped, only the polygons of this iteration need to be connected.
+	for (const KeyValue<gd::EdgeKey, NavMapIterationBuild::EdgeKeyPair> &pair_it : edge_key_pairs) {
+		const NavMapIterationBuild::EdgeKeyPair &pair = pair_it.value;
+		performance_data.pm_edge_count += 1;
 		if (pair.size == 2) {
 			// Connect edge that are shared in different polygons.
-			const gd::Edge::Connection &c1 = pair.connections[0];
-			const gd::Edge::Connection &c2 = pair.connections[1];
+			const gd::Edge::Connection c1 = _get_edge_key_owner_connection(pair.owners[0]);
+			const gd::Edge::Connection c2 = _get_edge_key_owner_connection(pair.owners[1]);
 			c1.polygon->edges[c1.edge].connections.push_back(c2);
 			c2.polygon->edges[c2.edge].connections.push_back(c1);
 			// Note: The pathway_start/end are full for those connection and do not need to be modified.
 			performance_data.pm_edge_merge_count += 1;
 		} else {
 			CRASH_COND_MSG(pair.size != 1, vformat("Number of connection != 1. Found: %d", pair.size));
-			if (use_edge_connections && pair.connections[0].polygon->owner->get_use_edge_connections()) {
-				free_edges.push_back(pair.connections[0]);
+			if (use_edge_connections && pair.owners[0].region->region->get_use_edge_connections()) {
+				free_edges.push_back(_get_edge_key_owner_connection(pair.owners[0]));
 			}
 		}
 	}
@@ -193,6 +316,8 @@ void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapItera
 
 	real_t edge_connection_margin = r_build.edge_connection_margin;
 	LocalVector<gd::Edge::Connection> &free_edges = r_build.iter_free_edges;
+	const LocalVector<NavMapIterationBuild::RegionEdges *> &iter_region_edges = r_build.iter_region_edges;
+	LocalVector<NavMapIterationBuild::EdgeMarginConnection> &edge_margin_connections = r_build.edge_margin_connections;
 	HashMap<uint32_t, LocalVector<gd::Edge::Connection>> &region_external_connections = map_iteration->external_region_connections;
 
 	// Find the compatible near edges.
@@ -206,12 +331,23 @@ void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapItera
 
 	const real_t edge_connection_margin_squared = edge_connection_margin * edge_connection_margin;
 
+	// Only pairs with at least one edge of a changed region are searched, the others are still cached.
+	LocalVector<uint32_t> dirty_free_edges;
+	for (uint32_t i = 0; i < free_edges.size(); i++) {
+		if (iter_region_edges[free_edges[i].polygon->owner->id]->dirty) {
+			dirty_free_edges.push_back(i);
+		}
+	}
+
 	for (uint32_t i = 0; i < free_edges.size(); i++) {
 		const gd::Edge::Connection &free_edge = free_edges[i];
+		NavMapIterationBuild::RegionEdges *free_edge_region = iter_region_edges[free_edge.polygon->owner->id];
 		Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
 		Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
 
-		for (uint32_t j = 0; j < free_edges.size(); j++) {
+		const uint32_t other_edge_count = free_edge_region->dirty ? free_edges.size() : dirty_free_edges.size();
+		for (uint32_t k = 0; k < other_edge_count; k++) {
+			const uint32_t j = free_edge_region->dirty ? k : dirty_free_edges[k];
 			const gd::Edge::Connection &other_edge = free_edges[j];
 			if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
 				continue;
@@ -252,16 +388,33 @@ void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapItera
 			}
 
 			// The edges can now be connected.
-			gd::Edge::Connection new_connection = other_edge;
-			new_connection.pathway_start = (self1 + other1) / 2.0;
-			new_connection.pathway_end = (self2 + other2) / 2.0;
-			free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
-
-			// Add the connection to the region_connection map.
-			region_external_connections[(uint32_t)free_edge.polygon->owner->id].push_back(new_connection);
-			performance_data.pm_edge_connection_count += 1;
+			NavMapIterationBuild::RegionEdges *other_edge_region = iter_region_edges[other_edge.polygon->owner->id];
+
+			NavMapIterationBuild::EdgeMarginConnection margin_connection;
+			margin_connection.from.region = free_edge_region;
+			margin_connection.from.polygon = free_edge.polygon - free_edge_region->region->navmesh_polygons.ptr();
+			margin_connection.from.edge = free_edge.edge;
+			margin_connection.to.region = other_edge_region;
+			margin_connection.to.polygon = other_edge.polygon - other_edge_region->region->navmesh_polygons.ptr();
+			margin_connection.to.edge = other_edge.edge;
+			margin_connection.pathway_start = (self1 + other1) / 2.0;
+			margin_connection.pathway_end = (self2 + other2) / 2.0;
+			edge_margin_connections.push_back(margin_connection);
 		}
 	}
+
+	for (const NavMapIterationBuild::EdgeMarginConnection &margin_connection : edge_margin_connections) {
+		gd::Edge::Connection new_connection = _get_edge_key_owner_connection(margin_connection.to);
+		new_connection.pathway_start = margin_connection.pathway_start;
+		new_connection.pathway_end = margin_connection.pathway_end;
+
+		NavRegionIteration *from_region = margin_connection.from.region->region;
+		from_region->navmesh_polygons[margin_connection.from.polygon].edges[margin_connection.from.edge].connections.push_back(new_connection);
+
+		// Add the connection to the region_connection map.
+		region_external_connections[(uint32_t)from_region->id].push_back(new_connection);
+		performance_data.pm_edge_connection_count += 1;
+	}
 }
 
 void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild &r_build) {
@@ -272,10 +425,21 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild &r_bu
 
 	LocalVector<gd::Polygon> &link_polygons = map_iteration->link_polygons;
 	LocalVector<NavLinkIteration> &links = map_iteration->link_iterations;
+	const LocalVector<NavMapIterationBuild::RegionEdges *> &iter_region_edges = r_build.iter_region_edges;
+	HashMap<RID, NavMapIterationBuild::LinkConnection> &link_connections_cache = r_build.link_connections_cache;
 	int polygon_count = r_build.polygon_count;
 
+	// The closest polygons of a link only need a new search when the link moved or the regions changed.
+	if (r_build.iter_regions_changed || r_build.cached_link_connection_radius != link_connection_radius) {
+		link_connections_cache.clear();
+		r_build.cached_link_connection_radius = link_connection_radius;
+	}
+	const uint32_t build_pass = r_build.edge_build_pass;
+
 	real_t link_connection_radius_sqr = link_connection_radius * link_connection_radius;
 	uint32_t link_poly_idx = 0;
+	// Start from empty polygons so that links without a connection don't keep the state of a previous build.
+	link_polygons.clear();
 	link_polygons.resize(links.size());
 
 	// Search for polygons within range of a nav link.
@@ -286,57 +450,80 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild &r_bu
 		const Vector3 link_start_pos = link.get_start_position();
 		const Vector3 link_end_pos = link.get_end_position();
 
-		gd::Polygon *closest_start_polygon = nullptr;
-		real_t closest_start_sqr_dist = link_connection_radius_sqr;
-		Vector3 closest_start_point;
-
-		gd::Polygon *closest_end_polygon = nullptr;
-		real_t closest_end_sqr_dist = link_connection_radius_sqr;
-		Vector3 closest_end_point;
-
-		for (NavRegionIteration &region : map_iteration->region_iterations) {
-			if (!region.get_enabled()) {
-				continue;
-			}
-			AABB region_bounds = region.get_bounds().grow(link_connection_radius);
-			if (!region_bounds.has_point(link_start_pos) && !region_bounds.has_point(link_end_pos)) {
-				continue;
+		NavMapIterationBuild::LinkConnection *link_connection = link_connections_cache.getptr(link.get_self());
+		if (link_connection == nullptr || link_connection->start_position != link_start_pos || link_connection->end_position != link_end_pos) {
+			if (link_connection == nullptr) {
+				link_connection = &link_connections_cache.insert(link.get_self(), NavMapIterationBuild::LinkConnection())->value;
 			}
+			link_connection->start_position = link_start_pos;
+			link_connection->end_position = link_end_pos;
 
-			for (gd::Polygon &polyon : region.navmesh_polygons) {
-				//for (gd::Polygon &polyon : polygons) {
-				for (uint32_t point_id = 2; point_id < polyon.points.size(); point_id += 1) {
-					const Face3 face(polyon.points[0].pos, polyon.points[point_id - 1].pos, polyon.points[point_id].pos);
+			NavMapIterationBuild::EdgeKeyOwner closest_start_owner;
+			real_t closest_start_sqr_dist = link_connection_radius_sqr;
+			Vector3 closest_start_point;
 
-					{
-						const Vector3 start_point = face.get_closest_point_to(link_start_pos);
-						const real_t sqr_dist = start_point.distance_squared_to(link_start_pos);
+			NavMapIterationBuild::EdgeKeyOwner closest_end_owner;
+			real_t closest_end_sqr_dist = link_connection_radius_sqr;
+			Vector3 closest_end_point;
 
-						// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-						if (sqr_dist < closest_start_sqr_dist) {
-							closest_start_sqr_dist = sqr_dist;
-							closest_start_point = start_point;
-							closest_start_polygon = &polyon;
-						}
-					}
+			for (NavRegionIteration &region : map_iteration->region_iterations) {
+				if (!region.get_enabled()) {
+					continue;
+				}
+				AABB region_bounds = region.get_bounds().grow(link_connection_radius);
+				if (!region_bounds.has_point(link_start_pos) && !region_bounds.has_point(link_end_pos)) {
+					continue;
+				}
 
-					{
-						const Vector3 end_point = face.get_closest_point_to(link_end_pos);
-						const real_t sqr_dist = end_point.distance_squared_to(link_end_pos);
+				for (uint32_t polygon_index = 0; polygon_index < region.navmesh_polygons.size(); polygon_index++) {
+					const gd::Polygon &polyon = region.navmesh_polygons[polygon_index];
+					for (uint32_t point_id = 2; point_id < polyon.points.size(); point_id += 1) {
+						const Face3 face(polyon.points[0].pos, polyon.points[point_id - 1].pos, polyon.points[point_id].pos);
+
+						{
+							const Vector3 start_point = face.get_closest_point_to(link_start_pos);
+							const real_t sqr_dist = start_point.distance_squared_to(link_start_pos);
+
+							// Pick the polygon that is within our radius and is closer than anything we've seen yet.
+							if (sqr_dist < closest_start_sqr_dist) {
+								closest_start_sqr_dist = sqr_dist;
+								closest_start_point = start_point;
+								closest_start_owner.region = iter_region_edges[region.id];
+								closest_start_owner.polygon = polygon_index;
+							}
+						}
 
-						// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-						if (sqr_dist < closest_end_sqr_dist) {
-							closest_end_sqr_dist = sqr_dist;
-							closest_end_point = end_point;
-							closest_end_polygon = &polyon;
+						{
+							const Vector3 end_point = face.get_closest_point_to(link_end_pos);
+							const real_t sqr_dist = end_point.distance_squared_to(link_end_pos);
+
+							// Pick the polygon that is within our radius and is closer than anything we've seen yet.
+							if (sqr_dist < closest_end_sqr_dist) {
+								closest_end_sqr_dist = sqr_dist;
+								closest_end_point = end_point;
+								closest_end_owner.region = iter_region_edges[region.id];
+								closest_end_owner.polygon = polygon_index;
+							}
 						}
 					}
 				}
 			}
+
+			link_connection->connected = closest_start_owner.region && closest_end_owner.region;
+			link_connection->start = closest_start_owner;
+			link_connection->end = closest_end_owner;
+			link_connection->start_point = closest_start_point;
+			link_connection->end_point = closest_end_point;
 		}
+		link_connection->build_pass = build_pass;
 
 		// If we have both a start and end point, then create a synthetic polygon to route through.
-		if (closest_start_polygon && closest_end_polygon) {
+		if (link_connection->connected) {
+			gd::Polygon *closest_start_polygon = &link_connection->start.region->region->navmesh_polygons[link_connection->start.polygon];
+			gd::Polygon *closest_end_polygon = &link_connection->end.region->region->navmesh_polygons[link_connection->end.polygon];
+			const Vector3 closest_start_point = link_connection->start_point;
+			const Vector3 closest_end_point = link_connection->end_point;
+
 			gd::Polygon &new_polygon = link_polygons[link_poly_idx++];
 			new_polygon.id = polygon_count++;
 			new_polygon.owner = &link;
@@ -386,6 +573,219 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild &r_bu
 			}
 		}
 	}
+
+	// Forget the links that left the map.
+	LocalVector<RID> removed_links;
+	for (const KeyValue<RID, NavMapIterationBuild::LinkConnection> &link_connection_it : link_connections_cache) {
+		if (link_connection_it.value.build_pass != build_pass) {
+			removed_links.push_back(link_connection_it.key);
+		}
+	}
+	for (const RID &link_rid : removed_links) {
+		link_connections_cache.erase(link_rid);
+	}
+}
+
+void NavMapBuilder3D::_build_region_clusters(const NavRegionIteration &p_region, real_t p_cluster_size, LocalVector<uint32_t> &r_polygon_clusters, uint32_t &r_cluster_count) {
+	const LocalVector<gd::Polygon> &polygons = p_region.navmesh_polygons;
+	const gd::Polygon *polygons_ptr = polygons.ptr();
+
+	// Bucket the polygons by the grid cell that contains their center.
+	LocalVector<Vector3i> polygon_cells;
+	polygon_cells.resize(polygons.size());
+	for (uint32_t i = 0; i < polygons.size(); i++) {
+		const gd::Polygon &polygon = polygons[i];
+		Vector3 center;
+		for (const gd::Point &point : polygon.points) {
+			center += point.pos;
+		}
+		if (polygon.points.size() > 0) {
+			center /= polygon.points.size();
+		}
+		polygon_cells[i] = Vector3i((center / p_cluster_size).floor());
+	}
+
+	// Flood fill the polygons connected within the same cell so a cluster is never split by a wall or a gap.
+	r_polygon_clusters.clear();
+	r_polygon_clusters.resize(polygons.size());
+	for (uint32_t &polygon_cluster : r_polygon_clusters) {
+		polygon_cluster = UINT32_MAX;
+	}
+	r_cluster_count = 0;
+
+	LocalVector<uint32_t> stack;
+	for (uint32_t i = 0; i < polygons.size(); i++) {
+		if (r_polygon_clusters[i] != UINT32_MAX) {
+			continue;
+		}
+
+		const uint32_t cluster_id = r_cluster_count++;
+		r_polygon_clusters[i] = cluster_id;
+		stack.push_back(i);
+
+		while (!stack.is_empty()) {
+			const uint32_t polygon_index = stack[stack.size() - 1];
+			stack.remove_at(stack.size() - 1);
+
+			for (const gd::Edge &edge : polygons[polygon_index].edges) {
+				for (const gd::Edge::Connection &connection : edge.connections) {
+					if (connection.polygon->owner != &p_region) {
+						continue;
+					}
+					const uint32_t neighbor_index = connection.polygon - polygons_ptr;
+					if (r_polygon_clusters[neighbor_index] != UINT32_MAX || polygon_cells[neighbor_index] != polygon_cells[i]) {
+						continue;
+					}
+					r_polygon_clusters[neighbor_index] = cluster_id;
+					stack.push_back(neighbor_index);
+				}
+			}
+		}
+	}
+}
+
+void NavMapBuilder3D::_build_step_cluster_graph(NavMapIterationBuild &r_build) {
+	NavMapIteration *map_iteration = r_build.map_iteration;
+
+	LocalVector<gd::Cluster> &clusters = map_iteration->clusters;
+	HashMap<RID, NavMapIterationBuild::RegionClusters> &region_clusters_cache = r_build.region_clusters_cache;
+	const real_t cluster_size = r_build.cluster_size;
+
+	clusters.clear();
+	map_iteration->cluster_size = cluster_size;
+	map_iteration->cluster_min_travel_cost = 1.0;
+
+	if (cluster_size <= 0.0) {
+		region_clusters_cache.clear();
+		return;
+	}
+
+	const uint32_t build_pass = ++r_build.cluster_build_pass;
+	LocalVector<uint32_t> cluster_polygon_counts;
+
+	// Assign the region polygons to clusters, reusing the partition of regions that did not change.
+	for (NavRegionIteration &region : map_iteration->region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+
+		NavMapIterationBuild::RegionClusters *region_clusters = region_clusters_cache.getptr(region.get_self());
+		if (region_clusters == nullptr) {
+			region_clusters = &region_clusters_cache.insert(region.get_self(), NavMapIterationBuild::RegionClusters())->value;
+		}
+		if (region_clusters->build_pass == 0 || region_clusters->region_iteration_id != region.get_iteration_id() || region_clusters->cluster_size != cluster_size) {
+			_build_region_clusters(region, cluster_size, region_clusters->polygon_clusters, region_clusters->cluster_count);
+			region_clusters->region_iteration_id = region.get_iteration_id();
+			region_clusters->cluster_size = cluster_size;
+		}
+		region_clusters->build_pass = build_pass;
+
+		const uint32_t first_cluster = clusters.size();
+		clusters.resize(first_cluster + region_clusters->cluster_count);
+		cluster_polygon_counts.resize(clusters.size());
+		for (uint32_t i = first_cluster; i < clusters.size(); i++) {
+			clusters[i].owner = &region;
+			cluster_polygon_counts[i] = 0;
+		}
+
+		for (uint32_t i = 0; i < region.navmesh_polygons.size(); i++) {
+			gd::Polygon &polygon = region.navmesh_polygons[i];
+			polygon.cluster = first_cluster + region_clusters->polygon_clusters[i];
+
+			Vector3 center;
+			for (const gd::Point &point : polygon.points) {
+				center += point.pos;
+			}
+			if (polygon.points.size() > 0) {
+				center /= polygon.points.size();
+			}
+			clusters[polygon.cluster].center += center;
+			cluster_polygon_counts[polygon.cluster] += 1;
+		}
+	}
+
+	// Each link gets a cluster of its own.
+	for (gd::Polygon &link_polygon : map_iteration->link_polygons) {
+		if (link_polygon.owner == nullptr) {
+			continue;
+		}
+		link_polygon.cluster = clusters.size();
+
+		gd::Cluster cluster;
+		cluster.owner = link_polygon.owner;
+		cluster.center = (link_polygon.points[0].pos + link_polygon.points[2].pos) * 0.5;
+		clusters.push_back(cluster);
+		cluster_polygon_counts.push_back(1);
+	}
+
+	real_t min_travel_cost = FLT_MAX;
+	for (uint32_t i = 0; i < clusters.size(); i++) {
+		if (cluster_polygon_counts[i] > 1) {
+			clusters[i].center /= cluster_polygon_counts[i];
+		}
+		min_travel_cost = MIN(min_travel_cost, clusters[i].owner->get_travel_cost());
+	}
+	if (!clusters.is_empty()) {
+		map_iteration->cluster_min_travel_cost = min_travel_cost;
+	}
+
+	// Connect the clusters along the polygon connections that cross a cluster border.
+	const auto connect_polygon = [&clusters](const gd::Polygon &p_polygon) {
+		gd::Cluster &cluster = clusters[p_polygon.cluster];
+		for (const gd::Edge &edge : p_polygon.edges) {
+			for (const gd::Edge::Connection &connection : edge.connections) {
+				const uint32_t neighbor_id = connection.polygon->cluster;
+				if (neighbor_id == p_polygon.cluster || neighbor_id == UINT32_MAX) {
+					continue;
+				}
+
+				bool already_connected = false;
+				for (const gd::ClusterConnection &cluster_connection : cluster.connections) {
+					if (cluster_connection.cluster == neighbor_id) {
+						already_connected = true;
+						break;
+					}
+				}
+				if (already_connected) {
+					continue;
+				}
+
+				const gd::Cluster &neighbor = clusters[neighbor_id];
+				gd::ClusterConnection cluster_connection;
+				cluster_connection.cluster = neighbor_id;
+				cluster_connection.cost = cluster.center.distance_to(neighbor.center) * (cluster.owner->get_travel_cost() + neighbor.owner->get_travel_cost()) * 0.5;
+				if (neighbor.owner != cluster.owner) {
+					cluster_connection.cost += neighbor.owner->get_enter_cost();
+				}
+				cluster.connections.push_back(cluster_connection);
+			}
+		}
+	};
+
+	for (const NavRegionIteration &region : map_iteration->region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+		for (const gd::Polygon &polygon : region.navmesh_polygons) {
+			connect_polygon(polygon);
+		}
+	}
+	for (const gd::Polygon &link_polygon : map_iteration->link_polygons) {
+		if (link_polygon.owner != nullptr) {
+			connect_polygon(link_polygon);
+		}
+	}
+
+	// Forget the partition of regions that are no longer part of the map.
+	LocalVector<RID> stale_regions;
+	for (const KeyValue<RID, NavMapIterationBuild::RegionClusters> &E : region_clusters_cache) {
+		if (E.value.build_pass != build_pass) {
+			stale_regions.push_back(E.key);
+		}
+	}
+	for (const RID &stale_region : stale_regions) {
+		region_clusters_cache.erase(stale_region);
+	}
 }
 
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild &r_build) {
@@ -402,8 +802,16 @@ void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild &r_build)
 		p_path_query_slot.traversable_polys.reserve(map_iteration->navmesh_polygon_count * 0.25);
 		p_path_query_slot.path_corridor.clear();
 		p_path_query_slot.path_corridor.resize(map_iteration->navmesh_polygon_count + map_iteration->link_polygon_count);
+		p_path_query_slot.traversable_clusters.clear();
+		p_path_query_slot.traversable_clusters.reserve(map_iteration->clusters.size() * 0.25);
+		p_path_query_slot.cluster_corridor.clear();
+		p_path_query_slot.cluster_corridor.resize(map_iteration->clusters.size());
 	}
 	map_iteration->path_query_slots_mutex.unlock();
+
+	map_iteration->path_corridor_cache_mutex.lock();
+	map_iteration->path_corridor_cache.clear();
+	map_iteration->path_corridor_cache_mutex.unlock();
 }
 
 #endif // _3D_DISABLED
@@ -32,15 +32,21 @@
 #define NAV_MAP_BUILDER_3D_H
 
 #include "../nav_utils.h"
+#include "nav_map_iteration_3d.h"
 
-struct NavMapIterationBuild;
+struct NavRegionIteration;
 
 class NavMapBuilder3D {
 	static void _build_step_gather_region_polygons(NavMapIterationBuild &r_build);
-	static void _build_step_find_edge_connection_pairs(NavMapIterationBuild &r_build);
+	static void _build_step_update_edge_keys(NavMapIterationBuild &r_build);
+	static void _add_region_edge_keys(NavMapIterationBuild &r_build, NavMapIterationBuild::RegionEdges &r_region_edges);
+	static void _remove_region_edge_keys(NavMapIterationBuild &r_build, NavMapIterationBuild::RegionEdges &r_region_edges);
+	static gd::Edge::Connection _get_edge_key_owner_connection(const NavMapIterationBuild::EdgeKeyOwner &p_owner);
 	static void _build_step_merge_edge_connection_pairs(NavMapIterationBuild &r_build);
 	static void _build_step_edge_connection_margin_connections(NavMapIterationBuild &r_build);
 	static void _build_step_navlink_connections(NavMapIterationBuild &r_build);
+	static void _build_step_cluster_graph(NavMapIterationBuild &r_build);
+	static void _build_region_clusters(const NavRegionIteration &p_region, real_t p_cluster_size, LocalVector<uint32_t> &r_polygon_clusters, uint32_t &r_cluster_count);
 	static void _build_update_map_iteration(NavMapIterationBuild &r_build);
 
 public:
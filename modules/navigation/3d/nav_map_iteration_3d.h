@@ -48,13 +48,81 @@ struct NavMapIterationBuild {
 	bool use_edge_connections = true;
 	real_t edge_connection_margin;
 	real_t link_connection_radius;
+	real_t cluster_size = 0.0;
 	gd::PerformanceData performance_data;
 	int polygon_count = 0;
-	int free_edge_count = 0;
 
-	HashMap<gd::EdgeKey, gd::EdgeConnectionPair, gd::EdgeKey> iter_connection_pairs_map;
 	LocalVector<gd::Edge::Connection> iter_free_edges;
 
+	// The edge keys of the regions are kept between builds so only the regions
+	// that changed their polygons are rehashed. Connections are stored as polygon
+	// indices, as every build gets a fresh copy of the region polygons.
+	struct RegionEdges;
+
+	struct EdgeKeyOwner {
+		RegionEdges *region = nullptr;
+		uint32_t polygon = 0;
+		uint32_t edge = 0;
+	};
+
+	struct EdgeKeyPair {
+		EdgeKeyOwner owners[2];
+		int size = 0;
+	};
+
+	struct RegionEdges {
+		uint32_t region_iteration_id = 0;
+		uint32_t build_pass = 0;
+		// Set when any edge pair of this region changed in the current build.
+		bool dirty = true;
+		NavRegionIteration *region = nullptr;
+		LocalVector<gd::EdgeKey> edge_keys;
+	};
+
+	struct EdgeMarginConnection {
+		EdgeKeyOwner from;
+		EdgeKeyOwner to;
+		Vector3 pathway_start;
+		Vector3 pathway_end;
+	};
+
+	struct LinkConnection {
+		uint32_t build_pass = 0;
+		Vector3 start_position;
+		Vector3 end_position;
+		bool connected = false;
+		EdgeKeyOwner start;
+		EdgeKeyOwner end;
+		Vector3 start_point;
+		Vector3 end_point;
+	};
+
+	HashMap<RID, RegionEdges> region_edges_cache;
+	HashMap<gd::EdgeKey, EdgeKeyPair, gd::EdgeKey> edge_key_pairs;
+	LocalVector<EdgeMarginConnection> edge_margin_connections;
+	HashMap<RID, LinkConnection> link_connections_cache;
+	LocalVector<RegionEdges *> iter_region_edges;
+	bool iter_regions_changed = true;
+	uint32_t edge_build_pass = 0;
+
+	// The settings the cached edge state was built with, a change discards the cache.
+	Vector3 cached_merge_rasterizer_cell_size;
+	bool cached_use_edge_connections = true;
+	real_t cached_edge_connection_margin = -1.0;
+	real_t cached_link_connection_radius = -1.0;
+
+	// The cluster partition of each region is kept between builds and only
+	// recomputed for regions that changed their polygons.
+	struct RegionClusters {
+		uint32_t region_iteration_id = 0;
+		real_t cluster_size = 0.0;
+		uint32_t cluster_count = 0;
+		uint32_t build_pass = 0;
+		LocalVector<uint32_t> polygon_clusters;
+	};
+	HashMap<RID, RegionClusters> region_clusters_cache;
+	uint32_t cluster_build_pass = 0;
+
 	NavMapIteration *map_iteration = nullptr;
 
 	int navmesh_polygon_count = 0;
@@ -63,10 +131,10 @@ struct NavMapIterationBuild {
 	void reset() {
 		performance_data.reset();
 
-		iter_connection_pairs_map.clear();
 		iter_free_edges.clear();
+		iter_region_edges.clear();
+		iter_regions_changed = true;
 		polygon_count = 0;
-		free_edge_count = 0;
 
 		navmesh_polygon_count = 0;
 		link_polygon_count = 0;
@@ -89,11 +157,22 @@ struct NavMapIteration {
 	// The edge connections that the map builds on top with the edge connection margin.
 	HashMap<uint32_t, LocalVector<gd::Edge::Connection>> external_region_connections;
 
+	// The abstract cluster graph used to route path queries before the polygon search.
+	LocalVector<gd::Cluster> clusters;
+	real_t cluster_size = 0.0;
+	// The lowest travel cost of the clustered regions and links, which keeps the cluster search heuristic admissible.
+	real_t cluster_min_travel_cost = 1.0;
+
 	HashMap<NavRegion *, uint32_t> region_ptr_to_region_id;
 
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
+
+	// Cleared with every rebuild, so cached corridors never outlive the polygons they point to.
+	uint32_t path_corridor_cache_size = 0;
+	mutable NavMeshQueries3D::PathCorridorCache path_corridor_cache;
+	Mutex path_corridor_cache_mutex;
 };
 
 class NavMapIterationRead {
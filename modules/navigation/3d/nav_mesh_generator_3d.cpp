@@ -266,166 +266,128 @@ void NavMeshGenerator3D::generator_parse_source_geometry_data(const Ref<Navigati
 	}
 }
 
-void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data) {
-	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
-		return;
-	}
-
-	Vector<float> source_geometry_vertices;
-	Vector<int> source_geometry_indices;
-	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
-
-	p_source_geometry_data->get_data(
-			source_geometry_vertices,
-			source_geometry_indices,
-			projected_obstructions);
-
-	if (source_geometry_vertices.size() < 3 || source_geometry_indices.size() < 3) {
-		return;
-	}
-
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
-
-	// added to keep track of steps, no functionality right now
-	String bake_state = "";
-
-	bake_state = "Setting up Configuration..."; // step #1
-
-	const float *verts = source_geometry_vertices.ptr();
-	const int nverts = source_geometry_vertices.size() / 3;
-	const int *tris = source_geometry_indices.ptr();
-	const int ntris = source_geometry_indices.size() / 3;
-
-	float bmin[3], bmax[3];
-	rcCalcBounds(verts, nverts, bmin, bmax);
+static void generator_init_config(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &r_cfg) {
+	memset(&r_cfg, 0, sizeof(r_cfg));
 
-	rcConfig cfg;
-	memset(&cfg, 0, sizeof(cfg));
-
-	cfg.cs = p_navigation_mesh->get_cell_size();
-	cfg.ch = p_navigation_mesh->get_cell_height();
+	r_cfg.cs = p_navigation_mesh->get_cell_size();
+	r_cfg.ch = p_navigation_mesh->get_cell_height();
 	if (p_navigation_mesh->get_border_size() > 0.0) {
-		cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / cfg.cs);
-	}
-	cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
-	cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / cfg.ch);
-	cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / cfg.ch);
-	cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / cfg.cs);
-	cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
-	cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
-	cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
-	cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
-	cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
-	cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
-	cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
+		r_cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / r_cfg.cs);
+	}
+	r_cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
+	r_cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / r_cfg.ch);
+	r_cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / r_cfg.ch);
+	r_cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / r_cfg.cs);
+	r_cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
+	r_cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
+	r_cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
+	r_cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
+	r_cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
+	r_cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
+	r_cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
 
 	if (p_navigation_mesh->get_border_size() > 0.0 && Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()) != 0.0) {
 		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_navigation_mesh->get_agent_height())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableHeight * r_cfg.ch, p_navigation_mesh->get_agent_height())) {
 		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableClimb * cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableClimb * r_cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
 		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableRadius * cfg.cs, p_navigation_mesh->get_agent_radius())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableRadius * r_cfg.cs, p_navigation_mesh->get_agent_radius())) {
 		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.maxEdgeLen * cfg.cs, p_navigation_mesh->get_edge_max_length())) {
+	if (!Math::is_equal_approx((float)r_cfg.maxEdgeLen * r_cfg.cs, p_navigation_mesh->get_edge_max_length())) {
 		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
+	if (!Math::is_equal_approx((float)r_cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
 		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
+	if (!Math::is_equal_approx((float)r_cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
 		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
+	if (!Math::is_equal_approx((float)r_cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
 		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
 	}
 	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
 		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
 	}
+}
 
-	cfg.bmin[0] = bmin[0];
-	cfg.bmin[1] = bmin[1];
-	cfg.bmin[2] = bmin[2];
-	cfg.bmax[0] = bmax[0];
-	cfg.bmax[1] = bmax[1];
-	cfg.bmax[2] = bmax[2];
-
-	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
-	if (baking_aabb.has_volume()) {
-		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
-		cfg.bmin[0] = baking_aabb.position[0] + baking_aabb_offset.x;
-		cfg.bmin[1] = baking_aabb.position[1] + baking_aabb_offset.y;
-		cfg.bmin[2] = baking_aabb.position[2] + baking_aabb_offset.z;
-		cfg.bmax[0] = cfg.bmin[0] + baking_aabb.size[0];
-		cfg.bmax[1] = cfg.bmin[1] + baking_aabb.size[1];
-		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
-	}
-
-	bake_state = "Calculating grid size..."; // step #2
-	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+static bool generator_bake_recast(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons, const float *p_clip_bmin = nullptr, const float *p_clip_bmax = nullptr) {
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	rcContext ctx;
 
-	// ~30000000 seems to be around sweetspot where Editor baking breaks
-	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
-		ERR_FAIL_MSG("Baking interrupted."
-					 "\nNavigationMesh baking process would likely crash the engine."
-					 "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
-					 "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
-					 "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
-					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
-		return;
-	}
+	// added to keep track of steps, no functionality right now
+	String bake_state = "";
 
 	bake_state = "Creating heightfield..."; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, p_cfg.width, p_cfg.height, p_cfg.bmin, p_cfg.bmax, p_cfg.cs, p_cfg.ch), false);
 
 	bake_state = "Marking walkable triangles..."; // step #4
 	{
 		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
+		tri_areas.resize(p_ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, p_cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, p_cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+		rcFilterLowHangingWalkableObstacles(&ctx, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+		rcFilterLedgeSpans(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+		rcFilterWalkableLowHeightSpans(&ctx, p_cfg.walkableHeight, *hf);
 	}
 
 	bake_state = "Constructing compact heightfield..."; // step #5
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
+	// Cells outside the clip bounds are not walkable, so the walkable area is eroded from the clip bounds
+	// as it is from the heightfield bounds. A cell is outside when its center is.
+	if (p_clip_bmin && p_clip_bmax) {
+		const float half_cell = p_cfg.cs * 0.5;
+		float box_min[3] = { p_cfg.bmin[0], p_cfg.bmin[1], p_cfg.bmin[2] };
+		float box_max[3] = { p_cfg.bmax[0], p_cfg.bmax[1], p_cfg.bmax[2] };
+		for (int axis = 0; axis <= 2; axis += 2) {
+			if (p_clip_bmin[axis] - half_cell > p_cfg.bmin[axis]) {
+				float strip_max[3] = { box_max[0], box_max[1], box_max[2] };
+				strip_max[axis] = p_clip_bmin[axis] - half_cell;
+				rcMarkBoxArea(&ctx, box_min, strip_max, RC_NULL_AREA, *chf);
+			}
+			if (p_clip_bmax[axis] + half_cell < p_cfg.bmax[axis]) {
+				float strip_min[3] = { box_min[0], box_min[1], box_min[2] };
+				strip_min[axis] = p_clip_bmax[axis] + half_cell;
+				rcMarkBoxArea(&ctx, strip_min, box_max, RC_NULL_AREA, *chf);
+			}
+		}
+	}
+
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -442,11 +404,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	bake_state = "Eroding walkable area..."; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, p_cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -464,30 +426,30 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	bake_state = "Partitioning..."; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea), false);
 	}
 
 	bake_state = "Creating contours..."; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, p_cfg.maxSimplificationError, p_cfg.maxEdgeLen, *cset), false);
 
 	bake_state = "Creating polymesh..."; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, p_cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, p_cfg.detailSampleDist, p_cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
@@ -496,8 +458,8 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	bake_state = "Converting to native navigation mesh..."; // step #10
 
-	Vector<Vector3> nav_vertices;
-	Vector<Vector<int>> nav_polygons;
+	r_vertices.clear();
+	r_polygons.clear();
 
 	HashMap<Vector3, int> recast_vertex_to_native_index;
 	LocalVector<int> recast_index_to_native_index;
@@ -511,7 +473,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			int new_index = recast_vertex_to_native_index.size();
 			recast_index_to_native_index[i] = new_index;
 			recast_vertex_to_native_index[vertex] = new_index;
-			nav_vertices.push_back(vertex);
+			r_vertices.push_back(vertex);
 		} else {
 			recast_index_to_native_index[i] = *existing_index_ptr;
 		}
@@ -535,12 +497,10 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			nav_indices.write[1] = recast_index_to_native_index[index2];
 			nav_indices.write[2] = recast_index_to_native_index[index3];
 
-			nav_polygons.push_back(nav_indices);
+			r_polygons.push_back(nav_indices);
 		}
 	}
 
-	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
-
 	bake_state = "Cleanup..."; // step #11
 
 	rcFreePolyMesh(poly_mesh);
@@ -549,6 +509,513 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	detail_mesh = nullptr;
 
 	bake_state = "Baking finished."; // step #12
+
+	return true;
+}
+
+struct NavMeshGeneratorTile3D {
+	Vector2i coords;
+	// Source triangles overlapping the tile and its border.
+	LocalVector<int> triangles;
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+	float min_height = FLT_MAX;
+	float max_height = -FLT_MAX;
+	uint32_t source_hash = 0;
+	Vector<Vector3> vertices;
+	Vector<Vector<int>> polygons;
+};
+
+struct NavMeshGeneratorTiledBake3D {
+	Ref<NavigationMesh> navigation_mesh;
+	rcConfig cfg;
+	int tile_cells = 0;
+	const float *verts = nullptr;
+	int nverts = 0;
+	const int *tris = nullptr;
+	LocalVector<NavMeshGeneratorTile3D> tiles;
+	LocalVector<uint32_t> dirty_tiles;
+	// The filter baking AABB, tiles are clipped to it when it is set.
+	bool clip = false;
+	float clip_bmin[3] = {};
+	float clip_bmax[3] = {};
+};
+
+static void generator_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshGeneratorTiledBake3D *tiled_bake = static_cast<NavMeshGeneratorTiledBake3D *>(p_arg);
+	NavMeshGeneratorTile3D &tile = tiled_bake->tiles[tiled_bake->dirty_tiles[p_index]];
+
+	// The border is rasterized for erosion and region building but cut off from the result,
+	// so each tile ends exactly at its bounds.
+	rcConfig cfg = tiled_bake->cfg;
+	const float tile_world_size = tiled_bake->tile_cells * cfg.cs;
+	const float tile_min[2] = { tile.coords.x * tile_world_size, tile.coords.y * tile_world_size };
+	cfg.borderSize = cfg.walkableRadius + 3;
+
+	// Tiles on the edge of the filter baking AABB only cover the cells it overlaps. The cells stay
+	// aligned to the world, so that the tile borders still match their neighbors.
+	int cells_begin[2] = { 0, 0 };
+	int cells_end[2] = { tiled_bake->tile_cells, tiled_bake->tile_cells };
+	if (tiled_bake->clip) {
+		for (int i = 0; i < 2; i++) {
+			cells_begin[i] = CLAMP((int)Math::floor((tiled_bake->clip_bmin[i * 2] - tile_min[i]) / cfg.cs), 0, tiled_bake->tile_cells);
+			cells_end[i] = CLAMP((int)Math::ceil((tiled_bake->clip_bmax[i * 2] - tile_min[i]) / cfg.cs), cells_begin[i], tiled_bake->tile_cells);
+		}
+	}
+
+	cfg.width = cells_end[0] - cells_begin[0] + cfg.borderSize * 2;
+	cfg.height = cells_end[1] - cells_begin[1] + cfg.borderSize * 2;
+	cfg.bmin[0] = tile_min[0] + (cells_begin[0] - cfg.borderSize) * cfg.cs;
+	cfg.bmin[1] = tile.min_height;
+	cfg.bmin[2] = tile_min[1] + (cells_begin[1] - cfg.borderSize) * cfg.cs;
+	cfg.bmax[0] = tile_min[0] + (cells_end[0] + cfg.borderSize) * cfg.cs;
+	cfg.bmax[1] = tile.max_height;
+	cfg.bmax[2] = tile_min[1] + (cells_end[1] + cfg.borderSize) * cfg.cs;
+
+	LocalVector<int> tile_tris;
+	tile_tris.resize(tile.triangles.size() * 3);
+	for (uint32_t i = 0; i < tile.triangles.size(); i++) {
+		const int *tri = &tiled_bake->tris[tile.triangles[i] * 3];
+		tile_tris[i * 3 + 0] = tri[0];
+		tile_tris[i * 3 + 1] = tri[1];
+		tile_tris[i * 3 + 2] = tri[2];
+	}
+
+	generator_bake_recast(tiled_bake->navigation_mesh, cfg, tiled_bake->verts, tiled_bake->nverts, tile_tris.ptr(), tile.triangles.size(), tile.projected_obstructions, tile.vertices, tile.polygons, tiled_bake->clip ? tiled_bake->clip_bmin : nullptr, tiled_bake->clip ? tiled_bake->clip_bmax : nullptr);
+}
+
+static uint32_t generator_find_welded_vertex(LocalVector<int> &p_welded_vertices, int p_index) {
+	while (p_welded_vertices[p_index] != p_index) {
+		p_welded_vertices[p_index] = p_welded_vertices[p_welded_vertices[p_index]];
+		p_index = p_welded_vertices[p_index];
+	}
+	return p_index;
+}
+
+// Tiles are baked independently, so the vertices on both sides of a tile border rarely match.
+// Welds the border vertices that are close and splits the border edges at the vertices of the other side,
+// so that the polygons of neighboring tiles share their edges and get connected by the region.
+static void generator_stitch_tiles(const LocalVector<NavMeshGeneratorTile3D> &p_tiles, float p_tile_world_size, float p_cell_size, float p_height_tolerance, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	LocalVector<Vector3> vertices;
+	LocalVector<LocalVector<int>> polygons;
+	for (const NavMeshGeneratorTile3D &tile : p_tiles) {
+		const int vertex_offset = vertices.size();
+		for (const Vector3 &vertex : tile.vertices) {
+			vertices.push_back(vertex);
+		}
+		for (const Vector<int> &tile_polygon : tile.polygons) {
+			LocalVector<int> polygon;
+			for (int index : tile_polygon) {
+				polygon.push_back(index + vertex_offset);
+			}
+			polygons.push_back(polygon);
+		}
+	}
+
+	struct BorderVertex {
+		float along = 0.0;
+		float height = 0.0;
+		int index = 0;
+
+		bool operator<(const BorderVertex &p_other) const {
+			return along == p_other.along ? height < p_other.height : along < p_other.along;
+		}
+	};
+
+	const float tolerance = p_cell_size * 0.5;
+
+	// Snap the vertices close to a tile border onto it.
+	for (Vector3 &vertex : vertices) {
+		for (int axis = 0; axis < 2; axis++) {
+			real_t &coord = axis == 0 ? vertex.x : vertex.z;
+			const real_t border = Math::round(coord / p_tile_world_size) * p_tile_world_size;
+			if (Math::abs(coord - border) <= tolerance) {
+				coord = border;
+			}
+		}
+	}
+
+	// Border lines are keyed by (axis, line index) and hold their vertices sorted along the line.
+	HashMap<Vector2i, LocalVector<BorderVertex>> borders;
+	for (uint32_t i = 0; i < vertices.size(); i++) {
+		const Vector3 &vertex = vertices[i];
+		for (int axis = 0; axis < 2; axis++) {
+			const real_t coord = axis == 0 ? vertex.x : vertex.z;
+			const int line = (int)Math::round(coord / p_tile_world_size);
+			if (coord != line * p_tile_world_size) {
+				continue;
+			}
+			borders[Vector2i(axis, line)].push_back({ (float)(axis == 0 ? vertex.z : vertex.x), (float)vertex.y, (int)i });
+		}
+	}
+
+	LocalVector<int> welded_vertices;
+	welded_vertices.resize(vertices.size());
+	for (uint32_t i = 0; i < vertices.size(); i++) {
+		welded_vertices[i] = i;
+	}
+
+	for (KeyValue<Vector2i, LocalVector<BorderVertex>> &E : borders) {
+		LocalVector<BorderVertex> &border_vertices = E.value;
+		border_vertices.sort();
+
+		// Keep one vertex per welded group, stacked floors stay apart by their height.
+		LocalVector<BorderVertex> kept_vertices;
+		for (const BorderVertex &border_vertex : border_vertices) {
+			int match = -1;
+			for (int j = (int)kept_vertices.size() - 1; j >= 0 && kept_vertices[j].along >= border_vertex.along - tolerance; j--) {
+				if (Math::abs(kept_vertices[j].height - border_vertex.height) <= p_height_tolerance) {
+					match = j;
+					break;
+				}
+			}
+			if (match >= 0) {
+				const uint32_t a = generator_find_welded_vertex(welded_vertices, border_vertex.index);
+				const uint32_t b = generator_find_welded_vertex(welded_vertices, kept_vertices[match].index);
+				welded_vertices[a] = b;
+			} else {
+				kept_vertices.push_back(border_vertex);
+			}
+		}
+		border_vertices = kept_vertices;
+	}
+
+	LocalVector<int> vertex_remap;
+	vertex_remap.resize(vertices.size());
+	r_vertices.clear();
+	for (uint32_t i = 0; i < vertices.size(); i++) {
+		if (generator_find_welded_vertex(welded_vertices, i) == i) {
+			vertex_remap[i] = r_vertices.size();
+			r_vertices.push_back(vertices[i]);
+		}
+	}
+
+	r_polygons.clear();
+	for (const LocalVector<int> &polygon : polygons) {
+		LocalVector<int> welded_polygon;
+		for (int index : polygon) {
+			const int welded_index = generator_find_welded_vertex(welded_vertices, index);
+			if (welded_polygon.is_empty() || welded_polygon[welded_polygon.size() - 1] != welded_index) {
+				welded_polygon.push_back(welded_index);
+			}
+		}
+		if (welded_polygon.size() > 1 && welded_polygon[0] == welded_polygon[welded_polygon.size() - 1]) {
+			welded_polygon.remove_at(welded_polygon.size() - 1);
+		}
+		if (welded_polygon.size() < 3) {
+			continue;
+		}
+
+		Vector<int> stitched_polygon;
+		for (uint32_t i = 0; i < welded_polygon.size(); i++) {
+			const int index_a = welded_polygon[i];
+			const int index_b = welded_polygon[(i + 1) % welded_polygon.size()];
+			stitched_polygon.push_back(vertex_remap[index_a]);
+
+			const Vector3 &vertex_a = vertices[index_a];
+			const Vector3 &vertex_b = vertices[index_b];
+			for (int axis = 0; axis < 2; axis++) {
+				const real_t coord = axis == 0 ? vertex_a.x : vertex_a.z;
+				const int line = (int)Math::round(coord / p_tile_world_size);
+				if (coord != line * p_tile_world_size || coord != (axis == 0 ? vertex_b.x : vertex_b.z)) {
+					continue;
+				}
+				const LocalVector<BorderVertex> *border_vertices = borders.getptr(Vector2i(axis, line));
+				if (border_vertices == nullptr) {
+					continue;
+				}
+
+				const float along_a = axis == 0 ? vertex_a.z : vertex_a.x;
+				const float along_b = axis == 0 ? vertex_b.z : vertex_b.x;
+				const float along_min = MIN(along_a, along_b) + tolerance;
+				const float along_max = MAX(along_a, along_b) - tolerance;
+				const uint32_t split_start = stitched_polygon.size();
+				for (const BorderVertex &border_vertex : *border_vertices) {
+					if (border_vertex.along <= along_min || border_vertex.along >= along_max) {
+						continue;
+					}
+					const float weight = (border_vertex.along - along_a) / (along_b - along_a);
+					if (Math::abs(Math::lerp(vertex_a.y, vertex_b.y, (real_t)weight) - border_vertex.height) > p_height_tolerance) {
+						continue;
+					}
+					stitched_polygon.push_back(vertex_remap[generator_find_welded_vertex(welded_vertices, border_vertex.index)]);
+				}
+				// The border vertices are sorted along the line, flip them when the edge runs the other way.
+				if (along_b < along_a) {
+					for (uint32_t j = split_start, k = stitched_polygon.size() - 1; j < k; j++, k--) {
+						SWAP(stitched_polygon.write[j], stitched_polygon.write[k]);
+					}
+				}
+				break;
+			}
+		}
+		r_polygons.push_back(stitched_polygon);
+	}
+}
+
+static void generator_bake_tiles(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const Vector<float> &p_vertices, const Vector<int> &p_indices, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, bool p_use_threads, bool p_high_priority) {
+	NavMeshGeneratorTiledBake3D tiled_bake;
+	tiled_bake.navigation_mesh = p_navigation_mesh;
+	tiled_bake.cfg = p_cfg;
+	tiled_bake.tile_cells = MAX(1, (int)Math::ceil(p_navigation_mesh->get_tile_size() / p_cfg.cs));
+	tiled_bake.verts = p_vertices.ptr();
+	tiled_bake.nverts = p_vertices.size() / 3;
+	tiled_bake.tris = p_indices.ptr();
+	const int ntris = p_indices.size() / 3;
+
+	const float tile_world_size = tiled_bake.tile_cells * p_cfg.cs;
+	if (!Math::is_equal_approx(tile_world_size, p_navigation_mesh->get_tile_size())) {
+		WARN_PRINT("Property tile_size is ceiled to cell_size voxel units and loses precision.");
+	}
+	const float tile_border_size = (p_cfg.walkableRadius + 3) * p_cfg.cs;
+
+	float bmin[3], bmax[3];
+	rcCalcBounds(tiled_bake.verts, tiled_bake.nverts, bmin, bmax);
+
+	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+	if (baking_aabb.has_volume()) {
+		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
+		for (int i = 0; i < 3; i++) {
+			bmin[i] = baking_aabb.position[i] + baking_aabb_offset[i];
+			bmax[i] = bmin[i] + baking_aabb.size[i];
+			tiled_bake.clip_bmin[i] = bmin[i];
+			tiled_bake.clip_bmax[i] = bmax[i];
+		}
+		tiled_bake.clip = true;
+	}
+
+	// Tiles are aligned to the world origin so that their coordinates stay the same between bakes.
+	const Vector2i tile_begin = Vector2i(Math::floor(bmin[0] / tile_world_size), Math::floor(bmin[2] / tile_world_size));
+	const Vector2i tile_end = Vector2i(MAX(tile_begin.x, (int)Math::ceil(bmax[0] / tile_world_size) - 1), MAX(tile_begin.y, (int)Math::ceil(bmax[2] / tile_world_size) - 1));
+	const Vector2i tile_count = tile_end - tile_begin + Vector2i(1, 1);
+	ERR_FAIL_COND_MSG((int64_t)tile_count.x * tile_count.y > (1 << 20), "Baking interrupted.\nThe tile_size is too small for the size of the source geometry.");
+
+	tiled_bake.tiles.resize(tile_count.x * tile_count.y);
+	for (int z = 0; z < tile_count.y; z++) {
+		for (int x = 0; x < tile_count.x; x++) {
+			tiled_bake.tiles[z * tile_count.x + x].coords = tile_begin + Vector2i(x, z);
+		}
+	}
+
+	// Sort the source geometry into the tiles it overlaps, including their borders.
+	auto for_each_overlapped_tile = [&](float p_min_x, float p_min_z, float p_max_x, float p_max_z, const auto &p_callback) {
+		const int begin_x = MAX(tile_begin.x, (int)Math::floor((p_min_x - tile_border_size) / tile_world_size));
+		const int begin_z = MAX(tile_begin.y, (int)Math::floor((p_min_z - tile_border_size) / tile_world_size));
+		const int end_x = MIN(tile_end.x, (int)Math::floor((p_max_x + tile_border_size) / tile_world_size));
+		const int end_z = MIN(tile_end.y, (int)Math::floor((p_max_z + tile_border_size) / tile_world_size));
+		for (int z = begin_z; z <= end_z; z++) {
+			for (int x = begin_x; x <= end_x; x++) {
+				p_callback(tiled_bake.tiles[(z - tile_begin.y) * tile_count.x + (x - tile_begin.x)]);
+			}
+		}
+	};
+
+	for (int i = 0; i < ntris; i++) {
+		const int *tri = &tiled_bake.tris[i * 3];
+		float tri_min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+		float tri_max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		for (int j = 0; j < 3; j++) {
+			const float *v = &tiled_bake.verts[tri[j] * 3];
+			for (int k = 0; k < 3; k++) {
+				tri_min[k] = MIN(tri_min[k], v[k]);
+				tri_max[k] = MAX(tri_max[k], v[k]);
+			}
+		}
+		if (tri_max[1] < bmin[1] || tri_min[1] > bmax[1]) {
+			continue;
+		}
+		for_each_overlapped_tile(tri_min[0], tri_min[2], tri_max[0], tri_max[2], [&](NavMeshGeneratorTile3D &r_tile) {
+			r_tile.triangles.push_back(i);
+			r_tile.min_height = MIN(r_tile.min_height, MAX(tri_min[1], bmin[1]));
+			r_tile.max_height = MAX(r_tile.max_height, MIN(tri_max[1], bmax[1]));
+		});
+	}
+
+	for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
+		if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 3 != 0) {
+			continue;
+		}
+		float obstruction_min[2] = { FLT_MAX, FLT_MAX };
+		float obstruction_max[2] = { -FLT_MAX, -FLT_MAX };
+		for (int j = 0; j < projected_obstruction.vertices.size(); j += 3) {
+			obstruction_min[0] = MIN(obstruction_min[0], projected_obstruction.vertices[j]);
+			obstruction_min[1] = MIN(obstruction_min[1], projected_obstruction.vertices[j + 2]);
+			obstruction_max[0] = MAX(obstruction_max[0], projected_obstruction.vertices[j]);
+			obstruction_max[1] = MAX(obstruction_max[1], projected_obstruction.vertices[j + 2]);
+		}
+		for_each_overlapped_tile(obstruction_min[0], obstruction_min[1], obstruction_max[0], obstruction_max[1], [&](NavMeshGeneratorTile3D &r_tile) {
+			r_tile.projected_obstructions.push_back(projected_obstruction);
+		});
+	}
+
+	// Everything that changes the result of a tile is part of its hash, tiles with an unchanged hash reuse their last bake.
+	uint32_t settings_hash = hash_murmur3_one_32(tiled_bake.tile_cells);
+	settings_hash = hash_murmur3_one_float(p_cfg.cs, settings_hash);
+	settings_hash = hash_murmur3_one_float(p_cfg.ch, settings_hash);
+	settings_hash = hash_murmur3_one_float(p_cfg.walkableSlopeAngle, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.walkableHeight, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.walkableClimb, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.walkableRadius, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.maxEdgeLen, settings_hash);
+	settings_hash = hash_murmur3_one_float(p_cfg.maxSimplificationError, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.minRegionArea, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.mergeRegionArea, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_cfg.maxVertsPerPoly, settings_hash);
+	settings_hash = hash_murmur3_one_float(p_cfg.detailSampleDist, settings_hash);
+	settings_hash = hash_murmur3_one_float(p_cfg.detailSampleMaxError, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_sample_partition_type(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_low_hanging_obstacles(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_ledge_spans(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_walkable_low_height_spans(), settings_hash);
+	settings_hash = hash_murmur3_one_32(tiled_bake.clip, settings_hash);
+	for (int i = 0; i < 3; i++) {
+		settings_hash = hash_murmur3_one_float(tiled_bake.clip_bmin[i], settings_hash);
+		settings_hash = hash_murmur3_one_float(tiled_bake.clip_bmax[i], settings_hash);
+	}
+
+	const HashMap<Vector2i, NavigationMesh::BakedTile> baked_tiles = p_navigation_mesh->get_baked_tiles();
+
+	for (uint32_t i = 0; i < tiled_bake.tiles.size(); i++) {
+		NavMeshGeneratorTile3D &tile = tiled_bake.tiles[i];
+		if (tile.triangles.is_empty()) {
+			continue;
+		}
+
+		uint32_t source_hash = hash_murmur3_one_float(tile.min_height, settings_hash);
+		source_hash = hash_murmur3_one_float(tile.max_height, source_hash);
+		for (int triangle : tile.triangles) {
+			const int *tri = &tiled_bake.tris[triangle * 3];
+			for (int j = 0; j < 3; j++) {
+				const float *v = &tiled_bake.verts[tri[j] * 3];
+				source_hash = hash_murmur3_one_float(v[0], source_hash);
+				source_hash = hash_murmur3_one_float(v[1], source_hash);
+				source_hash = hash_murmur3_one_float(v[2], source_hash);
+			}
+		}
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : tile.projected_obstructions) {
+			for (float value : projected_obstruction.vertices) {
+				source_hash = hash_murmur3_one_float(value, source_hash);
+			}
+			source_hash = hash_murmur3_one_float(projected_obstruction.elevation, source_hash);
+			source_hash = hash_murmur3_one_float(projected_obstruction.height, source_hash);
+			source_hash = hash_murmur3_one_32(projected_obstruction.carve, source_hash);
+		}
+		tile.source_hash = hash_fmix32(source_hash);
+
+		const NavigationMesh::BakedTile *baked_tile = baked_tiles.getptr(tile.coords);
+		if (baked_tile && baked_tile->source_hash == tile.source_hash) {
+			tile.vertices = baked_tile->vertices;
+			tile.polygons = baked_tile->polygons;
+		} else {
+			tiled_bake.dirty_tiles.push_back(i);
+		}
+	}
+
+	if (p_use_threads && tiled_bake.dirty_tiles.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&generator_bake_tile, &tiled_bake, tiled_bake.dirty_tiles.size(), -1, p_high_priority, SNAME("NavMeshGeneratorBakeTiles3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < tiled_bake.dirty_tiles.size(); i++) {
+			generator_bake_tile(&tiled_bake, i);
+		}
+	}
+
+	HashMap<Vector2i, NavigationMesh::BakedTile> new_baked_tiles;
+	for (const NavMeshGeneratorTile3D &tile : tiled_bake.tiles) {
+		if (tile.triangles.is_empty()) {
+			continue;
+		}
+		NavigationMesh::BakedTile &baked_tile = new_baked_tiles[tile.coords];
+		baked_tile.source_hash = tile.source_hash;
+		baked_tile.vertices = tile.vertices;
+		baked_tile.polygons = tile.polygons;
+	}
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	generator_stitch_tiles(tiled_bake.tiles, tile_world_size, p_cfg.cs, MAX(p_cfg.walkableClimb * p_cfg.ch, p_cfg.ch), nav_vertices, nav_polygons);
+
+	p_navigation_mesh->set_baked_tiles(new_baked_tiles);
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+}
+
+void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data) {
+	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
+		return;
+	}
+
+	Vector<float> source_geometry_vertices;
+	Vector<int> source_geometry_indices;
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+
+	p_source_geometry_data->get_data(
+			source_geometry_vertices,
+			source_geometry_indices,
+			projected_obstructions);
+
+	if (source_geometry_vertices.size() < 3 || source_geometry_indices.size() < 3) {
+		return;
+	}
+
+	// added to keep track of steps, no functionality right now
+	String bake_state = "";
+
+	bake_state = "Setting up Configuration..."; // step #1
+
+	rcConfig cfg;
+	generator_init_config(p_navigation_mesh, cfg);
+
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		generator_bake_tiles(p_navigation_mesh, cfg, source_geometry_vertices, source_geometry_indices, projected_obstructions, use_threads, baking_use_high_priority_threads);
+		return;
+	}
+
+	const float *verts = source_geometry_vertices.ptr();
+	const int nverts = source_geometry_vertices.size() / 3;
+	const int *tris = source_geometry_indices.ptr();
+	const int ntris = source_geometry_indices.size() / 3;
+
+	float bmin[3], bmax[3];
+	rcCalcBounds(verts, nverts, bmin, bmax);
+
+	cfg.bmin[0] = bmin[0];
+	cfg.bmin[1] = bmin[1];
+	cfg.bmin[2] = bmin[2];
+	cfg.bmax[0] = bmax[0];
+	cfg.bmax[1] = bmax[1];
+	cfg.bmax[2] = bmax[2];
+
+	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+	if (baking_aabb.has_volume()) {
+		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
+		cfg.bmin[0] = baking_aabb.position[0] + baking_aabb_offset.x;
+		cfg.bmin[1] = baking_aabb.position[1] + baking_aabb_offset.y;
+		cfg.bmin[2] = baking_aabb.position[2] + baking_aabb_offset.z;
+		cfg.bmax[0] = cfg.bmin[0] + baking_aabb.size[0];
+		cfg.bmax[1] = cfg.bmin[1] + baking_aabb.size[1];
+		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
+	}
+
+	bake_state = "Calculating grid size..."; // step #2
+	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+
+	// ~30000000 seems to be around sweetspot where Editor baking breaks
+	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
+		ERR_FAIL_MSG("Baking interrupted."
+					 "\nNavigationMesh baking process would likely crash the engine."
+					 "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
+					 "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
+					 "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
+					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
+		return;
+	}
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	if (!generator_bake_recast(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, nav_vertices, nav_polygons)) {
+		return;
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
 }
 
 bool NavMeshGenerator3D::generator_emit_callback(const Callable &p_callback) {
@@ -248,6 +248,170 @@ void NavMeshQueries3D::_query_task_find_start_end_positions(NavMeshPathQueryTask
 	}
 }
 
+bool NavMeshQueries3D::_query_task_restore_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration &p_map_iteration) {
+	if (p_map_iteration.path_corridor_cache_size == 0) {
+		return false;
+	}
+
+	PathCorridorKey key;
+	key.begin_polygon_id = p_query_task.begin_polygon->id;
+	key.end_polygon_id = p_query_task.end_polygon->id;
+	key.navigation_layers = p_query_task.navigation_layers;
+
+	LocalVector<gd::NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+
+	MutexLock lock(p_map_iteration.path_corridor_cache_mutex);
+
+	const LocalVector<PathCorridorStep> *steps = p_map_iteration.path_corridor_cache.getptr(key);
+	if (steps == nullptr || steps->is_empty()) {
+		return false;
+	}
+
+	// Relink the corridor from the begin polygon and recompute the entry points for the new begin position.
+	int back_navigation_poly_id = -1;
+	Vector3 entry = p_query_task.begin_position;
+	for (int i = steps->size() - 1; i >= 0; i--) {
+		const PathCorridorStep &step = (*steps)[i];
+		gd::NavigationPoly &navigation_poly = navigation_polys[step.poly->id];
+		navigation_poly.poly = step.poly;
+		navigation_poly.back_navigation_poly_id = back_navigation_poly_id;
+		navigation_poly.back_navigation_edge = step.back_navigation_edge;
+		if (back_navigation_poly_id == -1) {
+			navigation_poly.back_navigation_edge_pathway_start = entry;
+			navigation_poly.back_navigation_edge_pathway_end = entry;
+		} else {
+			navigation_poly.back_navigation_edge_pathway_start = step.back_navigation_edge_pathway_start;
+			navigation_poly.back_navigation_edge_pathway_end = step.back_navigation_edge_pathway_end;
+			Vector3 pathway[2] = { step.back_navigation_edge_pathway_start, step.back_navigation_edge_pathway_end };
+			entry = Geometry3D::get_closest_point_to_segment(entry, pathway);
+		}
+		navigation_poly.entry = entry;
+		back_navigation_poly_id = step.poly->id;
+	}
+
+	p_query_task.least_cost_id = p_query_task.end_polygon->id;
+	return true;
+}
+
+void NavMeshQueries3D::_query_task_cache_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration &p_map_iteration) {
+	if (p_map_iteration.path_corridor_cache_size == 0) {
+		return;
+	}
+
+	PathCorridorKey key;
+	key.begin_polygon_id = p_query_task.begin_polygon->id;
+	key.end_polygon_id = p_query_task.end_polygon->id;
+	key.navigation_layers = p_query_task.navigation_layers;
+
+	const LocalVector<gd::NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+
+	LocalVector<PathCorridorStep> steps;
+	for (int np_id = p_query_task.least_cost_id; np_id != -1; np_id = navigation_polys[np_id].back_navigation_poly_id) {
+		const gd::NavigationPoly &navigation_poly = navigation_polys[np_id];
+		PathCorridorStep step;
+		step.poly = navigation_poly.poly;
+		step.back_navigation_edge = navigation_poly.back_navigation_edge;
+		step.back_navigation_edge_pathway_start = navigation_poly.back_navigation_edge_pathway_start;
+		step.back_navigation_edge_pathway_end = navigation_poly.back_navigation_edge_pathway_end;
+		steps.push_back(step);
+	}
+
+	MutexLock lock(p_map_iteration.path_corridor_cache_mutex);
+	p_map_iteration.path_corridor_cache.insert(key, steps);
+}
+
+bool NavMeshQueries3D::_query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration &p_map_iteration) {
+	const LocalVector<gd::Cluster> &clusters = p_map_iteration.clusters;
+	const uint32_t begin_cluster_id = p_query_task.begin_polygon->cluster;
+	const uint32_t end_cluster_id = p_query_task.end_polygon->cluster;
+
+	// Without clusters, or within a single cluster, the polygon search is already local.
+	if (begin_cluster_id >= clusters.size() || end_cluster_id >= clusters.size() || begin_cluster_id == end_cluster_id) {
+		return false;
+	}
+
+	LocalVector<gd::NavigationCluster> &navigation_clusters = p_query_task.path_query_slot->cluster_corridor;
+	gd::Heap<gd::NavigationCluster *, gd::NavClusterTravelCostGreaterThan, gd::NavClusterHeapIndexer>
+			&traversable_clusters = p_query_task.path_query_slot->traversable_clusters;
+	traversable_clusters.clear();
+
+	for (gd::NavigationCluster &navigation_cluster : navigation_clusters) {
+		navigation_cluster.reset();
+	}
+
+	const Vector3 end_point = p_query_task.end_position;
+	// Scale the straight distance by the lowest travel cost so the estimate never exceeds the remaining cost.
+	const real_t min_travel_cost = p_map_iteration.cluster_min_travel_cost;
+
+	navigation_clusters[begin_cluster_id].traveled_distance = 0.0;
+	navigation_clusters[begin_cluster_id].distance_to_destination = clusters[begin_cluster_id].center.distance_to(end_point) * min_travel_cost;
+	traversable_clusters.push(&navigation_clusters[begin_cluster_id]);
+
+	// A* over the abstract cluster graph.
+	bool found_route = false;
+	while (!traversable_clusters.is_empty()) {
+		const gd::NavigationCluster *least_cost_cluster = traversable_clusters.pop();
+		const uint32_t least_cost_id = least_cost_cluster - navigation_clusters.ptr();
+		if (least_cost_id == end_cluster_id) {
+			found_route = true;
+			break;
+		}
+
+		for (const gd::ClusterConnection &connection : clusters[least_cost_id].connections) {
+			const gd::Cluster &neighbor_cluster = clusters[connection.cluster];
+			if ((p_query_task.navigation_layers & neighbor_cluster.owner->get_navigation_layers()) == 0) {
+				continue;
+			}
+
+			const real_t new_traveled_distance = least_cost_cluster->traveled_distance + connection.cost;
+			gd::NavigationCluster &neighbor = navigation_clusters[connection.cluster];
+			if (new_traveled_distance < neighbor.traveled_distance) {
+				neighbor.back_navigation_cluster_id = least_cost_id;
+				neighbor.traveled_distance = new_traveled_distance;
+				neighbor.distance_to_destination = neighbor_cluster.center.distance_to(end_point) * min_travel_cost;
+
+				if (neighbor.traversable_cluster_index != traversable_clusters.INVALID_INDEX) {
+					traversable_clusters.shift(neighbor.traversable_cluster_index);
+				} else {
+					traversable_clusters.push(&neighbor);
+				}
+			}
+		}
+	}
+
+	if (!found_route) {
+		// Let the polygon search handle unreachable targets.
+		return false;
+	}
+
+	// Open the clusters along the route, and their direct neighbors so the polygon search has room to cut corners.
+	const Vector3 begin_point = p_query_task.begin_position;
+	real_t route_length = clusters[end_cluster_id].center.distance_to(end_point);
+	for (uint32_t cluster_id = end_cluster_id; cluster_id != UINT32_MAX; cluster_id = navigation_clusters[cluster_id].back_navigation_cluster_id) {
+		navigation_clusters[cluster_id].in_corridor = true;
+		for (const gd::ClusterConnection &connection : clusters[cluster_id].connections) {
+			navigation_clusters[connection.cluster].in_corridor = true;
+		}
+
+		const uint32_t back_cluster_id = navigation_clusters[cluster_id].back_navigation_cluster_id;
+		route_length += clusters[cluster_id].center.distance_to(back_cluster_id != UINT32_MAX ? clusters[back_cluster_id].center : begin_point);
+	}
+
+	// The route through the cluster centers is rarely the shortest path, e.g. on a grid of clusters many
+	// staircase routes have the same cost. Also open every cluster that a path no longer than the route
+	// could cross, which lies within the ellipse around the begin and end points that fits the route,
+	// widened by the extent of the clusters.
+	const real_t max_length = route_length + p_map_iteration.cluster_size * Math::sqrt(3.0) * 4.0;
+	for (uint32_t cluster_id = 0; cluster_id < clusters.size(); cluster_id++) {
+		const Vector3 &center = clusters[cluster_id].center;
+		if (begin_point.distance_to(center) + center.distance_to(end_point) <= max_length) {
+			navigation_clusters[cluster_id].in_corridor = true;
+		}
+	}
+
+	return true;
+}
+
 void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task) {
 	const Vector3 p_target_position = p_query_task.target_position;
 	const uint32_t p_navigation_layers = p_query_task.navigation_layers;
@@ -266,6 +430,10 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		polygon.reset();
 	}
 
+	// When a cluster route was found, only polygons of clusters along that route are searched.
+	const LocalVector<gd::NavigationCluster> &navigation_clusters = p_query_task.path_query_slot->cluster_corridor;
+	bool use_cluster_corridor = p_query_task.use_cluster_corridor;
+
 	// Initialize the matching navigation polygon.
 	gd::NavigationPoly &begin_navigation_poly = navigation_polys[begin_poly->id];
 	begin_navigation_poly.poly = begin_poly;
@@ -286,6 +454,7 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	while (true) {
 		const gd::NavigationPoly &least_cost_poly = navigation_polys[least_cost_id];
 		real_t poly_travel_cost = least_cost_poly.poly->owner->get_travel_cost();
+		p_query_task.searched_polygon_count++;
 
 		// Takes the current least_cost_poly neighbors (iterating over its edges) and compute the traveled_distance.
 		for (const gd::Edge &edge : least_cost_poly.poly->edges) {
@@ -295,6 +464,9 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 
 				// Only consider the connection to another polygon if this polygon is in a region with compatible layers.
 				const NavBaseIteration *owner = connection.polygon->owner;
+				if (use_cluster_corridor && !navigation_clusters[connection.polygon->cluster].in_corridor) {
+					continue;
+				}
 				if ((p_navigation_layers & owner->get_navigation_layers()) != 0) {
 					Vector3 pathway[2] = { connection.pathway_start, connection.pathway_end };
 					const Vector3 new_entry = Geometry3D::get_closest_point_to_segment(least_cost_poly.entry, pathway);
@@ -326,6 +498,23 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		}
 
 		poly_enter_cost = 0;
+		if (traversable_polys.is_empty() && use_cluster_corridor) {
+			// The end polygon can't be reached inside the cluster corridor, search all polygons instead.
+			use_cluster_corridor = false;
+			for (gd::NavigationPoly &nav_poly : navigation_polys) {
+				nav_poly.reset();
+			}
+			navigation_polys[begin_poly->id].poly = begin_poly;
+			navigation_polys[begin_poly->id].entry = begin_point;
+			navigation_polys[begin_poly->id].back_navigation_edge_pathway_start = begin_point;
+			navigation_polys[begin_poly->id].back_navigation_edge_pathway_end = begin_point;
+			navigation_polys[begin_poly->id].traveled_distance = 0;
+			least_cost_id = begin_poly->id;
+			reachable_end = nullptr;
+			distance_to_reachable_end = FLT_MAX;
+			continue;
+		}
+
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
@@ -453,10 +642,21 @@ void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D
 		return;
 	}
 
-	_query_task_build_path_corridor(p_query_task);
+	if (!_query_task_restore_cached_path_corridor(p_query_task, p_map_iteration)) {
+		const gd::Polygon *requested_end_polygon = p_query_task.end_polygon;
 
-	if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
-		return;
+		p_query_task.use_cluster_corridor = _query_task_build_cluster_corridor(p_query_task, p_map_iteration);
+
+		_query_task_build_path_corridor(p_query_task);
+
+		if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
+			return;
+		}
+
+		// Only corridors that reached the requested end polygon are valid for other queries.
+		if (p_query_task.end_polygon == requested_end_polygon) {
+			_query_task_cache_path_corridor(p_query_task, p_map_iteration);
+		}
 	}
 
 	// Post-Process path.
@@ -35,6 +35,7 @@
 
 #include "../nav_utils.h"
 
+#include "core/templates/lru.h"
 #include "servers/navigation/navigation_path_query_parameters_3d.h"
 #include "servers/navigation/navigation_path_query_result_3d.h"
 #include "servers/navigation/navigation_utilities.h"
@@ -49,10 +50,39 @@ public:
 	struct PathQuerySlot {
 		LocalVector<gd::NavigationPoly> path_corridor;
 		gd::Heap<gd::NavigationPoly *, gd::NavPolyTravelCostGreaterThan, gd::NavPolyHeapIndexer> traversable_polys;
+		LocalVector<gd::NavigationCluster> cluster_corridor;
+		gd::Heap<gd::NavigationCluster *, gd::NavClusterTravelCostGreaterThan, gd::NavClusterHeapIndexer> traversable_clusters;
 		bool in_use = false;
 		uint32_t slot_index = 0;
 	};
 
+	struct PathCorridorKey {
+		uint32_t begin_polygon_id = UINT32_MAX;
+		uint32_t end_polygon_id = UINT32_MAX;
+		uint32_t navigation_layers = 0;
+
+		static uint32_t hash(const PathCorridorKey &p_key) {
+			uint32_t h = hash_murmur3_one_32(p_key.begin_polygon_id);
+			h = hash_murmur3_one_32(p_key.end_polygon_id, h);
+			h = hash_murmur3_one_32(p_key.navigation_layers, h);
+			return hash_fmix32(h);
+		}
+
+		bool operator==(const PathCorridorKey &p_key) const {
+			return begin_polygon_id == p_key.begin_polygon_id && end_polygon_id == p_key.end_polygon_id && navigation_layers == p_key.navigation_layers;
+		}
+	};
+
+	struct PathCorridorStep {
+		const gd::Polygon *poly = nullptr;
+		int back_navigation_edge = -1;
+		Vector3 back_navigation_edge_pathway_start;
+		Vector3 back_navigation_edge_pathway_end;
+	};
+
+	// Polygon corridors of previous queries, stored from the end polygon back to the begin polygon.
+	typedef LRUCache<PathCorridorKey, LocalVector<PathCorridorStep>, PathCorridorKey> PathCorridorCache;
+
 	struct NavMeshPathQueryTask3D {
 		enum TaskStatus {
 			QUERY_STARTED,
@@ -78,6 +108,8 @@ public:
 		const gd::Polygon *begin_polygon = nullptr;
 		const gd::Polygon *end_polygon = nullptr;
 		uint32_t least_cost_id = 0;
+		bool use_cluster_corridor = false;
+		uint32_t searched_polygon_count = 0;
 
 		// Map.
 		Vector3 map_up;
@@ -132,6 +164,9 @@ public:
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration &p_map_iteration);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const gd::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration &p_map_iteration);
+	static bool _query_task_restore_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration &p_map_iteration);
+	static void _query_task_cache_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration &p_map_iteration);
+	static bool _query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration &p_map_iteration);
 	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask3D &p_query_task);
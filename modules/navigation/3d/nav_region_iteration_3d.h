@@ -41,11 +41,13 @@ struct NavRegionIteration : NavBaseIteration {
 	LocalVector<gd::Polygon> navmesh_polygons;
 	real_t surface_area = 0.0;
 	AABB bounds;
+	uint32_t iteration_id = 0;
 
 	const Transform3D &get_transform() const { return transform; }
 	const LocalVector<gd::Polygon> &get_navmesh_polygons() const { return navmesh_polygons; }
 	real_t get_surface_area() const { return surface_area; }
 	AABB get_bounds() const { return bounds; }
+	uint32_t get_iteration_id() const { return iteration_id; }
 };
 
 #endif // NAV_REGION_ITERATION_3D_H
@@ -0,0 +1,364 @@
+/**************************************************************************/
+/*  nav_avoidance_2d.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "nav_avoidance_2d.h"
+
+#include "nav_agent.h"
+
+#include "core/object/worker_thread_pool.h"
+
+#include <KdTree2d.h>
+
+void NavAvoidance2D::step(const LocalVector<NavAgent *> &p_agents, RVO2D::RVOSimulator2D *p_simulation, bool p_use_threads, bool p_use_high_priority_threads) {
+	agents = p_agents.ptr();
+	agent_count = p_agents.size();
+	if (agent_count == 0) {
+		return;
+	}
+
+	simulation = p_simulation;
+	use_threads = p_use_threads;
+	use_high_priority_threads = p_use_high_priority_threads;
+	batch_count = (agent_count + BATCH_SIZE - 1) / BATCH_SIZE;
+
+	positions.resize(agent_count);
+	velocities.resize(agent_count);
+	preferred_velocities.resize(agent_count);
+	new_velocities.resize(agent_count);
+	radii.resize(agent_count);
+	max_speeds.resize(agent_count);
+	neighbor_distances.resize(agent_count);
+	time_horizons.resize(agent_count);
+	time_horizons_obstacles.resize(agent_count);
+	elevations.resize(agent_count);
+	heights.resize(agent_count);
+	priorities.resize(agent_count);
+	avoidance_layers.resize(agent_count);
+	avoidance_masks.resize(agent_count);
+	max_neighbors.resize(agent_count);
+	batch_neighbor_distances.resize(batch_count);
+
+	_run_batches(&NavAvoidance2D::_gather_batch, SNAME("NavAvoidance2DGather"));
+	_build_spatial_hash();
+	_run_batches(&NavAvoidance2D::_solve_batch, SNAME("NavAvoidance2DSolve"));
+	_run_batches(&NavAvoidance2D::_update_batch, SNAME("NavAvoidance2DUpdate"));
+
+	agents = nullptr;
+	simulation = nullptr;
+}
+
+void NavAvoidance2D::_run_batches(void (NavAvoidance2D::*p_method)(uint32_t, void *), const String &p_description) {
+	if (use_threads && batch_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, p_method, (void *)nullptr, batch_count, -1, use_high_priority_threads, p_description);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t batch = 0; batch < batch_count; batch++) {
+			(this->*p_method)(batch, nullptr);
+		}
+	}
+}
+
+void NavAvoidance2D::_gather_batch(uint32_t p_batch, void *p_userdata) {
+	const uint32_t begin = p_batch * BATCH_SIZE;
+	const uint32_t end = MIN(begin + BATCH_SIZE, agent_count);
+
+	float max_neighbor_distance = 0.0;
+	for (uint32_t i = begin; i < end; i++) {
+		const RVO2D::Agent2D *rvo_agent = agents[i]->get_rvo_agent_2d();
+		positions[i] = rvo_agent->position_;
+		velocities[i] = rvo_agent->velocity_;
+		preferred_velocities[i] = rvo_agent->prefVelocity_;
+		radii[i] = rvo_agent->radius_;
+		max_speeds[i] = rvo_agent->maxSpeed_;
+		neighbor_distances[i] = rvo_agent->neighborDist_;
+		time_horizons[i] = rvo_agent->timeHorizon_;
+		time_horizons_obstacles[i] = rvo_agent->timeHorizonObst_;
+		elevations[i] = rvo_agent->elevation_;
+		heights[i] = rvo_agent->height_;
+		priorities[i] = rvo_agent->avoidance_priority_;
+		avoidance_layers[i] = rvo_agent->avoidance_layers_;
+		avoidance_masks[i] = rvo_agent->avoidance_mask_;
+		max_neighbors[i] = rvo_agent->maxNeighbors_;
+
+		if (max_neighbors[i] > 0) {
+			max_neighbor_distance = MAX(max_neighbor_distance, neighbor_distances[i]);
+		}
+	}
+	batch_neighbor_distances[p_batch] = max_neighbor_distance;
+}
+
+void NavAvoidance2D::_hash_batch(uint32_t p_batch, void *p_userdata) {
+	const uint32_t begin = p_batch * BATCH_SIZE;
+	const uint32_t end = MIN(begin + BATCH_SIZE, agent_count);
+
+	const float inv_cell_size = 1.0f / cell_size;
+	for (uint32_t i = begin; i < end; i++) {
+		const Vector2i cell = Vector2i(Math::floor(positions[i].x() * inv_cell_size), Math::floor(positions[i].y() * inv_cell_size));
+		agent_cells[i] = cell;
+		agent_buckets[i] = _get_bucket(cell);
+	}
+}
+
+void NavAvoidance2D::_build_spatial_hash() {
+	// A cell as large as the largest neighbor distance keeps most queries within 3x3 cells.
+	float max_neighbor_distance = 0.0;
+	for (float batch_neighbor_distance : batch_neighbor_distances) {
+		max_neighbor_distance = MAX(max_neighbor_distance, batch_neighbor_distance);
+	}
+	cell_size = MAX(max_neighbor_distance, 0.01f);
+
+	const uint32_t bucket_count = next_power_of_2(agent_count * 2);
+	bucket_mask = bucket_count - 1;
+
+	agent_cells.resize(agent_count);
+	agent_buckets.resize(agent_count);
+	_run_batches(&NavAvoidance2D::_hash_batch, SNAME("NavAvoidance2DHash"));
+
+	// Counting sort of the agents by bucket, agents keep their relative order within a bucket.
+	bucket_starts.resize(bucket_count + 1);
+	memset(bucket_starts.ptr(), 0, sizeof(uint32_t) * bucket_starts.size());
+	for (uint32_t i = 0; i < agent_count; i++) {
+		bucket_starts[agent_buckets[i] + 1]++;
+	}
+	for (uint32_t bucket = 0; bucket < bucket_count; bucket++) {
+		bucket_starts[bucket + 1] += bucket_starts[bucket];
+	}
+
+	// The bucket starts are used as insertion cursors and shifted back afterwards.
+	bucket_agents.resize(agent_count);
+	for (uint32_t i = 0; i < agent_count; i++) {
+		bucket_agents[bucket_starts[agent_buckets[i]]++] = i;
+	}
+	for (uint32_t bucket = bucket_count; bucket > 0; bucket--) {
+		bucket_starts[bucket] = bucket_starts[bucket - 1];
+	}
+	bucket_starts[0] = 0;
+}
+
+void NavAvoidance2D::_insert_neighbor(uint32_t p_index, uint32_t p_other_index, float &r_range_squared, LocalVector<Neighbor> &r_neighbors) const {
+	// No point processing same agent.
+	if (p_index == p_other_index) {
+		return;
+	}
+	// Ignore other agent if layers/mask bitmasks have no matching bit.
+	if ((avoidance_masks[p_index] & avoidance_layers[p_other_index]) == 0) {
+		return;
+	}
+	// Ignore other agent if this agent is below or above.
+	if ((elevations[p_index] > elevations[p_other_index] + heights[p_other_index]) || (elevations[p_index] + heights[p_index] < elevations[p_other_index])) {
+		return;
+	}
+	if (priorities[p_index] > priorities[p_other_index]) {
+		return;
+	}
+
+	const float distance_squared = RVO2D::absSq(positions[p_index] - positions[p_other_index]);
+	if (distance_squared >= r_range_squared) {
+		return;
+	}
+
+	// Keep the neighbors sorted by distance and shrink the range once the list is full.
+	if (r_neighbors.size() < max_neighbors[p_index]) {
+		r_neighbors.push_back(Neighbor());
+	}
+	uint32_t i = r_neighbors.size() - 1;
+	while (i != 0 && distance_squared < r_neighbors[i - 1].distance_squared) {
+		r_neighbors[i] = r_neighbors[i - 1];
+		--i;
+	}
+	r_neighbors[i].distance_squared = distance_squared;
+	r_neighbors[i].index = p_other_index;
+
+	if (r_neighbors.size() == max_neighbors[p_index]) {
+		r_range_squared = r_neighbors[r_neighbors.size() - 1].distance_squared;
+	}
+}
+
+void NavAvoidance2D::_compute_neighbors(uint32_t p_index, LocalVector<Neighbor> &r_neighbors) const {
+	r_neighbors.clear();
+	if (max_neighbors[p_index] == 0) {
+		return;
+	}
+
+	const float range = neighbor_distances[p_index];
+	float range_squared = range * range;
+
+	const float inv_cell_size = 1.0f / cell_size;
+	const RVO2D::Vector2 &position = positions[p_index];
+	const Vector2i from = Vector2i(Math::floor((position.x() - range) * inv_cell_size), Math::floor((position.y() - range) * inv_cell_size));
+	const Vector2i to = Vector2i(Math::floor((position.x() + range) * inv_cell_size), Math::floor((position.y() + range) * inv_cell_size));
+
+	if (uint64_t(to.x - from.x + 1) * uint64_t(to.y - from.y + 1) > agent_count) {
+		// The range covers more cells than there are agents.
+		for (uint32_t other_index = 0; other_index < agent_count; other_index++) {
+			_insert_neighbor(p_index, other_index, range_squared, r_neighbors);
+		}
+		return;
+	}
+
+	for (int y = from.y; y <= to.y; y++) {
+		for (int x = from.x; x <= to.x; x++) {
+			const Vector2i cell = Vector2i(x, y);
+			const uint32_t bucket = _get_bucket(cell);
+			for (uint32_t i = bucket_starts[bucket]; i < bucket_starts[bucket + 1]; i++) {
+				const uint32_t other_index = bucket_agents[i];
+				// Different cells can share a bucket, only take the agents of this cell.
+				if (agent_cells[other_index] != cell) {
+					continue;
+				}
+				_insert_neighbor(p_index, other_index, range_squared, r_neighbors);
+			}
+		}
+	}
+}
+
+void NavAvoidance2D::_solve_batch(uint32_t p_batch, void *p_userdata) {
+	const uint32_t begin = p_batch * BATCH_SIZE;
+	const uint32_t end = MIN(begin + BATCH_SIZE, agent_count);
+
+	const float time_step = simulation->timeStep_;
+	const bool has_obstacles = !simulation->obstacles_.empty();
+
+	// Scratch memory shared by all agents of the batch.
+	LocalVector<Neighbor> neighbors;
+	// Cannot use LocalVector here as the RVO library expects std::vector for the linear programs.
+	std::vector<RVO2D::Line> orca_lines;
+	RVO2D::Agent2D obstacle_agent;
+
+	for (uint32_t i = begin; i < end; i++) {
+		const RVO2D::Vector2 &position = positions[i];
+		const RVO2D::Vector2 &velocity = velocities[i];
+		const float radius = radii[i];
+
+		orca_lines.clear();
+
+		if (has_obstacles) {
+			// The obstacle lines are built by the RVO2D agent without any agent neighbors.
+			obstacle_agent.position_ = position;
+			obstacle_agent.velocity_ = velocity;
+			obstacle_agent.prefVelocity_ = preferred_velocities[i];
+			obstacle_agent.radius_ = radius;
+			obstacle_agent.maxSpeed_ = max_speeds[i];
+			obstacle_agent.maxNeighbors_ = 0;
+			obstacle_agent.timeHorizonObst_ = time_horizons_obstacles[i];
+			obstacle_agent.elevation_ = elevations[i];
+			obstacle_agent.height_ = heights[i];
+			obstacle_agent.avoidance_mask_ = avoidance_masks[i];
+			obstacle_agent.computeNeighbors(simulation);
+			if (!obstacle_agent.obstacleNeighbors_.empty()) {
+				obstacle_agent.computeNewVelocity(simulation);
+				orca_lines.assign(obstacle_agent.orcaLines_.begin(), obstacle_agent.orcaLines_.end());
+			}
+		}
+		const size_t obstacle_line_count = orca_lines.size();
+
+		_compute_neighbors(i, neighbors);
+
+		const float inv_time_horizon = 1.0f / time_horizons[i];
+
+		// Create agent ORCA lines.
+		for (const Neighbor &neighbor : neighbors) {
+			const uint32_t other_index = neighbor.index;
+
+			const RVO2D::Vector2 relative_position = positions[other_index] - position;
+			const RVO2D::Vector2 relative_velocity = velocity - velocities[other_index];
+			const float distance_squared = neighbor.distance_squared;
+			const float combined_radius = radius + radii[other_index];
+			const float combined_radius_squared = combined_radius * combined_radius;
+
+			RVO2D::Line line;
+			RVO2D::Vector2 u;
+
+			if (distance_squared > combined_radius_squared) {
+				// No collision.
+				const RVO2D::Vector2 w = relative_velocity - inv_time_horizon * relative_position;
+				// Vector from cutoff center to relative velocity.
+				const float w_length_squared = RVO2D::absSq(w);
+				const float dot_product_1 = w * relative_position;
+
+				if (dot_product_1 < 0.0f && dot_product_1 * dot_product_1 > combined_radius_squared * w_length_squared) {
+					// Project on cut-off circle.
+					const float w_length = std::sqrt(w_length_squared);
+					const RVO2D::Vector2 unit_w = w / w_length;
+
+					line.direction = RVO2D::Vector2(unit_w.y(), -unit_w.x());
+					u = (combined_radius * inv_time_horizon - w_length) * unit_w;
+				} else {
+					// Project on legs.
+					const float leg = std::sqrt(distance_squared - combined_radius_squared);
+
+					if (RVO2D::det(relative_position, w) > 0.0f) {
+						// Project on left leg.
+						line.direction = RVO2D::Vector2(relative_position.x() * leg - relative_position.y() * combined_radius, relative_position.x() * combined_radius + relative_position.y() * leg) / distance_squared;
+					} else {
+						// Project on right leg.
+						line.direction = -RVO2D::Vector2(relative_position.x() * leg + relative_position.y() * combined_radius, -relative_position.x() * combined_radius + relative_position.y() * leg) / distance_squared;
+					}
+
+					const float dot_product_2 = relative_velocity * line.direction;
+					u = dot_product_2 * line.direction - relative_velocity;
+				}
+			} else {
+				// Collision. Project on cut-off circle of time step.
+				const float inv_time_step = 1.0f / time_step;
+
+				// Vector from cutoff center to relative velocity.
+				const RVO2D::Vector2 w = relative_velocity - inv_time_step * relative_position;
+				const float w_length = RVO2D::abs(w);
+				const RVO2D::Vector2 unit_w = w / w_length;
+
+				line.direction = RVO2D::Vector2(unit_w.y(), -unit_w.x());
+				u = (combined_radius * inv_time_step - w_length) * unit_w;
+			}
+
+			line.point = velocity + 0.5f * u;
+			orca_lines.push_back(line);
+		}
+
+		RVO2D::Vector2 new_velocity;
+		const size_t line_fail = RVO2D::linearProgram2(orca_lines, max_speeds[i], preferred_velocities[i], false, new_velocity);
+		if (line_fail < orca_lines.size()) {
+			RVO2D::linearProgram3(orca_lines, obstacle_line_count, line_fail, max_speeds[i], new_velocity);
+		}
+		new_velocities[i] = new_velocity;
+	}
+}
+
+void NavAvoidance2D::_update_batch(uint32_t p_batch, void *p_userdata) {
+	const uint32_t begin = p_batch * BATCH_SIZE;
+	const uint32_t end = MIN(begin + BATCH_SIZE, agent_count);
+
+	for (uint32_t i = begin; i < end; i++) {
+		RVO2D::Agent2D *rvo_agent = agents[i]->get_rvo_agent_2d();
+		rvo_agent->newVelocity_ = new_velocities[i];
+		rvo_agent->update(simulation);
+		agents[i]->update();
+	}
+}
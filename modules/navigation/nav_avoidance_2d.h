@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*  nav_avoidance_2d.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef NAV_AVOIDANCE_2D_H
+#define NAV_AVOIDANCE_2D_H
+
+#include "core/math/vector2i.h"
+#include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+
+#include <Agent2d.h>
+
+class NavAgent;
+
+// Computes the 2D avoidance velocities of all avoidance agents of a map.
+// The agent data is gathered into arrays, neighbors are found with a uniform
+// spatial hash that is rebuilt every step, and the ORCA linear programs are
+// solved in batches of agents that share their scratch memory.
+// Static obstacles are still queried from the obstacle tree of the RVO2D simulation.
+class NavAvoidance2D {
+	static constexpr uint32_t BATCH_SIZE = 64;
+
+	struct Neighbor {
+		float distance_squared = 0.0;
+		uint32_t index = 0;
+	};
+
+	NavAgent *const *agents = nullptr;
+	uint32_t agent_count = 0;
+	uint32_t batch_count = 0;
+
+	RVO2D::RVOSimulator2D *simulation = nullptr;
+	bool use_threads = true;
+	bool use_high_priority_threads = true;
+
+	LocalVector<RVO2D::Vector2> positions;
+	LocalVector<RVO2D::Vector2> velocities;
+	LocalVector<RVO2D::Vector2> preferred_velocities;
+	LocalVector<RVO2D::Vector2> new_velocities;
+	LocalVector<float> radii;
+	LocalVector<float> max_speeds;
+	LocalVector<float> neighbor_distances;
+	LocalVector<float> time_horizons;
+	LocalVector<float> time_horizons_obstacles;
+	LocalVector<float> elevations;
+	LocalVector<float> heights;
+	LocalVector<float> priorities;
+	LocalVector<uint32_t> avoidance_layers;
+	LocalVector<uint32_t> avoidance_masks;
+	LocalVector<uint32_t> max_neighbors;
+
+	// The largest neighbor distance of each batch, reduced to the cell size of the spatial hash.
+	LocalVector<float> batch_neighbor_distances;
+
+	float cell_size = 1.0;
+	uint32_t bucket_mask = 0;
+	LocalVector<Vector2i> agent_cells;
+	LocalVector<uint32_t> agent_buckets;
+	LocalVector<uint32_t> bucket_starts;
+	LocalVector<uint32_t> bucket_agents;
+
+	_FORCE_INLINE_ uint32_t _get_bucket(const Vector2i &p_cell) const {
+		return ((uint32_t)p_cell.x * 73856093u ^ (uint32_t)p_cell.y * 19349663u) & bucket_mask;
+	}
+
+	void _run_batches(void (NavAvoidance2D::*p_method)(uint32_t, void *), const String &p_description);
+
+	void _gather_batch(uint32_t p_batch, void *p_userdata);
+	void _hash_batch(uint32_t p_batch, void *p_userdata);
+	void _solve_batch(uint32_t p_batch, void *p_userdata);
+	void _update_batch(uint32_t p_batch, void *p_userdata);
+
+	void _build_spatial_hash();
+	void _insert_neighbor(uint32_t p_index, uint32_t p_other_index, float &r_range_squared, LocalVector<Neighbor> &r_neighbors) const;
+	void _compute_neighbors(uint32_t p_index, LocalVector<Neighbor> &r_neighbors) const;
+
+public:
+	void step(const LocalVector<NavAgent *> &p_agents, RVO2D::RVOSimulator2D *p_simulation, bool p_use_threads, bool p_use_high_priority_threads);
+};
+
+#endif // NAV_AVOIDANCE_2D_H
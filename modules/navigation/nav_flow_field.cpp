@@ -0,0 +1,502 @@
+/**************************************************************************/
+/*  nav_flow_field.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "nav_flow_field.h"
+
+#include "nav_map.h"
+#include "nav_obstacle.h"
+
+#include "3d/nav_map_iteration_3d.h"
+#include "3d/nav_region_iteration_3d.h"
+
+#include "core/math/geometry_2d.h"
+#include "core/math/geometry_3d.h"
+
+NavFlowField::~NavFlowField() {
+	_wait_for_integration();
+}
+
+void NavFlowField::set_map(NavMap *p_map) {
+	if (map == p_map) {
+		return;
+	}
+
+	_wait_for_integration();
+
+	if (map) {
+		map->remove_flow_field(this);
+	}
+
+	map = p_map;
+	field_dirty = true;
+
+	// The polygons of the field belong to the previous map.
+	field_rwlock.write_lock();
+	for (Field &field : fields) {
+		field.graph.clear();
+		field.distances.clear();
+		field.exit_points.clear();
+		field.next_polygons.clear();
+	}
+	field_map_iteration_id = 0;
+	field_rwlock.write_unlock();
+
+	if (map) {
+		map->add_flow_field(this);
+	}
+}
+
+void NavFlowField::set_targets(const Vector<Vector3> &p_targets) {
+	targets = p_targets;
+	field_dirty = true;
+}
+
+void NavFlowField::set_navigation_layers(uint32_t p_navigation_layers) {
+	if (navigation_layers == p_navigation_layers) {
+		return;
+	}
+	navigation_layers = p_navigation_layers;
+	field_dirty = true;
+}
+
+Vector3 NavFlowField::get_direction(const Vector3 &p_position) const {
+	RWLockRead read_lock(field_rwlock);
+
+	const Field &field = fields[field_index];
+	Vector3 closest_point;
+	const uint32_t polygon_index = _find_polygon(field.graph, p_position, closest_point);
+	if (polygon_index == UINT32_MAX || field.distances[polygon_index] == FLT_MAX) {
+		return Vector3();
+	}
+
+	Vector3 direction = field.exit_points[polygon_index] - p_position;
+	if (direction.is_zero_approx()) {
+		// Standing on the exit point, keep going towards the one of the next polygon.
+		const uint32_t next_polygon_index = field.next_polygons[polygon_index];
+		if (next_polygon_index == UINT32_MAX) {
+			return Vector3();
+		}
+		direction = field.exit_points[next_polygon_index] - p_position;
+		if (direction.is_zero_approx()) {
+			return Vector3();
+		}
+	}
+	return direction.normalized();
+}
+
+real_t NavFlowField::get_distance(const Vector3 &p_position) const {
+	RWLockRead read_lock(field_rwlock);
+
+	const Field &field = fields[field_index];
+	Vector3 closest_point;
+	const uint32_t polygon_index = _find_polygon(field.graph, p_position, closest_point);
+	if (polygon_index == UINT32_MAX || field.distances[polygon_index] == FLT_MAX) {
+		return INFINITY;
+	}
+
+	const gd::FlowFieldPolygon &polygon = field.graph.polygons[polygon_index];
+	return field.distances[polygon_index] + closest_point.distance_to(field.exit_points[polygon_index]) * polygon.travel_cost;
+}
+
+void NavFlowField::sync(bool p_obstacles_changed) {
+	if (p_obstacles_changed) {
+		obstacles_dirty = true;
+	}
+
+	if (integration_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		if (!WorkerThreadPool::get_singleton()->is_task_completed(integration_task_id)) {
+			return;
+		}
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(integration_task_id);
+		integration_task_id = WorkerThreadPool::INVALID_TASK_ID;
+		_finish_integration();
+	}
+
+	if (map == nullptr || map->get_iteration_id() == 0) {
+		return;
+	}
+
+	const uint32_t map_iteration_id = map->get_iteration_id();
+	const bool rebuild_graph = map_iteration_id != field_map_iteration_id;
+	if (!rebuild_graph && !field_dirty && !obstacles_dirty) {
+		return;
+	}
+
+	integration_task.targets = targets;
+	integration_task.navigation_layers = navigation_layers;
+	integration_task.rebuild_graph = rebuild_graph;
+	integration_task.update_obstacles = rebuild_graph || obstacles_dirty;
+	integration_task.obstacles.clear();
+	if (integration_task.update_obstacles) {
+		// Only static obstacles block the field, moving obstacles are left to avoidance.
+		for (NavObstacle *obstacle : map->get_obstacles()) {
+			const Vector<Vector3> &obstacle_vertices = obstacle->get_vertices();
+			if (obstacle_vertices.size() < 3) {
+				continue;
+			}
+			StaticObstacle static_obstacle;
+			const Vector3 &obstacle_position = obstacle->get_position();
+			static_obstacle.vertices.resize(obstacle_vertices.size());
+			for (int i = 0; i < obstacle_vertices.size(); i++) {
+				static_obstacle.vertices.write[i] = Vector2(obstacle_vertices[i].x + obstacle_position.x, obstacle_vertices[i].z + obstacle_position.z);
+			}
+			static_obstacle.elevation = obstacle_position.y;
+			static_obstacle.height = obstacle->get_height();
+			integration_task.obstacles.push_back(static_obstacle);
+		}
+	}
+	integration_map_iteration_id = map_iteration_id;
+
+	field_dirty = false;
+	obstacles_dirty = false;
+
+	if (map->get_use_async_iterations()) {
+		integration_task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavFlowField::_integrate_threaded, this, true, SNAME("NavFlowField"));
+	} else {
+		_integrate();
+		_finish_integration();
+	}
+}
+
+void NavFlowField::_integrate_threaded(void *p_arg) {
+	NavFlowField *flow_field = static_cast<NavFlowField *>(p_arg);
+	flow_field->_integrate();
+}
+
+void NavFlowField::_integrate() {
+	const Field &current_field = fields[field_index];
+	Field &field = fields[(field_index + 1) % 2];
+	gd::FlowFieldGraph &graph = field.graph;
+
+	// Only rebuild the graph when the map changed, target and obstacle changes reuse it.
+	if (integration_task.rebuild_graph) {
+		graph.clear();
+		map->get_flow_field_graph(graph);
+	} else {
+		graph = current_field.graph;
+	}
+
+	if (integration_task.update_obstacles) {
+		for (gd::FlowFieldPolygon &polygon : graph.polygons) {
+			polygon.blocked = false;
+			const Vector2 center_2d = Vector2(polygon.center.x, polygon.center.z);
+			for (const StaticObstacle &obstacle : integration_task.obstacles) {
+				if (obstacle.height > 0.0 && (polygon.center.y < obstacle.elevation || polygon.center.y > obstacle.elevation + obstacle.height)) {
+					continue;
+				}
+				if (Geometry2D::is_point_in_polygon(center_2d, obstacle.vertices)) {
+					polygon.blocked = true;
+					break;
+				}
+			}
+		}
+	}
+
+	const uint32_t polygon_count = graph.polygons.size();
+	field.distances.resize(polygon_count);
+	field.exit_points.resize(polygon_count);
+	field.next_polygons.resize(polygon_count);
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		field.distances[i] = FLT_MAX;
+		field.next_polygons[i] = UINT32_MAX;
+	}
+
+	struct OpenPolygon {
+		real_t distance = 0.0;
+		uint32_t polygon = UINT32_MAX;
+	};
+	struct OpenPolygonGreaterThan {
+		bool operator()(const OpenPolygon &p_a, const OpenPolygon &p_b) const {
+			return p_a.distance > p_b.distance;
+		}
+	};
+	gd::Heap<OpenPolygon, OpenPolygonGreaterThan> open_polygons;
+
+	const uint32_t layers = integration_task.navigation_layers;
+
+	for (const Vector3 &target : integration_task.targets) {
+		Vector3 closest_point;
+		const uint32_t polygon_index = _find_polygon(graph, target, closest_point);
+		if (polygon_index == UINT32_MAX || field.distances[polygon_index] == 0.0) {
+			continue;
+		}
+		const gd::FlowFieldPolygon &polygon = graph.polygons[polygon_index];
+		if ((layers & polygon.navigation_layers) == 0 || polygon.blocked) {
+			continue;
+		}
+		field.distances[polygon_index] = 0.0;
+		field.exit_points[polygon_index] = closest_point;
+		open_polygons.push({ 0.0, polygon_index });
+	}
+
+	// Dijkstra from the targets outwards, following the polygon connections backwards.
+	while (!open_polygons.is_empty()) {
+		const OpenPolygon open_polygon = open_polygons.pop();
+		const uint32_t polygon_index = open_polygon.polygon;
+		if (open_polygon.distance > field.distances[polygon_index]) {
+			continue;
+		}
+
+		const gd::FlowFieldPolygon &polygon = graph.polygons[polygon_index];
+		const Vector3 exit_point = field.exit_points[polygon_index];
+
+		for (uint32_t i = 0; i < polygon.connection_count; i++) {
+			const gd::FlowFieldConnection &connection = graph.connections[polygon.first_connection + i];
+			const gd::FlowFieldPolygon &neighbor = graph.polygons[connection.polygon];
+			if ((layers & neighbor.navigation_layers) == 0 || neighbor.blocked) {
+				continue;
+			}
+
+			Vector3 pathway[2] = { connection.pathway_start, connection.pathway_end };
+			const Vector3 neighbor_exit_point = Geometry3D::get_closest_point_to_segment(exit_point, pathway);
+			const real_t distance = field.distances[polygon_index] + neighbor_exit_point.distance_to(exit_point) * polygon.travel_cost;
+			if (distance < field.distances[connection.polygon]) {
+				field.distances[connection.polygon] = distance;
+				field.exit_points[connection.polygon] = neighbor_exit_point;
+				field.next_polygons[connection.polygon] = polygon_index;
+				open_polygons.push({ distance, connection.polygon });
+			}
+		}
+	}
+}
+
+void NavFlowField::_finish_integration() {
+	field_rwlock.write_lock();
+	field_index = (field_index + 1) % 2;
+	field_map_iteration_id = integration_map_iteration_id;
+	field_rwlock.write_unlock();
+
+	iteration_id = iteration_id % UINT32_MAX + 1;
+}
+
+void NavFlowField::_wait_for_integration() {
+	if (integration_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(integration_task_id);
+		integration_task_id = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
+uint32_t NavFlowField::_find_polygon(const gd::FlowFieldGraph &p_graph, const Vector3 &p_position, Vector3 &r_closest_point) {
+	if (p_graph.grid_width == 0 || p_graph.grid_depth == 0) {
+		return UINT32_MAX;
+	}
+
+	const int x = CLAMP(int(Math::floor((p_position.x - p_graph.grid_origin.x) / p_graph.grid_cell_size)), 0, p_graph.grid_width - 1);
+	const int z = CLAMP(int(Math::floor((p_position.z - p_graph.grid_origin.y) / p_graph.grid_cell_size)), 0, p_graph.grid_depth - 1);
+	const uint32_t cell = z * p_graph.grid_width + x;
+
+	uint32_t closest_polygon = UINT32_MAX;
+	real_t closest_distance = FLT_MAX;
+	for (uint32_t i = p_graph.grid_cell_offsets[cell]; i < p_graph.grid_cell_offsets[cell + 1]; i++) {
+		const uint32_t polygon_index = p_graph.grid_polygons[i];
+		const gd::FlowFieldPolygon &polygon = p_graph.polygons[polygon_index];
+		const Vector3 *points = &p_graph.vertices[polygon.first_vertex];
+		for (uint32_t point_id = 2; point_id < polygon.vertex_count; point_id++) {
+			const Face3 face(points[0], points[point_id - 1], points[point_id]);
+			const Vector3 point = face.get_closest_point_to(p_position);
+			const real_t distance = point.distance_squared_to(p_position);
+			if (distance < closest_distance) {
+				closest_distance = distance;
+				closest_polygon = polygon_index;
+				r_closest_point = point;
+			}
+		}
+	}
+	return closest_polygon;
+}
+
+void NavFlowField::build_graph(const NavMapIteration &p_map_iteration, gd::FlowFieldGraph &r_graph) {
+	const uint32_t polygon_count = p_map_iteration.navmesh_polygon_count + p_map_iteration.link_polygon_count;
+	r_graph.polygons.resize(polygon_count);
+
+	LocalVector<const gd::Polygon *> source_polygons;
+	source_polygons.resize(polygon_count);
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		source_polygons[i] = nullptr;
+	}
+	for (const NavRegionIteration &region : p_map_iteration.region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+		for (const gd::Polygon &polygon : region.get_navmesh_polygons()) {
+			if (polygon.id < polygon_count) {
+				source_polygons[polygon.id] = &polygon;
+			}
+		}
+	}
+	for (const gd::Polygon &link_polygon : p_map_iteration.link_polygons) {
+		if (link_polygon.owner != nullptr && link_polygon.id < polygon_count) {
+			source_polygons[link_polygon.id] = &link_polygon;
+		}
+	}
+
+	// Copy the polygons and count the connections that lead into each of them.
+	LocalVector<uint32_t> connection_counts;
+	connection_counts.resize(polygon_count);
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		connection_counts[i] = 0;
+	}
+
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		const gd::Polygon *source = source_polygons[i];
+		if (source == nullptr) {
+			continue;
+		}
+		gd::FlowFieldPolygon &polygon = r_graph.polygons[i];
+		polygon.first_vertex = r_graph.vertices.size();
+		polygon.vertex_count = source->points.size();
+		polygon.navigation_layers = source->owner->get_navigation_layers();
+		polygon.travel_cost = source->owner->get_travel_cost();
+		polygon.center = Vector3();
+		for (const gd::Point &point : source->points) {
+			r_graph.vertices.push_back(point.pos);
+			polygon.center += point.pos;
+		}
+		if (polygon.vertex_count > 0) {
+			polygon.center /= polygon.vertex_count;
+		}
+
+		for (const gd::Edge &edge : source->edges) {
+			for (const gd::Edge::Connection &connection : edge.connections) {
+				connection_counts[connection.polygon->id] += 1;
+			}
+		}
+	}
+
+	uint32_t connection_offset = 0;
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		r_graph.polygons[i].first_connection = connection_offset;
+		r_graph.polygons[i].connection_count = 0;
+		connection_offset += connection_counts[i];
+	}
+	r_graph.connections.resize(connection_offset);
+
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		const gd::Polygon *source = source_polygons[i];
+		if (source == nullptr) {
+			continue;
+		}
+		for (const gd::Edge &edge : source->edges) {
+			for (const gd::Edge::Connection &connection : edge.connections) {
+				gd::FlowFieldPolygon &target = r_graph.polygons[connection.polygon->id];
+				gd::FlowFieldConnection &incoming = r_graph.connections[target.first_connection + target.connection_count];
+				incoming.polygon = i;
+				incoming.pathway_start = connection.pathway_start;
+				incoming.pathway_end = connection.pathway_end;
+				target.connection_count += 1;
+			}
+		}
+	}
+
+	// Only region polygons are sampled, links are too thin to stand on.
+	Rect2 bounds;
+	uint32_t grid_polygon_count = 0;
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		const gd::Polygon *source = source_polygons[i];
+		if (source == nullptr || source->owner->get_type() != NavigationUtilities::PathSegmentType::PATH_SEGMENT_TYPE_REGION || source->points.size() < 3) {
+			continue;
+		}
+		for (const gd::Point &point : source->points) {
+			const Vector2 point_2d = Vector2(point.pos.x, point.pos.z);
+			if (grid_polygon_count == 0) {
+				bounds = Rect2(point_2d, Vector2());
+			} else {
+				bounds.expand_to(point_2d);
+			}
+		}
+		grid_polygon_count++;
+	}
+
+	if (grid_polygon_count == 0) {
+		r_graph.grid_width = 0;
+		r_graph.grid_depth = 0;
+		return;
+	}
+
+	// Aim for a handful of polygons per cell.
+	const int max_grid_cells = 512;
+	real_t cell_size = Math::sqrt(bounds.get_area() / grid_polygon_count) * 2.0;
+	cell_size = MAX(cell_size, MAX(bounds.size.x, bounds.size.y) / max_grid_cells);
+	cell_size = MAX(cell_size, (real_t)CMP_EPSILON);
+
+	r_graph.grid_origin = bounds.position;
+	r_graph.grid_cell_size = cell_size;
+	r_graph.grid_width = CLAMP(int(Math::ceil(bounds.size.x / cell_size)), 1, max_grid_cells);
+	r_graph.grid_depth = CLAMP(int(Math::ceil(bounds.size.y / cell_size)), 1, max_grid_cells);
+
+	const uint32_t cell_count = r_graph.grid_width * r_graph.grid_depth;
+	r_graph.grid_cell_offsets.resize(cell_count + 1);
+	for (uint32_t &cell_offset : r_graph.grid_cell_offsets) {
+		cell_offset = 0;
+	}
+
+	// Two passes over the polygon bounds, first counting and then filling the cells.
+	for (int pass = 0; pass < 2; pass++) {
+		for (uint32_t i = 0; i < polygon_count; i++) {
+			const gd::Polygon *source = source_polygons[i];
+			if (source == nullptr || source->owner->get_type() != NavigationUtilities::PathSegmentType::PATH_SEGMENT_TYPE_REGION || source->points.size() < 3) {
+				continue;
+			}
+
+			Rect2 polygon_bounds = Rect2(Vector2(source->points[0].pos.x, source->points[0].pos.z), Vector2());
+			for (const gd::Point &point : source->points) {
+				polygon_bounds.expand_to(Vector2(point.pos.x, point.pos.z));
+			}
+			const int begin_x = CLAMP(int(Math::floor((polygon_bounds.position.x - r_graph.grid_origin.x) / cell_size)), 0, r_graph.grid_width - 1);
+			const int begin_z = CLAMP(int(Math::floor((polygon_bounds.position.y - r_graph.grid_origin.y) / cell_size)), 0, r_graph.grid_depth - 1);
+			const int end_x = CLAMP(int(Math::floor((polygon_bounds.get_end().x - r_graph.grid_origin.x) / cell_size)), 0, r_graph.grid_width - 1);
+			const int end_z = CLAMP(int(Math::floor((polygon_bounds.get_end().y - r_graph.grid_origin.y) / cell_size)), 0, r_graph.grid_depth - 1);
+
+			for (int z = begin_z; z <= end_z; z++) {
+				for (int x = begin_x; x <= end_x; x++) {
+					const uint32_t cell = z * r_graph.grid_width + x;
+					if (pass == 0) {
+						r_graph.grid_cell_offsets[cell + 1] += 1;
+					} else {
+						r_graph.grid_polygons[r_graph.grid_cell_offsets[cell]++] = i;
+					}
+				}
+			}
+		}
+
+		if (pass == 0) {
+			for (uint32_t cell = 0; cell < cell_count; cell++) {
+				r_graph.grid_cell_offsets[cell + 1] += r_graph.grid_cell_offsets[cell];
+			}
+			r_graph.grid_polygons.resize(r_graph.grid_cell_offsets[cell_count]);
+		} else {
+			// Filling advanced each offset to the start of the next cell, shift them back.
+			for (uint32_t cell = cell_count; cell > 0; cell--) {
+				r_graph.grid_cell_offsets[cell] = r_graph.grid_cell_offsets[cell - 1];
+			}
+			r_graph.grid_cell_offsets[0] = 0;
+		}
+	}
+}
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*  nav_flow_field.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef NAV_FLOW_FIELD_H
+#define NAV_FLOW_FIELD_H
+
+#include "nav_rid.h"
+#include "nav_utils.h"
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/rw_lock.h"
+
+class NavMap;
+struct NavMapIteration;
+
+class NavFlowField : public NavRid {
+	struct StaticObstacle {
+		Vector<Vector2> vertices;
+		real_t elevation = 0.0;
+		real_t height = 0.0;
+	};
+
+	struct Field {
+		gd::FlowFieldGraph graph;
+		/// Travel cost from the exit point of each polygon to the closest target.
+		LocalVector<real_t> distances;
+		/// Point each polygon is left through on the way to the closest target.
+		LocalVector<Vector3> exit_points;
+		/// Polygon entered through the exit point, or UINT32_MAX for the polygons with a target.
+		LocalVector<uint32_t> next_polygons;
+	};
+
+	NavMap *map = nullptr;
+	Vector<Vector3> targets;
+	uint32_t navigation_layers = 1;
+
+	bool field_dirty = true;
+	bool obstacles_dirty = true;
+
+	/// Change the id each time a new field is ready.
+	uint32_t iteration_id = 0;
+
+	/// The field that is sampled, and the one that is being integrated.
+	Field fields[2];
+	uint32_t field_index = 0;
+	uint32_t field_map_iteration_id = 0;
+	mutable RWLock field_rwlock;
+
+	struct IntegrationTask {
+		bool rebuild_graph = false;
+		bool update_obstacles = false;
+		Vector<Vector3> targets;
+		uint32_t navigation_layers = 1;
+		LocalVector<StaticObstacle> obstacles;
+	} integration_task;
+	uint32_t integration_map_iteration_id = 0;
+	WorkerThreadPool::TaskID integration_task_id = WorkerThreadPool::INVALID_TASK_ID;
+
+	static void _integrate_threaded(void *p_arg);
+	void _integrate();
+	void _finish_integration();
+	void _wait_for_integration();
+
+	static uint32_t _find_polygon(const gd::FlowFieldGraph &p_graph, const Vector3 &p_position, Vector3 &r_closest_point);
+
+public:
+	NavFlowField() {}
+	~NavFlowField();
+
+	void set_map(NavMap *p_map);
+	NavMap *get_map() const { return map; }
+
+	void set_targets(const Vector<Vector3> &p_targets);
+	const Vector<Vector3> &get_targets() const { return targets; }
+
+	void set_navigation_layers(uint32_t p_navigation_layers);
+	uint32_t get_navigation_layers() const { return navigation_layers; }
+
+	uint32_t get_iteration_id() const { return iteration_id; }
+
+	Vector3 get_direction(const Vector3 &p_position) const;
+	real_t get_distance(const Vector3 &p_position) const;
+
+	void sync(bool p_obstacles_changed);
+
+	static void build_graph(const NavMapIteration &p_map_iteration, gd::FlowFieldGraph &r_graph);
+};
+
+#endif // NAV_FLOW_FIELD_H
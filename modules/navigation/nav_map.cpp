@@ -34,12 +34,14 @@
 #include "3d/nav_mesh_queries_3d.h"
 #include "3d/nav_region_iteration_3d.h"
 #include "nav_agent.h"
+#include "nav_flow_field.h"
 #include "nav_link.h"
 #include "nav_obstacle.h"
 #include "nav_region.h"
 
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 
 #include <Obstacle2d.h>
 
@@ -145,6 +147,8 @@ void NavMap::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task)
 		return;
 	}
 
+	const uint64_t query_begin = OS::get_singleton()->get_ticks_usec();
+
 	GET_MAP_ITERATION();
 
 	map_iteration.path_query_slots_semaphore.wait();
@@ -175,6 +179,13 @@ void NavMap::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task)
 	map_iteration.path_query_slots_mutex.unlock();
 
 	map_iteration.path_query_slots_semaphore.post();
+
+	const uint64_t query_usec = OS::get_singleton()->get_ticks_usec() - query_begin;
+	path_query_statistics.query_count.increment();
+	path_query_statistics.query_usec.add(query_usec);
+	path_query_statistics.query_max_usec.exchange_if_greater(query_usec);
+	path_query_statistics.polygon_count.add(p_query_task.searched_polygon_count);
+	path_query_statistics.latency_histogram[gd::PerformanceData::get_path_query_latency_bucket(query_usec)].increment();
 }
 
 Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
@@ -297,6 +308,25 @@ void NavMap::remove_obstacle(NavObstacle *obstacle) {
 	}
 }
 
+void NavMap::add_flow_field(NavFlowField *p_flow_field) {
+	if (!flow_fields.has(p_flow_field)) {
+		flow_fields.push_back(p_flow_field);
+	}
+}
+
+void NavMap::remove_flow_field(NavFlowField *p_flow_field) {
+	int64_t flow_field_index = flow_fields.find(p_flow_field);
+	if (flow_field_index >= 0) {
+		flow_fields.remove_at_unordered(flow_field_index);
+	}
+}
+
+void NavMap::get_flow_field_graph(gd::FlowFieldGraph &r_graph) const {
+	GET_MAP_ITERATION_CONST();
+
+	NavFlowField::build_graph(map_iteration, r_graph);
+}
+
 void NavMap::set_agent_as_controlled(NavAgent *agent) {
 	remove_agent_as_controlled(agent);
 
@@ -373,6 +403,7 @@ void NavMap::_build_iteration() {
 	iteration_build.use_edge_connections = get_use_edge_connections();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
+	iteration_build.cluster_size = path_cluster_size;
 
 	uint32_t enabled_region_count = 0;
 	uint32_t enabled_link_count = 0;
@@ -449,6 +480,9 @@ void NavMap::_sync_iteration() {
 	performance_data.pm_edge_merge_count = iteration_build.performance_data.pm_edge_merge_count;
 	performance_data.pm_edge_connection_count = iteration_build.performance_data.pm_edge_connection_count;
 	performance_data.pm_edge_free_count = iteration_build.performance_data.pm_edge_free_count;
+	for (int i = 0; i < gd::PerformanceData::BUILD_STEP_MAX; i++) {
+		performance_data.pm_build_step_usec[i] = iteration_build.performance_data.pm_build_step_usec[i];
+	}
 
 	iteration_id = iteration_id % UINT32_MAX + 1;
 
@@ -461,13 +495,46 @@ void NavMap::_sync_iteration() {
 	iteration_ready = false;
 }
 
+void NavMap::_sync_path_query_statistics() {
+	// Queries finishing while this runs are counted in the next sync, only the max may be lost.
+	const uint32_t query_count = path_query_statistics.query_count.get();
+	path_query_statistics.query_count.sub(query_count);
+	performance_data.pm_path_query_count = query_count;
+
+	const uint64_t query_usec = path_query_statistics.query_usec.get();
+	path_query_statistics.query_usec.sub(query_usec);
+	performance_data.pm_path_query_usec = query_usec;
+
+	performance_data.pm_path_query_max_usec = path_query_statistics.query_max_usec.get();
+	path_query_statistics.query_max_usec.set(0);
+
+	const uint32_t polygon_count = path_query_statistics.polygon_count.get();
+	path_query_statistics.polygon_count.sub(polygon_count);
+	performance_data.pm_path_query_polygon_count = polygon_count;
+
+	for (int i = 0; i < gd::PerformanceData::PATH_QUERY_LATENCY_BUCKETS; i++) {
+		const uint32_t bucket_count = path_query_statistics.latency_histogram[i].get();
+		path_query_statistics.latency_histogram[i].sub(bucket_count);
+		performance_data.pm_path_query_latency_histogram[i] = bucket_count;
+	}
+}
+
 void NavMap::sync() {
+	const uint64_t sync_begin = OS::get_singleton()->get_ticks_usec();
+
 	// Performance Monitor.
 	performance_data.pm_region_count = regions.size();
 	performance_data.pm_agent_count = agents.size();
 	performance_data.pm_link_count = links.size();
 	performance_data.pm_obstacle_count = obstacles.size();
 
+	// Build timings are only reported by the sync that takes over a new map iteration.
+	for (int i = 0; i < gd::PerformanceData::BUILD_STEP_MAX; i++) {
+		performance_data.pm_build_step_usec[i] = 0;
+	}
+
+	_sync_path_query_statistics();
+
 	_sync_dirty_map_update_requests();
 
 	if (iteration_dirty && !iteration_building && !iteration_ready) {
@@ -489,6 +556,9 @@ void NavMap::sync() {
 	map_settings_dirty = false;
 
 	_sync_avoidance();
+	_sync_flow_fields();
+
+	performance_data.pm_map_sync_usec = OS::get_singleton()->get_ticks_usec() - sync_begin;
 }
 
 void NavMap::_sync_avoidance() {
@@ -498,10 +568,18 @@ void NavMap::_sync_avoidance() {
 		_update_rvo_simulation();
 	}
 
+	flow_field_obstacles_dirty = flow_field_obstacles_dirty || obstacles_dirty;
 	obstacles_dirty = false;
 	agents_dirty = false;
 }
 
+void NavMap::_sync_flow_fields() {
+	for (NavFlowField *flow_field : flow_fields) {
+		flow_field->sync(flow_field_obstacles_dirty);
+	}
+	flow_field_obstacles_dirty = false;
+}
+
 void NavMap::_update_rvo_obstacles_tree_2d() {
 	int obstacle_vertex_count = 0;
 	for (NavObstacle *obstacle : obstacles) {
@@ -580,16 +658,6 @@ void NavMap::_update_rvo_obstacles_tree_2d() {
 	rvo_simulation_2d.kdTree_->buildObstacleTree(raw_obstacles);
 }
 
-void NavMap::_update_rvo_agents_tree_2d() {
-	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
-	std::vector<RVO2D::Agent2D *> raw_agents;
-	raw_agents.reserve(active_2d_avoidance_agents.size());
-	for (NavAgent *agent : active_2d_avoidance_agents) {
-		raw_agents.push_back(agent->get_rvo_agent_2d());
-	}
-	rvo_simulation_2d.kdTree_->buildAgentTree(raw_agents);
-}
-
 void NavMap::_update_rvo_agents_tree_3d() {
 	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
 	std::vector<RVO3D::Agent3D *> raw_agents;
@@ -605,18 +673,10 @@ void NavMap::_update_rvo_simulation() {
 		_update_rvo_obstacles_tree_2d();
 	}
 	if (agents_dirty) {
-		_update_rvo_agents_tree_2d();
 		_update_rvo_agents_tree_3d();
 	}
 }
 
-void NavMap::compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent) {
-	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-	(*(agent + index))->update();
-}
-
 void NavMap::compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent) {
 	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
 	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
@@ -625,23 +685,15 @@ void NavMap::compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent)
 }
 
 void NavMap::step(real_t p_deltatime) {
+	const uint64_t step_begin = OS::get_singleton()->get_ticks_usec();
+
 	deltatime = p_deltatime;
 
 	rvo_simulation_2d.setTimeStep(float(deltatime));
 	rvo_simulation_3d.setTimeStep(float(deltatime));
 
 	if (active_2d_avoidance_agents.size() > 0) {
-		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
-			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
-		} else {
-			for (NavAgent *agent : active_2d_avoidance_agents) {
-				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-				agent->update();
-			}
-		}
+		avoidance_2d.step(active_2d_avoidance_agents, &rvo_simulation_2d, use_threads && avoidance_use_multiple_threads, avoidance_use_high_priority_threads);
 	}
 
 	if (active_3d_avoidance_agents.size() > 0) {
@@ -657,6 +709,8 @@ void NavMap::step(real_t p_deltatime) {
 			}
 		}
 	}
+
+	performance_data.pm_avoidance_usec = OS::get_singleton()->get_ticks_usec() - step_begin;
 }
 
 void NavMap::dispatch_callbacks() {
@@ -782,6 +836,13 @@ void NavMap::remove_obstacle_sync_dirty_request(SelfList<NavObstacle> *p_sync_re
 }
 
 void NavMap::_sync_dirty_map_update_requests() {
+	// The cluster graph is part of the map iteration, so a new cluster size needs a new iteration.
+	const real_t cluster_size = MAX(0.0, real_t(GLOBAL_GET("navigation/pathfinding/cluster_size")));
+	if (path_cluster_size != cluster_size) {
+		path_cluster_size = cluster_size;
+		iteration_dirty = true;
+	}
+
 	// If entire map settings changed make all regions dirty.
 	if (map_settings_dirty) {
 		for (NavRegion *region : regions) {
@@ -845,6 +906,8 @@ NavMap::NavMap() {
 	avoidance_use_high_priority_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_high_priority_threads");
 
 	path_query_slots_max = GLOBAL_GET("navigation/pathfinding/max_threads");
+	path_cluster_size = MAX(0.0, real_t(GLOBAL_GET("navigation/pathfinding/cluster_size")));
+	path_corridor_cache_size = MAX(0, int(GLOBAL_GET("navigation/pathfinding/path_cache_size")));
 
 	int processor_count = OS::get_singleton()->get_processor_count();
 	if (path_query_slots_max < 0) {
@@ -865,6 +928,11 @@ NavMap::NavMap() {
 			iteration_slot.path_query_slots[i].slot_index = i;
 		}
 		iteration_slot.path_query_slots_semaphore.post(path_query_slots_max);
+
+		iteration_slot.path_corridor_cache_size = path_corridor_cache_size;
+		if (path_corridor_cache_size > 0) {
+			iteration_slot.path_corridor_cache.set_capacity(path_corridor_cache_size);
+		}
 	}
 
 #ifdef THREADS_ENABLED
@@ -33,11 +33,13 @@
 
 #include "3d/nav_map_iteration_3d.h"
 #include "3d/nav_mesh_queries_3d.h"
+#include "nav_avoidance_2d.h"
 #include "nav_rid.h"
 #include "nav_utils.h"
 
 #include "core/math/math_defs.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/safe_refcount.h"
 #include "servers/navigation/navigation_globals.h"
 
 #include <KdTree2d.h>
@@ -49,6 +51,7 @@ class NavLink;
 class NavRegion;
 class NavAgent;
 class NavObstacle;
+class NavFlowField;
 
 class NavMap : public NavRid {
 	/// Map Up
@@ -84,6 +87,9 @@ class NavMap : public NavRid {
 	RVO2D::RVOSimulator2D rvo_simulation_2d;
 	RVO3D::RVOSimulator3D rvo_simulation_3d;
 
+	/// 2D avoidance solver, the simulation above only provides its obstacle tree.
+	NavAvoidance2D avoidance_2d;
+
 	/// avoidance controlled agents
 	LocalVector<NavAgent *> active_2d_avoidance_agents;
 	LocalVector<NavAgent *> active_3d_avoidance_agents;
@@ -100,6 +106,12 @@ class NavMap : public NavRid {
 	/// Are rvo obstacles modified?
 	bool obstacles_dirty = true;
 
+	/// Flow fields integrated over this map
+	LocalVector<NavFlowField *> flow_fields;
+
+	/// Were obstacles modified since the flow fields were last synced?
+	bool flow_field_obstacles_dirty = true;
+
 	/// Physics delta time
 	real_t deltatime = 0.0;
 
@@ -113,6 +125,15 @@ class NavMap : public NavRid {
 	// Performance Monitor
 	gd::PerformanceData performance_data;
 
+	// Path queries run on any thread, their statistics are collected here until the next sync.
+	struct PathQueryStatistics {
+		SafeNumeric<uint32_t> query_count;
+		SafeNumeric<uint64_t> query_usec;
+		SafeNumeric<uint64_t> query_max_usec;
+		SafeNumeric<uint32_t> polygon_count;
+		SafeNumeric<uint32_t> latency_histogram[gd::PerformanceData::PATH_QUERY_LATENCY_BUCKETS];
+	} path_query_statistics;
+
 	struct {
 		SelfList<NavRegion>::List regions;
 		SelfList<NavLink>::List links;
@@ -122,6 +143,12 @@ class NavMap : public NavRid {
 
 	int path_query_slots_max = 4;
 
+	/// Size of the clusters used for hierarchical pathfinding, or 0 to search the polygons directly.
+	real_t path_cluster_size = 0.0;
+
+	/// Number of polygon corridors each map iteration keeps for reuse, or 0 to disable the cache.
+	int path_corridor_cache_size = 0;
+
 	bool use_async_iterations = true;
 
 	uint32_t iteration_slot_index = 0;
@@ -139,6 +166,7 @@ class NavMap : public NavRid {
 
 	void _build_iteration();
 	void _sync_iteration();
+	void _sync_path_query_statistics();
 
 public:
 	NavMap();
@@ -219,6 +247,13 @@ public:
 		return obstacles;
 	}
 
+	void add_flow_field(NavFlowField *p_flow_field);
+	void remove_flow_field(NavFlowField *p_flow_field);
+	const LocalVector<NavFlowField *> &get_flow_fields() const {
+		return flow_fields;
+	}
+	void get_flow_field_graph(gd::FlowFieldGraph &r_graph) const;
+
 	Vector3 get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const;
 
 	void sync();
@@ -235,6 +270,7 @@ public:
 	int get_pm_edge_connection_count() const { return performance_data.pm_edge_connection_count; }
 	int get_pm_edge_free_count() const { return performance_data.pm_edge_free_count; }
 	int get_pm_obstacle_count() const { return performance_data.pm_obstacle_count; }
+	const gd::PerformanceData &get_performance_data() const { return performance_data; }
 
 	int get_region_connections_count(NavRegion *p_region) const;
 	Vector3 get_region_connection_pathway_start(NavRegion *p_region, int p_connection_id) const;
@@ -259,13 +295,12 @@ private:
 
 	void compute_single_step(uint32_t index, NavAgent **agent);
 
-	void compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent);
 	void compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent);
 
 	void _sync_avoidance();
+	void _sync_flow_fields();
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
-	void _update_rvo_agents_tree_2d();
 	void _update_rvo_agents_tree_3d();
 
 	void _update_merge_rasterizer_cell_dimensions();
@@ -50,6 +50,9 @@ class NavRegion : public NavBase {
 
 	bool polygons_dirty = true;
 
+	/// Change the id each time the region polygons are updated.
+	uint32_t iteration_id = 0;
+
 	LocalVector<gd::Polygon> navmesh_polygons;
 
 	real_t surface_area = 0.0;
@@ -100,6 +103,8 @@ public:
 	real_t get_surface_area() const { return surface_area; }
 	AABB get_bounds() const { return bounds; }
 
+	uint32_t get_iteration_id() const { return iteration_id; }
+
 	bool sync();
 	void request_sync();
 	void cancel_sync_request();
@@ -31,6 +31,7 @@
 #ifndef NAV_UTILS_H
 #define NAV_UTILS_H
 
+#include "core/math/vector2.h"
 #include "core/math/vector3.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hashfuncs.h"
@@ -112,6 +113,30 @@ struct Polygon {
 	LocalVector<Edge> edges;
 
 	real_t surface_area = 0.0;
+
+	/// Id of the cluster in the map that contains this polygon.
+	uint32_t cluster = UINT32_MAX;
+};
+
+struct ClusterConnection {
+	/// Cluster that this connection leads to.
+	uint32_t cluster = UINT32_MAX;
+
+	/// Estimated travel cost between the centers of both clusters.
+	real_t cost = 0.0;
+};
+
+/// A group of connected polygons of the same owner that are close to each other.
+/// The clusters of a map form the abstract graph used by hierarchical pathfinding.
+struct Cluster {
+	/// Navigation region or link that contains the polygons of this cluster.
+	const NavBaseIteration *owner = nullptr;
+
+	/// The average position of the polygons in this cluster.
+	Vector3 center;
+
+	/// Connections to the neighboring clusters.
+	LocalVector<ClusterConnection> connections;
 };
 
 struct NavigationPoly {
@@ -179,6 +204,105 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+struct NavigationCluster {
+	/// Index in the heap of traversable clusters.
+	uint32_t traversable_cluster_index = UINT32_MAX;
+
+	/// The cluster this cluster was reached from.
+	uint32_t back_navigation_cluster_id = UINT32_MAX;
+
+	/// The distance traveled until now (g cost).
+	real_t traveled_distance = FLT_MAX;
+	/// The distance to the destination (h cost).
+	real_t distance_to_destination = 0.0;
+
+	/// If the polygon search is allowed to enter this cluster.
+	bool in_corridor = false;
+
+	/// The total travel cost (f cost).
+	real_t total_travel_cost() const {
+		return traveled_distance + distance_to_destination;
+	}
+
+	void reset() {
+		traversable_cluster_index = UINT32_MAX;
+		back_navigation_cluster_id = UINT32_MAX;
+		traveled_distance = FLT_MAX;
+		distance_to_destination = 0.0;
+		in_corridor = false;
+	}
+};
+
+struct NavClusterTravelCostGreaterThan {
+	// Returns `true` if the travel cost of `a` is higher than that of `b`.
+	bool operator()(const NavigationCluster *p_cluster_a, const NavigationCluster *p_cluster_b) const {
+		real_t f_cost_a = p_cluster_a->total_travel_cost();
+		real_t f_cost_b = p_cluster_b->total_travel_cost();
+
+		if (f_cost_a != f_cost_b) {
+			return f_cost_a > f_cost_b;
+		} else {
+			return p_cluster_a->distance_to_destination > p_cluster_b->distance_to_destination;
+		}
+	}
+};
+
+struct NavClusterHeapIndexer {
+	void operator()(NavigationCluster *p_cluster, uint32_t p_heap_index) const {
+		p_cluster->traversable_cluster_index = p_heap_index;
+	}
+};
+
+struct FlowFieldPolygon {
+	/// Range of the polygon points in the graph vertices.
+	uint32_t first_vertex = 0;
+	uint32_t vertex_count = 0;
+
+	/// Range of the connections that lead into this polygon.
+	uint32_t first_connection = 0;
+	uint32_t connection_count = 0;
+
+	uint32_t navigation_layers = 0;
+	real_t travel_cost = 1.0;
+	Vector3 center;
+
+	/// If a static obstacle covers the polygon center.
+	bool blocked = false;
+};
+
+struct FlowFieldConnection {
+	/// Polygon that this connection comes from.
+	uint32_t polygon = UINT32_MAX;
+
+	Vector3 pathway_start;
+	Vector3 pathway_end;
+};
+
+/// A snapshot of the map polygons that flow fields are integrated over.
+struct FlowFieldGraph {
+	LocalVector<FlowFieldPolygon> polygons;
+	LocalVector<Vector3> vertices;
+	LocalVector<FlowFieldConnection> connections;
+
+	/// Uniform grid on the XZ plane that lists the polygons overlapping each cell.
+	Vector2 grid_origin;
+	real_t grid_cell_size = 1.0;
+	int grid_width = 0;
+	int grid_depth = 0;
+	LocalVector<uint32_t> grid_cell_offsets;
+	LocalVector<uint32_t> grid_polygons;
+
+	void clear() {
+		polygons.clear();
+		vertices.clear();
+		connections.clear();
+		grid_width = 0;
+		grid_depth = 0;
+		grid_cell_offsets.clear();
+		grid_polygons.clear();
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
@@ -316,6 +440,21 @@ struct EdgeConnectionPair {
 };
 
 struct PerformanceData {
+	enum BuildStep {
+		BUILD_STEP_GATHER_REGION_POLYGONS,
+		BUILD_STEP_UPDATE_EDGE_KEYS,
+		BUILD_STEP_MERGE_EDGE_CONNECTION_PAIRS,
+		BUILD_STEP_EDGE_CONNECTION_MARGIN_CONNECTIONS,
+		BUILD_STEP_NAVLINK_CONNECTIONS,
+		BUILD_STEP_CLUSTER_GRAPH,
+		BUILD_STEP_UPDATE_MAP_ITERATION,
+		BUILD_STEP_MAX,
+	};
+
+	// Upper bounds of the path query latency histogram buckets in microseconds, the last bucket has no bound.
+	static constexpr int PATH_QUERY_LATENCY_BUCKETS = 9;
+	static constexpr uint64_t path_query_latency_bounds[PATH_QUERY_LATENCY_BUCKETS - 1] = { 50, 100, 250, 500, 1000, 2500, 5000, 10000 };
+
 	int pm_region_count = 0;
 	int pm_agent_count = 0;
 	int pm_link_count = 0;
@@ -326,6 +465,34 @@ struct PerformanceData {
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
 
+	// Timings in microseconds. The build steps are the ones of the last finished map iteration build.
+	uint64_t pm_build_step_usec[BUILD_STEP_MAX] = {};
+	uint64_t pm_map_sync_usec = 0;
+	uint64_t pm_avoidance_usec = 0;
+
+	// Path queries finished since the previous sync.
+	int pm_path_query_count = 0;
+	uint64_t pm_path_query_usec = 0;
+	uint64_t pm_path_query_max_usec = 0;
+	int pm_path_query_polygon_count = 0;
+	int pm_path_query_latency_histogram[PATH_QUERY_LATENCY_BUCKETS] = {};
+
+	uint64_t get_build_usec() const {
+		uint64_t build_usec = 0;
+		for (int i = 0; i < BUILD_STEP_MAX; i++) {
+			build_usec += pm_build_step_usec[i];
+		}
+		return build_usec;
+	}
+
+	static int get_path_query_latency_bucket(uint64_t p_usec) {
+		int bucket = 0;
+		while (bucket < PATH_QUERY_LATENCY_BUCKETS - 1 && p_usec > path_query_latency_bounds[bucket]) {
+			bucket++;
+		}
+		return bucket;
+	}
+
 	void reset() {
 		pm_region_count = 0;
 		pm_agent_count = 0;
@@ -336,6 +503,20 @@ struct PerformanceData {
 		pm_edge_connection_count = 0;
 		pm_edge_free_count = 0;
 		pm_obstacle_count = 0;
+
+		for (int i = 0; i < BUILD_STEP_MAX; i++) {
+			pm_build_step_usec[i] = 0;
+		}
+		pm_map_sync_usec = 0;
+		pm_avoidance_usec = 0;
+
+		pm_path_query_count = 0;
+		pm_path_query_usec = 0;
+		pm_path_query_max_usec = 0;
+		pm_path_query_polygon_count = 0;
+		for (int i = 0; i < PATH_QUERY_LATENCY_BUCKETS; i++) {
+			pm_path_query_latency_histogram[i] = 0;
+		}
 	}
 };
 
@@ -400,6 +400,7 @@ int64_t TextServerAdvanced::_get_features() const {
 void TextServerAdvanced::_free_rid(const RID &p_rid) {
 	_THREAD_SAFE_METHOD_
 	if (font_owner.owns(p_rid)) {
+		_shaping_cache_invalidate(p_rid);
 		MutexLock ftlock(ft_mutex);
 
 		FontAdvanced *fd = font_owner.get_or_null(p_rid);
@@ -409,6 +410,7 @@ void TextServerAdvanced::_free_rid(const RID &p_rid) {
 		}
 		memdelete(fd);
 	} else if (font_var_owner.owns(p_rid)) {
+		_shaping_cache_invalidate(p_rid);
 		MutexLock ftlock(ft_mutex);
 
 		FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(p_rid);
@@ -1951,6 +1953,7 @@ void TextServerAdvanced::_font_set_data(const RID &p_font_rid, const PackedByteA
 	ERR_FAIL_NULL(fd);
 
 	MutexLock lock(fd->mutex);
+	_shaping_cache_invalidate(p_font_rid);
 	_font_clear_cache(fd);
 	fd->data = p_data;
 	fd->data_ptr = fd->data.ptr();
@@ -1962,6 +1965,7 @@ void TextServerAdvanced::_font_set_data_ptr(const RID &p_font_rid, const uint8_t
 	ERR_FAIL_NULL(fd);
 
 	MutexLock lock(fd->mutex);
+	_shaping_cache_invalidate(p_font_rid);
 	_font_clear_cache(fd);
 	fd->data.resize(0);
 	fd->data_ptr = p_data_ptr;
@@ -1978,6 +1982,7 @@ void TextServerAdvanced::_font_set_face_index(const RID &p_font_rid, int64_t p_f
 	MutexLock lock(fd->mutex);
 	if (fd->face_index != p_face_index) {
 		fd->face_index = p_face_index;
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 	}
 }
@@ -2037,6 +2042,7 @@ int64_t TextServerAdvanced::_font_get_face_count(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_style(const RID &p_font_rid, BitField<FontStyle> p_style) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2081,6 +2087,7 @@ String TextServerAdvanced::_font_get_style_name(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_weight(const RID &p_font_rid, int64_t p_weight) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2103,6 +2110,7 @@ int64_t TextServerAdvanced::_font_get_weight(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_stretch(const RID &p_font_rid, int64_t p_stretch) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2125,6 +2133,7 @@ int64_t TextServerAdvanced::_font_get_stretch(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_name(const RID &p_font_rid, const String &p_name) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2266,6 +2275,7 @@ void TextServerAdvanced::_font_set_antialiasing(const RID &p_font_rid, TextServe
 
 	MutexLock lock(fd->mutex);
 	if (fd->antialiasing != p_antialiasing) {
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 		fd->antialiasing = p_antialiasing;
 	}
@@ -2285,6 +2295,7 @@ void TextServerAdvanced::_font_set_disable_embedded_bitmaps(const RID &p_font_ri
 
 	MutexLock lock(fd->mutex);
 	if (fd->disable_embedded_bitmaps != p_disable_embedded_bitmaps) {
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 		fd->disable_embedded_bitmaps = p_disable_embedded_bitmaps;
 	}
@@ -2328,6 +2339,7 @@ void TextServerAdvanced::_font_set_multichannel_signed_distance_field(const RID
 
 	MutexLock lock(fd->mutex);
 	if (fd->msdf != p_msdf) {
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 		fd->msdf = p_msdf;
 	}
@@ -2347,6 +2359,7 @@ void TextServerAdvanced::_font_set_msdf_pixel_range(const RID &p_font_rid, int64
 
 	MutexLock lock(fd->mutex);
 	if (fd->msdf_range != p_msdf_pixel_range) {
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 		fd->msdf_range = p_msdf_pixel_range;
 	}
@@ -2366,6 +2379,7 @@ void TextServerAdvanced::_font_set_msdf_size(const RID &p_font_rid, int64_t p_ms
 
 	MutexLock lock(fd->mutex);
 	if (fd->msdf_source_size != p_msdf_size) {
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 		fd->msdf_source_size = p_msdf_size;
 	}
@@ -2380,6 +2394,7 @@ int64_t TextServerAdvanced::_font_get_msdf_size(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_fixed_size(const RID &p_font_rid, int64_t p_fixed_size) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2396,6 +2411,7 @@ int64_t TextServerAdvanced::_font_get_fixed_size(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_fixed_size_scale_mode(const RID &p_font_rid, TextServer::FixedSizeScaleMode p_fixed_size_scale_mode) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2412,6 +2428,7 @@ TextServer::FixedSizeScaleMode TextServerAdvanced::_font_get_fixed_size_scale_mo
 }
 
 void TextServerAdvanced::_font_set_allow_system_fallback(const RID &p_font_rid, bool p_allow_system_fallback) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2433,6 +2450,7 @@ void TextServerAdvanced::_font_set_force_autohinter(const RID &p_font_rid, bool
 
 	MutexLock lock(fd->mutex);
 	if (fd->force_autohinter != p_force_autohinter) {
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 		fd->force_autohinter = p_force_autohinter;
 	}
@@ -2452,6 +2470,7 @@ void TextServerAdvanced::_font_set_hinting(const RID &p_font_rid, TextServer::Hi
 
 	MutexLock lock(fd->mutex);
 	if (fd->hinting != p_hinting) {
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 		fd->hinting = p_hinting;
 	}
@@ -2466,6 +2485,7 @@ TextServer::Hinting TextServerAdvanced::_font_get_hinting(const RID &p_font_rid)
 }
 
 void TextServerAdvanced::_font_set_subpixel_positioning(const RID &p_font_rid, TextServer::SubpixelPositioning p_subpixel) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2482,6 +2502,7 @@ TextServer::SubpixelPositioning TextServerAdvanced::_font_get_subpixel_positioni
 }
 
 void TextServerAdvanced::_font_set_keep_rounding_remainders(const RID &p_font_rid, bool p_keep_rounding_remainders) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2503,6 +2524,7 @@ void TextServerAdvanced::_font_set_embolden(const RID &p_font_rid, double p_stre
 
 	MutexLock lock(fd->mutex);
 	if (fd->embolden != p_strength) {
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 		fd->embolden = p_strength;
 	}
@@ -2517,6 +2539,7 @@ double TextServerAdvanced::_font_get_embolden(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_spacing(const RID &p_font_rid, SpacingType p_spacing, int64_t p_value) {
+	_shaping_cache_invalidate(p_font_rid);
 	ERR_FAIL_INDEX((int)p_spacing, 4);
 	FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(p_font_rid);
 	if (fdv) {
@@ -2560,6 +2583,7 @@ void TextServerAdvanced::_font_set_baseline_offset(const RID &p_font_rid, double
 
 		MutexLock lock(fd->mutex);
 		if (fd->baseline_offset != p_baseline_offset) {
+			_shaping_cache_invalidate(p_font_rid);
 			_font_clear_cache(fd);
 			fd->baseline_offset = p_baseline_offset;
 		}
@@ -2585,6 +2609,7 @@ void TextServerAdvanced::_font_set_transform(const RID &p_font_rid, const Transf
 
 	MutexLock lock(fd->mutex);
 	if (fd->transform != p_transform) {
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 		fd->transform = p_transform;
 	}
@@ -2604,6 +2629,7 @@ void TextServerAdvanced::_font_set_variation_coordinates(const RID &p_font_rid,
 
 	MutexLock lock(fd->mutex);
 	if (!fd->variation_coordinates.recursive_equal(p_variation_coordinates, 1)) {
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 		fd->variation_coordinates = p_variation_coordinates.duplicate();
 	}
@@ -2623,6 +2649,7 @@ void TextServerAdvanced::_font_set_oversampling(const RID &p_font_rid, double p_
 
 	MutexLock lock(fd->mutex);
 	if (fd->oversampling != p_oversampling) {
+		_shaping_cache_invalidate(p_font_rid);
 		_font_clear_cache(fd);
 		fd->oversampling = p_oversampling;
 	}
@@ -2649,6 +2676,7 @@ TypedArray<Vector2i> TextServerAdvanced::_font_get_size_cache_list(const RID &p_
 }
 
 void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2661,6 +2689,7 @@ void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
 }
 
 void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Vector2i &p_size) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2673,6 +2702,7 @@ void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Ve
 }
 
 void TextServerAdvanced::_font_set_ascent(const RID &p_font_rid, int64_t p_size, double p_ascent) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2708,6 +2738,7 @@ double TextServerAdvanced::_font_get_ascent(const RID &p_font_rid, int64_t p_siz
 }
 
 void TextServerAdvanced::_font_set_descent(const RID &p_font_rid, int64_t p_size, double p_descent) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2742,6 +2773,7 @@ double TextServerAdvanced::_font_get_descent(const RID &p_font_rid, int64_t p_si
 }
 
 void TextServerAdvanced::_font_set_underline_position(const RID &p_font_rid, int64_t p_size, double p_underline_position) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2777,6 +2809,7 @@ double TextServerAdvanced::_font_get_underline_position(const RID &p_font_rid, i
 }
 
 void TextServerAdvanced::_font_set_underline_thickness(const RID &p_font_rid, int64_t p_size, double p_underline_thickness) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2812,6 +2845,7 @@ double TextServerAdvanced::_font_get_underline_thickness(const RID &p_font_rid,
 }
 
 void TextServerAdvanced::_font_set_scale(const RID &p_font_rid, int64_t p_size, double p_scale) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2997,6 +3031,7 @@ PackedInt32Array TextServerAdvanced::_font_get_glyph_list(const RID &p_font_rid,
 }
 
 void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2i &p_size) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3009,6 +3044,7 @@ void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2
 }
 
 void TextServerAdvanced::_font_remove_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3079,6 +3115,7 @@ Vector2 TextServerAdvanced::_font_get_glyph_advance(const RID &p_font_rid, int64
 }
 
 void TextServerAdvanced::_font_set_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph, const Vector2 &p_advance) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3453,6 +3490,7 @@ TypedArray<Vector2i> TextServerAdvanced::_font_get_kerning_list(const RID &p_fon
 }
 
 void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t p_size) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3465,6 +3503,7 @@ void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t
 }
 
 void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3477,6 +3516,7 @@ void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_s
 }
 
 void TextServerAdvanced::_font_set_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair, const Vector2 &p_kerning) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3982,6 +4022,7 @@ bool TextServerAdvanced::_font_is_language_supported(const RID &p_font_rid, cons
 }
 
 void TextServerAdvanced::_font_set_language_support_override(const RID &p_font_rid, const String &p_language, bool p_supported) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3998,6 +4039,7 @@ bool TextServerAdvanced::_font_get_language_support_override(const RID &p_font_r
 }
 
 void TextServerAdvanced::_font_remove_language_support_override(const RID &p_font_rid, const String &p_language) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -4033,6 +4075,7 @@ bool TextServerAdvanced::_font_is_script_supported(const RID &p_font_rid, const
 }
 
 void TextServerAdvanced::_font_set_script_support_override(const RID &p_font_rid, const String &p_script, bool p_supported) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -4049,6 +4092,7 @@ bool TextServerAdvanced::_font_get_script_support_override(const RID &p_font_rid
 }
 
 void TextServerAdvanced::_font_remove_script_support_override(const RID &p_font_rid, const String &p_script) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -4069,6 +4113,7 @@ PackedStringArray TextServerAdvanced::_font_get_script_support_overrides(const R
 }
 
 void TextServerAdvanced::_font_set_opentype_feature_overrides(const RID &p_font_rid, const Dictionary &p_overrides) {
+	_shaping_cache_invalidate(p_font_rid);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -4116,6 +4161,7 @@ double TextServerAdvanced::_font_get_global_oversampling() const {
 void TextServerAdvanced::_font_set_global_oversampling(double p_oversampling) {
 	_THREAD_SAFE_METHOD_
 	if (oversampling != p_oversampling) {
+		_shaping_cache_invalidate();
 		oversampling = p_oversampling;
 		List<RID> fonts;
 		font_owner.get_owned_list(&fonts);
@@ -6121,6 +6167,11 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 		// Try system fallback.
 		RID fdef = p_fonts[0];
 		if (_font_is_allow_system_fallback(fdef)) {
+			if (p_sd->threaded) {
+				// System fonts are created and cached by the server, leave this paragraph to the calling thread.
+				p_sd->fallback_deferred = true;
+				return;
+			}
 			_update_chars(p_sd);
 
 			int64_t next = p_end;
@@ -6439,6 +6490,273 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	}
 }
 
+bool TextServerAdvanced::ShapingCacheKey::operator==(const ShapingCacheKey &p_b) const {
+	if (hash != p_b.hash || direction != p_b.direction || orientation != p_b.orientation || preserve_invalid != p_b.preserve_invalid || preserve_control != p_b.preserve_control) {
+		return false;
+	}
+	for (int i = 0; i < 4; i++) {
+		if (extra_spacing[i] != p_b.extra_spacing[i]) {
+			return false;
+		}
+	}
+	if (text != p_b.text || locale != p_b.locale || spans.size() != p_b.spans.size() || bidi_override.size() != p_b.bidi_override.size()) {
+		return false;
+	}
+	for (int i = 0; i < bidi_override.size(); i++) {
+		if (bidi_override[i] != p_b.bidi_override[i]) {
+			return false;
+		}
+	}
+	for (int i = 0; i < spans.size(); i++) {
+		const ShapingCacheSpan &span_a = spans[i];
+		const ShapingCacheSpan &span_b = p_b.spans[i];
+		if (span_a.start != span_b.start || span_a.end != span_b.end || span_a.font_size != span_b.font_size || span_a.fonts.size() != span_b.fonts.size() || span_a.language != span_b.language || span_a.features != span_b.features) {
+			return false;
+		}
+		for (int j = 0; j < span_a.fonts.size(); j++) {
+			if (span_a.fonts[j] != span_b.fonts[j]) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool TextServerAdvanced::_shaping_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapingCacheKey &r_key) const {
+	// Embedded object positions are written to the buffer during shaping, and substrings are shaped from their parent.
+	if (!p_sd->objects.is_empty() || p_sd->parent != RID() || p_sd->text.length() > SHAPING_CACHE_MAX_COST / 16) {
+		return false;
+	}
+
+	r_key.text = p_sd->text;
+	r_key.bidi_override = p_sd->bidi_override;
+	r_key.direction = p_sd->direction;
+	r_key.orientation = p_sd->orientation;
+	r_key.preserve_invalid = p_sd->preserve_invalid;
+	r_key.preserve_control = p_sd->preserve_control;
+	if (p_sd->direction == DIRECTION_AUTO || p_sd->direction == DIRECTION_INHERITED) {
+		r_key.locale = TranslationServer::get_singleton()->get_tool_locale();
+	}
+
+	uint32_t hash = r_key.text.hash();
+	hash = hash_murmur3_one_32(r_key.locale.hash(), hash);
+	hash = hash_murmur3_one_32(((int)r_key.direction) | ((int)r_key.orientation << 2) | ((int)r_key.preserve_invalid << 3) | ((int)r_key.preserve_control << 4), hash);
+	for (int i = 0; i < 4; i++) {
+		r_key.extra_spacing[i] = p_sd->extra_spacing[i];
+		hash = hash_murmur3_one_32(r_key.extra_spacing[i], hash);
+	}
+	for (const Vector3i &E : r_key.bidi_override) {
+		hash = hash_murmur3_one_32(E.x, hash);
+		hash = hash_murmur3_one_32(E.y, hash);
+		hash = hash_murmur3_one_32(E.z, hash);
+	}
+
+	r_key.spans.resize(p_sd->spans.size());
+	ShapingCacheSpan *spans_w = r_key.spans.ptrw();
+	for (int i = 0; i < p_sd->spans.size(); i++) {
+		const ShapedTextDataAdvanced::Span &span = p_sd->spans[i];
+		ShapingCacheSpan &key_span = spans_w[i];
+		key_span.start = span.start;
+		key_span.end = span.end;
+		key_span.font_size = span.font_size;
+		key_span.language = span.language;
+		key_span.features = span.features.is_empty() ? Dictionary() : span.features.duplicate();
+		hash = hash_murmur3_one_32(key_span.start, hash);
+		hash = hash_murmur3_one_32(key_span.end, hash);
+		hash = hash_murmur3_one_32(key_span.font_size, hash);
+		hash = hash_murmur3_one_32(key_span.language.hash(), hash);
+		hash = hash_murmur3_one_32(key_span.features.hash(), hash);
+		for (int j = 0; j < span.fonts.size(); j++) {
+			RID font_rid = span.fonts[j];
+			key_span.fonts.push_back(font_rid);
+			hash = hash_murmur3_one_64(font_rid.get_id(), hash);
+		}
+	}
+	r_key.hash = hash_fmix32(hash);
+
+	return true;
+}
+
+bool TextServerAdvanced::_shaping_cache_get(const ShapingCacheKey &p_key, ShapedTextDataAdvanced *p_sd, uint64_t &r_version) {
+	MutexLock lock(shaping_cache_mutex);
+	r_version = shaping_cache_version;
+
+	HashMap<ShapingCacheKey, ShapingCacheEntry *, ShapingCacheKeyHasher>::Iterator E = shaping_cache.find(p_key);
+	if (!E) {
+		return false;
+	}
+
+	// Move to the front of the list.
+	ShapingCacheEntry *entry = E->value;
+	if (entry != shaping_cache_first) {
+		entry->prev->next = entry->next;
+		if (entry->next) {
+			entry->next->prev = entry->prev;
+		} else {
+			shaping_cache_last = entry->prev;
+		}
+		entry->prev = nullptr;
+		entry->next = shaping_cache_first;
+		shaping_cache_first->prev = entry;
+		shaping_cache_first = entry;
+	}
+
+	p_sd->glyphs = entry->glyphs;
+	p_sd->ascent = entry->ascent;
+	p_sd->descent = entry->descent;
+	p_sd->width = entry->width;
+	p_sd->upos = entry->upos;
+	p_sd->uthk = entry->uthk;
+	return true;
+}
+
+void TextServerAdvanced::_shaping_cache_insert(const ShapingCacheKey &p_key, uint64_t p_version, const ShapedTextDataAdvanced *p_sd) {
+	int64_t cost = p_key.text.length() + p_sd->glyphs.size();
+	if (cost > SHAPING_CACHE_MAX_COST / 8) {
+		return;
+	}
+
+	MutexLock lock(shaping_cache_mutex);
+	if (p_version != shaping_cache_version || shaping_cache.has(p_key)) {
+		// Fonts were changed while shaping, or the same paragraph was shaped on another thread.
+		return;
+	}
+
+	ShapingCacheEntry *entry = memnew(ShapingCacheEntry);
+	entry->key = p_key;
+	entry->glyphs = p_sd->glyphs;
+	entry->ascent = p_sd->ascent;
+	entry->descent = p_sd->descent;
+	entry->width = p_sd->width;
+	entry->upos = p_sd->upos;
+	entry->uthk = p_sd->uthk;
+	entry->cost = cost;
+
+	entry->next = shaping_cache_first;
+	if (shaping_cache_first) {
+		shaping_cache_first->prev = entry;
+	} else {
+		shaping_cache_last = entry;
+	}
+	shaping_cache_first = entry;
+	shaping_cache.insert(p_key, entry);
+	shaping_cache_cost += cost;
+
+	// Evict least recently used paragraphs.
+	while (shaping_cache_cost > SHAPING_CACHE_MAX_COST && shaping_cache_last != entry) {
+		ShapingCacheEntry *last = shaping_cache_last;
+		shaping_cache_last = last->prev;
+		shaping_cache_last->next = nullptr;
+		shaping_cache_cost -= last->cost;
+		shaping_cache.erase(last->key);
+		memdelete(last);
+	}
+}
+
+void TextServerAdvanced::_shaping_cache_invalidate() {
+	MutexLock lock(shaping_cache_mutex);
+	ShapingCacheEntry *entry = shaping_cache_first;
+	while (entry) {
+		ShapingCacheEntry *next = entry->next;
+		memdelete(entry);
+		entry = next;
+	}
+	shaping_cache.clear();
+	shaping_cache_first = nullptr;
+	shaping_cache_last = nullptr;
+	shaping_cache_cost = 0;
+	shaping_cache_version++;
+}
+
+void TextServerAdvanced::_shaping_cache_invalidate(const RID &p_font_rid) {
+	// Linked variations share the data of their base font, so changing any of them affects all.
+	const RID base_font = _get_font_base_rid(p_font_rid);
+
+	MutexLock lock(shaping_cache_mutex);
+	ShapingCacheEntry *entry = shaping_cache_first;
+	while (entry) {
+		ShapingCacheEntry *next = entry->next;
+
+		bool uses_font = false;
+		for (int i = 0; i < entry->key.spans.size() && !uses_font; i++) {
+			for (const RID &font : entry->key.spans[i].fonts) {
+				if (_get_font_base_rid(font) == base_font) {
+					uses_font = true;
+					break;
+				}
+			}
+		}
+		// System fallback fonts are only found in the glyphs.
+		const Glyph *glyphs = entry->glyphs.ptr();
+		for (int i = 0; i < entry->glyphs.size() && !uses_font; i++) {
+			uses_font = glyphs[i].font_rid.is_valid() && _get_font_base_rid(glyphs[i].font_rid) == base_font;
+		}
+
+		if (uses_font) {
+			if (entry->prev) {
+				entry->prev->next = entry->next;
+			} else {
+				shaping_cache_first = entry->next;
+			}
+			if (entry->next) {
+				entry->next->prev = entry->prev;
+			} else {
+				shaping_cache_last = entry->prev;
+			}
+			shaping_cache_cost -= entry->cost;
+			shaping_cache.erase(entry->key);
+			memdelete(entry);
+		}
+		entry = next;
+	}
+	// Paragraphs shaped while the font was changed are not inserted.
+	shaping_cache_version++;
+}
+
+void TextServerAdvanced::_shape_paragraph_threaded(void *p_td, uint32_t p_index) {
+	ShapeThreadData *td = static_cast<ShapeThreadData *>(p_td);
+	ShapedTextDataAdvanced *sd = td->paragraphs[p_index];
+
+	MutexLock lock(sd->mutex);
+	if (sd->valid.is_set()) {
+		return;
+	}
+
+	td->server->invalidate(sd, false);
+	sd->threaded = true;
+	td->server->_shape_paragraph(sd);
+	sd->threaded = false;
+}
+
+bool TextServerAdvanced::_shaped_text_shape_batch(const TypedArray<RID> &p_shaped) {
+	_THREAD_SAFE_METHOD_
+	// Creating or freeing buffers and fonts is blocked while the batch is shaped, so the owners are not modified by other threads.
+	Vector<ShapedTextDataAdvanced *> paragraphs;
+	for (int i = 0; i < p_shaped.size(); i++) {
+		ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped[i]);
+		ERR_CONTINUE(!sd);
+		if (sd->parent == RID() && !sd->valid.is_set()) {
+			paragraphs.push_back(sd);
+		}
+	}
+
+	if (paragraphs.size() > 1) {
+		ShapeThreadData td;
+		td.server = this;
+		td.paragraphs = paragraphs.ptrw();
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&TextServerAdvanced::_shape_paragraph_threaded, &td, paragraphs.size(), -1, true, String("TextServerShapeParagraphs"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Substrings, paragraphs that need a system font fallback, and single paragraphs are shaped on the calling thread.
+	bool ok = true;
+	for (int i = 0; i < p_shaped.size(); i++) {
+		ok = _shaped_text_shape(p_shaped[i]) && ok;
+	}
+	return ok;
+}
+
 bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 	_THREAD_SAFE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
@@ -6458,58 +6776,69 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		return true;
 	}
 
-	if (sd->text.length() == 0) {
-		sd->valid.set();
+	return _shape_paragraph(sd);
+}
+
+bool TextServerAdvanced::_shape_paragraph(ShapedTextDataAdvanced *p_sd) {
+	if (p_sd->text.length() == 0) {
+		p_sd->valid.set();
 		return true;
 	}
 
-	sd->utf16 = sd->text.utf16();
-	const UChar *data = sd->utf16.get_data();
+	// Identical paragraphs are shaped once, the BiDi iterators are still rebuilt since they are owned by the buffer.
+	ShapingCacheKey cache_key;
+	uint64_t cache_version = 0;
+	bool cacheable = _shaping_cache_make_key(p_sd, cache_key);
+	bool cached = cacheable && _shaping_cache_get(cache_key, p_sd, cache_version);
+	p_sd->fallback_deferred = false;
+
+	p_sd->utf16 = p_sd->text.utf16();
+	const UChar *data = p_sd->utf16.get_data();
 
 	// Create script iterator.
-	if (sd->script_iter == nullptr) {
-		sd->script_iter = memnew(ScriptIterator(sd->text, 0, sd->text.length()));
+	if (p_sd->script_iter == nullptr) {
+		p_sd->script_iter = memnew(ScriptIterator(p_sd->text, 0, p_sd->text.length()));
 	}
 
-	sd->base_para_direction = UBIDI_DEFAULT_LTR;
-	switch (sd->direction) {
+	p_sd->base_para_direction = UBIDI_DEFAULT_LTR;
+	switch (p_sd->direction) {
 		case DIRECTION_LTR: {
-			sd->para_direction = DIRECTION_LTR;
-			sd->base_para_direction = UBIDI_LTR;
+			p_sd->para_direction = DIRECTION_LTR;
+			p_sd->base_para_direction = UBIDI_LTR;
 		} break;
 		case DIRECTION_RTL: {
-			sd->para_direction = DIRECTION_RTL;
-			sd->base_para_direction = UBIDI_RTL;
+			p_sd->para_direction = DIRECTION_RTL;
+			p_sd->base_para_direction = UBIDI_RTL;
 		} break;
 		case DIRECTION_INHERITED:
 		case DIRECTION_AUTO: {
-			UBiDiDirection direction = ubidi_getBaseDirection(data, sd->utf16.length());
+			UBiDiDirection direction = ubidi_getBaseDirection(data, p_sd->utf16.length());
 			if (direction != UBIDI_NEUTRAL) {
-				sd->para_direction = (direction == UBIDI_RTL) ? DIRECTION_RTL : DIRECTION_LTR;
-				sd->base_para_direction = direction;
+				p_sd->para_direction = (direction == UBIDI_RTL) ? DIRECTION_RTL : DIRECTION_LTR;
+				p_sd->base_para_direction = direction;
 			} else {
-				const String &lang = (sd->spans.is_empty() || sd->spans[0].language.is_empty()) ? TranslationServer::get_singleton()->get_tool_locale() : sd->spans[0].language;
+				const String &lang = (p_sd->spans.is_empty() || p_sd->spans[0].language.is_empty()) ? TranslationServer::get_singleton()->get_tool_locale() : p_sd->spans[0].language;
 				bool lang_rtl = _is_locale_right_to_left(lang);
 
-				sd->para_direction = lang_rtl ? DIRECTION_RTL : DIRECTION_LTR;
-				sd->base_para_direction = lang_rtl ? UBIDI_DEFAULT_RTL : UBIDI_DEFAULT_LTR;
+				p_sd->para_direction = lang_rtl ? DIRECTION_RTL : DIRECTION_LTR;
+				p_sd->base_para_direction = lang_rtl ? UBIDI_DEFAULT_RTL : UBIDI_DEFAULT_LTR;
 			}
 		} break;
 	}
 
 	Vector<Vector3i> bidi_ranges;
-	if (sd->bidi_override.is_empty()) {
-		bidi_ranges.push_back(Vector3i(sd->start, sd->end, DIRECTION_INHERITED));
+	if (p_sd->bidi_override.is_empty()) {
+		bidi_ranges.push_back(Vector3i(p_sd->start, p_sd->end, DIRECTION_INHERITED));
 	} else {
-		bidi_ranges = sd->bidi_override;
+		bidi_ranges = p_sd->bidi_override;
 	}
 
 	for (int ov = 0; ov < bidi_ranges.size(); ov++) {
 		// Create BiDi iterator.
-		int start = _convert_pos_inv(sd, bidi_ranges[ov].x - sd->start);
-		int end = _convert_pos_inv(sd, bidi_ranges[ov].y - sd->start);
+		int start = _convert_pos_inv(p_sd, bidi_ranges[ov].x - p_sd->start);
+		int end = _convert_pos_inv(p_sd, bidi_ranges[ov].y - p_sd->start);
 
-		if (start < 0 || end - start > sd->utf16.length()) {
+		if (start < 0 || end - start > p_sd->utf16.length()) {
 			continue;
 		}
 
@@ -6524,14 +6853,14 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 					ubidi_setPara(bidi_iter, data + start, end - start, UBIDI_RTL, nullptr, &err);
 				} break;
 				case DIRECTION_INHERITED: {
-					ubidi_setPara(bidi_iter, data + start, end - start, sd->base_para_direction, nullptr, &err);
+					ubidi_setPara(bidi_iter, data + start, end - start, p_sd->base_para_direction, nullptr, &err);
 				} break;
 				case DIRECTION_AUTO: {
 					UBiDiDirection direction = ubidi_getBaseDirection(data + start, end - start);
 					if (direction != UBIDI_NEUTRAL) {
 						ubidi_setPara(bidi_iter, data + start, end - start, direction, nullptr, &err);
 					} else {
-						ubidi_setPara(bidi_iter, data + start, end - start, sd->base_para_direction, nullptr, &err);
+						ubidi_setPara(bidi_iter, data + start, end - start, p_sd->base_para_direction, nullptr, &err);
 					}
 				} break;
 			}
@@ -6544,7 +6873,10 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 			bidi_iter = nullptr;
 			ERR_PRINT(vformat("BiDi iterator allocation for the paragraph failed: %s", u_errorName(err)));
 		}
-		sd->bidi_iter.push_back(bidi_iter);
+		p_sd->bidi_iter.push_back(bidi_iter);
+		if (cached) {
+			continue;
+		}
 
 		err = U_ZERO_ERROR;
 		int bidi_run_count = 1;
@@ -6562,7 +6894,7 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 			if (bidi_iter) {
 				is_ltr = (ubidi_getVisualRun(bidi_iter, i, &_bidi_run_start, &_bidi_run_length) == UBIDI_LTR);
 			}
-			switch (sd->orientation) {
+			switch (p_sd->orientation) {
 				case ORIENTATION_HORIZONTAL: {
 					if (is_ltr) {
 						bidi_run_direction = HB_DIRECTION_LTR;
@@ -6579,40 +6911,40 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 				}
 			}
 
-			int32_t bidi_run_start = _convert_pos(sd, start + _bidi_run_start);
-			int32_t bidi_run_end = _convert_pos(sd, start + _bidi_run_start + _bidi_run_length);
+			int32_t bidi_run_start = _convert_pos(p_sd, start + _bidi_run_start);
+			int32_t bidi_run_end = _convert_pos(p_sd, start + _bidi_run_start + _bidi_run_length);
 
 			// Shape runs.
 
-			int scr_from = (is_ltr) ? 0 : sd->script_iter->script_ranges.size() - 1;
-			int scr_to = (is_ltr) ? sd->script_iter->script_ranges.size() : -1;
+			int scr_from = (is_ltr) ? 0 : p_sd->script_iter->script_ranges.size() - 1;
+			int scr_to = (is_ltr) ? p_sd->script_iter->script_ranges.size() : -1;
 			int scr_delta = (is_ltr) ? +1 : -1;
 
 			for (int j = scr_from; j != scr_to; j += scr_delta) {
-				if ((sd->script_iter->script_ranges[j].start < bidi_run_end) && (sd->script_iter->script_ranges[j].end > bidi_run_start)) {
-					int32_t script_run_start = MAX(sd->script_iter->script_ranges[j].start, bidi_run_start);
-					int32_t script_run_end = MIN(sd->script_iter->script_ranges[j].end, bidi_run_end);
+				if ((p_sd->script_iter->script_ranges[j].start < bidi_run_end) && (p_sd->script_iter->script_ranges[j].end > bidi_run_start)) {
+					int32_t script_run_start = MAX(p_sd->script_iter->script_ranges[j].start, bidi_run_start);
+					int32_t script_run_end = MIN(p_sd->script_iter->script_ranges[j].end, bidi_run_end);
 					char scr_buffer[5] = { 0, 0, 0, 0, 0 };
-					hb_tag_to_string(hb_script_to_iso15924_tag(sd->script_iter->script_ranges[j].script), scr_buffer);
+					hb_tag_to_string(hb_script_to_iso15924_tag(p_sd->script_iter->script_ranges[j].script), scr_buffer);
 					String script_code = String(scr_buffer);
 
-					int spn_from = (is_ltr) ? 0 : sd->spans.size() - 1;
-					int spn_to = (is_ltr) ? sd->spans.size() : -1;
+					int spn_from = (is_ltr) ? 0 : p_sd->spans.size() - 1;
+					int spn_to = (is_ltr) ? p_sd->spans.size() : -1;
 					int spn_delta = (is_ltr) ? +1 : -1;
 
 					for (int k = spn_from; k != spn_to; k += spn_delta) {
-						const ShapedTextDataAdvanced::Span &span = sd->spans[k];
-						if (span.start - sd->start >= script_run_end || span.end - sd->start <= script_run_start) {
+						const ShapedTextDataAdvanced::Span &span = p_sd->spans[k];
+						if (span.start - p_sd->start >= script_run_end || span.end - p_sd->start <= script_run_start) {
 							continue;
 						}
 						if (span.embedded_key != Variant()) {
 							// Embedded object.
-							if (sd->orientation == ORIENTATION_HORIZONTAL) {
-								sd->objects[span.embedded_key].rect.position.x = sd->width;
-								sd->width += sd->objects[span.embedded_key].rect.size.x;
+							if (p_sd->orientation == ORIENTATION_HORIZONTAL) {
+								p_sd->objects[span.embedded_key].rect.position.x = p_sd->width;
+								p_sd->width += p_sd->objects[span.embedded_key].rect.size.x;
 							} else {
-								sd->objects[span.embedded_key].rect.position.y = sd->width;
-								sd->width += sd->objects[span.embedded_key].rect.size.y;
+								p_sd->objects[span.embedded_key].rect.position.y = p_sd->width;
+								p_sd->width += p_sd->objects[span.embedded_key].rect.size.y;
 							}
 							Glyph gl;
 							gl.start = span.start;
@@ -6620,34 +6952,34 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 							gl.count = 1;
 							gl.span_index = k;
 							gl.flags = GRAPHEME_IS_VALID | GRAPHEME_IS_EMBEDDED_OBJECT;
-							if (sd->orientation == ORIENTATION_HORIZONTAL) {
-								gl.advance = sd->objects[span.embedded_key].rect.size.x;
+							if (p_sd->orientation == ORIENTATION_HORIZONTAL) {
+								gl.advance = p_sd->objects[span.embedded_key].rect.size.x;
 							} else {
-								gl.advance = sd->objects[span.embedded_key].rect.size.y;
+								gl.advance = p_sd->objects[span.embedded_key].rect.size.y;
 							}
-							sd->glyphs.push_back(gl);
+							p_sd->glyphs.push_back(gl);
 						} else {
 							Array fonts;
 							Array fonts_scr_only;
 							Array fonts_no_match;
 							int font_count = span.fonts.size();
 							if (font_count > 0) {
-								fonts.push_back(sd->spans[k].fonts[0]);
+								fonts.push_back(p_sd->spans[k].fonts[0]);
 							}
 							for (int l = 1; l < font_count; l++) {
 								if (_font_is_script_supported(span.fonts[l], script_code)) {
 									if (_font_is_language_supported(span.fonts[l], span.language)) {
-										fonts.push_back(sd->spans[k].fonts[l]);
+										fonts.push_back(p_sd->spans[k].fonts[l]);
 									} else {
-										fonts_scr_only.push_back(sd->spans[k].fonts[l]);
+										fonts_scr_only.push_back(p_sd->spans[k].fonts[l]);
 									}
 								} else {
-									fonts_no_match.push_back(sd->spans[k].fonts[l]);
+									fonts_no_match.push_back(p_sd->spans[k].fonts[l]);
 								}
 							}
 							fonts.append_array(fonts_scr_only);
 							fonts.append_array(fonts_no_match);
-							_shape_run(sd, MAX(sd->spans[k].start - sd->start, script_run_start), MIN(sd->spans[k].end - sd->start, script_run_end), sd->script_iter->script_ranges[j].script, bidi_run_direction, fonts, k, 0, 0, 0, RID());
+							_shape_run(p_sd, MAX(p_sd->spans[k].start - p_sd->start, script_run_start), MIN(p_sd->spans[k].end - p_sd->start, script_run_end), p_sd->script_iter->script_ranges[j].script, bidi_run_direction, fonts, k, 0, 0, 0, RID());
 						}
 					}
 				}
@@ -6655,9 +6987,17 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		}
 	}
 
-	_realign(sd);
-	sd->valid.set();
-	return sd->valid.is_set();
+	if (p_sd->fallback_deferred) {
+		return false;
+	}
+	if (!cached) {
+		_realign(p_sd);
+		if (cacheable) {
+			_shaping_cache_insert(cache_key, cache_version, p_sd);
+		}
+	}
+	p_sd->valid.set();
+	return p_sd->valid.is_set();
 }
 
 bool TextServerAdvanced::_shaped_text_is_ready(const RID &p_shaped) const {
@@ -7646,6 +7986,7 @@ TextServerAdvanced::TextServerAdvanced() {
 
 void TextServerAdvanced::_cleanup() {
 	_THREAD_SAFE_METHOD_
+	_shaping_cache_invalidate();
 	for (const KeyValue<SystemFontKey, SystemFontCache> &E : system_fonts) {
 		const Vector<SystemFontCacheRec> &sysf_cache = E.value.var;
 		for (const SystemFontCacheRec &F : sysf_cache) {
@@ -7657,6 +7998,7 @@ void TextServerAdvanced::_cleanup() {
 }
 
 TextServerAdvanced::~TextServerAdvanced() {
+	_shaping_cache_invalidate();
 	_bmp_free_font_funcs();
 #ifdef MODULE_FREETYPE_ENABLED
 	if (ft_library != nullptr) {
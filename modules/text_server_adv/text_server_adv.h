@@ -543,6 +543,8 @@ class TextServerAdvanced : public TextServerExtension {
 		bool break_ops_valid = false;
 		bool js_ops_valid = false;
 		bool chars_valid = false;
+		bool threaded = false; // Shaped on a worker thread, system font fallback is left to the calling thread.
+		bool fallback_deferred = false;
 
 		~ShapedTextDataAdvanced() {
 			for (int i = 0; i < bidi_iter.size(); i++) {
@@ -575,6 +577,11 @@ class TextServerAdvanced : public TextServerExtension {
 		return font_owner.get_or_null(rid);
 	}
 
+	_FORCE_INLINE_ RID _get_font_base_rid(const RID &p_font_rid) const {
+		FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(p_font_rid);
+		return fdv ? fdv->base_font : p_font_rid;
+	}
+
 	struct SystemFontKey {
 		String font_name;
 		TextServer::FontAntialiasing antialiasing = TextServer::FONT_ANTIALIASING_GRAY;
@@ -666,6 +673,73 @@ class TextServerAdvanced : public TextServerExtension {
 	mutable HashMap<SystemFontKey, SystemFontCache, SystemFontKeyHasher> system_fonts;
 	mutable HashMap<String, PackedByteArray> system_font_data;
 
+	// Shaping cache, shared by all shaped text buffers.
+
+	struct ShapingCacheSpan {
+		int start = -1;
+		int end = -1;
+		Vector<RID> fonts;
+		int font_size = 0;
+		String language;
+		Dictionary features;
+	};
+
+	struct ShapingCacheKey {
+		String text;
+		Vector<ShapingCacheSpan> spans;
+		Vector<Vector3i> bidi_override;
+		String locale; // Only set for the auto direction, it is used for strings without strong directional characters.
+		TextServer::Direction direction = DIRECTION_AUTO;
+		TextServer::Orientation orientation = ORIENTATION_HORIZONTAL;
+		bool preserve_invalid = true;
+		bool preserve_control = false;
+		int extra_spacing[4] = { 0, 0, 0, 0 };
+		uint32_t hash = 0;
+
+		bool operator==(const ShapingCacheKey &p_b) const;
+	};
+
+	struct ShapingCacheKeyHasher {
+		_FORCE_INLINE_ static uint32_t hash(const ShapingCacheKey &p_a) { return p_a.hash; }
+	};
+
+	struct ShapingCacheEntry {
+		ShapingCacheKey key;
+		Vector<Glyph> glyphs;
+		double ascent = 0.0;
+		double descent = 0.0;
+		double width = 0.0;
+		double upos = 0.0;
+		double uthk = 0.0;
+		int64_t cost = 0;
+
+		ShapingCacheEntry *prev = nullptr; // More recently used.
+		ShapingCacheEntry *next = nullptr; // Less recently used.
+	};
+
+	static constexpr int64_t SHAPING_CACHE_MAX_COST = 262144; // Total number of characters and glyphs kept in the cache.
+
+	Mutex shaping_cache_mutex;
+	HashMap<ShapingCacheKey, ShapingCacheEntry *, ShapingCacheKeyHasher> shaping_cache;
+	ShapingCacheEntry *shaping_cache_first = nullptr;
+	ShapingCacheEntry *shaping_cache_last = nullptr;
+	int64_t shaping_cache_cost = 0;
+	uint64_t shaping_cache_version = 0;
+
+	bool _shaping_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapingCacheKey &r_key) const;
+	bool _shaping_cache_get(const ShapingCacheKey &p_key, ShapedTextDataAdvanced *p_sd, uint64_t &r_version);
+	void _shaping_cache_insert(const ShapingCacheKey &p_key, uint64_t p_version, const ShapedTextDataAdvanced *p_sd);
+	void _shaping_cache_invalidate();
+	void _shaping_cache_invalidate(const RID &p_font_rid);
+
+	struct ShapeThreadData {
+		TextServerAdvanced *server = nullptr;
+		ShapedTextDataAdvanced **paragraphs = nullptr;
+	};
+
+	bool _shape_paragraph(ShapedTextDataAdvanced *p_sd);
+	static void _shape_paragraph_threaded(void *p_td, uint32_t p_index);
+
 	void _update_chars(ShapedTextDataAdvanced *p_sd) const;
 	void _realign(ShapedTextDataAdvanced *p_sd) const;
 	int64_t _convert_pos(const String &p_utf32, const Char16String &p_utf16, int64_t p_pos) const;
@@ -969,6 +1043,7 @@ public:
 	MODBIND2R(double, shaped_text_tab_align, const RID &, const PackedFloat32Array &);
 
 	MODBIND1R(bool, shaped_text_shape, const RID &);
+	MODBIND1R(bool, shaped_text_shape_batch, const TypedArray<RID> &);
 	MODBIND1R(bool, shaped_text_update_breaks, const RID &);
 	MODBIND1R(bool, shaped_text_update_justification_ops, const RID &);
 
@@ -142,24 +142,64 @@ struct _RigidBody2DInOut {
 	int local_shape = 0;
 };
 
-void RigidBody2D::_sync_body_state(PhysicsDirectBodyState2D *p_state) {
+void RigidBody2D::_apply_body_state(const PhysicsServer2D::BodyStateSync &p_state) {
 	if (!freeze || freeze_mode != FREEZE_MODE_KINEMATIC) {
 		set_block_transform_notify(true);
-		set_global_transform(p_state->get_transform());
+		set_global_transform(p_state.transform);
 		set_block_transform_notify(false);
 	}
 
-	linear_velocity = p_state->get_linear_velocity();
-	angular_velocity = p_state->get_angular_velocity();
+	linear_velocity = p_state.linear_velocity;
+	angular_velocity = p_state.angular_velocity;
 
-	contact_count = p_state->get_contact_count();
+	contact_count = p_state.contact_count;
 
-	if (sleeping != p_state->is_sleeping()) {
-		sleeping = p_state->is_sleeping();
+	if (sleeping != p_state.sleeping) {
+		sleeping = p_state.sleeping;
 		emit_signal(SceneStringName(sleeping_state_changed));
 	}
 }
 
+void RigidBody2D::_sync_body_state(PhysicsDirectBodyState2D *p_state) {
+	PhysicsServer2D::BodyStateSync state;
+	state.transform = p_state->get_transform();
+	state.linear_velocity = p_state->get_linear_velocity();
+	state.angular_velocity = p_state->get_angular_velocity();
+	state.contact_count = p_state->get_contact_count();
+	state.sleeping = p_state->is_sleeping();
+	_apply_body_state(state);
+}
+
+void RigidBody2D::_sync_body_state_bulk(const PhysicsServer2D::BodyStateSync &p_state) {
+	lock_callback();
+	_apply_body_state(p_state);
+	unlock_callback();
+}
+
+void RigidBody2D::_body_state_sync_bulk(const PhysicsServer2D::BodyStateSync *p_states, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		RigidBody2D *body = Object::cast_to<RigidBody2D>(ObjectDB::get_instance(p_states[i].instance_id));
+		if (body && body->state_sync_bulk) {
+			body->_sync_body_state_bulk(p_states[i]);
+		}
+	}
+}
+
+bool RigidBody2D::_can_sync_state_in_bulk() const {
+	// The bulk path carries neither contacts nor a direct body state.
+	return !contact_monitor && !GDVIRTUAL_IS_OVERRIDDEN(_integrate_forces);
+}
+
+void RigidBody2D::_update_state_sync_bulk() {
+	bool enable = _can_sync_state_in_bulk();
+	if (enable == state_sync_bulk) {
+		return;
+	}
+
+	state_sync_bulk = enable;
+	PhysicsServer2D::get_singleton()->body_set_state_sync_bulk(get_rid(), state_sync_bulk);
+}
+
 void RigidBody2D::_body_state_changed(PhysicsDirectBodyState2D *p_state) {
 	lock_callback();
 
@@ -615,6 +655,8 @@ void RigidBody2D::set_contact_monitor(bool p_enabled) {
 		contact_monitor->locked = false;
 	}
 
+	_update_state_sync_bulk();
+
 	notify_property_list_changed();
 }
 
@@ -623,19 +665,23 @@ bool RigidBody2D::is_contact_monitor_enabled() const {
 }
 
 void RigidBody2D::_notification(int p_what) {
-#ifdef TOOLS_ENABLED
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
+			_update_state_sync_bulk();
+
+#ifdef TOOLS_ENABLED
 			if (Engine::get_singleton()->is_editor_hint()) {
 				set_notify_local_transform(true); // Used for warnings and only in editor.
 			}
+#endif
 		} break;
 
+#ifdef TOOLS_ENABLED
 		case NOTIFICATION_LOCAL_TRANSFORM_CHANGED: {
 			update_configuration_warnings();
 		} break;
-	}
 #endif
+	}
 }
 
 PackedStringArray RigidBody2D::get_configuration_warnings() const {
@@ -801,6 +847,8 @@ void RigidBody2D::_validate_property(PropertyInfo &p_property) const {
 RigidBody2D::RigidBody2D() :
 		PhysicsBody2D(PhysicsServer2D::BODY_MODE_RIGID) {
 	PhysicsServer2D::get_singleton()->body_set_state_sync_callback(get_rid(), callable_mp(this, &RigidBody2D::_body_state_changed));
+	// A script overriding _integrate_forces() needs the direct body state.
+	connect(CoreStringName(script_changed), callable_mp(this, &RigidBody2D::_update_state_sync_bulk));
 }
 
 RigidBody2D::~RigidBody2D() {
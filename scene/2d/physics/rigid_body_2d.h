@@ -87,6 +87,7 @@ private:
 	int contact_count = 0;
 
 	bool custom_integrator = false;
+	bool state_sync_bulk = false;
 
 	CCDMode ccd_mode = CCD_MODE_DISABLED;
 
@@ -134,7 +135,11 @@ private:
 	static void _body_state_changed_callback(void *p_instance, PhysicsDirectBodyState2D *p_state);
 	void _body_state_changed(PhysicsDirectBodyState2D *p_state);
 
+	void _apply_body_state(const PhysicsServer2D::BodyStateSync &p_state);
 	void _sync_body_state(PhysicsDirectBodyState2D *p_state);
+	void _sync_body_state_bulk(const PhysicsServer2D::BodyStateSync &p_state);
+	bool _can_sync_state_in_bulk() const;
+	void _update_state_sync_bulk();
 
 protected:
 	void _notification(int p_what);
@@ -147,6 +152,8 @@ protected:
 	void _apply_body_mode();
 
 public:
+	static void _body_state_sync_bulk(const PhysicsServer2D::BodyStateSync *p_states, uint32_t p_count);
+
 	void set_lock_rotation_enabled(bool p_lock_rotation);
 	bool is_lock_rotation_enabled() const;
 
@@ -0,0 +1,611 @@
+/**************************************************************************/
+/*  sprite_batch_2d.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "sprite_batch_2d.h"
+
+#include "scene/scene_string_names.h"
+
+Mutex SpriteBatch2D::shader_mutex;
+int SpriteBatch2D::shader_users = 0;
+RID SpriteBatch2D::shader;
+RID SpriteBatch2D::material;
+RID SpriteBatch2D::mesh;
+
+void SpriteBatch2D::_add_shader_user() {
+	MutexLock shader_lock(shader_mutex);
+	if (shader_users++ > 0) {
+		return;
+	}
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	// Each instance draws a unit quad, scaled to its frame size by the instance transform.
+	// The instance custom data holds the texture region in UV space.
+	shader = rs->shader_create();
+	rs->shader_set_code(shader, R"(
+shader_type canvas_item;
+
+void vertex() {
+	UV = INSTANCE_CUSTOM.xy + UV * INSTANCE_CUSTOM.zw;
+}
+)");
+
+	material = rs->material_create();
+	rs->material_set_shader(material, shader);
+
+	PackedVector2Array quad;
+	quad.push_back(Vector2(0, 0));
+	quad.push_back(Vector2(1, 0));
+	quad.push_back(Vector2(1, 1));
+	quad.push_back(Vector2(0, 1));
+
+	PackedInt32Array indices;
+	indices.push_back(0);
+	indices.push_back(1);
+	indices.push_back(2);
+	indices.push_back(0);
+	indices.push_back(2);
+	indices.push_back(3);
+
+	Array arrays;
+	arrays.resize(RS::ARRAY_MAX);
+	arrays[RS::ARRAY_VERTEX] = quad;
+	arrays[RS::ARRAY_TEX_UV] = quad;
+	arrays[RS::ARRAY_INDEX] = indices;
+
+	mesh = rs->mesh_create();
+	rs->mesh_add_surface_from_arrays(mesh, RS::PRIMITIVE_TRIANGLES, arrays, Array(), Dictionary(), RS::ARRAY_FLAG_USE_2D_VERTICES);
+}
+
+void SpriteBatch2D::_remove_shader_user() {
+	MutexLock shader_lock(shader_mutex);
+	if (--shader_users > 0) {
+		return;
+	}
+
+	RS::get_singleton()->free(mesh);
+	RS::get_singleton()->free(material);
+	RS::get_singleton()->free(shader);
+	mesh = RID();
+	material = RID();
+	shader = RID();
+}
+
+void SpriteBatch2D::_instances_changed() {
+	instances_dirty = true;
+	queue_redraw();
+}
+
+void SpriteBatch2D::_update_instances() {
+	instances_dirty = false;
+
+	const int instance_count = texture.is_valid() ? positions.size() : 0;
+	if (instance_count != multimesh_instance_count) {
+		RS::get_singleton()->multimesh_allocate_data(multimesh, instance_count, RS::MULTIMESH_TRANSFORM_2D, true, true);
+		multimesh_instance_count = instance_count;
+	}
+
+	bounds = Rect2();
+	if (instance_count == 0) {
+		return;
+	}
+
+	// Instances are drawn in increasing z offset. Equal offsets keep the array order.
+	draw_order.resize(instance_count);
+	for (int i = 0; i < instance_count; i++) {
+		draw_order[i] = i;
+	}
+	if (!z_offsets.is_empty()) {
+		struct ZOffsetSort {
+			const int32_t *z_offsets = nullptr;
+			int z_offset_count = 0;
+
+			_FORCE_INLINE_ int32_t get_z(uint32_t p_index) const {
+				return (int)p_index < z_offset_count ? z_offsets[p_index] : 0;
+			}
+			_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+				int32_t a = get_z(p_a);
+				int32_t b = get_z(p_b);
+				return a < b || (a == b && p_a < p_b);
+			}
+		};
+
+		SortArray<uint32_t, ZOffsetSort> sorter;
+		sorter.compare.z_offsets = z_offsets.ptr();
+		sorter.compare.z_offset_count = z_offsets.size();
+		sorter.sort(draw_order.ptr(), instance_count);
+	}
+
+	const Size2 texture_size = texture->get_size();
+	const Rect2 sheet_rect = region_enabled ? region_rect : Rect2(Point2(), texture_size);
+	const Size2 frame_size = sheet_rect.size / Size2(hframes, vframes);
+	const int frame_count = hframes * vframes;
+
+	const Vector2 *positions_ptr = positions.ptr();
+	const float *rotations_ptr = rotations.ptr();
+	const Vector2 *scales_ptr = scales.ptr();
+	const int32_t *frames_ptr = frames.ptr();
+	const Vector4 *regions_ptr = regions.ptr();
+	const Color *modulates_ptr = modulates.ptr();
+
+	// Transform (8 floats), color (4 floats) and custom data (4 floats).
+	constexpr int stride = 16;
+	buffer.resize(instance_count * stride);
+	float *w = buffer.ptrw();
+
+	for (int i = 0; i < instance_count; i++) {
+		const uint32_t index = draw_order[i];
+
+		// Source region in pixels. As with Rect2, a negative size extends the region back from its
+		// position, and as with draw_texture_rect_region(), it mirrors the region.
+		Rect2 src_rect;
+		if ((int)index < regions.size() && regions_ptr[index].z != 0 && regions_ptr[index].w != 0) {
+			const Vector4 &region = regions_ptr[index];
+			src_rect = Rect2(region.x, region.y, region.z, region.w);
+		} else {
+			int frame = (int)index < frames.size() ? CLAMP(frames_ptr[index], 0, frame_count - 1) : 0;
+			src_rect = Rect2(sheet_rect.position + frame_size * Vector2(frame % hframes, frame / hframes), frame_size);
+		}
+
+		const Size2 dst_size = src_rect.size.abs();
+		Point2 dst_offset = offset;
+		if (centered) {
+			dst_offset -= dst_size / 2;
+		}
+
+		Point2 uv_position = src_rect.position;
+		Size2 uv_size = src_rect.size;
+		if (hflip) {
+			uv_position.x += uv_size.x;
+			uv_size.x = -uv_size.x;
+		}
+		if (vflip) {
+			uv_position.y += uv_size.y;
+			uv_size.y = -uv_size.y;
+		}
+
+		const float rotation = (int)index < rotations.size() ? rotations_ptr[index] : 0.0;
+		const Size2 scale = (int)index < scales.size() ? scales_ptr[index] : Size2(1, 1);
+		const Transform2D xform = Transform2D(rotation, scale, 0.0, positions_ptr[index]) * Transform2D(0.0, dst_size, 0.0, dst_offset);
+
+		const Rect2 instance_rect = xform.xform(Rect2(0, 0, 1, 1));
+		bounds = i == 0 ? instance_rect : bounds.merge(instance_rect);
+
+		float *dataptr = w + i * stride;
+
+		dataptr[0] = xform.columns[0][0];
+		dataptr[1] = xform.columns[1][0];
+		dataptr[2] = 0;
+		dataptr[3] = xform.columns[2][0];
+		dataptr[4] = xform.columns[0][1];
+		dataptr[5] = xform.columns[1][1];
+		dataptr[6] = 0;
+		dataptr[7] = xform.columns[2][1];
+
+		const Color modulate = (int)index < modulates.size() ? modulates_ptr[index] : Color(1, 1, 1, 1);
+		dataptr[8] = modulate.r;
+		dataptr[9] = modulate.g;
+		dataptr[10] = modulate.b;
+		dataptr[11] = modulate.a;
+
+		dataptr[12] = uv_position.x / texture_size.width;
+		dataptr[13] = uv_position.y / texture_size.height;
+		dataptr[14] = uv_size.x / texture_size.width;
+		dataptr[15] = uv_size.y / texture_size.height;
+	}
+
+	RS::get_singleton()->multimesh_set_buffer(multimesh, buffer);
+	RS::get_singleton()->multimesh_set_custom_aabb(multimesh, AABB(Vector3(bounds.position.x, bounds.position.y, 0), Vector3(bounds.size.x, bounds.size.y, 0)));
+}
+
+Ref<Material> SpriteBatch2D::_get_inherited_material() const {
+	const CanvasItem *item = this;
+	while (item->get_use_parent_material() && item->get_parent_item()) {
+		item = item->get_parent_item();
+	}
+	return item->get_material();
+}
+
+void SpriteBatch2D::_update_material() {
+	// The instance regions are only mapped by the default material or a custom one, so a parent
+	// without a material is not used, as the default canvas shader would draw the whole texture.
+	RID ci = get_canvas_item();
+	RS::get_singleton()->canvas_item_set_use_parent_material(ci, get_use_parent_material() && _get_inherited_material().is_valid());
+	RS::get_singleton()->canvas_item_set_material(ci, get_material().is_valid() ? get_material()->get_rid() : material);
+}
+
+void SpriteBatch2D::_texture_changed() {
+	// The regions are stored in UV space, so they depend on the texture size.
+	_instances_changed();
+}
+
+void SpriteBatch2D::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_ENTER_TREE: {
+			_update_material();
+		} break;
+
+		case NOTIFICATION_DRAW: {
+			if (instances_dirty) {
+				_update_instances();
+			}
+			if (multimesh_instance_count == 0) {
+				return;
+			}
+
+			// Ancestor materials may have changed since the last draw.
+			if (get_use_parent_material()) {
+				_update_material();
+			}
+			RS::get_singleton()->canvas_item_add_multimesh(get_canvas_item(), multimesh, texture->get_rid());
+		} break;
+	}
+}
+
+#ifdef DEBUG_ENABLED
+Rect2 SpriteBatch2D::_edit_get_rect() const {
+	return get_rect();
+}
+
+bool SpriteBatch2D::_edit_use_rect() const {
+	return texture.is_valid() && !positions.is_empty();
+}
+#endif // DEBUG_ENABLED
+
+void SpriteBatch2D::set_material(const Ref<Material> &p_material) {
+	CanvasItem::set_material(p_material);
+	_update_material();
+}
+
+void SpriteBatch2D::set_use_parent_material(bool p_use_parent_material) {
+	CanvasItem::set_use_parent_material(p_use_parent_material);
+	_update_material();
+}
+
+void SpriteBatch2D::set_texture(const Ref<Texture2D> &p_texture) {
+	if (p_texture == texture) {
+		return;
+	}
+
+	if (texture.is_valid()) {
+		texture->disconnect_changed(callable_mp(this, &SpriteBatch2D::_texture_changed));
+	}
+
+	texture = p_texture;
+
+	if (texture.is_valid()) {
+		texture->connect_changed(callable_mp(this, &SpriteBatch2D::_texture_changed));
+	}
+
+	_instances_changed();
+	emit_signal(SceneStringName(texture_changed));
+	item_rect_changed();
+}
+
+Ref<Texture2D> SpriteBatch2D::get_texture() const {
+	return texture;
+}
+
+void SpriteBatch2D::set_centered(bool p_center) {
+	if (centered == p_center) {
+		return;
+	}
+
+	centered = p_center;
+	_instances_changed();
+	item_rect_changed();
+}
+
+bool SpriteBatch2D::is_centered() const {
+	return centered;
+}
+
+void SpriteBatch2D::set_offset(const Point2 &p_offset) {
+	if (offset == p_offset) {
+		return;
+	}
+
+	offset = p_offset;
+	_instances_changed();
+	item_rect_changed();
+}
+
+Point2 SpriteBatch2D::get_offset() const {
+	return offset;
+}
+
+void SpriteBatch2D::set_flip_h(bool p_flip) {
+	if (hflip == p_flip) {
+		return;
+	}
+
+	hflip = p_flip;
+	_instances_changed();
+}
+
+bool SpriteBatch2D::is_flipped_h() const {
+	return hflip;
+}
+
+void SpriteBatch2D::set_flip_v(bool p_flip) {
+	if (vflip == p_flip) {
+		return;
+	}
+
+	vflip = p_flip;
+	_instances_changed();
+}
+
+bool SpriteBatch2D::is_flipped_v() const {
+	return vflip;
+}
+
+void SpriteBatch2D::set_region_enabled(bool p_enabled) {
+	if (p_enabled == region_enabled) {
+		return;
+	}
+
+	region_enabled = p_enabled;
+	_instances_changed();
+	notify_property_list_changed();
+}
+
+bool SpriteBatch2D::is_region_enabled() const {
+	return region_enabled;
+}
+
+void SpriteBatch2D::set_region_rect(const Rect2 &p_region_rect) {
+	if (region_rect == p_region_rect) {
+		return;
+	}
+
+	region_rect = p_region_rect;
+	if (region_enabled) {
+		_instances_changed();
+		item_rect_changed();
+	}
+}
+
+Rect2 SpriteBatch2D::get_region_rect() const {
+	return region_rect;
+}
+
+void SpriteBatch2D::set_vframes(int p_amount) {
+	ERR_FAIL_COND_MSG(p_amount < 1, "Amount of vframes cannot be smaller than 1.");
+
+	if (vframes == p_amount) {
+		return;
+	}
+
+	vframes = p_amount;
+	_instances_changed();
+	item_rect_changed();
+}
+
+int SpriteBatch2D::get_vframes() const {
+	return vframes;
+}
+
+void SpriteBatch2D::set_hframes(int p_amount) {
+	ERR_FAIL_COND_MSG(p_amount < 1, "Amount of hframes cannot be smaller than 1.");
+
+	if (hframes == p_amount) {
+		return;
+	}
+
+	hframes = p_amount;
+	_instances_changed();
+	item_rect_changed();
+}
+
+int SpriteBatch2D::get_hframes() const {
+	return hframes;
+}
+
+void SpriteBatch2D::set_positions(const PackedVector2Array &p_positions) {
+	positions = p_positions;
+	_instances_changed();
+	item_rect_changed();
+}
+
+PackedVector2Array SpriteBatch2D::get_positions() const {
+	return positions;
+}
+
+void SpriteBatch2D::set_rotations(const PackedFloat32Array &p_rotations) {
+	rotations = p_rotations;
+	_instances_changed();
+}
+
+PackedFloat32Array SpriteBatch2D::get_rotations() const {
+	return rotations;
+}
+
+void SpriteBatch2D::set_scales(const PackedVector2Array &p_scales) {
+	scales = p_scales;
+	_instances_changed();
+}
+
+PackedVector2Array SpriteBatch2D::get_scales() const {
+	return scales;
+}
+
+void SpriteBatch2D::set_frames(const PackedInt32Array &p_frames) {
+	frames = p_frames;
+	_instances_changed();
+}
+
+PackedInt32Array SpriteBatch2D::get_frames() const {
+	return frames;
+}
+
+void SpriteBatch2D::set_regions(const PackedVector4Array &p_regions) {
+	regions = p_regions;
+	_instances_changed();
+}
+
+PackedVector4Array SpriteBatch2D::get_regions() const {
+	return regions;
+}
+
+void SpriteBatch2D::set_modulates(const PackedColorArray &p_modulates) {
+	modulates = p_modulates;
+	_instances_changed();
+}
+
+PackedColorArray SpriteBatch2D::get_modulates() const {
+	return modulates;
+}
+
+void SpriteBatch2D::set_z_offsets(const PackedInt32Array &p_z_offsets) {
+	z_offsets = p_z_offsets;
+	_instances_changed();
+}
+
+PackedInt32Array SpriteBatch2D::get_z_offsets() const {
+	return z_offsets;
+}
+
+void SpriteBatch2D::set_instances(const PackedVector2Array &p_positions, const PackedInt32Array &p_frames, const PackedColorArray &p_modulates, const PackedInt32Array &p_z_offsets) {
+	positions = p_positions;
+	frames = p_frames;
+	modulates = p_modulates;
+	z_offsets = p_z_offsets;
+	_instances_changed();
+	item_rect_changed();
+}
+
+int SpriteBatch2D::get_instance_count() const {
+	return positions.size();
+}
+
+RID SpriteBatch2D::get_multimesh() const {
+	return multimesh;
+}
+
+Rect2 SpriteBatch2D::get_rect() const {
+	if (instances_dirty) {
+		const_cast<SpriteBatch2D *>(this)->_update_instances();
+	}
+	return bounds;
+}
+
+void SpriteBatch2D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_texture", "texture"), &SpriteBatch2D::set_texture);
+	ClassDB::bind_method(D_METHOD("get_texture"), &SpriteBatch2D::get_texture);
+
+	ClassDB::bind_method(D_METHOD("set_centered", "centered"), &SpriteBatch2D::set_centered);
+	ClassDB::bind_method(D_METHOD("is_centered"), &SpriteBatch2D::is_centered);
+
+	ClassDB::bind_method(D_METHOD("set_offset", "offset"), &SpriteBatch2D::set_offset);
+	ClassDB::bind_method(D_METHOD("get_offset"), &SpriteBatch2D::get_offset);
+
+	ClassDB::bind_method(D_METHOD("set_flip_h", "flip_h"), &SpriteBatch2D::set_flip_h);
+	ClassDB::bind_method(D_METHOD("is_flipped_h"), &SpriteBatch2D::is_flipped_h);
+
+	ClassDB::bind_method(D_METHOD("set_flip_v", "flip_v"), &SpriteBatch2D::set_flip_v);
+	ClassDB::bind_method(D_METHOD("is_flipped_v"), &SpriteBatch2D::is_flipped_v);
+
+	ClassDB::bind_method(D_METHOD("set_region_enabled", "enabled"), &SpriteBatch2D::set_region_enabled);
+	ClassDB::bind_method(D_METHOD("is_region_enabled"), &SpriteBatch2D::is_region_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_region_rect", "rect"), &SpriteBatch2D::set_region_rect);
+	ClassDB::bind_method(D_METHOD("get_region_rect"), &SpriteBatch2D::get_region_rect);
+
+	ClassDB::bind_method(D_METHOD("set_vframes", "vframes"), &SpriteBatch2D::set_vframes);
+	ClassDB::bind_method(D_METHOD("get_vframes"), &SpriteBatch2D::get_vframes);
+
+	ClassDB::bind_method(D_METHOD("set_hframes", "hframes"), &SpriteBatch2D::set_hframes);
+	ClassDB::bind_method(D_METHOD("get_hframes"), &SpriteBatch2D::get_hframes);
+
+	ClassDB::bind_method(D_METHOD("set_positions", "positions"), &SpriteBatch2D::set_positions);
+	ClassDB::bind_method(D_METHOD("get_positions"), &SpriteBatch2D::get_positions);
+
+	ClassDB::bind_method(D_METHOD("set_rotations", "rotations"), &SpriteBatch2D::set_rotations);
+	ClassDB::bind_method(D_METHOD("get_rotations"), &SpriteBatch2D::get_rotations);
+
+	ClassDB::bind_method(D_METHOD("set_scales", "scales"), &SpriteBatch2D::set_scales);
+	ClassDB::bind_method(D_METHOD("get_scales"), &SpriteBatch2D::get_scales);
+
+	ClassDB::bind_method(D_METHOD("set_frames", "frames"), &SpriteBatch2D::set_frames);
+	ClassDB::bind_method(D_METHOD("get_frames"), &SpriteBatch2D::get_frames);
+
+	ClassDB::bind_method(D_METHOD("set_regions", "regions"), &SpriteBatch2D::set_regions);
+	ClassDB::bind_method(D_METHOD("get_regions"), &SpriteBatch2D::get_regions);
+
+	ClassDB::bind_method(D_METHOD("set_modulates", "modulates"), &SpriteBatch2D::set_modulates);
+	ClassDB::bind_method(D_METHOD("get_modulates"), &SpriteBatch2D::get_modulates);
+
+	ClassDB::bind_method(D_METHOD("set_z_offsets", "z_offsets"), &SpriteBatch2D::set_z_offsets);
+	ClassDB::bind_method(D_METHOD("get_z_offsets"), &SpriteBatch2D::get_z_offsets);
+
+	ClassDB::bind_method(D_METHOD("set_instances", "positions", "frames", "modulates", "z_offsets"), &SpriteBatch2D::set_instances, DEFVAL(PackedInt32Array()), DEFVAL(PackedColorArray()), DEFVAL(PackedInt32Array()));
+	ClassDB::bind_method(D_METHOD("get_instance_count"), &SpriteBatch2D::get_instance_count);
+
+	ClassDB::bind_method(D_METHOD("get_rect"), &SpriteBatch2D::get_rect);
+
+	ADD_SIGNAL(MethodInfo("texture_changed"));
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "texture", PROPERTY_HINT_RESOURCE_TYPE, "Texture2D"), "set_texture", "get_texture");
+	ADD_GROUP("Offset", "");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "centered"), "set_centered", "is_centered");
+	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "offset", PROPERTY_HINT_NONE, "suffix:px"), "set_offset", "get_offset");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "flip_h"), "set_flip_h", "is_flipped_h");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "flip_v"), "set_flip_v", "is_flipped_v");
+	ADD_GROUP("Animation", "");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "hframes", PROPERTY_HINT_RANGE, "1,16384,1"), "set_hframes", "get_hframes");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "vframes", PROPERTY_HINT_RANGE, "1,16384,1"), "set_vframes", "get_vframes");
+
+	ADD_GROUP("Region", "region_");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "region_enabled"), "set_region_enabled", "is_region_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::RECT2, "region_rect"), "set_region_rect", "get_region_rect");
+
+	ADD_GROUP("Instances", "");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR2_ARRAY, "positions"), "set_positions", "get_positions");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_FLOAT32_ARRAY, "rotations"), "set_rotations", "get_rotations");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR2_ARRAY, "scales"), "set_scales", "get_scales");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_INT32_ARRAY, "frames"), "set_frames", "get_frames");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR4_ARRAY, "regions"), "set_regions", "get_regions");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_COLOR_ARRAY, "modulates"), "set_modulates", "get_modulates");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_INT32_ARRAY, "z_offsets"), "set_z_offsets", "get_z_offsets");
+}
+
+SpriteBatch2D::SpriteBatch2D() {
+	_add_shader_user();
+	multimesh = RS::get_singleton()->multimesh_create();
+	RS::get_singleton()->multimesh_set_mesh(multimesh, mesh);
+	RS::get_singleton()->canvas_item_set_material(get_canvas_item(), material);
+}
+
+SpriteBatch2D::~SpriteBatch2D() {
+	ERR_FAIL_NULL(RenderingServer::get_singleton());
+	RS::get_singleton()->free(multimesh);
+	_remove_shader_user();
+}
@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*  sprite_batch_2d.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SPRITE_BATCH_2D_H
+#define SPRITE_BATCH_2D_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/resources/texture.h"
+
+class SpriteBatch2D : public Node2D {
+	GDCLASS(SpriteBatch2D, Node2D);
+
+	// Shared by all batches, and freed with the last one.
+	static Mutex shader_mutex;
+	static int shader_users;
+	static RID shader;
+	static RID material;
+	static RID mesh;
+
+	static void _add_shader_user();
+	static void _remove_shader_user();
+
+	Ref<Texture2D> texture;
+
+	bool centered = true;
+	Point2 offset;
+
+	bool hflip = false;
+	bool vflip = false;
+	bool region_enabled = false;
+	Rect2 region_rect;
+
+	int vframes = 1;
+	int hframes = 1;
+
+	// Per-instance data. The instance count is the size of `positions`, the other arrays are optional.
+	PackedVector2Array positions;
+	PackedFloat32Array rotations;
+	PackedVector2Array scales;
+	PackedInt32Array frames;
+	PackedVector4Array regions;
+	PackedColorArray modulates;
+	PackedInt32Array z_offsets;
+
+	RID multimesh;
+	int multimesh_instance_count = 0;
+	bool instances_dirty = true;
+	Rect2 bounds;
+
+	LocalVector<uint32_t> draw_order;
+	Vector<float> buffer;
+
+	void _instances_changed();
+	void _update_instances();
+	Ref<Material> _get_inherited_material() const;
+	void _update_material();
+	void _texture_changed();
+
+protected:
+	void _notification(int p_what);
+	static void _bind_methods();
+
+public:
+#ifdef DEBUG_ENABLED
+	virtual Rect2 _edit_get_rect() const override;
+	virtual bool _edit_use_rect() const override;
+#endif // DEBUG_ENABLED
+
+	virtual void set_material(const Ref<Material> &p_material) override;
+	virtual void set_use_parent_material(bool p_use_parent_material) override;
+
+	void set_texture(const Ref<Texture2D> &p_texture);
+	Ref<Texture2D> get_texture() const;
+
+	void set_centered(bool p_center);
+	bool is_centered() const;
+
+	void set_offset(const Point2 &p_offset);
+	Point2 get_offset() const;
+
+	void set_flip_h(bool p_flip);
+	bool is_flipped_h() const;
+
+	void set_flip_v(bool p_flip);
+	bool is_flipped_v() const;
+
+	void set_region_enabled(bool p_enabled);
+	bool is_region_enabled() const;
+
+	void set_region_rect(const Rect2 &p_region_rect);
+	Rect2 get_region_rect() const;
+
+	void set_vframes(int p_amount);
+	int get_vframes() const;
+
+	void set_hframes(int p_amount);
+	int get_hframes() const;
+
+	void set_positions(const PackedVector2Array &p_positions);
+	PackedVector2Array get_positions() const;
+
+	void set_rotations(const PackedFloat32Array &p_rotations);
+	PackedFloat32Array get_rotations() const;
+
+	void set_scales(const PackedVector2Array &p_scales);
+	PackedVector2Array get_scales() const;
+
+	void set_frames(const PackedInt32Array &p_frames);
+	PackedInt32Array get_frames() const;
+
+	void set_regions(const PackedVector4Array &p_regions);
+	PackedVector4Array get_regions() const;
+
+	void set_modulates(const PackedColorArray &p_modulates);
+	PackedColorArray get_modulates() const;
+
+	void set_z_offsets(const PackedInt32Array &p_z_offsets);
+	PackedInt32Array get_z_offsets() const;
+
+	void set_instances(const PackedVector2Array &p_positions, const PackedInt32Array &p_frames = PackedInt32Array(), const PackedColorArray &p_modulates = PackedColorArray(), const PackedInt32Array &p_z_offsets = PackedInt32Array());
+	int get_instance_count() const;
+
+	RID get_multimesh() const;
+	Rect2 get_rect() const;
+
+	SpriteBatch2D();
+	~SpriteBatch2D();
+};
+
+#endif // SPRITE_BATCH_2D_H
@@ -30,7 +30,11 @@
 
 #include "tile_map_layer.h"
 
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
 #include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 #include "scene/2d/tile_map.h"
 #include "scene/gui/control.h"
 #include "scene/resources/2d/navigation_mesh_source_geometry_data_2d.h"
@@ -40,6 +44,28 @@
 Callable TileMapLayer::_navmesh_source_geometry_parsing_callback;
 RID TileMapLayer::_navmesh_source_geometry_parser;
 
+Vector2i TileMapLayer::_coords_to_quadrant_coords(const Vector2i &p_coords, int p_quadrant_size) const {
+	// Rounding down, instead of simply rounding towards zero (truncating).
+	return Vector2i(
+			p_coords.x > 0 ? p_coords.x / p_quadrant_size : (p_coords.x - (p_quadrant_size - 1)) / p_quadrant_size,
+			p_coords.y > 0 ? p_coords.y / p_quadrant_size : (p_coords.y - (p_quadrant_size - 1)) / p_quadrant_size);
+}
+
+const TileData *TileMapLayer::_get_cell_data_tile_data(const CellData &p_cell_data) const {
+	const TileMapCell &c = p_cell_data.cell;
+	if (!tile_set->has_source(c.source_id)) {
+		return nullptr;
+	}
+	TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(c.source_id));
+	if (!atlas_source || !atlas_source->has_tile(c.get_atlas_coords()) || !atlas_source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+		return nullptr;
+	}
+	if (p_cell_data.runtime_tile_data_cache) {
+		return p_cell_data.runtime_tile_data_cache;
+	}
+	return atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+}
+
 #ifdef DEBUG_ENABLED
 /////////////////////////////// Debug //////////////////////////////////////////
 constexpr int TILE_MAP_DEBUG_QUADRANT_SIZE = 16;
@@ -93,6 +119,19 @@ void TileMapLayer::_debug_update(bool p_force_cleanup) {
 			CellData &cell_data = *cell_data_list_element->self();
 			_debug_quadrants_update_cell(cell_data, dirty_debug_quadrant_list);
 		}
+
+		// Rebuilding a physics quadrant can reshape merged collisions that are drawn by cells that did not change.
+		for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+			if (!kv.value->debug_redraw) {
+				continue;
+			}
+			for (SelfList<CellData> *cell_data_list_element = kv.value->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+				_debug_quadrants_update_cell(*cell_data_list_element->self(), dirty_debug_quadrant_list);
+			}
+		}
+	}
+	for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+		kv.value->debug_redraw = false;
 	}
 
 	// Update those quadrants.
@@ -243,122 +282,43 @@ void TileMapLayer::_rendering_update(bool p_force_cleanup) {
 			}
 		}
 
-		// Update all dirty quadrants.
-		bool needs_set_not_interpolated = is_inside_tree() && get_tree()->is_physics_interpolation_enabled() && !is_physics_interpolated();
-		for (SelfList<RenderingQuadrant> *quadrant_list_element = dirty_rendering_quadrant_list.first(); quadrant_list_element;) {
-			SelfList<RenderingQuadrant> *next_quadrant_list_element = quadrant_list_element->next(); // "Hack" to clear the list while iterating.
-
-			const Ref<RenderingQuadrant> &rendering_quadrant = quadrant_list_element->self();
-
-			// Check if the quadrant has a tile.
-			bool has_a_tile = false;
-			for (SelfList<CellData> *cell_data_list_element = rendering_quadrant->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
-				CellData &cell_data = *cell_data_list_element->self();
-				if (cell_data.cell.source_id != TileSet::INVALID_SOURCE) {
-					has_a_tile = true;
-					break;
-				}
+		// Build the drawing commands of the dirty quadrants, in parallel if there are enough of them.
+		RenderingQuadrantsBuild build;
+		build.y_sorted_x_reversed = is_y_sort_enabled() && x_draw_order_reversed;
+		build.self_modulate = get_self_modulate();
+		build.parent_canvas_item = get_canvas_item();
+		build.light_mask = get_light_mask();
+		build.texture_filter = RS::CanvasItemTextureFilter(get_texture_filter_in_tree());
+		build.texture_repeat = RS::CanvasItemTextureRepeat(get_texture_repeat_in_tree());
+		build.needs_set_not_interpolated = is_inside_tree() && get_tree()->is_physics_interpolation_enabled() && !is_physics_interpolated();
+		build.needs_reset_physics_interpolation = is_physics_interpolated_and_enabled() && is_visible_in_tree();
+		for (SelfList<RenderingQuadrant> *quadrant_list_element = dirty_rendering_quadrant_list.first(); quadrant_list_element; quadrant_list_element = quadrant_list_element->next()) {
+			build.quadrants.push_back(quadrant_list_element->self());
+		}
+		build.canvas_items.resize(build.quadrants.size());
+		build.draw_commands.resize(build.quadrants.size());
+		if (build.quadrants.size() >= RENDERING_QUADRANTS_THREADED_UPDATE_THRESHOLD) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &TileMapLayer::_rendering_build_quadrant, &build, build.quadrants.size(), -1, true, SNAME("TileMapLayerBuildRenderingQuadrants"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (uint32_t i = 0; i < build.quadrants.size(); i++) {
+				_rendering_build_quadrant(i, &build);
 			}
+		}
 
-			if (has_a_tile) {
-				// Process the quadrant.
-
-				// First, clear the quadrant's canvas items.
-				for (RID &ci : rendering_quadrant->canvas_items) {
-					rs->free(ci);
-				}
-				rendering_quadrant->canvas_items.clear();
-
-				// Sort the quadrant cells.
-				if (is_y_sort_enabled() && x_draw_order_reversed) {
-					rendering_quadrant->cells.sort_custom<CellDataYSortedXReversedComparator>();
-				} else {
-					rendering_quadrant->cells.sort();
-				}
-
-				// Those allow to group cell per material or z-index.
-				Ref<Material> prev_material;
-				int prev_z_index = 0;
-				RID prev_ci;
-
-				for (SelfList<CellData> *cell_data_quadrant_list_element = rendering_quadrant->cells.first(); cell_data_quadrant_list_element; cell_data_quadrant_list_element = cell_data_quadrant_list_element->next()) {
-					CellData &cell_data = *cell_data_quadrant_list_element->self();
-
-					TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(cell_data.cell.source_id));
-
-					// Get the tile data.
-					const TileData *tile_data;
-					if (cell_data.runtime_tile_data_cache) {
-						tile_data = cell_data.runtime_tile_data_cache;
-					} else {
-						tile_data = atlas_source->get_tile_data(cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile);
-					}
-
-					Ref<Material> mat = tile_data->get_material();
-					int tile_z_index = tile_data->get_z_index();
-
-					// Quandrant pos.
-
-					// --- CanvasItems ---
-					RID ci;
-
-					// Check if the material or the z_index changed.
-					if (prev_ci == RID() || prev_material != mat || prev_z_index != tile_z_index) {
-						// If so, create a new CanvasItem.
-						ci = rs->canvas_item_create();
-						if (needs_set_not_interpolated) {
-							rs->canvas_item_set_interpolated(ci, false);
-						}
-						if (mat.is_valid()) {
-							rs->canvas_item_set_material(ci, mat->get_rid());
-						}
-						rs->canvas_item_set_parent(ci, get_canvas_item());
-						rs->canvas_item_set_use_parent_material(ci, mat.is_null());
-
-						Transform2D xform(0, rendering_quadrant->canvas_items_position);
-						rs->canvas_item_set_transform(ci, xform);
-
-						rs->canvas_item_set_light_mask(ci, get_light_mask());
-						rs->canvas_item_set_z_as_relative_to_parent(ci, true);
-						rs->canvas_item_set_z_index(ci, tile_z_index);
-
-						rs->canvas_item_set_default_texture_filter(ci, RS::CanvasItemTextureFilter(get_texture_filter_in_tree()));
-						rs->canvas_item_set_default_texture_repeat(ci, RS::CanvasItemTextureRepeat(get_texture_repeat_in_tree()));
-
-						rendering_quadrant->canvas_items.push_back(ci);
-
-						prev_ci = ci;
-						prev_material = mat;
-						prev_z_index = tile_z_index;
-
-					} else {
-						// Keep the same canvas_item to draw on.
-						ci = prev_ci;
-					}
-
-					const Vector2 local_tile_pos = tile_set->map_to_local(cell_data.coords);
-
-					// Random animation offset.
-					real_t random_animation_offset = 0.0;
-					if (atlas_source->get_tile_animation_mode(cell_data.cell.get_atlas_coords()) != TileSetAtlasSource::TILE_ANIMATION_MODE_DEFAULT) {
-						Array to_hash;
-						to_hash.push_back(local_tile_pos);
-						to_hash.push_back(get_instance_id()); // Use instance id as a random hash
-						random_animation_offset = RandomPCG(to_hash.hash()).randf();
-					}
-
-					// Drawing the tile in the canvas item.
-					draw_tile(ci, local_tile_pos - rendering_quadrant->canvas_items_position, tile_set, cell_data.cell.source_id, cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile, -1, get_self_modulate(), tile_data, random_animation_offset);
-				}
+		// Submit them from this thread, as RenderingServer calls aren't safe to make from worker threads.
+		for (uint32_t i = 0; i < build.quadrants.size(); i++) {
+			if (build.quadrants[i]->pending_has_a_tile) {
+				_rendering_submit_quadrant(build.quadrants[i], &build, build.canvas_items[i], build.draw_commands[i]);
+			}
+		}
 
-				// Reset physics interpolation for any recreated canvas items.
-				if (is_physics_interpolated_and_enabled() && is_visible_in_tree()) {
-					for (const RID &ci : rendering_quadrant->canvas_items) {
-						rs->canvas_item_reset_physics_interpolation(ci);
-					}
-				}
+		// Free the quadrants left without tiles.
+		for (SelfList<RenderingQuadrant> *quadrant_list_element = dirty_rendering_quadrant_list.first(); quadrant_list_element;) {
+			SelfList<RenderingQuadrant> *next_quadrant_list_element = quadrant_list_element->next(); // "Hack" to clear the list while iterating.
 
-			} else {
+			RenderingQuadrant *rendering_quadrant = quadrant_list_element->self();
+			if (!rendering_quadrant->pending_has_a_tile) {
 				// Free the quadrant.
 				for (const RID &ci : rendering_quadrant->canvas_items) {
 					if (ci.is_valid()) {
@@ -436,6 +396,119 @@ void TileMapLayer::_rendering_update(bool p_force_cleanup) {
 	_rendering_was_cleaned_up = forced_cleanup || !occlusion_enabled;
 }
 
+void TileMapLayer::_rendering_build_quadrant(uint32_t p_index, RenderingQuadrantsBuild *p_build) {
+	// Called from worker threads, so this must not modify anything but the quadrant and its commands, nor call the RenderingServer.
+	RenderingQuadrant *rendering_quadrant = p_build->quadrants[p_index];
+	LocalVector<RenderingQuadrant::CanvasItemDescriptor> &canvas_items = p_build->canvas_items[p_index];
+	LocalVector<TileDrawCommand> &draw_commands = p_build->draw_commands[p_index];
+
+	// Check if the quadrant has a tile.
+	rendering_quadrant->pending_has_a_tile = false;
+	for (SelfList<CellData> *cell_data_list_element = rendering_quadrant->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+		CellData &cell_data = *cell_data_list_element->self();
+		if (cell_data.cell.source_id != TileSet::INVALID_SOURCE) {
+			rendering_quadrant->pending_has_a_tile = true;
+			break;
+		}
+	}
+	if (!rendering_quadrant->pending_has_a_tile) {
+		return;
+	}
+
+	// Sort the quadrant cells.
+	if (p_build->y_sorted_x_reversed) {
+		rendering_quadrant->cells.sort_custom<CellDataYSortedXReversedComparator>();
+	} else {
+		rendering_quadrant->cells.sort();
+	}
+
+	for (SelfList<CellData> *cell_data_quadrant_list_element = rendering_quadrant->cells.first(); cell_data_quadrant_list_element; cell_data_quadrant_list_element = cell_data_quadrant_list_element->next()) {
+		CellData &cell_data = *cell_data_quadrant_list_element->self();
+
+		TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(cell_data.cell.source_id));
+
+		// Get the tile data.
+		const TileData *tile_data;
+		if (cell_data.runtime_tile_data_cache) {
+			tile_data = cell_data.runtime_tile_data_cache;
+		} else {
+			tile_data = atlas_source->get_tile_data(cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile);
+		}
+
+		// Group the cells per material or z-index, creating a new CanvasItem if any of those changed.
+		Ref<Material> mat = tile_data->get_material();
+		int tile_z_index = tile_data->get_z_index();
+		if (canvas_items.is_empty() || canvas_items[canvas_items.size() - 1].material != mat || canvas_items[canvas_items.size() - 1].z_index != tile_z_index) {
+			RenderingQuadrant::CanvasItemDescriptor canvas_item;
+			canvas_item.material = mat;
+			canvas_item.z_index = tile_z_index;
+			canvas_items.push_back(canvas_item);
+		}
+
+		const Vector2 local_tile_pos = tile_set->map_to_local(cell_data.coords);
+
+		// Random animation offset.
+		real_t random_animation_offset = 0.0;
+		if (atlas_source->get_tile_animation_mode(cell_data.cell.get_atlas_coords()) != TileSetAtlasSource::TILE_ANIMATION_MODE_DEFAULT) {
+			Array to_hash;
+			to_hash.push_back(local_tile_pos);
+			to_hash.push_back(get_instance_id()); // Use instance id as a random hash
+			random_animation_offset = RandomPCG(to_hash.hash()).randf();
+		}
+
+		// Drawing the tile in the canvas item.
+		build_tile_draw_commands(draw_commands, canvas_items.size() - 1, local_tile_pos - rendering_quadrant->canvas_items_position, tile_set, cell_data.cell.source_id, cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile, -1, p_build->self_modulate, tile_data, random_animation_offset);
+	}
+}
+
+void TileMapLayer::_rendering_submit_quadrant(RenderingQuadrant *p_rendering_quadrant, const RenderingQuadrantsBuild *p_build, const LocalVector<RenderingQuadrant::CanvasItemDescriptor> &p_canvas_items, const LocalVector<TileDrawCommand> &p_draw_commands) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	// First, clear the quadrant's canvas items.
+	for (RID &ci : p_rendering_quadrant->canvas_items) {
+		rs->free(ci);
+	}
+	p_rendering_quadrant->canvas_items.clear();
+
+	// Create the canvas items.
+	LocalVector<RID> canvas_items;
+	canvas_items.reserve(p_canvas_items.size());
+	for (const RenderingQuadrant::CanvasItemDescriptor &canvas_item : p_canvas_items) {
+		RID ci = rs->canvas_item_create();
+		if (p_build->needs_set_not_interpolated) {
+			rs->canvas_item_set_interpolated(ci, false);
+		}
+		if (canvas_item.material.is_valid()) {
+			rs->canvas_item_set_material(ci, canvas_item.material->get_rid());
+		}
+		rs->canvas_item_set_parent(ci, p_build->parent_canvas_item);
+		rs->canvas_item_set_use_parent_material(ci, canvas_item.material.is_null());
+
+		Transform2D xform(0, p_rendering_quadrant->canvas_items_position);
+		rs->canvas_item_set_transform(ci, xform);
+
+		rs->canvas_item_set_light_mask(ci, p_build->light_mask);
+		rs->canvas_item_set_z_as_relative_to_parent(ci, true);
+		rs->canvas_item_set_z_index(ci, canvas_item.z_index);
+
+		rs->canvas_item_set_default_texture_filter(ci, p_build->texture_filter);
+		rs->canvas_item_set_default_texture_repeat(ci, p_build->texture_repeat);
+
+		p_rendering_quadrant->canvas_items.push_back(ci);
+		canvas_items.push_back(ci);
+	}
+
+	// Submit the drawing commands all at once.
+	submit_tile_draw_commands(p_draw_commands, canvas_items.ptr());
+
+	// Reset physics interpolation for any recreated canvas items.
+	if (p_build->needs_reset_physics_interpolation) {
+		for (const RID &ci : p_rendering_quadrant->canvas_items) {
+			rs->canvas_item_reset_physics_interpolation(ci);
+		}
+	}
+}
+
 void TileMapLayer::_rendering_notification(int p_what) {
 	RenderingServer *rs = RenderingServer::get_singleton();
 	if (p_what == NOTIFICATION_TRANSFORM_CHANGED || p_what == NOTIFICATION_ENTER_CANVAS || p_what == NOTIFICATION_VISIBILITY_CHANGED) {
@@ -701,27 +774,101 @@ void TileMapLayer::_rendering_draw_cell_debug(const RID &p_canvas_item, const Ve
 
 /////////////////////////////// Physics //////////////////////////////////////
 
+// Sorts cell coords row by row, as expected when merging cells into rectangles.
+struct CellCoordsRowComparator {
+	_FORCE_INLINE_ bool operator()(const Vector2i &p_a, const Vector2i &p_b) const {
+		return p_a.y == p_b.y ? (p_a.x < p_b.x) : (p_a.y < p_b.y);
+	}
+};
+
+// Whether the collision of a tile is a single solid rectangle covering the whole tile, in which case it can be merged with its neighbors.
+static bool _is_tile_collision_full(const TileData *p_tile_data, int p_physics_layer, const Vector2 &p_tile_size) {
+	if (p_tile_data->get_collision_polygons_count(p_physics_layer) != 1 || p_tile_data->is_collision_polygon_one_way(p_physics_layer, 0)) {
+		return false;
+	}
+
+	Vector<Vector2> points = p_tile_data->get_collision_polygon_points(p_physics_layer, 0);
+	if (points.size() != 4) {
+		return false;
+	}
+
+	Vector2 half_size = p_tile_size / 2;
+	real_t area = 0.0;
+	for (int i = 0; i < 4; i++) {
+		if (!Math::is_equal_approx(Math::abs(points[i].x), half_size.x) || !Math::is_equal_approx(Math::abs(points[i].y), half_size.y)) {
+			return false;
+		}
+		area += points[i].cross(points[(i + 1) % 4]);
+	}
+
+	// Rules out self-intersecting orders of the corners.
+	return Math::is_equal_approx(Math::abs(area) * 0.5f, p_tile_size.x * p_tile_size.y);
+}
+
 void TileMapLayer::_physics_update(bool p_force_cleanup) {
 	// Check if we should cleanup everything.
 	bool forced_cleanup = p_force_cleanup || !enabled || !collision_enabled || !is_inside_tree() || tile_set.is_null();
-	if (forced_cleanup) {
-		// Clean everything.
-		for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-			_physics_clear_cell(kv.value);
+
+	// Check if anything changed that might change the quadrant shape.
+	// If so, recreate everything.
+	bool quadrant_shape_changed = dirty.flags[DIRTY_FLAGS_TILE_SET] || dirty.flags[DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE];
+
+	// Free all quadrants.
+	if (forced_cleanup || quadrant_shape_changed) {
+		for (const KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+			_physics_clear_quadrant(kv.value);
+			for (SelfList<CellData> *cell_data_list_element = kv.value->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+				cell_data_list_element->self()->physics_quadrant = Ref<PhysicsQuadrant>();
+			}
+			kv.value->cells.clear();
 		}
-	} else {
-		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_SET] || dirty.flags[DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES] || dirty.flags[DIRTY_FLAGS_LAYER_IN_TREE]) {
+		physics_quadrant_map.clear();
+		_physics_was_cleaned_up = true;
+	}
+
+	if (!forced_cleanup) {
+		// List all quadrants to update, creating new ones if needed.
+		SelfList<PhysicsQuadrant>::List dirty_physics_quadrant_list;
+
+		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_LAYER_IN_TREE]) {
 			// Update all cells.
 			for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-				_physics_update_cell(kv.value);
+				_physics_quadrants_update_cell(kv.value, dirty_physics_quadrant_list);
 			}
 		} else {
 			// Update dirty cells.
 			for (SelfList<CellData> *cell_data_list_element = dirty.cell_list.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
 				CellData &cell_data = *cell_data_list_element->self();
-				_physics_update_cell(cell_data);
+				_physics_quadrants_update_cell(cell_data, dirty_physics_quadrant_list);
+			}
+		}
+
+		// The body mode is shared by all bodies.
+		if (dirty.flags[DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES]) {
+			for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+				if (!kv.value->dirty_quadrant_list_element.in_list()) {
+					dirty_physics_quadrant_list.add(&kv.value->dirty_quadrant_list_element);
+				}
+			}
+		}
+
+		// Update all dirty quadrants.
+		for (SelfList<PhysicsQuadrant> *quadrant_list_element = dirty_physics_quadrant_list.first(); quadrant_list_element;) {
+			SelfList<PhysicsQuadrant> *next_quadrant_list_element = quadrant_list_element->next(); // "Hack" to clear the list while iterating.
+
+			Ref<PhysicsQuadrant> physics_quadrant = quadrant_list_element->self();
+			if (physics_quadrant->cells.first()) {
+				_physics_update_quadrant(physics_quadrant);
+			} else {
+				// Free the quadrant.
+				_physics_clear_quadrant(physics_quadrant);
+				physics_quadrant_map.erase(physics_quadrant->quadrant_coords);
 			}
+
+			quadrant_list_element = next_quadrant_list_element;
 		}
+
+		dirty_physics_quadrant_list.clear();
 	}
 
 	// -----------
@@ -737,15 +884,10 @@ void TileMapLayer::_physics_notification(int p_what) {
 		case NOTIFICATION_TRANSFORM_CHANGED:
 			// Move the collisison shapes along with the TileMap.
 			if (is_inside_tree() && tile_set.is_valid()) {
-				for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-					const CellData &cell_data = kv.value;
-
-					for (RID body : cell_data.bodies) {
-						if (body.is_valid()) {
-							Transform2D xform(0, tile_set->map_to_local(kv.key));
-							xform = gl_transform * xform;
-							ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-						}
+				for (const KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+					Transform2D xform = gl_transform * Transform2D(0, kv.value->bodies_position);
+					for (const PhysicsQuadrant::Body &body : kv.value->bodies) {
+						ps->body_set_state(body.rid, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
 					}
 				}
 			}
@@ -755,146 +897,244 @@ void TileMapLayer::_physics_notification(int p_what) {
 			if (is_inside_tree()) {
 				RID space = get_world_2d()->get_space();
 
-				for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-					const CellData &cell_data = kv.value;
-
-					for (RID body : cell_data.bodies) {
-						if (body.is_valid()) {
-							ps->body_set_space(body, space);
-						}
+				for (const KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+					for (const PhysicsQuadrant::Body &body : kv.value->bodies) {
+						ps->body_set_space(body.rid, space);
 					}
 				}
 			}
 	}
 }
 
-void TileMapLayer::_physics_clear_cell(CellData &r_cell_data) {
+void TileMapLayer::_physics_quadrants_update_cell(CellData &r_cell_data, SelfList<PhysicsQuadrant>::List &r_dirty_physics_quadrant_list) {
+	// Remove the cell from its old quadrant, marking it as dirty.
+	if (r_cell_data.physics_quadrant.is_valid()) {
+		if (!r_cell_data.physics_quadrant->dirty_quadrant_list_element.in_list()) {
+			r_dirty_physics_quadrant_list.add(&r_cell_data.physics_quadrant->dirty_quadrant_list_element);
+		}
+		if (r_cell_data.physics_quadrant_list_element.in_list()) {
+			r_cell_data.physics_quadrant->cells.remove(&r_cell_data.physics_quadrant_list_element);
+		}
+		r_cell_data.physics_quadrant = Ref<PhysicsQuadrant>();
+	}
+
+	if (!_get_cell_data_tile_data(r_cell_data)) {
+		return;
+	}
+
+	Vector2i quadrant_coords = _coords_to_quadrant_coords(r_cell_data.coords, physics_quadrant_size);
+	Ref<PhysicsQuadrant> physics_quadrant;
+	if (physics_quadrant_map.has(quadrant_coords)) {
+		// Reuse existing physics quadrant.
+		physics_quadrant = physics_quadrant_map[quadrant_coords];
+	} else {
+		// Create a new physics quadrant.
+		physics_quadrant.instantiate();
+		physics_quadrant->quadrant_coords = quadrant_coords;
+		physics_quadrant->bodies_position = tile_set->map_to_local(physics_quadrant_size * quadrant_coords);
+		physics_quadrant_map[quadrant_coords] = physics_quadrant;
+	}
+
+	// Add the cell to its new quadrant, and mark it as dirty.
+	r_cell_data.physics_quadrant = physics_quadrant;
+	physics_quadrant->cells.add(&r_cell_data.physics_quadrant_list_element);
+	if (!physics_quadrant->dirty_quadrant_list_element.in_list()) {
+		r_dirty_physics_quadrant_list.add(&physics_quadrant->dirty_quadrant_list_element);
+	}
+}
+
+void TileMapLayer::_physics_clear_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant) {
 	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 
 	// Clear bodies.
-	for (RID body : r_cell_data.bodies) {
-		if (body.is_valid()) {
-			bodies_coords.erase(body);
-			ps->free(body);
-		}
+	for (const PhysicsQuadrant::Body &body : p_physics_quadrant->bodies) {
+		bodies_quadrants.erase(body.rid);
+		ps->free(body.rid);
 	}
-	r_cell_data.bodies.clear();
+	p_physics_quadrant->bodies.clear();
 }
 
-void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
+void TileMapLayer::_physics_update_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant) {
 	Transform2D gl_transform = get_global_transform();
 	RID space = get_world_2d()->get_space();
 	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	LocalVector<PhysicsQuadrant::Body> &bodies = p_physics_quadrant->bodies;
 
-	// Recreate bodies and shapes.
-	TileMapCell &c = r_cell_data.cell;
+	p_physics_quadrant->debug_redraw = true;
 
-	TileSetSource *source;
-	if (tile_set->has_source(c.source_id)) {
-		source = *tile_set->get_source(c.source_id);
+	// Clear the shapes of the bodies, which are kept for the cells that still match them.
+	for (PhysicsQuadrant::Body &body : bodies) {
+		ps->body_clear_shapes(body.rid);
+		body.merged_shapes.clear();
+		body.merged_shapes_coords.clear();
+		body.shapes_coords.clear();
+		body.shapes_end_coords.clear();
+	}
 
-		if (source->has_tile(c.get_atlas_coords()) && source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
-			TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
-			if (atlas_source) {
-				const TileData *tile_data;
-				if (r_cell_data.runtime_tile_data_cache) {
-					tile_data = r_cell_data.runtime_tile_data_cache;
-				} else {
-					tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+	// Only square tiles fill the plane without gaps, so only their collisions can be merged.
+	// A quadrant of a single cell has nothing to merge, and keeps the tile's own shapes.
+	Vector2 tile_size = tile_set->get_tile_size();
+	bool can_merge = physics_quadrant_size > 1 && tile_set->get_tile_shape() == TileSet::TILE_SHAPE_SQUARE;
+	LocalVector<LocalVector<Vector2i>> bodies_full_cells;
+
+	// Add the shapes of the cells to the bodies.
+	for (SelfList<CellData> *cell_data_list_element = p_physics_quadrant->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+		const CellData &cell_data = *cell_data_list_element->self();
+		const TileData *tile_data = _get_cell_data_tile_data(cell_data);
+
+		// Transform flags.
+		bool flip_h = (cell_data.cell.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_H);
+		bool flip_v = (cell_data.cell.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_V);
+		bool transpose = (cell_data.cell.alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
+		Transform2D cell_to_body(0, tile_set->map_to_local(cell_data.coords) - p_physics_quadrant->bodies_position);
+
+		for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+			int polygons_count = tile_data->get_collision_polygons_count(tile_set_physics_layer);
+			if (polygons_count == 0) {
+				continue;
+			}
+
+			// Find or create the body matching the cell.
+			Vector2 linear_velocity = tile_data->get_constant_linear_velocity(tile_set_physics_layer);
+			real_t angular_velocity = tile_data->get_constant_angular_velocity(tile_set_physics_layer);
+			uint32_t body_index = 0;
+			for (; body_index < bodies.size(); body_index++) {
+				const PhysicsQuadrant::Body &body = bodies[body_index];
+				if (body.physics_layer == tile_set_physics_layer && body.linear_velocity == linear_velocity && body.angular_velocity == angular_velocity) {
+					break;
 				}
+			}
+			if (body_index == bodies.size()) {
+				PhysicsQuadrant::Body new_body;
+				new_body.physics_layer = tile_set_physics_layer;
+				new_body.linear_velocity = linear_velocity;
+				new_body.angular_velocity = angular_velocity;
+				new_body.rid = ps->body_create();
+				bodies_quadrants[new_body.rid] = p_physics_quadrant;
+				bodies.push_back(new_body);
+			}
+			if (bodies_full_cells.size() < bodies.size()) {
+				bodies_full_cells.resize(bodies.size());
+			}
+			PhysicsQuadrant::Body &body = bodies[body_index];
 
-				// Transform flags.
-				bool flip_h = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_H);
-				bool flip_v = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_V);
-				bool transpose = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
-
-				// Free unused bodies then resize the bodies array.
-				for (uint32_t i = tile_set->get_physics_layers_count(); i < r_cell_data.bodies.size(); i++) {
-					RID &body = r_cell_data.bodies[i];
-					if (body.is_valid()) {
-						bodies_coords.erase(body);
-						ps->free(body);
-						body = RID();
-					}
+			// Full tiles are merged afterwards.
+			if (can_merge && (!transpose || tile_size.x == tile_size.y) && _is_tile_collision_full(tile_data, tile_set_physics_layer, tile_size)) {
+				bodies_full_cells[body_index].push_back(cell_data.coords);
+				continue;
+			}
+
+			for (int polygon_index = 0; polygon_index < polygons_count; polygon_index++) {
+				// Iterate over the polygons.
+				bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
+				float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
+				int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
+				for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
+					// Add decomposed convex shapes.
+					Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index, flip_h, flip_v, transpose);
+					ps->body_add_shape(body.rid, shape->get_rid(), cell_to_body);
+					ps->body_set_shape_as_one_way_collision(body.rid, body.shapes_coords.size(), one_way_collision, one_way_collision_margin);
+					body.shapes_coords.push_back(cell_data.coords);
+					body.shapes_end_coords.push_back(cell_data.coords);
 				}
-				r_cell_data.bodies.resize(tile_set->get_physics_layers_count());
-
-				for (uint32_t tile_set_physics_layer = 0; tile_set_physics_layer < (uint32_t)tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
-					Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(tile_set_physics_layer);
-					uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(tile_set_physics_layer);
-					uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(tile_set_physics_layer);
-					real_t physics_priority = tile_set->get_physics_layer_collision_priority(tile_set_physics_layer);
-
-					RID body = r_cell_data.bodies[tile_set_physics_layer];
-					if (tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0) {
-						// No body needed, free it if it exists.
-						if (body.is_valid()) {
-							bodies_coords.erase(body);
-							ps->free(body);
-						}
-						body = RID();
-					} else {
-						// Create or update the body.
-						if (!body.is_valid()) {
-							body = ps->body_create();
-						}
-						bodies_coords[body] = r_cell_data.coords;
-						ps->body_set_mode(body, use_kinematic_bodies ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
-						ps->body_set_space(body, space);
+			}
+		}
+	}
 
-						Transform2D xform;
-						xform.set_origin(tile_set->map_to_local(r_cell_data.coords));
-						xform = gl_transform * xform;
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-
-						ps->body_attach_object_instance_id(body, tile_map_node ? tile_map_node->get_instance_id() : get_instance_id());
-						ps->body_set_collision_layer(body, physics_layer);
-						ps->body_set_collision_mask(body, physics_mask);
-						ps->body_set_collision_priority(body, physics_priority);
-						ps->body_set_pickable(body, false);
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, tile_data->get_constant_linear_velocity(tile_set_physics_layer));
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, tile_data->get_constant_angular_velocity(tile_set_physics_layer));
-
-						if (physics_material.is_null()) {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
-						} else {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
-						}
+	// Merge the full tiles into rectangles, growing rows of cells then extending them downwards while the rows below are full too.
+	for (uint32_t body_index = 0; body_index < bodies_full_cells.size(); body_index++) {
+		LocalVector<Vector2i> &full_cells = bodies_full_cells[body_index];
+		if (full_cells.is_empty()) {
+			continue;
+		}
+		PhysicsQuadrant::Body &body = bodies[body_index];
 
-						// Clear body's shape if needed.
-						ps->body_clear_shapes(body);
-
-						// Add the shapes to the body.
-						int body_shape_index = 0;
-						for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
-							// Iterate over the polygons.
-							bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
-							float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
-							int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
-							for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
-								// Add decomposed convex shapes.
-								Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index, flip_h, flip_v, transpose);
-								ps->body_add_shape(body, shape->get_rid());
-								ps->body_set_shape_as_one_way_collision(body, body_shape_index, one_way_collision, one_way_collision_margin);
-
-								body_shape_index++;
-							}
-						}
-					}
+		HashSet<Vector2i> remaining_cells;
+		for (const Vector2i &coords : full_cells) {
+			remaining_cells.insert(coords);
+		}
+		full_cells.sort_custom<CellCoordsRowComparator>();
 
-					// Set the body again.
-					r_cell_data.bodies[tile_set_physics_layer] = body;
-				}
+		for (const Vector2i &coords : full_cells) {
+			if (!remaining_cells.has(coords)) {
+				continue;
+			}
 
-				return;
+			Vector2i end_coords = coords;
+			while (remaining_cells.has(Vector2i(end_coords.x + 1, coords.y))) {
+				end_coords.x++;
+			}
+			bool row_full = true;
+			while (row_full) {
+				for (int x = coords.x; x <= end_coords.x; x++) {
+					if (!remaining_cells.has(Vector2i(x, end_coords.y + 1))) {
+						row_full = false;
+						break;
+					}
+				}
+				if (row_full) {
+					end_coords.y++;
+				}
 			}
+			for (int y = coords.y; y <= end_coords.y; y++) {
+				for (int x = coords.x; x <= end_coords.x; x++) {
+					remaining_cells.erase(Vector2i(x, y));
+				}
+			}
+
+			// Counter-clockwise rectangle, as expected by convex polygon shapes.
+			Vector2 begin = tile_set->map_to_local(coords) - tile_size / 2 - p_physics_quadrant->bodies_position;
+			Vector2 end = tile_set->map_to_local(end_coords) + tile_size / 2 - p_physics_quadrant->bodies_position;
+			Vector<Vector2> points = { begin, Vector2(end.x, begin.y), end, Vector2(begin.x, end.y) };
+
+			Ref<ConvexPolygonShape2D> shape;
+			shape.instantiate();
+			shape->set_points(points);
+			ps->body_add_shape(body.rid, shape->get_rid());
+			body.merged_shapes.push_back(shape);
+			body.merged_shapes_coords.push_back(coords);
+			body.shapes_coords.push_back(coords);
+			body.shapes_end_coords.push_back(end_coords);
 		}
 	}
 
-	// If we did not return earlier, clear the cell.
-	_physics_clear_cell(r_cell_data);
+	// Configure the bodies, freeing the ones left without shapes.
+	for (uint32_t body_index = 0; body_index < bodies.size();) {
+		PhysicsQuadrant::Body &body = bodies[body_index];
+		if (body.shapes_coords.is_empty()) {
+			bodies_quadrants.erase(body.rid);
+			ps->free(body.rid);
+			bodies.remove_at_unordered(body_index);
+			continue;
+		}
+
+		Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(body.physics_layer);
+		uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(body.physics_layer);
+		uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(body.physics_layer);
+		real_t physics_priority = tile_set->get_physics_layer_collision_priority(body.physics_layer);
+
+		ps->body_set_mode(body.rid, use_kinematic_bodies ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
+		ps->body_set_space(body.rid, space);
+		ps->body_set_state(body.rid, PhysicsServer2D::BODY_STATE_TRANSFORM, gl_transform * Transform2D(0, p_physics_quadrant->bodies_position));
+
+		ps->body_attach_object_instance_id(body.rid, tile_map_node ? tile_map_node->get_instance_id() : get_instance_id());
+		ps->body_set_collision_layer(body.rid, physics_layer);
+		ps->body_set_collision_mask(body.rid, physics_mask);
+		ps->body_set_collision_priority(body.rid, physics_priority);
+		ps->body_set_pickable(body.rid, false);
+		ps->body_set_state(body.rid, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, body.linear_velocity);
+		ps->body_set_state(body.rid, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, body.angular_velocity);
+
+		if (physics_material.is_null()) {
+			ps->body_set_param(body.rid, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
+			ps->body_set_param(body.rid, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
+		} else {
+			ps->body_set_param(body.rid, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
+			ps->body_set_param(body.rid, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
+		}
+
+		body_index++;
+	}
 }
 
 #ifdef DEBUG_ENABLED
@@ -922,32 +1162,60 @@ void TileMapLayer::_physics_draw_cell_debug(const RID &p_canvas_item, const Vect
 		return;
 	}
 
+	// Check if the collisions are used.
+	if (r_cell_data.physics_quadrant.is_null()) {
+		return;
+	}
+	const TileData *tile_data = _get_cell_data_tile_data(r_cell_data);
+	if (!tile_data) {
+		return;
+	}
+
 	RenderingServer *rs = RenderingServer::get_singleton();
-	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 
 	Color debug_collision_color = get_tree()->get_debug_collisions_color();
 	Vector<Color> color;
 	color.push_back(debug_collision_color);
 
-	Transform2D quadrant_to_local(0, p_quadrant_pos);
-	Transform2D global_to_quadrant = (get_global_transform() * quadrant_to_local).affine_inverse();
+	bool flip_h = (r_cell_data.cell.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_H);
+	bool flip_v = (r_cell_data.cell.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_V);
+	bool transpose = (r_cell_data.cell.alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
+
+	Transform2D cell_to_quadrant;
+	cell_to_quadrant.set_origin(tile_set->map_to_local(r_cell_data.coords) - p_quadrant_pos);
+	Transform2D body_to_quadrant;
+	body_to_quadrant.set_origin(r_cell_data.physics_quadrant->bodies_position - p_quadrant_pos);
 
-	for (RID body : r_cell_data.bodies) {
-		if (body.is_valid()) {
-			Transform2D body_to_quadrant = global_to_quadrant * Transform2D(ps->body_get_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM));
+	Vector2 tile_size = tile_set->get_tile_size();
+	bool can_merge = physics_quadrant_size > 1 && tile_set->get_tile_shape() == TileSet::TILE_SHAPE_SQUARE;
+
+	for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+		if (can_merge && (!transpose || tile_size.x == tile_size.y) && _is_tile_collision_full(tile_data, tile_set_physics_layer, tile_size)) {
+			// The cell was merged with its neighbors, draw the merged shapes starting at this cell.
 			rs->canvas_item_add_set_transform(p_canvas_item, body_to_quadrant);
-			for (int shape_index = 0; shape_index < ps->body_get_shape_count(body); shape_index++) {
-				const RID &shape = ps->body_get_shape(body, shape_index);
-				const PhysicsServer2D::ShapeType &type = ps->shape_get_type(shape);
-				if (type == PhysicsServer2D::SHAPE_CONVEX_POLYGON) {
-					rs->canvas_item_add_polygon(p_canvas_item, ps->shape_get_data(shape), color);
-				} else {
-					WARN_PRINT("Wrong shape type for a tile, should be SHAPE_CONVEX_POLYGON.");
+			for (const PhysicsQuadrant::Body &body : r_cell_data.physics_quadrant->bodies) {
+				if (body.physics_layer != tile_set_physics_layer) {
+					continue;
+				}
+				for (uint32_t merged_shape_index = 0; merged_shape_index < body.merged_shapes.size(); merged_shape_index++) {
+					if (body.merged_shapes_coords[merged_shape_index] == r_cell_data.coords) {
+						rs->canvas_item_add_polygon(p_canvas_item, body.merged_shapes[merged_shape_index]->get_points(), color);
+					}
 				}
 			}
-			rs->canvas_item_add_set_transform(p_canvas_item, Transform2D());
+			continue;
+		}
+
+		rs->canvas_item_add_set_transform(p_canvas_item, cell_to_quadrant);
+		for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
+			for (int shape_index = 0; shape_index < tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index); shape_index++) {
+				Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index, flip_h, flip_v, transpose);
+				rs->canvas_item_add_polygon(p_canvas_item, shape->get_points(), color);
+			}
 		}
 	}
+
+	rs->canvas_item_add_set_transform(p_canvas_item, Transform2D());
 }
 #endif // DEBUG_ENABLED
 
@@ -984,25 +1252,68 @@ void TileMapLayer::_navigation_update(bool p_force_cleanup) {
 		}
 	}
 
-	// ----------- Navigation regions processing -----------
-	if (forced_cleanup) {
-		// Clean everything.
-		for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-			_navigation_clear_cell(kv.value);
+	// ----------- Navigation quadrants processing -----------
+
+	// Check if anything changed that might change the quadrant shape.
+	// If so, recreate everything.
+	bool quadrant_shape_changed = dirty.flags[DIRTY_FLAGS_TILE_SET] || dirty.flags[DIRTY_FLAGS_LAYER_NAVIGATION_QUADRANT_SIZE];
+
+	// Free all quadrants.
+	if (forced_cleanup || quadrant_shape_changed) {
+		for (const KeyValue<Vector2i, Ref<NavigationQuadrant>> &kv : navigation_quadrant_map) {
+			_navigation_clear_quadrant(kv.value);
+			for (SelfList<CellData> *cell_data_list_element = kv.value->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+				cell_data_list_element->self()->navigation_quadrant = Ref<NavigationQuadrant>();
+			}
+			kv.value->cells.clear();
 		}
-	} else {
-		if (_navigation_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_SET] || dirty.flags[DIRTY_FLAGS_LAYER_IN_TREE] || dirty.flags[DIRTY_FLAGS_LAYER_NAVIGATION_MAP]) {
+		navigation_quadrant_map.clear();
+		_navigation_was_cleaned_up = true;
+	}
+
+	if (!forced_cleanup) {
+		// List all quadrants to update, creating new ones if needed.
+		SelfList<NavigationQuadrant>::List dirty_navigation_quadrant_list;
+
+		if (_navigation_was_cleaned_up || dirty.flags[DIRTY_FLAGS_LAYER_IN_TREE]) {
 			// Update all cells.
 			for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-				_navigation_update_cell(kv.value);
+				_navigation_quadrants_update_cell(kv.value, dirty_navigation_quadrant_list);
 			}
 		} else {
 			// Update dirty cells.
 			for (SelfList<CellData> *cell_data_list_element = dirty.cell_list.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
 				CellData &cell_data = *cell_data_list_element->self();
-				_navigation_update_cell(cell_data);
+				_navigation_quadrants_update_cell(cell_data, dirty_navigation_quadrant_list);
 			}
 		}
+
+		// The navigation map is shared by all regions.
+		if (dirty.flags[DIRTY_FLAGS_LAYER_NAVIGATION_MAP]) {
+			for (KeyValue<Vector2i, Ref<NavigationQuadrant>> &kv : navigation_quadrant_map) {
+				if (!kv.value->dirty_quadrant_list_element.in_list()) {
+					dirty_navigation_quadrant_list.add(&kv.value->dirty_quadrant_list_element);
+				}
+			}
+		}
+
+		// Update all dirty quadrants.
+		for (SelfList<NavigationQuadrant> *quadrant_list_element = dirty_navigation_quadrant_list.first(); quadrant_list_element;) {
+			SelfList<NavigationQuadrant> *next_quadrant_list_element = quadrant_list_element->next(); // "Hack" to clear the list while iterating.
+
+			Ref<NavigationQuadrant> navigation_quadrant = quadrant_list_element->self();
+			if (navigation_quadrant->cells.first()) {
+				_navigation_update_quadrant(navigation_quadrant);
+			} else {
+				// Free the quadrant.
+				_navigation_clear_quadrant(navigation_quadrant);
+				navigation_quadrant_map.erase(navigation_quadrant->quadrant_coords);
+			}
+
+			quadrant_list_element = next_quadrant_list_element;
+		}
+
+		dirty_navigation_quadrant_list.clear();
 	}
 
 	// -----------
@@ -1014,109 +1325,159 @@ void TileMapLayer::_navigation_notification(int p_what) {
 	if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
 		if (tile_set.is_valid()) {
 			Transform2D tilemap_xform = get_global_transform();
-			for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-				const CellData &cell_data = kv.value;
+			for (const KeyValue<Vector2i, Ref<NavigationQuadrant>> &kv : navigation_quadrant_map) {
 				// Update navigation regions transform.
-				for (const RID &region : cell_data.navigation_regions) {
+				Transform2D quadrant_transform(0, kv.value->regions_position);
+				for (const RID &region : kv.value->regions) {
 					if (!region.is_valid()) {
 						continue;
 					}
-					Transform2D tile_transform;
-					tile_transform.set_origin(tile_set->map_to_local(kv.key));
-					NavigationServer2D::get_singleton()->region_set_transform(region, tilemap_xform * tile_transform);
+					NavigationServer2D::get_singleton()->region_set_transform(region, tilemap_xform * quadrant_transform);
 				}
 			}
 		}
 	}
 }
 
-void TileMapLayer::_navigation_clear_cell(CellData &r_cell_data) {
+void TileMapLayer::_navigation_quadrants_update_cell(CellData &r_cell_data, SelfList<NavigationQuadrant>::List &r_dirty_navigation_quadrant_list) {
+	// Remove the cell from its old quadrant, marking it as dirty.
+	if (r_cell_data.navigation_quadrant.is_valid()) {
+		if (!r_cell_data.navigation_quadrant->dirty_quadrant_list_element.in_list()) {
+			r_dirty_navigation_quadrant_list.add(&r_cell_data.navigation_quadrant->dirty_quadrant_list_element);
+		}
+		if (r_cell_data.navigation_quadrant_list_element.in_list()) {
+			r_cell_data.navigation_quadrant->cells.remove(&r_cell_data.navigation_quadrant_list_element);
+		}
+		r_cell_data.navigation_quadrant = Ref<NavigationQuadrant>();
+	}
+
+	if (!_get_cell_data_tile_data(r_cell_data)) {
+		return;
+	}
+
+	Vector2i quadrant_coords = _coords_to_quadrant_coords(r_cell_data.coords, navigation_quadrant_size);
+	Ref<NavigationQuadrant> navigation_quadrant;
+	if (navigation_quadrant_map.has(quadrant_coords)) {
+		// Reuse existing navigation quadrant.
+		navigation_quadrant = navigation_quadrant_map[quadrant_coords];
+	} else {
+		// Create a new navigation quadrant.
+		navigation_quadrant.instantiate();
+		navigation_quadrant->quadrant_coords = quadrant_coords;
+		navigation_quadrant->regions_position = tile_set->map_to_local(navigation_quadrant_size * quadrant_coords);
+		navigation_quadrant_map[quadrant_coords] = navigation_quadrant;
+	}
+
+	// Add the cell to its new quadrant, and mark it as dirty.
+	r_cell_data.navigation_quadrant = navigation_quadrant;
+	navigation_quadrant->cells.add(&r_cell_data.navigation_quadrant_list_element);
+	if (!navigation_quadrant->dirty_quadrant_list_element.in_list()) {
+		r_dirty_navigation_quadrant_list.add(&navigation_quadrant->dirty_quadrant_list_element);
+	}
+}
+
+void TileMapLayer::_navigation_clear_quadrant(const Ref<NavigationQuadrant> &p_navigation_quadrant) {
 	NavigationServer2D *ns = NavigationServer2D::get_singleton();
 	// Clear navigation shapes.
-	for (uint32_t i = 0; i < r_cell_data.navigation_regions.size(); i++) {
-		const RID &region = r_cell_data.navigation_regions[i];
+	for (const RID &region : p_navigation_quadrant->regions) {
 		if (region.is_valid()) {
 			ns->region_set_map(region, RID());
 			ns->free(region);
 		}
 	}
-	r_cell_data.navigation_regions.clear();
+	p_navigation_quadrant->regions.clear();
 }
 
-void TileMapLayer::_navigation_update_cell(CellData &r_cell_data) {
+void TileMapLayer::_navigation_update_quadrant(const Ref<NavigationQuadrant> &p_navigation_quadrant) {
 	NavigationServer2D *ns = NavigationServer2D::get_singleton();
 	Transform2D gl_xform = get_global_transform();
 	RID navigation_map = navigation_map_override.is_valid() ? navigation_map_override : get_world_2d()->get_navigation_map();
 	ERR_FAIL_COND(navigation_map.is_null());
 
-	// Get the navigation polygons and create regions.
-	TileMapCell &c = r_cell_data.cell;
-
-	TileSetSource *source;
-	if (tile_set->has_source(c.source_id)) {
-		source = *tile_set->get_source(c.source_id);
+	LocalVector<RID> &regions = p_navigation_quadrant->regions;
 
-		if (source->has_tile(c.get_atlas_coords()) && source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
-			TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
-			if (atlas_source) {
-				const TileData *tile_data;
-				if (r_cell_data.runtime_tile_data_cache) {
-					tile_data = r_cell_data.runtime_tile_data_cache;
-				} else {
-					tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
-				}
+	// Free unused regions then resize the regions array.
+	for (uint32_t i = tile_set->get_navigation_layers_count(); i < regions.size(); i++) {
+		RID &region = regions[i];
+		if (region.is_valid()) {
+			ns->region_set_map(region, RID());
+			ns->free(region);
+			region = RID();
+		}
+	}
+	regions.resize(tile_set->get_navigation_layers_count());
 
-				// Transform flags.
-				bool flip_h = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_H);
-				bool flip_v = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_V);
-				bool transpose = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
-
-				// Free unused regions then resize the regions array.
-				for (uint32_t i = tile_set->get_navigation_layers_count(); i < r_cell_data.navigation_regions.size(); i++) {
-					RID &region = r_cell_data.navigation_regions[i];
-					if (region.is_valid()) {
-						ns->region_set_map(region, RID());
-						ns->free(region);
-						region = RID();
-					}
-				}
-				r_cell_data.navigation_regions.resize(tile_set->get_navigation_layers_count());
+	// Create, update or clear regions.
+	for (uint32_t navigation_layer_index = 0; navigation_layer_index < regions.size(); navigation_layer_index++) {
+		// Merge the navigation polygons of the cells, sharing the vertices on their common edges.
+		Vector<Vector2> vertices;
+		Vector<Vector<int>> polygons;
+		HashMap<Vector2, int> vertices_indices;
+		real_t cell_size = NavigationDefaults2D::navmesh_cell_size;
 
-				// Create, update or clear regions.
-				for (uint32_t navigation_layer_index = 0; navigation_layer_index < r_cell_data.navigation_regions.size(); navigation_layer_index++) {
-					Ref<NavigationPolygon> navigation_polygon = tile_data->get_navigation_polygon(navigation_layer_index, flip_h, flip_v, transpose);
+		for (SelfList<CellData> *cell_data_list_element = p_navigation_quadrant->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+			const CellData &cell_data = *cell_data_list_element->self();
+			const TileData *tile_data = _get_cell_data_tile_data(cell_data);
 
-					RID &region = r_cell_data.navigation_regions[navigation_layer_index];
+			// Transform flags.
+			bool flip_h = (cell_data.cell.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_H);
+			bool flip_v = (cell_data.cell.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_V);
+			bool transpose = (cell_data.cell.alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
 
-					if (navigation_polygon.is_valid() && (navigation_polygon->get_polygon_count() > 0 || navigation_polygon->get_outline_count() > 0)) {
-						// Create or update regions.
-						Transform2D tile_transform;
-						tile_transform.set_origin(tile_set->map_to_local(r_cell_data.coords));
-						if (!region.is_valid()) {
-							region = ns->region_create();
-						}
-						ns->region_set_owner_id(region, tile_map_node ? tile_map_node->get_instance_id() : get_instance_id());
-						ns->region_set_map(region, navigation_map);
-						ns->region_set_transform(region, gl_xform * tile_transform);
-						ns->region_set_navigation_layers(region, tile_set->get_navigation_layer_layers(navigation_layer_index));
-						ns->region_set_navigation_polygon(region, navigation_polygon);
+			Ref<NavigationPolygon> navigation_polygon = tile_data->get_navigation_polygon(navigation_layer_index, flip_h, flip_v, transpose);
+			if (navigation_polygon.is_null()) {
+				continue;
+			}
+			cell_size = navigation_polygon->get_cell_size();
+
+			Vector<Vector2> navigation_polygon_vertices = navigation_polygon->get_vertices();
+			Vector2 cell_position = tile_set->map_to_local(cell_data.coords) - p_navigation_quadrant->regions_position;
+			for (int i = 0; i < navigation_polygon->get_polygon_count(); i++) {
+				Vector<int> polygon = navigation_polygon->get_polygon(i);
+				int *polygon_ptrw = polygon.ptrw();
+				for (int j = 0; j < polygon.size(); j++) {
+					ERR_FAIL_INDEX(polygon_ptrw[j], navigation_polygon_vertices.size());
+					Vector2 vertex = navigation_polygon_vertices[polygon_ptrw[j]] + cell_position;
+					const int *vertex_index = vertices_indices.getptr(vertex);
+					if (vertex_index) {
+						polygon_ptrw[j] = *vertex_index;
 					} else {
-						// Clear region.
-						if (region.is_valid()) {
-							ns->region_set_map(region, RID());
-							ns->free(region);
-							region = RID();
-						}
+						polygon_ptrw[j] = vertices.size();
+						vertices_indices.insert(vertex, vertices.size());
+						vertices.push_back(vertex);
 					}
 				}
+				polygons.push_back(polygon);
+			}
+		}
 
-				return;
+		RID &region = regions[navigation_layer_index];
+
+		if (!polygons.is_empty()) {
+			// Create or update regions.
+			Ref<NavigationPolygon> navigation_polygon;
+			navigation_polygon.instantiate();
+			navigation_polygon->set_cell_size(cell_size);
+			navigation_polygon->set_vertices(vertices);
+			navigation_polygon->set_polygons(polygons);
+
+			if (!region.is_valid()) {
+				region = ns->region_create();
+			}
+			ns->region_set_owner_id(region, tile_map_node ? tile_map_node->get_instance_id() : get_instance_id());
+			ns->region_set_map(region, navigation_map);
+			ns->region_set_transform(region, gl_xform * Transform2D(0, p_navigation_quadrant->regions_position));
+			ns->region_set_navigation_layers(region, tile_set->get_navigation_layer_layers(navigation_layer_index));
+			ns->region_set_navigation_polygon(region, navigation_polygon);
+		} else {
+			// Clear region.
+			if (region.is_valid()) {
+				ns->region_set_map(region, RID());
+				ns->free(region);
+				region = RID();
 			}
 		}
 	}
-
-	// If we did not return earlier, clear the cell.
-	_navigation_clear_cell(r_cell_data);
 }
 
 #ifdef DEBUG_ENABLED
@@ -1139,7 +1500,7 @@ void TileMapLayer::_navigation_draw_cell_debug(const RID &p_canvas_item, const V
 	}
 
 	// Check if the navigation is used.
-	if (r_cell_data.navigation_regions.is_empty()) {
+	if (r_cell_data.navigation_quadrant.is_null()) {
 		return;
 	}
 
@@ -1478,92 +1839,139 @@ void TileMapLayer::_update_cells_callback(bool p_force_cleanup) {
 	GDVIRTUAL_CALL(_update_cells, dirty_cell_positions, forced_cleanup);
 }
 
-TileSet::TerrainsPattern TileMapLayer::_get_best_terrain_pattern_for_constraints(int p_terrain_set, const Vector2i &p_position, const RBSet<TerrainConstraint> &p_constraints, TileSet::TerrainsPattern p_current_pattern) const {
-	if (tile_set.is_null()) {
-		return TileSet::TerrainsPattern();
+const TileData *TileMapLayer::_get_cell_terrains_tile_data(const Vector2i &p_coords, int p_terrain_set) const {
+	TileMapCell cell = get_cell(p_coords);
+	if (cell.source_id == TileSet::INVALID_SOURCE) {
+		return nullptr;
 	}
-	// Returns all tiles compatible with the given constraints.
-	RBMap<TileSet::TerrainsPattern, int> terrain_pattern_score;
-	RBSet<TileSet::TerrainsPattern> pattern_set = tile_set->get_terrains_pattern_set(p_terrain_set);
-	ERR_FAIL_COND_V(pattern_set.is_empty(), TileSet::TerrainsPattern());
-	for (TileSet::TerrainsPattern &terrain_pattern : pattern_set) {
-		int score = 0;
+	TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(tile_set->get_source(cell.source_id).ptr());
+	if (!atlas_source) {
+		return nullptr;
+	}
+	const TileData *tile_data = atlas_source->get_tile_data(cell.get_atlas_coords(), cell.alternative_tile);
+	if (!tile_data || tile_data->get_terrain_set() != p_terrain_set) {
+		return nullptr;
+	}
+	return tile_data;
+}
 
-		// Check the center bit constraint.
-		TerrainConstraint terrain_constraint = TerrainConstraint(tile_set, p_position, terrain_pattern.get_terrain());
-		const RBSet<TerrainConstraint>::Element *in_set_constraint_element = p_constraints.find(terrain_constraint);
-		if (in_set_constraint_element) {
-			if (in_set_constraint_element->get().get_terrain() != terrain_constraint.get_terrain()) {
-				score += in_set_constraint_element->get().get_priority();
+void TileMapLayer::_read_terrains_cell(uint32_t p_index, TerrainsCellsRead *p_read) const {
+	p_read->tile_data[p_index] = _get_cell_terrains_tile_data(p_read->coords[p_index], p_read->terrain_set);
+}
+
+void TileMapLayer::_read_terrains_painted_constraint(uint32_t p_index, TerrainsPaintedConstraints *p_painted_constraints) const {
+	HashMap<int, int> terrain_count;
+
+	// Count the number of occurrences per terrain.
+	HashMap<Vector2i, TileSet::CellNeighbor> overlapping_terrain_bits = p_painted_constraints->constraints[p_index].get_overlapping_coords_and_peering_bits();
+	for (const KeyValue<Vector2i, TileSet::CellNeighbor> &E_overlapping : overlapping_terrain_bits) {
+		const TileData *neighbor_tile_data = _get_cell_terrains_tile_data(E_overlapping.key, p_painted_constraints->terrain_set);
+		int terrain = neighbor_tile_data ? neighbor_tile_data->get_terrain_peering_bit(TileSet::CellNeighbor(E_overlapping.value)) : -1;
+		if (!p_painted_constraints->ignore_empty_terrains || terrain >= 0) {
+			if (!terrain_count.has(terrain)) {
+				terrain_count[terrain] = 0;
 			}
-		} else if (p_current_pattern.get_terrain() != terrain_pattern.get_terrain()) {
-			continue; // Ignore a pattern that cannot keep bits without constraints unmodified.
+			terrain_count[terrain] += 1;
 		}
+	}
 
-		// Check the surrounding bits
-		bool invalid_pattern = false;
-		for (int i = 0; i < TileSet::CELL_NEIGHBOR_MAX; i++) {
-			TileSet::CellNeighbor bit = TileSet::CellNeighbor(i);
-			if (tile_set->is_valid_terrain_peering_bit(p_terrain_set, bit)) {
-				// Check if the bit is compatible with the constraints.
-				TerrainConstraint terrain_bit_constraint = TerrainConstraint(tile_set, p_position, bit, terrain_pattern.get_terrain_peering_bit(bit));
-				in_set_constraint_element = p_constraints.find(terrain_bit_constraint);
-				if (in_set_constraint_element) {
-					if (in_set_constraint_element->get().get_terrain() != terrain_bit_constraint.get_terrain()) {
-						score += in_set_constraint_element->get().get_priority();
-					}
-				} else if (p_current_pattern.get_terrain_peering_bit(bit) != terrain_pattern.get_terrain_peering_bit(bit)) {
-					invalid_pattern = true; // Ignore a pattern that cannot keep bits without constraints unmodified.
-					break;
-				}
-			}
+	// Get the terrain with the max number of occurrences.
+	int max = 0;
+	int max_terrain = -2;
+	for (const KeyValue<int, int> &E_terrain_count : terrain_count) {
+		if (E_terrain_count.value > max) {
+			max = E_terrain_count.value;
+			max_terrain = E_terrain_count.key;
 		}
-		if (invalid_pattern) {
-			continue;
+	}
+	p_painted_constraints->terrains[p_index] = max_terrain;
+}
+
+void TileMapLayer::_get_terrains_cell_slots(const Vector2i &p_position, const TileSet::TerrainsLookup &p_lookup, TerrainsCellSlots &r_slots) const {
+	r_slots.base_cell_coords[0] = p_position;
+	r_slots.bits[0] = 0;
+	for (uint32_t i = 0; i < p_lookup.peering_bits.size(); i++) {
+		TerrainConstraint::get_base_cell_coords_and_bit(*tile_set, p_position, p_lookup.peering_bits[i], r_slots.base_cell_coords[i + 1], r_slots.bits[i + 1]);
+	}
+}
+
+TileSet::TerrainsPattern TileMapLayer::_get_best_terrain_pattern_for_constraints(const TileSet::TerrainsLookup &p_lookup, const TerrainsCellSlots &p_slots, const TerrainConstraintsGrid &p_constraints, const TileSet::TerrainsPattern &p_current_pattern) const {
+	ERR_FAIL_COND_V(p_lookup.patterns.is_empty(), TileSet::TerrainsPattern());
+	const uint32_t slots_count = 1 + p_lookup.peering_bits.size();
+
+	// Gather the constraints on the cell, and the pattern matching them while keeping the bits without constraints unmodified.
+	const TerrainConstraintsGrid::Constraint *constraints[1 + TileSet::CELL_NEIGHBOR_MAX];
+	int current_terrains[1 + TileSet::CELL_NEIGHBOR_MAX];
+	TileSet::TerrainsPattern matching_pattern = p_current_pattern;
+	bool all_prioritized = true;
+	for (uint32_t slot = 0; slot < slots_count; slot++) {
+		constraints[slot] = p_constraints.get(p_slots.base_cell_coords[slot], p_slots.bits[slot]);
+		current_terrains[slot] = slot == 0 ? p_current_pattern.get_terrain() : p_current_pattern.get_terrain_peering_bit(p_lookup.peering_bits[slot - 1]);
+		if (constraints[slot]) {
+			all_prioritized = all_prioritized && constraints[slot]->priority > 0;
+			if (slot == 0) {
+				matching_pattern.set_terrain(constraints[slot]->terrain);
+			} else {
+				matching_pattern.set_terrain_peering_bit(p_lookup.peering_bits[slot - 1], constraints[slot]->terrain);
+			}
 		}
+	}
 
-		terrain_pattern_score[terrain_pattern] = score;
+	// With only prioritized constraints, the matching pattern is the only one with a score of 0.
+	if (all_prioritized) {
+		HashMap<TileSet::TerrainsPattern, int, TileSet::TerrainsPatternHasher>::ConstIterator E = p_lookup.pattern_indices.find(matching_pattern);
+		if (E) {
+			return p_lookup.patterns[E->value];
+		}
 	}
 
-	// Compute the minimum score.
-	TileSet::TerrainsPattern min_score_pattern = p_current_pattern;
+	// Otherwise, find the pattern with the minimum score, ignoring the ones that cannot keep bits without constraints unmodified.
 	int min_score = INT32_MAX;
-	for (KeyValue<TileSet::TerrainsPattern, int> E : terrain_pattern_score) {
-		if (E.value < min_score) {
-			min_score_pattern = E.key;
-			min_score = E.value;
+	int min_score_pattern_index = -1;
+	for (uint32_t pattern_index = 0; pattern_index < p_lookup.patterns.size(); pattern_index++) {
+		const int *pattern_terrains = &p_lookup.patterns_terrains[pattern_index * slots_count];
+		int score = 0;
+		bool invalid_pattern = false;
+		for (uint32_t slot = 0; slot < slots_count; slot++) {
+			if (constraints[slot]) {
+				if (constraints[slot]->terrain != pattern_terrains[slot]) {
+					score += constraints[slot]->priority;
+				}
+			} else if (current_terrains[slot] != pattern_terrains[slot]) {
+				invalid_pattern = true;
+				break;
+			}
+		}
+		if (!invalid_pattern && score < min_score) {
+			min_score = score;
+			min_score_pattern_index = pattern_index;
 		}
 	}
 
-	return min_score_pattern;
+	return min_score_pattern_index >= 0 ? p_lookup.patterns[min_score_pattern_index] : p_current_pattern;
 }
 
-RBSet<TerrainConstraint> TileMapLayer::_get_terrain_constraints_from_added_pattern(const Vector2i &p_position, int p_terrain_set, TileSet::TerrainsPattern p_terrains_pattern) const {
+void TileMapLayer::_add_terrain_constraints_from_added_pattern(const Vector2i &p_position, int p_terrain_set, const TileSet::TerrainsPattern &p_terrains_pattern, int p_priority, TerrainConstraintsGrid &r_constraints) const {
 	if (tile_set.is_null()) {
-		return RBSet<TerrainConstraint>();
+		return;
 	}
 
 	// Compute the constraints needed from the surrounding tiles.
-	RBSet<TerrainConstraint> output;
-	output.insert(TerrainConstraint(tile_set, p_position, p_terrains_pattern.get_terrain()));
-
-	for (uint32_t i = 0; i < TileSet::CELL_NEIGHBOR_MAX; i++) {
-		TileSet::CellNeighbor side = TileSet::CellNeighbor(i);
-		if (tile_set->is_valid_terrain_peering_bit(p_terrain_set, side)) {
-			TerrainConstraint c = TerrainConstraint(tile_set, p_position, side, p_terrains_pattern.get_terrain_peering_bit(side));
-			output.insert(c);
-		}
+	const TileSet::TerrainsLookup &lookup = tile_set->get_terrains_lookup(p_terrain_set);
+	TerrainsCellSlots slots;
+	_get_terrains_cell_slots(p_position, lookup, slots);
+	r_constraints.insert(slots.base_cell_coords[0], slots.bits[0], p_terrains_pattern.get_terrain(), p_priority);
+	for (uint32_t i = 0; i < lookup.peering_bits.size(); i++) {
+		r_constraints.insert(slots.base_cell_coords[i + 1], slots.bits[i + 1], p_terrains_pattern.get_terrain_peering_bit(lookup.peering_bits[i]), p_priority);
 	}
-
-	return output;
 }
 
-RBSet<TerrainConstraint> TileMapLayer::_get_terrain_constraints_from_painted_cells_list(const RBSet<Vector2i> &p_painted, int p_terrain_set, bool p_ignore_empty_terrains) const {
+void TileMapLayer::_add_terrain_constraints_from_painted_cells_list(const RBSet<Vector2i> &p_painted, int p_terrain_set, bool p_ignore_empty_terrains, TerrainConstraintsGrid &r_constraints) const {
 	if (tile_set.is_null()) {
-		return RBSet<TerrainConstraint>();
+		return;
 	}
 
-	ERR_FAIL_INDEX_V(p_terrain_set, tile_set->get_terrain_sets_count(), RBSet<TerrainConstraint>());
+	ERR_FAIL_INDEX(p_terrain_set, tile_set->get_terrain_sets_count());
 
 	// Build a set of dummy constraints to get the constrained points.
 	RBSet<TerrainConstraint> dummy_constraints;
@@ -1576,96 +1984,382 @@ RBSet<TerrainConstraint> TileMapLayer::_get_terrain_constraints_from_painted_cel
 		}
 	}
 
-	// For each constrained point, we get all overlapping tiles, and select the most adequate terrain for it.
-	RBSet<TerrainConstraint> constraints;
-	for (const TerrainConstraint &E_constraint : dummy_constraints) {
-		HashMap<int, int> terrain_count;
-
-		// Count the number of occurrences per terrain.
-		HashMap<Vector2i, TileSet::CellNeighbor> overlapping_terrain_bits = E_constraint.get_overlapping_coords_and_peering_bits();
-		for (const KeyValue<Vector2i, TileSet::CellNeighbor> &E_overlapping : overlapping_terrain_bits) {
-			TileData *neighbor_tile_data = nullptr;
-			TileMapCell neighbor_cell = get_cell(E_overlapping.key);
-			if (neighbor_cell.source_id != TileSet::INVALID_SOURCE) {
-				Ref<TileSetSource> source = tile_set->get_source(neighbor_cell.source_id);
-				Ref<TileSetAtlasSource> atlas_source = source;
-				if (atlas_source.is_valid()) {
-					TileData *tile_data = atlas_source->get_tile_data(neighbor_cell.get_atlas_coords(), neighbor_cell.alternative_tile);
-					if (tile_data && tile_data->get_terrain_set() == p_terrain_set) {
-						neighbor_tile_data = tile_data;
-					}
-				}
-			}
+	// For each constrained point, we get all overlapping tiles, and select the most adequate terrain for it.
+	TerrainsPaintedConstraints painted_constraints;
+	painted_constraints.terrain_set = p_terrain_set;
+	painted_constraints.ignore_empty_terrains = p_ignore_empty_terrains;
+	painted_constraints.constraints.reserve(dummy_constraints.size());
+	for (const TerrainConstraint &E_constraint : dummy_constraints) {
+		painted_constraints.constraints.push_back(E_constraint);
+	}
+	painted_constraints.terrains.resize(painted_constraints.constraints.size());
+	if (painted_constraints.constraints.size() >= TERRAINS_THREADED_READ_THRESHOLD) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &TileMapLayer::_read_terrains_painted_constraint, &painted_constraints, painted_constraints.constraints.size(), -1, true, SNAME("TileMapLayerReadTerrainsConstraints"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < painted_constraints.constraints.size(); i++) {
+			_read_terrains_painted_constraint(i, &painted_constraints);
+		}
+	}
+
+	// Set the adequate terrain.
+	for (uint32_t i = 0; i < painted_constraints.constraints.size(); i++) {
+		if (painted_constraints.terrains[i] != -2) {
+			const TerrainConstraint &c = painted_constraints.constraints[i];
+			r_constraints.insert(c.get_base_cell_coords(), c.get_bit(), painted_constraints.terrains[i], c.get_priority());
+		}
+	}
+
+	// Add the centers as constraints.
+	for (const Vector2i &E_coords : p_painted) {
+		const TileData *tile_data = _get_cell_terrains_tile_data(E_coords, p_terrain_set);
+		int terrain = tile_data ? tile_data->get_terrain() : -1;
+		if (!p_ignore_empty_terrains || terrain >= 0) {
+			r_constraints.insert(E_coords, 0, terrain, 1);
+		}
+	}
+}
+
+void TileMapLayer::_tile_set_changed() {
+	dirty.flags[DIRTY_FLAGS_TILE_SET] = true;
+	_queue_internal_update();
+	emit_signal(CoreStringName(changed));
+}
+
+void TileMapLayer::_renamed() {
+	emit_signal(CoreStringName(changed));
+}
+
+void TileMapLayer::_update_notify_local_transform() {
+	bool notify = is_using_kinematic_bodies() || is_y_sort_enabled();
+	if (!notify) {
+		if (is_y_sort_enabled()) {
+			notify = true;
+		}
+	}
+	set_notify_local_transform(notify);
+}
+
+uint32_t TileMapLayer::CellChunk::_find_sparse_position(int p_index) const {
+	// Binary search of the first used cell with an index not smaller than p_index.
+	uint32_t low = 0;
+	uint32_t high = sparse_indices.size();
+	while (low < high) {
+		uint32_t middle = (low + high) / 2;
+		if (sparse_indices[middle] < p_index) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	return low;
+}
+
+TileMapCell TileMapLayer::CellChunk::get_cell(int p_index) const {
+	if (dense) {
+		return cells[p_index];
+	}
+	uint32_t position = _find_sparse_position(p_index);
+	if (position < sparse_indices.size() && sparse_indices[position] == p_index) {
+		return cells[position];
+	}
+	return TileMapCell();
+}
+
+void TileMapLayer::CellChunk::set_cell(int p_index, const TileMapCell &p_cell) {
+	bool used = p_cell.source_id != TileSet::INVALID_SOURCE;
+
+	if (dense) {
+		TileMapCell &c = cells[p_index];
+		bool was_used = c.source_id != TileSet::INVALID_SOURCE;
+		c = p_cell;
+		if (used == was_used) {
+			return;
+		}
+		if (used) {
+			used_cells_count++;
+			return;
+		}
+		used_cells_count--;
+
+		if (used_cells_count < CELL_CHUNK_DENSE_THRESHOLD / 2) {
+			// Only store the used cells.
+			LocalVector<TileMapCell> used_cells;
+			used_cells.reserve(used_cells_count);
+			sparse_indices.reserve(used_cells_count);
+			for (uint32_t i = 0; i < cells.size(); i++) {
+				if (cells[i].source_id != TileSet::INVALID_SOURCE) {
+					used_cells.push_back(cells[i]);
+					sparse_indices.push_back(i);
+				}
+			}
+			cells = std::move(used_cells);
+			dense = false;
+		}
+		return;
+	}
+
+	uint32_t position = _find_sparse_position(p_index);
+	if (position < sparse_indices.size() && sparse_indices[position] == p_index) {
+		if (used) {
+			cells[position] = p_cell;
+		} else {
+			cells.remove_at(position);
+			sparse_indices.remove_at(position);
+			used_cells_count--;
+		}
+		return;
+	}
+	if (!used) {
+		return; // Nothing to do, the cell is already empty.
+	}
+
+	used_cells_count++;
+	if (used_cells_count > CELL_CHUNK_DENSE_THRESHOLD) {
+		// Store all the cells.
+		LocalVector<TileMapCell> all_cells;
+		all_cells.resize(CELL_CHUNK_SIZE * CELL_CHUNK_SIZE);
+		for (uint32_t i = 0; i < sparse_indices.size(); i++) {
+			all_cells[sparse_indices[i]] = cells[i];
+		}
+		all_cells[p_index] = p_cell;
+		cells = std::move(all_cells);
+		sparse_indices.reset();
+		dense = true;
+		return;
+	}
+	cells.insert(position, p_cell);
+	sparse_indices.insert(position, p_index);
+}
+
+TileMapLayer::CellChunk *TileMapLayer::_get_cell_chunk(const Vector2i &p_chunk_coords, bool p_create) {
+	HashMap<Vector2i, CellChunk>::Iterator E = cell_chunks.find(p_chunk_coords);
+	if (E) {
+		return &E->value;
+	}
+
+	// Chunks saved to disk are loaded back as soon as they are modified.
+	if (_load_cell_chunk(p_chunk_coords)) {
+		return cell_chunks.getptr(p_chunk_coords);
+	}
+
+	if (!p_create) {
+		return nullptr;
+	}
+	E = cell_chunks.insert(p_chunk_coords, CellChunk());
+	E->value.active = _is_cell_chunk_streamed_in(p_chunk_coords);
+	return &E->value;
+}
+
+void TileMapLayer::_set_cell_chunk_active(const Vector2i &p_chunk_coords, CellChunk &r_chunk, bool p_active) {
+	if (r_chunk.active == p_active) {
+		return;
+	}
+	r_chunk.active = p_active;
+
+	if (r_chunk.used_cells_count == 0) {
+		return;
+	}
+	r_chunk.for_each_used_cell([&](int p_index, const TileMapCell &p_cell) {
+		// Deactivated cells are set as empty, their runtime data is freed by the next update.
+		_set_cell_data(_get_cell_chunk_cell_coords(p_chunk_coords, p_index), p_active ? p_cell : TileMapCell());
+	});
+	_queue_internal_update();
+}
+
+void TileMapLayer::_set_cell_data(const Vector2i &p_coords, const TileMapCell &p_cell) {
+	CellDataMap::Iterator E = tile_map_layer_data.find(p_coords);
+	if (!E) {
+		if (p_cell.source_id == TileSet::INVALID_SOURCE) {
+			return; // Nothing to do, the tile is already empty.
+		}
+
+		// Insert a new cell in the tile map.
+		CellData new_cell_data;
+		new_cell_data.coords = p_coords;
+		E = tile_map_layer_data.insert(p_coords, new_cell_data);
+	} else if (E->value.cell == p_cell) {
+		return; // Nothing changed.
+	}
+
+	E->value.cell = p_cell;
+
+	// Make the given cell dirty.
+	if (!E->value.dirty_list_element.in_list()) {
+		dirty.cell_list.add(&(E->value.dirty_list_element));
+	}
+}
+
+bool TileMapLayer::_is_cell_chunk_streamed_in(const Vector2i &p_chunk_coords) const {
+	if (!cell_streaming_enabled) {
+		return true;
+	}
+	Vector2i offset = (p_chunk_coords - _coords_to_cell_chunk_coords(cell_streaming_focus)).abs();
+	return MAX(offset.x, offset.y) <= cell_streaming_radius;
+}
 
-			int terrain = neighbor_tile_data ? neighbor_tile_data->get_terrain_peering_bit(TileSet::CellNeighbor(E_overlapping.value)) : -1;
-			if (!p_ignore_empty_terrains || terrain >= 0) {
-				if (!terrain_count.has(terrain)) {
-					terrain_count[terrain] = 0;
-				}
-				terrain_count[terrain] += 1;
-			}
-		}
+String TileMapLayer::_get_cell_chunk_file_path(const Vector2i &p_chunk_coords) const {
+	return cell_streaming_session_path.path_join(vformat("chunk_%d_%d.bin", p_chunk_coords.x, p_chunk_coords.y));
+}
 
-		// Get the terrain with the max number of occurrences.
-		int max = 0;
-		int max_terrain = -1;
-		for (const KeyValue<int, int> &E_terrain_count : terrain_count) {
-			if (E_terrain_count.value > max) {
-				max = E_terrain_count.value;
-				max_terrain = E_terrain_count.key;
-			}
-		}
+bool TileMapLayer::_read_cell_chunk_file(const Vector2i &p_chunk_coords, CellChunk &r_chunk) const {
+	const uint32_t *used_cells_count = cell_chunks_on_disk.getptr(p_chunk_coords);
+	if (!used_cells_count) {
+		return false;
+	}
+
+	String path = _get_cell_chunk_file_path(p_chunk_coords);
+	Ref<FileAccess> file = FileAccess::open_compressed(path, FileAccess::READ, FileAccess::COMPRESSION_ZSTD);
+	ERR_FAIL_COND_V_MSG(file.is_null(), false, vformat("Cannot open TileMapLayer chunk file \"%s\".", path));
+
+	// Only accept the file written for this chunk, by this layer, during this session.
+	bool valid = file->get_32() == CELL_CHUNK_FILE_MAGIC;
+	valid = valid && file->get_16() == CELL_CHUNK_SIZE;
+	valid = valid && file->get_64() == cell_streaming_session_id;
+	valid = valid && (int32_t)file->get_32() == p_chunk_coords.x;
+	valid = valid && (int32_t)file->get_32() == p_chunk_coords.y;
+	valid = valid && file->get_32() == *used_cells_count;
+	ERR_FAIL_COND_V_MSG(!valid, false, vformat("Invalid TileMapLayer chunk file \"%s\".", path));
+
+	// Read into a separate chunk, so that nothing is modified if the file is truncated.
+	CellChunk chunk;
+	for (uint32_t i = 0; i < *used_cells_count; i++) {
+		int index = file->get_16();
+		TileMapCell c;
+		c.source_id = file->get_16();
+		c.coord_x = file->get_16();
+		c.coord_y = file->get_16();
+		c.alternative_tile = file->get_16();
+		ERR_FAIL_COND_V_MSG(index >= CELL_CHUNK_SIZE * CELL_CHUNK_SIZE || c.source_id == TileSet::INVALID_SOURCE, false, vformat("Invalid TileMapLayer chunk file \"%s\".", path));
+		chunk.set_cell(index, c);
+	}
+	ERR_FAIL_COND_V_MSG(file->get_error() != OK || chunk.used_cells_count != *used_cells_count, false, vformat("Error while reading TileMapLayer chunk file \"%s\".", path));
+
+	r_chunk = chunk;
+	return true;
+}
 
-		// Set the adequate terrain.
-		if (max > 0) {
-			TerrainConstraint c = E_constraint;
-			c.set_terrain(max_terrain);
-			constraints.insert(c);
-		}
+bool TileMapLayer::_load_cell_chunk(const Vector2i &p_chunk_coords) {
+	CellChunk chunk;
+	if (!_read_cell_chunk_file(p_chunk_coords, chunk)) {
+		return false;
 	}
 
-	// Add the centers as constraints.
-	for (Vector2i E_coords : p_painted) {
-		TileData *tile_data = nullptr;
-		TileMapCell cell = get_cell(E_coords);
-		if (cell.source_id != TileSet::INVALID_SOURCE) {
-			Ref<TileSetSource> source = tile_set->get_source(cell.source_id);
-			Ref<TileSetAtlasSource> atlas_source = source;
-			if (atlas_source.is_valid()) {
-				tile_data = atlas_source->get_tile_data(cell.get_atlas_coords(), cell.alternative_tile);
-			}
-		}
+	// The chunk now lives in memory only.
+	DirAccess::remove_absolute(_get_cell_chunk_file_path(p_chunk_coords));
+	cell_chunks_on_disk.erase(p_chunk_coords);
 
-		int terrain = (tile_data && tile_data->get_terrain_set() == p_terrain_set) ? tile_data->get_terrain() : -1;
-		if (!p_ignore_empty_terrains || terrain >= 0) {
-			constraints.insert(TerrainConstraint(tile_set, E_coords, terrain));
-		}
-	}
+	CellChunk &loaded_chunk = cell_chunks.insert(p_chunk_coords, chunk)->value;
+	_set_cell_chunk_active(p_chunk_coords, loaded_chunk, _is_cell_chunk_streamed_in(p_chunk_coords));
+	used_rect_cache_dirty = true;
+	return true;
+}
 
-	return constraints;
+bool TileMapLayer::_save_cell_chunk(const Vector2i &p_chunk_coords, const CellChunk &p_chunk) {
+	if (p_chunk.used_cells_count == 0) {
+		return true; // Empty chunks are not saved.
+	}
+
+	if (cell_streaming_session_path.is_empty()) {
+		uint64_t session_hash = hash_murmur3_one_64(OS::get_singleton()->get_ticks_usec());
+		session_hash = hash_murmur3_one_64((uint64_t)(OS::get_singleton()->get_unix_time() * 1000000.0), session_hash);
+		cell_streaming_session_id = hash_murmur3_one_64(get_instance_id(), session_hash);
+		cell_streaming_session_path = cell_streaming_path.path_join("tile_map_layer_" + String::num_uint64(cell_streaming_session_id, 16));
+	}
+	Error err = DirAccess::make_dir_recursive_absolute(cell_streaming_session_path);
+	ERR_FAIL_COND_V_MSG(err != OK && err != ERR_ALREADY_EXISTS, false, vformat("Cannot create the TileMapLayer cell streaming directory \"%s\".", cell_streaming_session_path));
+
+	String path = _get_cell_chunk_file_path(p_chunk_coords);
+	Ref<FileAccess> file = FileAccess::open_compressed(path, FileAccess::WRITE, FileAccess::COMPRESSION_ZSTD);
+	ERR_FAIL_COND_V_MSG(file.is_null(), false, vformat("Cannot save TileMapLayer chunk file \"%s\".", path));
+
+	file->store_32(CELL_CHUNK_FILE_MAGIC);
+	file->store_16(CELL_CHUNK_SIZE);
+	file->store_64(cell_streaming_session_id);
+	file->store_32(p_chunk_coords.x);
+	file->store_32(p_chunk_coords.y);
+	file->store_32(p_chunk.used_cells_count);
+	p_chunk.for_each_used_cell([&](int p_index, const TileMapCell &p_cell) {
+		file->store_16(p_index);
+		file->store_16(p_cell.source_id);
+		file->store_16(p_cell.coord_x);
+		file->store_16(p_cell.coord_y);
+		file->store_16(p_cell.alternative_tile);
+	});
+
+	cell_chunks_on_disk[p_chunk_coords] = p_chunk.used_cells_count;
+	return true;
 }
 
-void TileMapLayer::_tile_set_changed() {
-	dirty.flags[DIRTY_FLAGS_TILE_SET] = true;
-	_queue_internal_update();
-	emit_signal(CoreStringName(changed));
+void TileMapLayer::_load_all_cell_chunks() {
+	LocalVector<Vector2i> chunks_coords;
+	for (const KeyValue<Vector2i, uint32_t> &kv : cell_chunks_on_disk) {
+		chunks_coords.push_back(kv.key);
+	}
+	for (const Vector2i &chunk_coords : chunks_coords) {
+		_load_cell_chunk(chunk_coords);
+	}
+	if (cell_chunks_on_disk.is_empty()) {
+		_clear_cell_chunk_files();
+	}
 }
 
-void TileMapLayer::_renamed() {
-	emit_signal(CoreStringName(changed));
+void TileMapLayer::_clear_cell_chunk_files() {
+	for (const KeyValue<Vector2i, uint32_t> &kv : cell_chunks_on_disk) {
+		DirAccess::remove_absolute(_get_cell_chunk_file_path(kv.key));
+	}
+	cell_chunks_on_disk.clear();
+
+	// The next save starts a new session.
+	if (!cell_streaming_session_path.is_empty()) {
+		DirAccess::remove_absolute(cell_streaming_session_path);
+		cell_streaming_session_path = String();
+	}
 }
 
-void TileMapLayer::_update_notify_local_transform() {
-	bool notify = is_using_kinematic_bodies() || is_y_sort_enabled();
-	if (!notify) {
-		if (is_y_sort_enabled()) {
-			notify = true;
+void TileMapLayer::_update_cell_streaming() {
+	bool to_disk = _is_cell_streaming_to_disk();
+
+	if (to_disk) {
+		// Load the saved chunks around the focus.
+		Vector2i focus_chunk_coords = _coords_to_cell_chunk_coords(cell_streaming_focus);
+		for (int y = -cell_streaming_radius; y <= cell_streaming_radius; y++) {
+			for (int x = -cell_streaming_radius; x <= cell_streaming_radius; x++) {
+				Vector2i chunk_coords = focus_chunk_coords + Vector2i(x, y);
+				if (cell_chunks_on_disk.has(chunk_coords)) {
+					_load_cell_chunk(chunk_coords);
+				}
+			}
+		}
+	} else if (!cell_chunks_on_disk.is_empty()) {
+		// Not streaming to disk anymore, bring every chunk back.
+		_load_all_cell_chunks();
+	}
+
+	// Activate or deactivate the chunks.
+	Vector<Vector2i> to_unload;
+	for (KeyValue<Vector2i, CellChunk> &kv : cell_chunks) {
+		bool streamed_in = _is_cell_chunk_streamed_in(kv.key);
+		_set_cell_chunk_active(kv.key, kv.value, streamed_in);
+		if (to_disk && !streamed_in) {
+			to_unload.push_back(kv.key);
 		}
 	}
-	set_notify_local_transform(notify);
+
+	// Save the chunks out of range to disk, and free them. Chunks failing to save are kept in memory.
+	for (const Vector2i &chunk_coords : to_unload) {
+		if (_save_cell_chunk(chunk_coords, cell_chunks[chunk_coords])) {
+			cell_chunks.erase(chunk_coords);
+		}
+	}
+
+	used_rect_cache_dirty = true;
 }
 
 void TileMapLayer::_queue_internal_update() {
+	// Every change to the cells or the tile set goes through here.
+	navmesh_source_geometry_cache.dirty = true;
+
 	if (pending_update) {
 		return;
 	}
@@ -1835,6 +2529,8 @@ void TileMapLayer::_bind_methods() {
 	// --- Physics helpers ---
 	ClassDB::bind_method(D_METHOD("has_body_rid", "body"), &TileMapLayer::has_body_rid);
 	ClassDB::bind_method(D_METHOD("get_coords_for_body_rid", "body"), &TileMapLayer::get_coords_for_body_rid);
+	ClassDB::bind_method(D_METHOD("get_coords_for_body_shape", "body", "body_shape_index"), &TileMapLayer::get_coords_for_body_shape);
+	ClassDB::bind_method(D_METHOD("get_coords_for_body_shape_at", "body", "body_shape_index", "position"), &TileMapLayer::get_coords_for_body_shape_at);
 
 	// --- Runtime ---
 	ClassDB::bind_method(D_METHOD("update_internals"), &TileMapLayer::update_internals);
@@ -1870,6 +2566,8 @@ void TileMapLayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_using_kinematic_bodies"), &TileMapLayer::is_using_kinematic_bodies);
 	ClassDB::bind_method(D_METHOD("set_collision_visibility_mode", "visibility_mode"), &TileMapLayer::set_collision_visibility_mode);
 	ClassDB::bind_method(D_METHOD("get_collision_visibility_mode"), &TileMapLayer::get_collision_visibility_mode);
+	ClassDB::bind_method(D_METHOD("set_physics_quadrant_size", "size"), &TileMapLayer::set_physics_quadrant_size);
+	ClassDB::bind_method(D_METHOD("get_physics_quadrant_size"), &TileMapLayer::get_physics_quadrant_size);
 
 	ClassDB::bind_method(D_METHOD("set_occlusion_enabled", "enabled"), &TileMapLayer::set_occlusion_enabled);
 	ClassDB::bind_method(D_METHOD("is_occlusion_enabled"), &TileMapLayer::is_occlusion_enabled);
@@ -1880,6 +2578,17 @@ void TileMapLayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_navigation_map"), &TileMapLayer::get_navigation_map);
 	ClassDB::bind_method(D_METHOD("set_navigation_visibility_mode", "show_navigation"), &TileMapLayer::set_navigation_visibility_mode);
 	ClassDB::bind_method(D_METHOD("get_navigation_visibility_mode"), &TileMapLayer::get_navigation_visibility_mode);
+	ClassDB::bind_method(D_METHOD("set_navigation_quadrant_size", "size"), &TileMapLayer::set_navigation_quadrant_size);
+	ClassDB::bind_method(D_METHOD("get_navigation_quadrant_size"), &TileMapLayer::get_navigation_quadrant_size);
+
+	ClassDB::bind_method(D_METHOD("set_cell_streaming_enabled", "enabled"), &TileMapLayer::set_cell_streaming_enabled);
+	ClassDB::bind_method(D_METHOD("is_cell_streaming_enabled"), &TileMapLayer::is_cell_streaming_enabled);
+	ClassDB::bind_method(D_METHOD("set_cell_streaming_radius", "radius"), &TileMapLayer::set_cell_streaming_radius);
+	ClassDB::bind_method(D_METHOD("get_cell_streaming_radius"), &TileMapLayer::get_cell_streaming_radius);
+	ClassDB::bind_method(D_METHOD("set_cell_streaming_path", "path"), &TileMapLayer::set_cell_streaming_path);
+	ClassDB::bind_method(D_METHOD("get_cell_streaming_path"), &TileMapLayer::get_cell_streaming_path);
+	ClassDB::bind_method(D_METHOD("set_cell_streaming_focus", "coords"), &TileMapLayer::set_cell_streaming_focus);
+	ClassDB::bind_method(D_METHOD("get_cell_streaming_focus"), &TileMapLayer::get_cell_streaming_focus);
 
 	GDVIRTUAL_BIND(_use_tile_data_runtime_update, "coords");
 	GDVIRTUAL_BIND(_tile_data_runtime_update, "coords", "tile_data");
@@ -1898,9 +2607,15 @@ void TileMapLayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_enabled"), "set_collision_enabled", "is_collision_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_kinematic_bodies"), "set_use_kinematic_bodies", "is_using_kinematic_bodies");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_collision_visibility_mode", "get_collision_visibility_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "physics_quadrant_size"), "set_physics_quadrant_size", "get_physics_quadrant_size");
 	ADD_GROUP("Navigation", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "navigation_enabled"), "set_navigation_enabled", "is_navigation_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "navigation_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_navigation_visibility_mode", "get_navigation_visibility_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "navigation_quadrant_size"), "set_navigation_quadrant_size", "get_navigation_quadrant_size");
+	ADD_GROUP("Cell Streaming", "cell_streaming_");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "cell_streaming_enabled"), "set_cell_streaming_enabled", "is_cell_streaming_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "cell_streaming_radius", PROPERTY_HINT_RANGE, "0,64,1,or_greater"), "set_cell_streaming_radius", "get_cell_streaming_radius");
+	ADD_PROPERTY(PropertyInfo(Variant::STRING, "cell_streaming_path", PROPERTY_HINT_GLOBAL_DIR), "set_cell_streaming_path", "get_cell_streaming_path");
 
 	ADD_SIGNAL(MethodInfo(CoreStringName(changed)));
 
@@ -1951,6 +2666,9 @@ void TileMapLayer::set_as_tile_map_internal_node(int p_index) {
 	tile_map_node = Object::cast_to<TileMap>(get_parent());
 	set_use_parent_material(true);
 	force_parent_owned();
+	// TileMap kept one body and navigation region per cell.
+	set_physics_quadrant_size(1);
+	set_navigation_quadrant_size(1);
 	if (layer_index_in_tile_map_node != p_index) {
 		layer_index_in_tile_map_node = p_index;
 		dirty.flags[DIRTY_FLAGS_LAYER_INDEX_IN_TILE_MAP_NODE] = true;
@@ -1971,16 +2689,18 @@ Rect2 TileMapLayer::get_rect(bool &r_changed) const {
 	if (rect_cache_dirty) {
 		Rect2 r_total;
 		bool first = true;
-		for (const KeyValue<Vector2i, CellData> &E : tile_map_layer_data) {
-			Rect2 r;
-			r.position = tile_set->map_to_local(E.key);
-			r.size = Size2();
-			if (first) {
-				r_total = r;
-				first = false;
-			} else {
-				r_total = r_total.merge(r);
-			}
+		for (const KeyValue<Vector2i, CellChunk> &kv : cell_chunks) {
+			kv.value.for_each_used_cell([&](int p_index, const TileMapCell &p_cell) {
+				Rect2 r;
+				r.position = tile_set->map_to_local(_get_cell_chunk_cell_coords(kv.key, p_index));
+				r.size = Size2();
+				if (first) {
+					r_total = r;
+					first = false;
+				} else {
+					r_total = r_total.merge(r);
+				}
+			});
 		}
 
 		r_changed = rect_cache != r_total;
@@ -1992,46 +2712,43 @@ Rect2 TileMapLayer::get_rect(bool &r_changed) const {
 	return rect_cache;
 }
 
-HashMap<Vector2i, TileSet::TerrainsPattern> TileMapLayer::terrain_fill_constraints(const Vector<Vector2i> &p_to_replace, int p_terrain_set, const RBSet<TerrainConstraint> &p_constraints) const {
+HashMap<Vector2i, TileSet::TerrainsPattern> TileMapLayer::_terrain_fill_constraints(const Vector<Vector2i> &p_to_replace, int p_terrain_set, TerrainConstraintsGrid &r_constraints) const {
 	if (tile_set.is_null()) {
 		return HashMap<Vector2i, TileSet::TerrainsPattern>();
 	}
+	const TileSet::TerrainsLookup &lookup = tile_set->get_terrains_lookup(p_terrain_set);
 
-	// Copy the constraints set.
-	RBSet<TerrainConstraint> constraints = p_constraints;
+	// Read the current tiles. Those are not modified while solving, so this can be done in parallel.
+	TerrainsCellsRead read;
+	read.coords = p_to_replace.ptr();
+	read.terrain_set = p_terrain_set;
+	read.tile_data.resize(p_to_replace.size());
+	if (p_to_replace.size() >= TERRAINS_THREADED_READ_THRESHOLD) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &TileMapLayer::_read_terrains_cell, &read, p_to_replace.size(), -1, true, SNAME("TileMapLayerReadTerrainsCells"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (int i = 0; i < p_to_replace.size(); i++) {
+			_read_terrains_cell(i, &read);
+		}
+	}
 
 	// Output map.
 	HashMap<Vector2i, TileSet::TerrainsPattern> output;
+	output.reserve(p_to_replace.size());
 
-	// Add all positions to a set.
+	TerrainsCellSlots slots;
 	for (int i = 0; i < p_to_replace.size(); i++) {
 		const Vector2i &coords = p_to_replace[i];
 
 		// Select the best pattern for the given constraints.
-		TileSet::TerrainsPattern current_pattern = TileSet::TerrainsPattern(*tile_set, p_terrain_set);
-		TileMapCell cell = get_cell(coords);
-		if (cell.source_id != TileSet::INVALID_SOURCE) {
-			TileSetSource *source = *tile_set->get_source(cell.source_id);
-			TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
-			if (atlas_source) {
-				// Get tile data.
-				TileData *tile_data = atlas_source->get_tile_data(cell.get_atlas_coords(), cell.alternative_tile);
-				if (tile_data && tile_data->get_terrain_set() == p_terrain_set) {
-					current_pattern = tile_data->get_terrains_pattern();
-				}
-			}
-		}
-		TileSet::TerrainsPattern pattern = _get_best_terrain_pattern_for_constraints(p_terrain_set, coords, constraints, current_pattern);
-
-		// Update the constraint set with the new ones.
-		RBSet<TerrainConstraint> new_constraints = _get_terrain_constraints_from_added_pattern(coords, p_terrain_set, pattern);
-		for (const TerrainConstraint &E_constraint : new_constraints) {
-			if (constraints.has(E_constraint)) {
-				constraints.erase(E_constraint);
-			}
-			TerrainConstraint c = E_constraint;
-			c.set_priority(5);
-			constraints.insert(c);
+		TileSet::TerrainsPattern current_pattern = read.tile_data[i] ? read.tile_data[i]->get_terrains_pattern() : TileSet::TerrainsPattern(*tile_set, p_terrain_set);
+		_get_terrains_cell_slots(coords, lookup, slots);
+		TileSet::TerrainsPattern pattern = _get_best_terrain_pattern_for_constraints(lookup, slots, r_constraints, current_pattern);
+
+		// Update the constraints with the new ones.
+		r_constraints.set(slots.base_cell_coords[0], slots.bits[0], pattern.get_terrain(), 5);
+		for (uint32_t j = 0; j < lookup.peering_bits.size(); j++) {
+			r_constraints.set(slots.base_cell_coords[j + 1], slots.bits[j + 1], pattern.get_terrain_peering_bit(lookup.peering_bits[j]), 5);
 		}
 
 		output[coords] = pattern;
@@ -2039,6 +2756,15 @@ HashMap<Vector2i, TileSet::TerrainsPattern> TileMapLayer::terrain_fill_constrain
 	return output;
 }
 
+HashMap<Vector2i, TileSet::TerrainsPattern> TileMapLayer::terrain_fill_constraints(const Vector<Vector2i> &p_to_replace, int p_terrain_set, const RBSet<TerrainConstraint> &p_constraints) const {
+	// Copy the constraints set.
+	TerrainConstraintsGrid constraints;
+	for (const TerrainConstraint &E_constraint : p_constraints) {
+		constraints.insert(E_constraint);
+	}
+	return _terrain_fill_constraints(p_to_replace, p_terrain_set, constraints);
+}
+
 HashMap<Vector2i, TileSet::TerrainsPattern> TileMapLayer::terrain_fill_connect(const Vector<Vector2i> &p_coords_array, int p_terrain_set, int p_terrain, bool p_ignore_empty_terrains) const {
 	HashMap<Vector2i, TileSet::TerrainsPattern> output;
 	ERR_FAIL_COND_V(tile_set.is_null(), output);
@@ -2095,7 +2821,7 @@ HashMap<Vector2i, TileSet::TerrainsPattern> TileMapLayer::terrain_fill_connect(c
 		}
 	}
 
-	RBSet<TerrainConstraint> constraints;
+	TerrainConstraintsGrid constraints;
 
 	// Add new constraints from the path drawn.
 	for (Vector2i coords : p_coords_array) {
@@ -2135,12 +2861,10 @@ HashMap<Vector2i, TileSet::TerrainsPattern> TileMapLayer::terrain_fill_connect(c
 	}
 
 	// Fills in the constraint list from existing tiles.
-	for (TerrainConstraint c : _get_terrain_constraints_from_painted_cells_list(painted_set, p_terrain_set, p_ignore_empty_terrains)) {
-		constraints.insert(c);
-	}
+	_add_terrain_constraints_from_painted_cells_list(painted_set, p_terrain_set, p_ignore_empty_terrains, constraints);
 
 	// Fill the terrains.
-	output = terrain_fill_constraints(can_modify_list, p_terrain_set, constraints);
+	output = _terrain_fill_constraints(can_modify_list, p_terrain_set, constraints);
 	return output;
 }
 
@@ -2191,7 +2915,7 @@ HashMap<Vector2i, TileSet::TerrainsPattern> TileMapLayer::terrain_fill_path(cons
 		}
 	}
 
-	RBSet<TerrainConstraint> constraints;
+	TerrainConstraintsGrid constraints;
 
 	// Add new constraints from the path drawn.
 	for (Vector2i coords : p_coords_array) {
@@ -2208,12 +2932,10 @@ HashMap<Vector2i, TileSet::TerrainsPattern> TileMapLayer::terrain_fill_path(cons
 	}
 
 	// Fills in the constraint list from existing tiles.
-	for (TerrainConstraint c : _get_terrain_constraints_from_painted_cells_list(painted_set, p_terrain_set, p_ignore_empty_terrains)) {
-		constraints.insert(c);
-	}
+	_add_terrain_constraints_from_painted_cells_list(painted_set, p_terrain_set, p_ignore_empty_terrains, constraints);
 
 	// Fill the terrains.
-	output = terrain_fill_constraints(can_modify_list, p_terrain_set, constraints);
+	output = _terrain_fill_constraints(can_modify_list, p_terrain_set, constraints);
 	return output;
 }
 
@@ -2247,37 +2969,32 @@ HashMap<Vector2i, TileSet::TerrainsPattern> TileMapLayer::terrain_fill_pattern(c
 	}
 
 	// Add constraint by the new ones.
-	RBSet<TerrainConstraint> constraints;
+	TerrainConstraintsGrid constraints;
 
 	// Add new constraints from the path drawn.
 	for (Vector2i coords : p_coords_array) {
 		// Constraints on the center bit.
-		RBSet<TerrainConstraint> added_constraints = _get_terrain_constraints_from_added_pattern(coords, p_terrain_set, p_terrains_pattern);
-		for (TerrainConstraint c : added_constraints) {
-			c.set_priority(10);
-			constraints.insert(c);
-		}
+		_add_terrain_constraints_from_added_pattern(coords, p_terrain_set, p_terrains_pattern, 10, constraints);
 	}
 
 	// Fills in the constraint list from modified tiles border.
-	for (TerrainConstraint c : _get_terrain_constraints_from_painted_cells_list(painted_set, p_terrain_set, p_ignore_empty_terrains)) {
-		constraints.insert(c);
-	}
+	_add_terrain_constraints_from_painted_cells_list(painted_set, p_terrain_set, p_ignore_empty_terrains, constraints);
 
 	// Fill the terrains.
-	output = terrain_fill_constraints(can_modify_list, p_terrain_set, constraints);
+	output = _terrain_fill_constraints(can_modify_list, p_terrain_set, constraints);
 	return output;
 }
 
 TileMapCell TileMapLayer::get_cell(const Vector2i &p_coords) const {
-	if (!tile_map_layer_data.has(p_coords)) {
+	Vector2i chunk_coords = _coords_to_cell_chunk_coords(p_coords);
+	const CellChunk *chunk = cell_chunks.getptr(chunk_coords);
+	if (!chunk) {
 		return TileMapCell();
-	} else {
-		return tile_map_layer_data.find(p_coords)->value.cell;
 	}
+	return chunk->get_cell(_get_cell_chunk_index(chunk_coords, p_coords));
 }
 
-void TileMapLayer::draw_tile(RID p_canvas_item, const Vector2 &p_position, const Ref<TileSet> p_tile_set, int p_atlas_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile, int p_frame, Color p_modulation, const TileData *p_tile_data_override, real_t p_normalized_animation_offset) {
+void TileMapLayer::build_tile_draw_commands(LocalVector<TileDrawCommand> &r_commands, uint32_t p_canvas_item_index, const Vector2 &p_position, const Ref<TileSet> &p_tile_set, int p_atlas_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile, int p_frame, Color p_modulation, const TileData *p_tile_data_override, real_t p_normalized_animation_offset) {
 	ERR_FAIL_COND(p_tile_set.is_null());
 	ERR_FAIL_COND(!p_tile_set->has_source(p_atlas_source_id));
 	ERR_FAIL_COND(!p_tile_set->get_source(p_atlas_source_id)->has_tile(p_atlas_coords));
@@ -2290,7 +3007,7 @@ void TileMapLayer::draw_tile(RID p_canvas_item, const Vector2 &p_position, const
 			ERR_FAIL_INDEX(p_frame, atlas_source->get_tile_animation_frames_count(p_atlas_coords));
 		}
 
-		// Get the texture.
+		// Get the texture. It is kept alive by the atlas source until the commands are submitted.
 		Ref<Texture2D> tex = atlas_source->get_runtime_texture();
 		if (tex.is_null()) {
 			return;
@@ -2305,20 +3022,25 @@ void TileMapLayer::draw_tile(RID p_canvas_item, const Vector2 &p_position, const
 		// Get tile data.
 		const TileData *tile_data = p_tile_data_override ? p_tile_data_override : atlas_source->get_tile_data(p_atlas_coords, p_alternative_tile);
 
+		TileDrawCommand command;
+		command.canvas_item_index = p_canvas_item_index;
+		command.texture = tex.ptr();
+		command.clip_uv = p_tile_set->is_uv_clipping();
+
 		// Get the tile modulation.
-		Color modulate = tile_data->get_modulate() * p_modulation;
+		command.modulate = tile_data->get_modulate() * p_modulation;
 
 		// Compute the offset.
 		Vector2 tile_offset = tile_data->get_texture_origin();
 
 		// Get destination rect.
-		Rect2 dest_rect;
+		Rect2 &dest_rect = command.rect;
 		dest_rect.size = atlas_source->get_runtime_tile_texture_region(p_atlas_coords).size;
 		dest_rect.size.x += FP_ADJUST;
 		dest_rect.size.y += FP_ADJUST;
 
-		bool transpose = tile_data->get_transpose() ^ bool(p_alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
-		if (transpose) {
+		command.transpose = tile_data->get_transpose() ^ bool(p_alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
+		if (command.transpose) {
 			dest_rect.position = (p_position - Vector2(dest_rect.size.y, dest_rect.size.x) / 2 - tile_offset);
 		} else {
 			dest_rect.position = (p_position - dest_rect.size / 2 - tile_offset);
@@ -2334,12 +3056,16 @@ void TileMapLayer::draw_tile(RID p_canvas_item, const Vector2 &p_position, const
 
 		// Draw the tile.
 		if (p_frame >= 0) {
-			Rect2i source_rect = atlas_source->get_runtime_tile_texture_region(p_atlas_coords, p_frame);
-			tex->draw_rect_region(p_canvas_item, dest_rect, source_rect, modulate, transpose, p_tile_set->is_uv_clipping());
+			command.source_rect = atlas_source->get_runtime_tile_texture_region(p_atlas_coords, p_frame);
+			r_commands.push_back(command);
 		} else if (atlas_source->get_tile_animation_frames_count(p_atlas_coords) == 1) {
-			Rect2i source_rect = atlas_source->get_runtime_tile_texture_region(p_atlas_coords, 0);
-			tex->draw_rect_region(p_canvas_item, dest_rect, source_rect, modulate, transpose, p_tile_set->is_uv_clipping());
+			command.source_rect = atlas_source->get_runtime_tile_texture_region(p_atlas_coords, 0);
+			r_commands.push_back(command);
 		} else {
+			TileDrawCommand slice_command;
+			slice_command.type = TileDrawCommand::TYPE_ANIMATION_SLICE;
+			slice_command.canvas_item_index = p_canvas_item_index;
+
 			real_t speed = atlas_source->get_tile_animation_speed(p_atlas_coords);
 			real_t animation_duration = atlas_source->get_tile_animation_total_duration(p_atlas_coords) / speed;
 			real_t animation_offset = p_normalized_animation_offset * animation_duration;
@@ -2348,25 +3074,51 @@ void TileMapLayer::draw_tile(RID p_canvas_item, const Vector2 &p_position, const
 			real_t time_unscaled = 0.0;
 			for (int frame = 0; frame < atlas_source->get_tile_animation_frames_count(p_atlas_coords); frame++) {
 				real_t frame_duration_unscaled = atlas_source->get_tile_animation_frame_duration(p_atlas_coords, frame);
-				real_t slice_start = time_unscaled / speed;
-				real_t slice_end = (time_unscaled + frame_duration_unscaled) / speed;
-				RenderingServer::get_singleton()->canvas_item_add_animation_slice(p_canvas_item, animation_duration, slice_start, slice_end, animation_offset);
+				slice_command.animation_length = animation_duration;
+				slice_command.slice_begin = time_unscaled / speed;
+				slice_command.slice_end = (time_unscaled + frame_duration_unscaled) / speed;
+				slice_command.animation_offset = animation_offset;
+				r_commands.push_back(slice_command);
 
-				Rect2i source_rect = atlas_source->get_runtime_tile_texture_region(p_atlas_coords, frame);
-				tex->draw_rect_region(p_canvas_item, dest_rect, source_rect, modulate, transpose, p_tile_set->is_uv_clipping());
+				command.source_rect = atlas_source->get_runtime_tile_texture_region(p_atlas_coords, frame);
+				r_commands.push_back(command);
 
 				time_unscaled += frame_duration_unscaled;
 			}
-			RenderingServer::get_singleton()->canvas_item_add_animation_slice(p_canvas_item, 1.0, 0.0, 1.0, 0.0);
+			slice_command.animation_length = 1.0;
+			slice_command.slice_begin = 0.0;
+			slice_command.slice_end = 1.0;
+			slice_command.animation_offset = 0.0;
+			r_commands.push_back(slice_command);
+		}
+	}
+}
+
+void TileMapLayer::submit_tile_draw_commands(const LocalVector<TileDrawCommand> &p_commands, const RID *p_canvas_items) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	for (const TileDrawCommand &command : p_commands) {
+		const RID &ci = p_canvas_items[command.canvas_item_index];
+		switch (command.type) {
+			case TileDrawCommand::TYPE_TEXTURE_RECT_REGION: {
+				command.texture->draw_rect_region(ci, command.rect, command.source_rect, command.modulate, command.transpose, command.clip_uv);
+			} break;
+			case TileDrawCommand::TYPE_ANIMATION_SLICE: {
+				rs->canvas_item_add_animation_slice(ci, command.animation_length, command.slice_begin, command.slice_end, command.animation_offset);
+			} break;
 		}
 	}
 }
 
+void TileMapLayer::draw_tile(RID p_canvas_item, const Vector2 &p_position, const Ref<TileSet> p_tile_set, int p_atlas_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile, int p_frame, Color p_modulation, const TileData *p_tile_data_override, real_t p_normalized_animation_offset) {
+	// Reuse the buffer between calls, as tiles are drawn one by one.
+	thread_local LocalVector<TileDrawCommand> commands;
+	commands.clear();
+	build_tile_draw_commands(commands, 0, p_position, p_tile_set, p_atlas_source_id, p_atlas_coords, p_alternative_tile, p_frame, p_modulation, p_tile_data_override, p_normalized_animation_offset);
+	submit_tile_draw_commands(commands, &p_canvas_item);
+}
+
 void TileMapLayer::set_cell(const Vector2i &p_coords, int p_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile) {
 	// Set the current cell tile (using integer position).
-	Vector2i pk(p_coords);
-	HashMap<Vector2i, CellData>::Iterator E = tile_map_layer_data.find(pk);
-
 	int source_id = p_source_id;
 	Vector2i atlas_coords = p_atlas_coords;
 	int alternative_tile = p_alternative_tile;
@@ -2378,30 +3130,28 @@ void TileMapLayer::set_cell(const Vector2i &p_coords, int p_source_id, const Vec
 		alternative_tile = TileSetSource::INVALID_TILE_ALTERNATIVE;
 	}
 
-	if (!E) {
-		if (source_id == TileSet::INVALID_SOURCE) {
-			return; // Nothing to do, the tile is already empty.
-		}
+	Vector2i chunk_coords = _coords_to_cell_chunk_coords(p_coords);
+	CellChunk *chunk = _get_cell_chunk(chunk_coords, source_id != TileSet::INVALID_SOURCE);
+	if (!chunk) {
+		return; // Nothing to do, the tile is already empty.
+	}
 
-		// Insert a new cell in the tile map.
-		CellData new_cell_data;
-		new_cell_data.coords = pk;
-		E = tile_map_layer_data.insert(pk, new_cell_data);
-	} else {
-		if (E->value.cell.source_id == source_id && E->value.cell.get_atlas_coords() == atlas_coords && E->value.cell.alternative_tile == alternative_tile) {
-			return; // Nothing changed.
-		}
+	TileMapCell new_cell(source_id, atlas_coords, alternative_tile);
+	int index = _get_cell_chunk_index(chunk_coords, p_coords);
+	if (chunk->get_cell(index) == new_cell) {
+		return; // Nothing changed.
 	}
+	chunk->set_cell(index, new_cell);
 
-	TileMapCell &c = E->value.cell;
-	c.source_id = source_id;
-	c.set_atlas_coords(atlas_coords);
-	c.alternative_tile = alternative_tile;
+	// Update the runtime data of the cell, making it dirty.
+	if (chunk->active) {
+		_set_cell_data(p_coords, new_cell);
+	}
 
-	// Make the given cell dirty.
-	if (!E->value.dirty_list_element.in_list()) {
-		dirty.cell_list.add(&(E->value.dirty_list_element));
+	if (chunk->used_cells_count == 0) {
+		cell_chunks.erase(chunk_coords);
 	}
+
 	_queue_internal_update();
 
 	used_rect_cache_dirty = true;
@@ -2415,11 +3165,13 @@ void TileMapLayer::fix_invalid_tiles() {
 	ERR_FAIL_COND_MSG(tile_set.is_null(), "Cannot call fix_invalid_tiles() on a TileMapLayer without a valid TileSet.");
 
 	RBSet<Vector2i> coords;
-	for (const KeyValue<Vector2i, CellData> &E : tile_map_layer_data) {
-		TileSetSource *source = *tile_set->get_source(E.value.cell.source_id);
-		if (!source || !source->has_tile(E.value.cell.get_atlas_coords()) || !source->has_alternative_tile(E.value.cell.get_atlas_coords(), E.value.cell.alternative_tile)) {
-			coords.insert(E.key);
-		}
+	for (const KeyValue<Vector2i, CellChunk> &kv : cell_chunks) {
+		kv.value.for_each_used_cell([&](int p_index, const TileMapCell &p_cell) {
+			TileSetSource *source = *tile_set->get_source(p_cell.source_id);
+			if (!source || !source->has_tile(p_cell.get_atlas_coords()) || !source->has_alternative_tile(p_cell.get_atlas_coords(), p_cell.alternative_tile)) {
+				coords.insert(_get_cell_chunk_cell_coords(kv.key, p_index));
+			}
+		});
 	}
 	for (const Vector2i &E : coords) {
 		set_cell(E, TileSet::INVALID_SOURCE, TileSetSource::INVALID_ATLAS_COORDS, TileSetSource::INVALID_TILE_ALTERNATIVE);
@@ -2427,44 +3179,29 @@ void TileMapLayer::fix_invalid_tiles() {
 }
 
 void TileMapLayer::clear() {
-	// Remove all tiles.
-	for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-		erase_cell(kv.key);
+	// Remove all tiles, the runtime data of the cells is freed on the next update.
+	for (KeyValue<Vector2i, CellChunk> &kv : cell_chunks) {
+		_set_cell_chunk_active(kv.key, kv.value, false);
 	}
+	cell_chunks.clear();
+	_clear_cell_chunk_files();
+	_queue_internal_update();
 	used_rect_cache_dirty = true;
 }
 
 int TileMapLayer::get_cell_source_id(const Vector2i &p_coords) const {
 	// Get a cell source id from position.
-	HashMap<Vector2i, CellData>::ConstIterator E = tile_map_layer_data.find(p_coords);
-
-	if (!E) {
-		return TileSet::INVALID_SOURCE;
-	}
-
-	return E->value.cell.source_id;
+	return get_cell(p_coords).source_id;
 }
 
 Vector2i TileMapLayer::get_cell_atlas_coords(const Vector2i &p_coords) const {
 	// Get a cell source id from position.
-	HashMap<Vector2i, CellData>::ConstIterator E = tile_map_layer_data.find(p_coords);
-
-	if (!E) {
-		return TileSetSource::INVALID_ATLAS_COORDS;
-	}
-
-	return E->value.cell.get_atlas_coords();
+	return get_cell(p_coords).get_atlas_coords();
 }
 
 int TileMapLayer::get_cell_alternative_tile(const Vector2i &p_coords) const {
 	// Get a cell source id from position.
-	HashMap<Vector2i, CellData>::ConstIterator E = tile_map_layer_data.find(p_coords);
-
-	if (!E) {
-		return TileSetSource::INVALID_TILE_ALTERNATIVE;
-	}
-
-	return E->value.cell.alternative_tile;
+	return get_cell(p_coords).alternative_tile;
 }
 
 TileData *TileMapLayer::get_cell_tile_data(const Vector2i &p_coords) const {
@@ -2484,12 +3221,10 @@ TileData *TileMapLayer::get_cell_tile_data(const Vector2i &p_coords) const {
 TypedArray<Vector2i> TileMapLayer::get_used_cells() const {
 	// Returns the cells used in the tilemap.
 	TypedArray<Vector2i> a;
-	for (const KeyValue<Vector2i, CellData> &E : tile_map_layer_data) {
-		const TileMapCell &c = E.value.cell;
-		if (c.source_id == TileSet::INVALID_SOURCE) {
-			continue;
-		}
-		a.push_back(E.key);
+	for (const KeyValue<Vector2i, CellChunk> &kv : cell_chunks) {
+		kv.value.for_each_used_cell([&](int p_index, const TileMapCell &p_cell) {
+			a.push_back(_get_cell_chunk_cell_coords(kv.key, p_index));
+		});
 	}
 
 	return a;
@@ -2498,16 +3233,14 @@ TypedArray<Vector2i> TileMapLayer::get_used_cells() const {
 TypedArray<Vector2i> TileMapLayer::get_used_cells_by_id(int p_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile) const {
 	// Returns the cells used in the tilemap.
 	TypedArray<Vector2i> a;
-	for (const KeyValue<Vector2i, CellData> &E : tile_map_layer_data) {
-		const TileMapCell &c = E.value.cell;
-		if (c.source_id == TileSet::INVALID_SOURCE) {
-			continue;
-		}
-		if ((p_source_id == TileSet::INVALID_SOURCE || p_source_id == c.source_id) &&
-				(p_atlas_coords == TileSetSource::INVALID_ATLAS_COORDS || p_atlas_coords == c.get_atlas_coords()) &&
-				(p_alternative_tile == TileSetSource::INVALID_TILE_ALTERNATIVE || p_alternative_tile == c.alternative_tile)) {
-			a.push_back(E.key);
-		}
+	for (const KeyValue<Vector2i, CellChunk> &kv : cell_chunks) {
+		kv.value.for_each_used_cell([&](int p_index, const TileMapCell &p_cell) {
+			if ((p_source_id == TileSet::INVALID_SOURCE || p_source_id == p_cell.source_id) &&
+					(p_atlas_coords == TileSetSource::INVALID_ATLAS_COORDS || p_atlas_coords == p_cell.get_atlas_coords()) &&
+					(p_alternative_tile == TileSetSource::INVALID_TILE_ALTERNATIVE || p_alternative_tile == p_cell.alternative_tile)) {
+				a.push_back(_get_cell_chunk_cell_coords(kv.key, p_index));
+			}
+		});
 	}
 
 	return a;
@@ -2519,17 +3252,16 @@ Rect2i TileMapLayer::get_used_rect() const {
 		used_rect_cache = Rect2i();
 
 		bool first = true;
-		for (const KeyValue<Vector2i, CellData> &E : tile_map_layer_data) {
-			const TileMapCell &c = E.value.cell;
-			if (c.source_id == TileSet::INVALID_SOURCE) {
-				continue;
-			}
-			if (first) {
-				used_rect_cache = Rect2i(E.key, Size2i());
-				first = false;
-			} else {
-				used_rect_cache.expand_to(E.key);
-			}
+		for (const KeyValue<Vector2i, CellChunk> &kv : cell_chunks) {
+			kv.value.for_each_used_cell([&](int p_index, const TileMapCell &p_cell) {
+				Vector2i coords = _get_cell_chunk_cell_coords(kv.key, p_index);
+				if (first) {
+					used_rect_cache = Rect2i(coords, Size2i());
+					first = false;
+				} else {
+					used_rect_cache.expand_to(coords);
+				}
+			});
 		}
 		if (!first) {
 			// Only if we have at least one cell.
@@ -2698,13 +3430,50 @@ void TileMapLayer::set_cells_terrain_path(TypedArray<Vector2i> p_path, int p_ter
 }
 
 bool TileMapLayer::has_body_rid(RID p_physics_body) const {
-	return bodies_coords.has(p_physics_body);
+	return bodies_quadrants.has(p_physics_body);
+}
+
+const PhysicsQuadrant::Body *TileMapLayer::_get_physics_quadrant_body(RID p_physics_body) const {
+	const Ref<PhysicsQuadrant> *found = bodies_quadrants.getptr(p_physics_body);
+	ERR_FAIL_NULL_V(found, nullptr);
+	for (const PhysicsQuadrant::Body &body : (*found)->bodies) {
+		if (body.rid == p_physics_body) {
+			return &body;
+		}
+	}
+	return nullptr;
 }
 
 Vector2i TileMapLayer::get_coords_for_body_rid(RID p_physics_body) const {
-	const Vector2i *found = bodies_coords.getptr(p_physics_body);
-	ERR_FAIL_NULL_V(found, Vector2i());
-	return *found;
+	const PhysicsQuadrant::Body *body = _get_physics_quadrant_body(p_physics_body);
+	ERR_FAIL_NULL_V(body, Vector2i());
+	ERR_FAIL_COND_V(body->shapes_coords.is_empty(), Vector2i());
+
+	// Only a body holding the shapes of a single cell can be mapped to it.
+	const Vector2i &coords = body->shapes_coords[0];
+	for (uint32_t shape_index = 0; shape_index < body->shapes_coords.size(); shape_index++) {
+		ERR_FAIL_COND_V_MSG(body->shapes_coords[shape_index] != coords || body->shapes_end_coords[shape_index] != coords, Vector2i(), "The physics body holds the collisions of several tiles, use get_coords_for_body_shape_at() instead, or set physics_quadrant_size to 1.");
+	}
+	return coords;
+}
+
+Vector2i TileMapLayer::get_coords_for_body_shape(RID p_physics_body, int p_body_shape_index) const {
+	const PhysicsQuadrant::Body *body = _get_physics_quadrant_body(p_physics_body);
+	ERR_FAIL_NULL_V(body, Vector2i());
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_body_shape_index, body->shapes_coords.size(), Vector2i());
+	return body->shapes_coords[p_body_shape_index];
+}
+
+Vector2i TileMapLayer::get_coords_for_body_shape_at(RID p_physics_body, int p_body_shape_index, const Vector2 &p_position) const {
+	ERR_FAIL_COND_V(tile_set.is_null(), Vector2i());
+	const PhysicsQuadrant::Body *body = _get_physics_quadrant_body(p_physics_body);
+	ERR_FAIL_NULL_V(body, Vector2i());
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_body_shape_index, body->shapes_coords.size(), Vector2i());
+
+	// A merged shape covers a rectangle of cells. Contact points lie on its edges, so clamp the cell into that rectangle.
+	const Vector2i &begin = body->shapes_coords[p_body_shape_index];
+	const Vector2i &end = body->shapes_end_coords[p_body_shape_index];
+	return local_to_map(to_local(p_position)).clamp(begin, end);
 }
 
 void TileMapLayer::update_internals() {
@@ -2845,11 +3614,20 @@ Vector<uint8_t> TileMapLayer::get_tile_map_data_as_array() const {
 	const int cell_data_struct_size = 12;
 
 	Vector<uint8_t> tile_map_data_array;
-	if (tile_map_layer_data.is_empty()) {
+	uint32_t used_cells_count = 0;
+	for (const KeyValue<Vector2i, CellChunk> &kv : cell_chunks) {
+		used_cells_count += kv.value.used_cells_count;
+	}
+	for (const KeyValue<Vector2i, uint32_t> &kv : cell_chunks_on_disk) {
+		if (!cell_chunks.has(kv.key)) {
+			used_cells_count += kv.value;
+		}
+	}
+	if (used_cells_count == 0) {
 		return tile_map_data_array;
 	}
 
-	tile_map_data_array.resize(2 + tile_map_layer_data.size() * cell_data_struct_size);
+	tile_map_data_array.resize(2 + used_cells_count * cell_data_struct_size);
 	uint8_t *ptr = tile_map_data_array.ptrw();
 
 	// Index in the array.
@@ -2860,21 +3638,44 @@ Vector<uint8_t> TileMapLayer::get_tile_map_data_as_array() const {
 	index += 2;
 
 	// Save in highest format.
-	for (const KeyValue<Vector2i, CellData> &E : tile_map_layer_data) {
-		// Get a pointer at the start of the cell data.
-		uint8_t *cell_data_ptr = (uint8_t *)&ptr[index];
+	auto encode_chunk = [&](const Vector2i &p_chunk_coords, const CellChunk &p_chunk) {
+		p_chunk.for_each_used_cell([&](int p_index, const TileMapCell &p_cell) {
+			Vector2i coords = _get_cell_chunk_cell_coords(p_chunk_coords, p_index);
 
-		// Store position in TileMap.
-		encode_uint16((int16_t)(E.key.x), &cell_data_ptr[0]);
-		encode_uint16((int16_t)(E.key.y), &cell_data_ptr[2]);
+			// Get a pointer at the start of the cell data.
+			uint8_t *cell_data_ptr = (uint8_t *)&ptr[index];
 
-		// Store the tile identifiers.
-		encode_uint16(E.value.cell.source_id, &cell_data_ptr[4]);
-		encode_uint16(E.value.cell.coord_x, &cell_data_ptr[6]);
-		encode_uint16(E.value.cell.coord_y, &cell_data_ptr[8]);
-		encode_uint16(E.value.cell.alternative_tile, &cell_data_ptr[10]);
+			// Store position in TileMap.
+			encode_uint16((int16_t)(coords.x), &cell_data_ptr[0]);
+			encode_uint16((int16_t)(coords.y), &cell_data_ptr[2]);
 
-		index += cell_data_struct_size;
+			// Store the tile identifiers.
+			encode_uint16(p_cell.source_id, &cell_data_ptr[4]);
+			encode_uint16(p_cell.coord_x, &cell_data_ptr[6]);
+			encode_uint16(p_cell.coord_y, &cell_data_ptr[8]);
+			encode_uint16(p_cell.alternative_tile, &cell_data_ptr[10]);
+
+			index += cell_data_struct_size;
+		});
+	};
+	for (const KeyValue<Vector2i, CellChunk> &kv : cell_chunks) {
+		encode_chunk(kv.key, kv.value);
+	}
+
+	// Chunks streamed out to disk are read back one at a time.
+	for (const KeyValue<Vector2i, uint32_t> &kv : cell_chunks_on_disk) {
+		if (cell_chunks.has(kv.key)) {
+			continue;
+		}
+		CellChunk chunk;
+		if (_read_cell_chunk_file(kv.key, chunk)) {
+			encode_chunk(kv.key, chunk);
+		}
+	}
+
+	// Unreadable chunks were skipped.
+	if (index < tile_map_data_array.size()) {
+		tile_map_data_array.resize(index);
 	}
 
 	return tile_map_data_array;
@@ -2966,6 +3767,90 @@ int TileMapLayer::get_rendering_quadrant_size() const {
 	return rendering_quadrant_size;
 }
 
+void TileMapLayer::set_physics_quadrant_size(int p_size) {
+	if (physics_quadrant_size == p_size) {
+		return;
+	}
+	ERR_FAIL_COND_MSG(p_size < 1, "Physics quadrant size cannot be smaller than 1.");
+	physics_quadrant_size = p_size;
+	dirty.flags[DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE] = true;
+	_queue_internal_update();
+	emit_signal(CoreStringName(changed));
+}
+
+int TileMapLayer::get_physics_quadrant_size() const {
+	return physics_quadrant_size;
+}
+
+void TileMapLayer::set_navigation_quadrant_size(int p_size) {
+	if (navigation_quadrant_size == p_size) {
+		return;
+	}
+	ERR_FAIL_COND_MSG(p_size < 1, "Navigation quadrant size cannot be smaller than 1.");
+	navigation_quadrant_size = p_size;
+	dirty.flags[DIRTY_FLAGS_LAYER_NAVIGATION_QUADRANT_SIZE] = true;
+	_queue_internal_update();
+	emit_signal(CoreStringName(changed));
+}
+
+int TileMapLayer::get_navigation_quadrant_size() const {
+	return navigation_quadrant_size;
+}
+
+void TileMapLayer::set_cell_streaming_enabled(bool p_enabled) {
+	if (cell_streaming_enabled == p_enabled) {
+		return;
+	}
+	cell_streaming_enabled = p_enabled;
+	_update_cell_streaming();
+	emit_signal(CoreStringName(changed));
+}
+
+bool TileMapLayer::is_cell_streaming_enabled() const {
+	return cell_streaming_enabled;
+}
+
+void TileMapLayer::set_cell_streaming_radius(int p_radius) {
+	if (cell_streaming_radius == p_radius) {
+		return;
+	}
+	ERR_FAIL_COND_MSG(p_radius < 0, "Cell streaming radius cannot be negative.");
+	cell_streaming_radius = p_radius;
+	_update_cell_streaming();
+	emit_signal(CoreStringName(changed));
+}
+
+int TileMapLayer::get_cell_streaming_radius() const {
+	return cell_streaming_radius;
+}
+
+void TileMapLayer::set_cell_streaming_path(const String &p_path) {
+	if (cell_streaming_path == p_path) {
+		return;
+	}
+	// Bring back the chunks saved in the previous directory, they are saved again in the new one if needed.
+	_load_all_cell_chunks();
+	cell_streaming_path = p_path;
+	_update_cell_streaming();
+	emit_signal(CoreStringName(changed));
+}
+
+String TileMapLayer::get_cell_streaming_path() const {
+	return cell_streaming_path;
+}
+
+void TileMapLayer::set_cell_streaming_focus(const Vector2i &p_coords) {
+	Vector2i previous_focus_chunk_coords = _coords_to_cell_chunk_coords(cell_streaming_focus);
+	cell_streaming_focus = p_coords;
+	if (cell_streaming_enabled && _coords_to_cell_chunk_coords(p_coords) != previous_focus_chunk_coords) {
+		_update_cell_streaming();
+	}
+}
+
+Vector2i TileMapLayer::get_cell_streaming_focus() const {
+	return cell_streaming_focus;
+}
+
 void TileMapLayer::set_collision_enabled(bool p_enabled) {
 	if (collision_enabled == p_enabled) {
 		return;
@@ -3078,14 +3963,18 @@ void TileMapLayer::navmesh_parse_init() {
 	}
 }
 
-void TileMapLayer::navmesh_parse_source_geometry(const Ref<NavigationPolygon> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData2D> p_source_geometry_data, Node *p_node) {
-	TileMapLayer *tile_map_layer = Object::cast_to<TileMapLayer>(p_node);
-
-	if (tile_map_layer == nullptr) {
+void TileMapLayer::_navmesh_update_source_geometry_cache(int p_parsed_geometry_type, uint32_t p_parsed_collision_mask) {
+	NavmeshSourceGeometryCache &cache = navmesh_source_geometry_cache;
+	if (!cache.dirty && cache.parsed_geometry_type == p_parsed_geometry_type && cache.parsed_collision_mask == p_parsed_collision_mask) {
 		return;
 	}
 
-	Ref<TileSet> tile_set = tile_map_layer->get_tile_set();
+	cache.dirty = false;
+	cache.parsed_geometry_type = p_parsed_geometry_type;
+	cache.parsed_collision_mask = p_parsed_collision_mask;
+	cache.traversable_outlines.clear();
+	cache.obstruction_outlines.clear();
+
 	if (tile_set.is_null()) {
 		return;
 	}
@@ -3096,30 +3985,24 @@ void TileMapLayer::navmesh_parse_source_geometry(const Ref<NavigationPolygon> &p
 		return;
 	}
 
-	NavigationPolygon::ParsedGeometryType parsed_geometry_type = p_navigation_mesh->get_parsed_geometry_type();
-	uint32_t parsed_collision_mask = p_navigation_mesh->get_parsed_collision_mask();
-
-	const Transform2D tilemap_xform = p_source_geometry_data->root_node_transform * tile_map_layer->get_global_transform();
+	const bool parse_static_colliders = p_parsed_geometry_type == NavigationPolygon::PARSED_GEOMETRY_STATIC_COLLIDERS || p_parsed_geometry_type == NavigationPolygon::PARSED_GEOMETRY_BOTH;
 
-	TypedArray<Vector2i> used_cells = tile_map_layer->get_used_cells();
-	for (int used_cell_index = 0; used_cell_index < used_cells.size(); used_cell_index++) {
-		const Vector2i &cell = used_cells[used_cell_index];
+	for (const KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
+		const Vector2i &cell = kv.key;
 
-		const TileData *tile_data = tile_map_layer->get_cell_tile_data(cell);
+		const TileData *tile_data = get_cell_tile_data(cell);
 		if (tile_data == nullptr) {
 			continue;
 		}
 
 		// Transform flags.
-		const int alternative_id = tile_map_layer->get_cell_alternative_tile(cell);
+		const int alternative_id = get_cell_alternative_tile(cell);
 		bool flip_h = (alternative_id & TileSetAtlasSource::TRANSFORM_FLIP_H);
 		bool flip_v = (alternative_id & TileSetAtlasSource::TRANSFORM_FLIP_V);
 		bool transpose = (alternative_id & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
 
 		Transform2D tile_transform;
-		tile_transform.set_origin(tile_map_layer->map_to_local(cell));
-
-		const Transform2D tile_transform_offset = tilemap_xform * tile_transform;
+		tile_transform.set_origin(map_to_local(cell));
 
 		// Parse traversable polygons.
 		for (int navigation_layer = 0; navigation_layer < navigation_layers_count; navigation_layer++) {
@@ -3138,18 +4021,17 @@ void TileMapLayer::navmesh_parse_source_geometry(const Ref<NavigationPolygon> &p
 					Vector2 *traversable_outline_ptrw = traversable_outline.ptrw();
 
 					for (int traversable_outline_index = 0; traversable_outline_index < traversable_outline.size(); traversable_outline_index++) {
-						traversable_outline_ptrw[traversable_outline_index] = tile_transform_offset.xform(navigation_polygon_outline_ptr[traversable_outline_index]);
+						traversable_outline_ptrw[traversable_outline_index] = tile_transform.xform(navigation_polygon_outline_ptr[traversable_outline_index]);
 					}
 
-					p_source_geometry_data->_add_traversable_outline(traversable_outline);
+					cache.traversable_outlines.push_back(traversable_outline);
 				}
 			}
 		}
 
 		// Parse obstacles.
 		for (int physics_layer = 0; physics_layer < physics_layers_count; physics_layer++) {
-			if ((parsed_geometry_type == NavigationPolygon::PARSED_GEOMETRY_STATIC_COLLIDERS || parsed_geometry_type == NavigationPolygon::PARSED_GEOMETRY_BOTH) &&
-					(tile_set->get_physics_layer_collision_layer(physics_layer) & parsed_collision_mask)) {
+			if (parse_static_colliders && (tile_set->get_physics_layer_collision_layer(physics_layer) & p_parsed_collision_mask)) {
 				for (int collision_polygon_index = 0; collision_polygon_index < tile_data->get_collision_polygons_count(physics_layer); collision_polygon_index++) {
 					PackedVector2Array collision_polygon_points = tile_data->get_collision_polygon_points(physics_layer, collision_polygon_index);
 					if (collision_polygon_points.is_empty()) {
@@ -3167,16 +4049,37 @@ void TileMapLayer::navmesh_parse_source_geometry(const Ref<NavigationPolygon> &p
 					Vector2 *obstruction_outline_ptrw = obstruction_outline.ptrw();
 
 					for (int obstruction_outline_index = 0; obstruction_outline_index < obstruction_outline.size(); obstruction_outline_index++) {
-						obstruction_outline_ptrw[obstruction_outline_index] = tile_transform_offset.xform(collision_polygon_points_ptr[obstruction_outline_index]);
+						obstruction_outline_ptrw[obstruction_outline_index] = tile_transform.xform(collision_polygon_points_ptr[obstruction_outline_index]);
 					}
 
-					p_source_geometry_data->_add_obstruction_outline(obstruction_outline);
+					cache.obstruction_outlines.push_back(obstruction_outline);
 				}
 			}
 		}
 	}
 }
 
+void TileMapLayer::navmesh_parse_source_geometry(const Ref<NavigationPolygon> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData2D> p_source_geometry_data, Node *p_node) {
+	TileMapLayer *tile_map_layer = Object::cast_to<TileMapLayer>(p_node);
+
+	if (tile_map_layer == nullptr) {
+		return;
+	}
+
+	// Only layers modified since the last bake parse their cells again, the others only get transformed.
+	tile_map_layer->_navmesh_update_source_geometry_cache(p_navigation_mesh->get_parsed_geometry_type(), p_navigation_mesh->get_parsed_collision_mask());
+
+	const NavmeshSourceGeometryCache &cache = tile_map_layer->navmesh_source_geometry_cache;
+	const Transform2D tilemap_xform = p_source_geometry_data->root_node_transform * tile_map_layer->get_global_transform();
+
+	for (const Vector<Vector2> &outline : cache.traversable_outlines) {
+		p_source_geometry_data->_add_traversable_outline(tilemap_xform.xform(outline));
+	}
+	for (const Vector<Vector2> &outline : cache.obstruction_outlines) {
+		p_source_geometry_data->_add_obstruction_outline(tilemap_xform.xform(outline));
+	}
+}
+
 TileMapLayer::TileMapLayer() {
 	set_notify_transform(true);
 }
@@ -3186,6 +4089,47 @@ TileMapLayer::~TileMapLayer() {
 	_internal_update(true);
 }
 
+TerrainConstraintsGrid::Constraint &TerrainConstraintsGrid::_get_or_create(const Vector2i &p_base_cell_coords, int p_bit) {
+	Vector2i chunk_coords = _get_chunk_coords(p_base_cell_coords);
+	HashMap<Vector2i, Chunk>::Iterator E = chunks.find(chunk_coords);
+	if (!E) {
+		E = chunks.insert(chunk_coords, Chunk());
+	}
+	return E->value.constraints[_get_index(chunk_coords, p_base_cell_coords, p_bit)];
+}
+
+const TerrainConstraintsGrid::Constraint *TerrainConstraintsGrid::get(const Vector2i &p_base_cell_coords, int p_bit) const {
+	Vector2i chunk_coords = _get_chunk_coords(p_base_cell_coords);
+	const Chunk *chunk = chunks.getptr(chunk_coords);
+	if (!chunk) {
+		return nullptr;
+	}
+	const Constraint &constraint = chunk->constraints[_get_index(chunk_coords, p_base_cell_coords, p_bit)];
+	return constraint.valid ? &constraint : nullptr;
+}
+
+void TerrainConstraintsGrid::insert(const Vector2i &p_base_cell_coords, int p_bit, int p_terrain, int p_priority) {
+	ERR_FAIL_INDEX(p_bit, BITS_PER_CELL);
+	Constraint &constraint = _get_or_create(p_base_cell_coords, p_bit);
+	if (!constraint.valid) {
+		constraint.valid = true;
+		constraint.terrain = p_terrain;
+		constraint.priority = p_priority;
+	}
+}
+
+void TerrainConstraintsGrid::insert(const TerrainConstraint &p_constraint) {
+	insert(p_constraint.get_base_cell_coords(), p_constraint.get_bit(), p_constraint.get_terrain(), p_constraint.get_priority());
+}
+
+void TerrainConstraintsGrid::set(const Vector2i &p_base_cell_coords, int p_bit, int p_terrain, int p_priority) {
+	ERR_FAIL_INDEX(p_bit, BITS_PER_CELL);
+	Constraint &constraint = _get_or_create(p_base_cell_coords, p_bit);
+	constraint.valid = true;
+	constraint.terrain = p_terrain;
+	constraint.priority = p_priority;
+}
+
 HashMap<Vector2i, TileSet::CellNeighbor> TerrainConstraint::get_overlapping_coords_and_peering_bits() const {
 	HashMap<Vector2i, TileSet::CellNeighbor> output;
 
@@ -3301,45 +4245,41 @@ TerrainConstraint::TerrainConstraint(Ref<TileSet> p_tile_set, const Vector2i &p_
 	terrain = p_terrain;
 }
 
-TerrainConstraint::TerrainConstraint(Ref<TileSet> p_tile_set, const Vector2i &p_position, const TileSet::CellNeighbor &p_bit, int p_terrain) {
-	// The way we build the constraint make it easy to detect conflicting constraints.
-	ERR_FAIL_COND(p_tile_set.is_null());
-	tile_set = p_tile_set;
-
-	TileSet::TileShape shape = tile_set->get_tile_shape();
+void TerrainConstraint::get_base_cell_coords_and_bit(const TileSet *p_tile_set, const Vector2i &p_position, TileSet::CellNeighbor p_bit, Vector2i &r_base_cell_coords, int &r_bit) {
+	TileSet::TileShape shape = p_tile_set->get_tile_shape();
 	if (shape == TileSet::TILE_SHAPE_SQUARE) {
 		switch (p_bit) {
 			case TileSet::CELL_NEIGHBOR_RIGHT_SIDE:
-				bit = 1;
-				base_cell_coords = p_position;
+				r_bit = 1;
+				r_base_cell_coords = p_position;
 				break;
 			case TileSet::CELL_NEIGHBOR_BOTTOM_RIGHT_CORNER:
-				bit = 2;
-				base_cell_coords = p_position;
+				r_bit = 2;
+				r_base_cell_coords = p_position;
 				break;
 			case TileSet::CELL_NEIGHBOR_BOTTOM_SIDE:
-				bit = 3;
-				base_cell_coords = p_position;
+				r_bit = 3;
+				r_base_cell_coords = p_position;
 				break;
 			case TileSet::CELL_NEIGHBOR_BOTTOM_LEFT_CORNER:
-				bit = 2;
-				base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_LEFT_SIDE);
+				r_bit = 2;
+				r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_LEFT_SIDE);
 				break;
 			case TileSet::CELL_NEIGHBOR_LEFT_SIDE:
-				bit = 1;
-				base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_LEFT_SIDE);
+				r_bit = 1;
+				r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_LEFT_SIDE);
 				break;
 			case TileSet::CELL_NEIGHBOR_TOP_LEFT_CORNER:
-				bit = 2;
-				base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_CORNER);
+				r_bit = 2;
+				r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_CORNER);
 				break;
 			case TileSet::CELL_NEIGHBOR_TOP_SIDE:
-				bit = 3;
-				base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_SIDE);
+				r_bit = 3;
+				r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_SIDE);
 				break;
 			case TileSet::CELL_NEIGHBOR_TOP_RIGHT_CORNER:
-				bit = 2;
-				base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_SIDE);
+				r_bit = 2;
+				r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_SIDE);
 				break;
 			default:
 				ERR_FAIL();
@@ -3348,36 +4288,36 @@ TerrainConstraint::TerrainConstraint(Ref<TileSet> p_tile_set, const Vector2i &p_
 	} else if (shape == TileSet::TILE_SHAPE_ISOMETRIC) {
 		switch (p_bit) {
 			case TileSet::CELL_NEIGHBOR_RIGHT_CORNER:
-				bit = 2;
-				base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE);
+				r_bit = 2;
+				r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE);
 				break;
 			case TileSet::CELL_NEIGHBOR_BOTTOM_RIGHT_SIDE:
-				bit = 1;
-				base_cell_coords = p_position;
+				r_bit = 1;
+				r_base_cell_coords = p_position;
 				break;
 			case TileSet::CELL_NEIGHBOR_BOTTOM_CORNER:
-				bit = 2;
-				base_cell_coords = p_position;
+				r_bit = 2;
+				r_base_cell_coords = p_position;
 				break;
 			case TileSet::CELL_NEIGHBOR_BOTTOM_LEFT_SIDE:
-				bit = 3;
-				base_cell_coords = p_position;
+				r_bit = 3;
+				r_base_cell_coords = p_position;
 				break;
 			case TileSet::CELL_NEIGHBOR_LEFT_CORNER:
-				bit = 2;
-				base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
+				r_bit = 2;
+				r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
 				break;
 			case TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE:
-				bit = 1;
-				base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
+				r_bit = 1;
+				r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
 				break;
 			case TileSet::CELL_NEIGHBOR_TOP_CORNER:
-				bit = 2;
-				base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_CORNER);
+				r_bit = 2;
+				r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_CORNER);
 				break;
 			case TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE:
-				bit = 3;
-				base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE);
+				r_bit = 3;
+				r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE);
 				break;
 			default:
 				ERR_FAIL();
@@ -3385,56 +4325,56 @@ TerrainConstraint::TerrainConstraint(Ref<TileSet> p_tile_set, const Vector2i &p_
 		}
 	} else {
 		// Half-offset shapes.
-		TileSet::TileOffsetAxis offset_axis = tile_set->get_tile_offset_axis();
+		TileSet::TileOffsetAxis offset_axis = p_tile_set->get_tile_offset_axis();
 		if (offset_axis == TileSet::TILE_OFFSET_AXIS_HORIZONTAL) {
 			switch (p_bit) {
 				case TileSet::CELL_NEIGHBOR_RIGHT_SIDE:
-					bit = 1;
-					base_cell_coords = p_position;
+					r_bit = 1;
+					r_base_cell_coords = p_position;
 					break;
 				case TileSet::CELL_NEIGHBOR_BOTTOM_RIGHT_CORNER:
-					bit = 2;
-					base_cell_coords = p_position;
+					r_bit = 2;
+					r_base_cell_coords = p_position;
 					break;
 				case TileSet::CELL_NEIGHBOR_BOTTOM_RIGHT_SIDE:
-					bit = 3;
-					base_cell_coords = p_position;
+					r_bit = 3;
+					r_base_cell_coords = p_position;
 					break;
 				case TileSet::CELL_NEIGHBOR_BOTTOM_CORNER:
-					bit = 4;
-					base_cell_coords = p_position;
+					r_bit = 4;
+					r_base_cell_coords = p_position;
 					break;
 				case TileSet::CELL_NEIGHBOR_BOTTOM_LEFT_SIDE:
-					bit = 5;
-					base_cell_coords = p_position;
+					r_bit = 5;
+					r_base_cell_coords = p_position;
 					break;
 				case TileSet::CELL_NEIGHBOR_BOTTOM_LEFT_CORNER:
-					bit = 2;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_LEFT_SIDE);
+					r_bit = 2;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_LEFT_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_LEFT_SIDE:
-					bit = 1;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_LEFT_SIDE);
+					r_bit = 1;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_LEFT_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_TOP_LEFT_CORNER:
-					bit = 4;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
+					r_bit = 4;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE:
-					bit = 3;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
+					r_bit = 3;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_TOP_CORNER:
-					bit = 2;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
+					r_bit = 2;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE:
-					bit = 5;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE);
+					r_bit = 5;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_TOP_RIGHT_CORNER:
-					bit = 4;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE);
+					r_bit = 4;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE);
 					break;
 				default:
 					ERR_FAIL();
@@ -3443,52 +4383,52 @@ TerrainConstraint::TerrainConstraint(Ref<TileSet> p_tile_set, const Vector2i &p_
 		} else {
 			switch (p_bit) {
 				case TileSet::CELL_NEIGHBOR_RIGHT_CORNER:
-					bit = 1;
-					base_cell_coords = p_position;
+					r_bit = 1;
+					r_base_cell_coords = p_position;
 					break;
 				case TileSet::CELL_NEIGHBOR_BOTTOM_RIGHT_SIDE:
-					bit = 2;
-					base_cell_coords = p_position;
+					r_bit = 2;
+					r_base_cell_coords = p_position;
 					break;
 				case TileSet::CELL_NEIGHBOR_BOTTOM_RIGHT_CORNER:
-					bit = 3;
-					base_cell_coords = p_position;
+					r_bit = 3;
+					r_base_cell_coords = p_position;
 					break;
 				case TileSet::CELL_NEIGHBOR_BOTTOM_SIDE:
-					bit = 4;
-					base_cell_coords = p_position;
+					r_bit = 4;
+					r_base_cell_coords = p_position;
 					break;
 				case TileSet::CELL_NEIGHBOR_BOTTOM_LEFT_CORNER:
-					bit = 1;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_BOTTOM_LEFT_SIDE);
+					r_bit = 1;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_BOTTOM_LEFT_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_BOTTOM_LEFT_SIDE:
-					bit = 5;
-					base_cell_coords = p_position;
+					r_bit = 5;
+					r_base_cell_coords = p_position;
 					break;
 				case TileSet::CELL_NEIGHBOR_LEFT_CORNER:
-					bit = 3;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
+					r_bit = 3;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE:
-					bit = 2;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
+					r_bit = 2;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_TOP_LEFT_CORNER:
-					bit = 1;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
+					r_bit = 1;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_LEFT_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_TOP_SIDE:
-					bit = 4;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_SIDE);
+					r_bit = 4;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_TOP_RIGHT_CORNER:
-					bit = 3;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_SIDE);
+					r_bit = 3;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_SIDE);
 					break;
 				case TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE:
-					bit = 5;
-					base_cell_coords = tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE);
+					r_bit = 5;
+					r_base_cell_coords = p_tile_set->get_neighbor_cell(p_position, TileSet::CELL_NEIGHBOR_TOP_RIGHT_SIDE);
 					break;
 				default:
 					ERR_FAIL();
@@ -3496,5 +4436,12 @@ TerrainConstraint::TerrainConstraint(Ref<TileSet> p_tile_set, const Vector2i &p_
 			}
 		}
 	}
+}
+
+TerrainConstraint::TerrainConstraint(Ref<TileSet> p_tile_set, const Vector2i &p_position, const TileSet::CellNeighbor &p_bit, int p_terrain) {
+	// The way we build the constraint make it easy to detect conflicting constraints.
+	ERR_FAIL_COND(p_tile_set.is_null());
+	tile_set = p_tile_set;
+	get_base_cell_coords_and_bit(*tile_set, p_position, p_bit, base_cell_coords, bit);
 	terrain = p_terrain;
 }
@@ -31,6 +31,7 @@
 #ifndef TILE_MAP_LAYER_H
 #define TILE_MAP_LAYER_H
 
+#include "core/templates/paged_allocator.h"
 #include "scene/resources/2d/tile_set.h"
 
 class NavigationMeshSourceGeometryData2D;
@@ -67,6 +68,10 @@ public:
 		return base_cell_coords;
 	}
 
+	int get_bit() const {
+		return bit;
+	}
+
 	bool is_center_bit() const {
 		return bit == 0;
 	}
@@ -89,22 +94,66 @@ public:
 		return priority;
 	}
 
+	// Computes the base cell and bit shared by all the peering bits at the same position.
+	static void get_base_cell_coords_and_bit(const TileSet *p_tile_set, const Vector2i &p_position, TileSet::CellNeighbor p_bit, Vector2i &r_base_cell_coords, int &r_bit);
+
 	TerrainConstraint(Ref<TileSet> p_tile_set, const Vector2i &p_position, int p_terrain); // For the center terrain bit
 	TerrainConstraint(Ref<TileSet> p_tile_set, const Vector2i &p_position, const TileSet::CellNeighbor &p_bit, int p_terrain); // For peering bits
 	TerrainConstraint() {}
 };
 
+// Terrain constraints stored in dense arrays, indexed by base cell coords and bit, by chunks.
+class TerrainConstraintsGrid {
+public:
+	static constexpr int CHUNK_SIZE = 16;
+	static constexpr int BITS_PER_CELL = 6; // The center bit and up to 5 peering bits per base cell.
+
+	struct Constraint {
+		bool valid = false;
+		int terrain = -1;
+		int priority = 1;
+	};
+
+private:
+	struct Chunk {
+		Constraint constraints[CHUNK_SIZE * CHUNK_SIZE * BITS_PER_CELL];
+	};
+	HashMap<Vector2i, Chunk> chunks;
+
+	_FORCE_INLINE_ static Vector2i _get_chunk_coords(const Vector2i &p_base_cell_coords) {
+		return Vector2i(Math::floor((double)p_base_cell_coords.x / CHUNK_SIZE), Math::floor((double)p_base_cell_coords.y / CHUNK_SIZE));
+	}
+	_FORCE_INLINE_ static int _get_index(const Vector2i &p_chunk_coords, const Vector2i &p_base_cell_coords, int p_bit) {
+		Vector2i in_chunk_coords = p_base_cell_coords - p_chunk_coords * CHUNK_SIZE;
+		return (in_chunk_coords.y * CHUNK_SIZE + in_chunk_coords.x) * BITS_PER_CELL + p_bit;
+	}
+	Constraint &_get_or_create(const Vector2i &p_base_cell_coords, int p_bit);
+
+public:
+	// Returns nullptr if there is no constraint.
+	const Constraint *get(const Vector2i &p_base_cell_coords, int p_bit) const;
+
+	// Does not replace an existing constraint, like inserting in a RBSet<TerrainConstraint>.
+	void insert(const Vector2i &p_base_cell_coords, int p_bit, int p_terrain, int p_priority);
+	void insert(const TerrainConstraint &p_constraint);
+	void set(const Vector2i &p_base_cell_coords, int p_bit, int p_terrain, int p_priority);
+};
+
 #ifdef DEBUG_ENABLED
 class DebugQuadrant;
 #endif // DEBUG_ENABLED
 class RenderingQuadrant;
+class PhysicsQuadrant;
+class NavigationQuadrant;
 
 struct CellData {
 	Vector2i coords;
 	TileMapCell cell;
 
+#ifdef DEBUG_ENABLED
 	// Debug.
 	SelfList<CellData> debug_quadrant_list_element;
+#endif // DEBUG_ENABLED
 
 	// Rendering.
 	Ref<RenderingQuadrant> rendering_quadrant;
@@ -112,10 +161,12 @@ struct CellData {
 	LocalVector<LocalVector<RID>> occluders;
 
 	// Physics.
-	LocalVector<RID> bodies;
+	Ref<PhysicsQuadrant> physics_quadrant;
+	SelfList<CellData> physics_quadrant_list_element;
 
 	// Navigation.
-	LocalVector<RID> navigation_regions;
+	Ref<NavigationQuadrant> navigation_quadrant;
+	SelfList<CellData> navigation_quadrant_list_element;
 
 	// Scenes.
 	String scene;
@@ -135,32 +186,39 @@ struct CellData {
 		coords = p_other.coords;
 		cell = p_other.cell;
 		occluders = p_other.occluders;
-		bodies = p_other.bodies;
-		navigation_regions = p_other.navigation_regions;
 		scene = p_other.scene;
 		runtime_tile_data_cache = p_other.runtime_tile_data_cache;
 	}
 
 	CellData(const CellData &p_other) :
+#ifdef DEBUG_ENABLED
 			debug_quadrant_list_element(this),
+#endif // DEBUG_ENABLED
 			rendering_quadrant_list_element(this),
+			physics_quadrant_list_element(this),
+			navigation_quadrant_list_element(this),
 			dirty_list_element(this) {
 		coords = p_other.coords;
 		cell = p_other.cell;
 		occluders = p_other.occluders;
-		bodies = p_other.bodies;
-		navigation_regions = p_other.navigation_regions;
 		scene = p_other.scene;
 		runtime_tile_data_cache = p_other.runtime_tile_data_cache;
 	}
 
 	CellData() :
+#ifdef DEBUG_ENABLED
 			debug_quadrant_list_element(this),
+#endif // DEBUG_ENABLED
 			rendering_quadrant_list_element(this),
+			physics_quadrant_list_element(this),
+			navigation_quadrant_list_element(this),
 			dirty_list_element(this) {
 	}
 };
 
+// The runtime data of the cells is allocated by pages, so that the cells of a chunk activated together share their memory.
+typedef HashMap<Vector2i, CellData, HashMapHasherDefault, HashMapComparatorDefault<Vector2i>, PagedAllocator<HashMapElement<Vector2i, CellData>, false, 64>> CellDataMap;
+
 // We use another comparator for Y-sorted layers with reversed X drawing order.
 struct CellDataYSortedXReversedComparator {
 	_FORCE_INLINE_ bool operator()(const CellData &p_a, const CellData &p_b) const {
@@ -189,10 +247,40 @@ public:
 };
 #endif // DEBUG_ENABLED
 
+// A drawing operation of a tile. Those are generated without calling the RenderingServer, then submitted all at once.
+struct TileDrawCommand {
+	enum Type {
+		TYPE_TEXTURE_RECT_REGION,
+		TYPE_ANIMATION_SLICE,
+	};
+
+	Type type = TYPE_TEXTURE_RECT_REGION;
+	uint32_t canvas_item_index = 0;
+
+	// Texture rect region.
+	const Texture2D *texture = nullptr;
+	Rect2 rect;
+	Rect2 source_rect;
+	Color modulate;
+	bool transpose = false;
+	bool clip_uv = false;
+
+	// Animation slice.
+	double animation_length = 0.0;
+	double slice_begin = 0.0;
+	double slice_end = 0.0;
+	double animation_offset = 0.0;
+};
+
 class RenderingQuadrant : public RefCounted {
 	GDCLASS(RenderingQuadrant, RefCounted);
 
 public:
+	struct CanvasItemDescriptor {
+		Ref<Material> material;
+		int z_index = 0;
+	};
+
 	struct CoordsWorldComparator {
 		_ALWAYS_INLINE_ bool operator()(const Vector2 &p_a, const Vector2 &p_b) const {
 			// We sort the cells by their local coords, as it is needed by rendering.
@@ -209,6 +297,9 @@ public:
 	List<RID> canvas_items;
 	Vector2 canvas_items_position;
 
+	// Whether the quadrant still has a tile after its last update.
+	bool pending_has_a_tile = false;
+
 	SelfList<RenderingQuadrant> dirty_quadrant_list_element;
 
 	RenderingQuadrant() :
@@ -220,6 +311,62 @@ public:
 	}
 };
 
+// Groups the collision shapes of the cells in a quadrant into a few bodies.
+class PhysicsQuadrant : public RefCounted {
+	GDCLASS(PhysicsQuadrant, RefCounted);
+
+public:
+	struct Body {
+		// Those properties are set on the whole body, so cells only share a body if they match.
+		int physics_layer = 0;
+		Vector2 linear_velocity;
+		real_t angular_velocity = 0.0;
+
+		RID rid;
+		LocalVector<Ref<ConvexPolygonShape2D>> merged_shapes; // Shapes covering several merged cells.
+		LocalVector<Vector2i> merged_shapes_coords; // Coords of the top-left cell of each merged shape.
+		LocalVector<Vector2i> shapes_coords; // Coords of the cell each shape comes from.
+		LocalVector<Vector2i> shapes_end_coords; // Coords of the bottom-right cell each shape covers, the same as shapes_coords unless the shape was merged.
+	};
+
+	Vector2i quadrant_coords;
+	SelfList<CellData>::List cells;
+	Vector2 bodies_position;
+	LocalVector<Body> bodies;
+	bool debug_redraw = false; // Set when the bodies were rebuilt, so the debug collisions of all the cells are redrawn.
+
+	SelfList<PhysicsQuadrant> dirty_quadrant_list_element;
+
+	PhysicsQuadrant() :
+			dirty_quadrant_list_element(this) {
+	}
+
+	~PhysicsQuadrant() {
+		cells.clear();
+	}
+};
+
+// Merges the navigation polygons of the cells in a quadrant into a region per navigation layer.
+class NavigationQuadrant : public RefCounted {
+	GDCLASS(NavigationQuadrant, RefCounted);
+
+public:
+	Vector2i quadrant_coords;
+	SelfList<CellData>::List cells;
+	Vector2 regions_position;
+	LocalVector<RID> regions;
+
+	SelfList<NavigationQuadrant> dirty_quadrant_list_element;
+
+	NavigationQuadrant() :
+			dirty_quadrant_list_element(this) {
+	}
+
+	~NavigationQuadrant() {
+		cells.clear();
+	}
+};
+
 class TileMapLayer : public Node2D {
 	GDCLASS(TileMapLayer, Node2D);
 
@@ -255,10 +402,12 @@ public:
 		DIRTY_FLAGS_LAYER_COLLISION_ENABLED,
 		DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES,
 		DIRTY_FLAGS_LAYER_COLLISION_VISIBILITY_MODE,
+		DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE,
 		DIRTY_FLAGS_LAYER_OCCLUSION_ENABLED,
 		DIRTY_FLAGS_LAYER_NAVIGATION_ENABLED,
 		DIRTY_FLAGS_LAYER_NAVIGATION_MAP,
 		DIRTY_FLAGS_LAYER_NAVIGATION_VISIBILITY_MODE,
+		DIRTY_FLAGS_LAYER_NAVIGATION_QUADRANT_SIZE,
 		DIRTY_FLAGS_LAYER_RUNTIME_UPDATE,
 
 		DIRTY_FLAGS_LAYER_INDEX_IN_TILE_MAP_NODE, // For compatibility.
@@ -273,9 +422,43 @@ public:
 
 private:
 	static constexpr float FP_ADJUST = 0.00001;
+	static constexpr int CELL_CHUNK_SIZE = 32;
+
+	// Cells are stored packed, by chunks of CELL_CHUNK_SIZE * CELL_CHUNK_SIZE.
+	// Chunks with few cells only store their used cells, sorted by index. They switch to storing all their cells above
+	// CELL_CHUNK_DENSE_THRESHOLD used cells, and back under half of it.
+	static constexpr uint32_t CELL_CHUNK_DENSE_THRESHOLD = 256;
+	static constexpr uint32_t CELL_CHUNK_FILE_MAGIC = 0x434c4d54; // "TMLC".
+	struct CellChunk {
+		LocalVector<TileMapCell> cells; // All the cells of the chunk if dense, else only the used ones.
+		LocalVector<uint16_t> sparse_indices; // Index in the chunk of each used cell, if sparse.
+		uint32_t used_cells_count = 0;
+		bool dense = false;
+		bool active = false; // Whether the cells have their runtime data in tile_map_layer_data.
+
+		uint32_t _find_sparse_position(int p_index) const;
+		TileMapCell get_cell(int p_index) const;
+		void set_cell(int p_index, const TileMapCell &p_cell);
+
+		// Calls p_callback(index, cell) on every used cell of the chunk, by increasing index.
+		template <typename Callback>
+		void for_each_used_cell(Callback p_callback) const {
+			if (dense) {
+				for (uint32_t i = 0; i < cells.size(); i++) {
+					if (cells[i].source_id != TileSet::INVALID_SOURCE) {
+						p_callback(i, cells[i]);
+					}
+				}
+			} else {
+				for (uint32_t i = 0; i < cells.size(); i++) {
+					p_callback(sparse_indices[i], cells[i]);
+				}
+			}
+		}
+	};
 
 	// Properties.
-	HashMap<Vector2i, CellData> tile_map_layer_data;
+	HashMap<Vector2i, CellChunk> cell_chunks;
 
 	bool enabled = true;
 	Ref<TileSet> tile_set;
@@ -289,16 +472,33 @@ private:
 	bool collision_enabled = true;
 	bool use_kinematic_bodies = false;
 	DebugVisibilityMode collision_visibility_mode = DEBUG_VISIBILITY_MODE_DEFAULT;
+	int physics_quadrant_size = 1;
 
 	bool occlusion_enabled = true;
 
 	bool navigation_enabled = true;
 	RID navigation_map_override;
 	DebugVisibilityMode navigation_visibility_mode = DEBUG_VISIBILITY_MODE_DEFAULT;
+	int navigation_quadrant_size = 16;
+
+	bool cell_streaming_enabled = false;
+	int cell_streaming_radius = 2;
+	String cell_streaming_path;
+	Vector2i cell_streaming_focus;
 
 	// Internal.
 	bool pending_update = false;
 
+	// Runtime data of the cells in active chunks.
+	CellDataMap tile_map_layer_data;
+
+	// Chunks streamed out to disk, with their used cells count. A chunk is either in cell_chunks or saved to disk.
+	HashMap<Vector2i, uint32_t> cell_chunks_on_disk;
+	// Files are written in a directory specific to the layer and session, so that files left by other layers or
+	// previous sessions are never loaded.
+	uint64_t cell_streaming_session_id = 0;
+	String cell_streaming_session_path;
+
 	// For keeping compatibility with TileMap.
 	TileMap *tile_map_node = nullptr;
 	int layer_index_in_tile_map_node = -1;
@@ -315,6 +515,25 @@ private:
 	mutable Rect2i used_rect_cache;
 	mutable bool used_rect_cache_dirty = true;
 
+	// Cell chunks.
+	_FORCE_INLINE_ Vector2i _coords_to_cell_chunk_coords(const Vector2i &p_coords) const { return _coords_to_quadrant_coords(p_coords, CELL_CHUNK_SIZE); }
+	_FORCE_INLINE_ static Vector2i _get_cell_chunk_cell_coords(const Vector2i &p_chunk_coords, int p_index) { return p_chunk_coords * CELL_CHUNK_SIZE + Vector2i(p_index % CELL_CHUNK_SIZE, p_index / CELL_CHUNK_SIZE); }
+	_FORCE_INLINE_ static int _get_cell_chunk_index(const Vector2i &p_chunk_coords, const Vector2i &p_coords) { return (p_coords.y - p_chunk_coords.y * CELL_CHUNK_SIZE) * CELL_CHUNK_SIZE + p_coords.x - p_chunk_coords.x * CELL_CHUNK_SIZE; }
+	CellChunk *_get_cell_chunk(const Vector2i &p_chunk_coords, bool p_create);
+	void _set_cell_chunk_active(const Vector2i &p_chunk_coords, CellChunk &r_chunk, bool p_active);
+	void _set_cell_data(const Vector2i &p_coords, const TileMapCell &p_cell);
+
+	// Cell streaming.
+	_FORCE_INLINE_ bool _is_cell_streaming_to_disk() const { return cell_streaming_enabled && !cell_streaming_path.is_empty(); }
+	bool _is_cell_chunk_streamed_in(const Vector2i &p_chunk_coords) const;
+	String _get_cell_chunk_file_path(const Vector2i &p_chunk_coords) const;
+	bool _read_cell_chunk_file(const Vector2i &p_chunk_coords, CellChunk &r_chunk) const;
+	bool _load_cell_chunk(const Vector2i &p_chunk_coords);
+	bool _save_cell_chunk(const Vector2i &p_chunk_coords, const CellChunk &p_chunk);
+	void _load_all_cell_chunks();
+	void _clear_cell_chunk_files();
+	void _update_cell_streaming();
+
 	// Runtime tile data.
 	bool _runtime_update_tile_data_was_cleaned_up = false;
 	void _build_runtime_update_tile_data(bool p_force_cleanup);
@@ -325,6 +544,9 @@ private:
 	void _update_cells_callback(bool p_force_cleanup);
 
 	// Per-system methods.
+	Vector2i _coords_to_quadrant_coords(const Vector2i &p_coords, int p_quadrant_size) const;
+	const TileData *_get_cell_data_tile_data(const CellData &p_cell_data) const;
+
 #ifdef DEBUG_ENABLED
 	HashMap<Vector2i, Ref<DebugQuadrant>> debug_quadrant_map;
 	Vector2i _coords_to_debug_quadrant_coords(const Vector2i &p_coords) const;
@@ -333,32 +555,59 @@ private:
 	void _debug_quadrants_update_cell(CellData &r_cell_data, SelfList<DebugQuadrant>::List &r_dirty_debug_quadrant_list);
 #endif // DEBUG_ENABLED
 
+	// Under this number of dirty rendering quadrants, they are built on the calling thread.
+	static constexpr int RENDERING_QUADRANTS_THREADED_UPDATE_THRESHOLD = 4;
+	struct RenderingQuadrantsBuild {
+		LocalVector<RenderingQuadrant *> quadrants;
+		bool y_sorted_x_reversed = false;
+		Color self_modulate;
+
+		// The commands built for each quadrant, submitted afterwards on the calling thread.
+		LocalVector<LocalVector<RenderingQuadrant::CanvasItemDescriptor>> canvas_items;
+		LocalVector<LocalVector<TileDrawCommand>> draw_commands;
+
+		// Canvas items settings, read on the calling thread.
+		RID parent_canvas_item;
+		uint32_t light_mask = 1;
+		RS::CanvasItemTextureFilter texture_filter = RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT;
+		RS::CanvasItemTextureRepeat texture_repeat = RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT;
+		bool needs_set_not_interpolated = false;
+		bool needs_reset_physics_interpolation = false;
+	};
+
 	HashMap<Vector2i, Ref<RenderingQuadrant>> rendering_quadrant_map;
 	bool _rendering_was_cleaned_up = false;
 	void _rendering_update(bool p_force_cleanup);
 	void _rendering_notification(int p_what);
 	void _rendering_quadrants_update_cell(CellData &r_cell_data, SelfList<RenderingQuadrant>::List &r_dirty_rendering_quadrant_list);
+	void _rendering_build_quadrant(uint32_t p_index, RenderingQuadrantsBuild *p_build);
+	void _rendering_submit_quadrant(RenderingQuadrant *p_rendering_quadrant, const RenderingQuadrantsBuild *p_build, const LocalVector<RenderingQuadrant::CanvasItemDescriptor> &p_canvas_items, const LocalVector<TileDrawCommand> &p_draw_commands);
 	void _rendering_occluders_clear_cell(CellData &r_cell_data);
 	void _rendering_occluders_update_cell(CellData &r_cell_data);
 #ifdef DEBUG_ENABLED
 	void _rendering_draw_cell_debug(const RID &p_canvas_item, const Vector2 &p_quadrant_pos, const CellData &r_cell_data);
 #endif // DEBUG_ENABLED
 
-	HashMap<RID, Vector2i> bodies_coords; // Mapping for RID to coords.
+	HashMap<Vector2i, Ref<PhysicsQuadrant>> physics_quadrant_map;
+	HashMap<RID, Ref<PhysicsQuadrant>> bodies_quadrants; // Mapping for RID to quadrant.
 	bool _physics_was_cleaned_up = false;
 	void _physics_update(bool p_force_cleanup);
 	void _physics_notification(int p_what);
-	void _physics_clear_cell(CellData &r_cell_data);
-	void _physics_update_cell(CellData &r_cell_data);
+	void _physics_quadrants_update_cell(CellData &r_cell_data, SelfList<PhysicsQuadrant>::List &r_dirty_physics_quadrant_list);
+	void _physics_clear_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant);
+	void _physics_update_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant);
+	const PhysicsQuadrant::Body *_get_physics_quadrant_body(RID p_physics_body) const;
 #ifdef DEBUG_ENABLED
 	void _physics_draw_cell_debug(const RID &p_canvas_item, const Vector2 &p_quadrant_pos, const CellData &r_cell_data);
 #endif // DEBUG_ENABLED
 
+	HashMap<Vector2i, Ref<NavigationQuadrant>> navigation_quadrant_map;
 	bool _navigation_was_cleaned_up = false;
 	void _navigation_update(bool p_force_cleanup);
 	void _navigation_notification(int p_what);
-	void _navigation_clear_cell(CellData &r_cell_data);
-	void _navigation_update_cell(CellData &r_cell_data);
+	void _navigation_quadrants_update_cell(CellData &r_cell_data, SelfList<NavigationQuadrant>::List &r_dirty_navigation_quadrant_list);
+	void _navigation_clear_quadrant(const Ref<NavigationQuadrant> &p_navigation_quadrant);
+	void _navigation_update_quadrant(const Ref<NavigationQuadrant> &p_navigation_quadrant);
 #ifdef DEBUG_ENABLED
 	void _navigation_draw_cell_debug(const RID &p_canvas_item, const Vector2 &p_quadrant_pos, const CellData &r_cell_data);
 #endif // DEBUG_ENABLED
@@ -372,9 +621,32 @@ private:
 #endif // DEBUG_ENABLED
 
 	// Terrains.
-	TileSet::TerrainsPattern _get_best_terrain_pattern_for_constraints(int p_terrain_set, const Vector2i &p_position, const RBSet<TerrainConstraint> &p_constraints, TileSet::TerrainsPattern p_current_pattern) const;
-	RBSet<TerrainConstraint> _get_terrain_constraints_from_added_pattern(const Vector2i &p_position, int p_terrain_set, TileSet::TerrainsPattern p_terrains_pattern) const;
-	RBSet<TerrainConstraint> _get_terrain_constraints_from_painted_cells_list(const RBSet<Vector2i> &p_painted, int p_terrain_set, bool p_ignore_empty_terrains) const;
+	// Under this number of cells, the cells are read on the calling thread when solving terrains.
+	static constexpr int TERRAINS_THREADED_READ_THRESHOLD = 1024;
+	struct TerrainsCellSlots {
+		// The center bit, then the peering bits of the terrain set.
+		Vector2i base_cell_coords[1 + TileSet::CELL_NEIGHBOR_MAX];
+		int bits[1 + TileSet::CELL_NEIGHBOR_MAX] = {};
+	};
+	struct TerrainsCellsRead {
+		const Vector2i *coords = nullptr;
+		int terrain_set = -1;
+		LocalVector<const TileData *> tile_data; // nullptr if the cell has no tile of the terrain set.
+	};
+	struct TerrainsPaintedConstraints {
+		int terrain_set = -1;
+		bool ignore_empty_terrains = false;
+		LocalVector<TerrainConstraint> constraints;
+		LocalVector<int> terrains; // The most common terrain around each constraint, or -2 if none.
+	};
+	const TileData *_get_cell_terrains_tile_data(const Vector2i &p_coords, int p_terrain_set) const;
+	void _read_terrains_cell(uint32_t p_index, TerrainsCellsRead *p_read) const;
+	void _read_terrains_painted_constraint(uint32_t p_index, TerrainsPaintedConstraints *p_painted_constraints) const;
+	void _get_terrains_cell_slots(const Vector2i &p_position, const TileSet::TerrainsLookup &p_lookup, TerrainsCellSlots &r_slots) const;
+	TileSet::TerrainsPattern _get_best_terrain_pattern_for_constraints(const TileSet::TerrainsLookup &p_lookup, const TerrainsCellSlots &p_slots, const TerrainConstraintsGrid &p_constraints, const TileSet::TerrainsPattern &p_current_pattern) const;
+	void _add_terrain_constraints_from_added_pattern(const Vector2i &p_position, int p_terrain_set, const TileSet::TerrainsPattern &p_terrains_pattern, int p_priority, TerrainConstraintsGrid &r_constraints) const;
+	void _add_terrain_constraints_from_painted_cells_list(const RBSet<Vector2i> &p_painted, int p_terrain_set, bool p_ignore_empty_terrains, TerrainConstraintsGrid &r_constraints) const;
+	HashMap<Vector2i, TileSet::TerrainsPattern> _terrain_fill_constraints(const Vector<Vector2i> &p_to_replace, int p_terrain_set, TerrainConstraintsGrid &r_constraints) const;
 
 	void _tile_set_changed();
 
@@ -407,7 +679,7 @@ public:
 	int get_index_in_tile_map() const {
 		return layer_index_in_tile_map_node;
 	}
-	const HashMap<Vector2i, CellData> &get_tile_map_layer_data() const {
+	const CellDataMap &get_tile_map_layer_data() const {
 		return tile_map_layer_data;
 	}
 
@@ -423,6 +695,8 @@ public:
 	// Not exposed to users.
 	TileMapCell get_cell(const Vector2i &p_coords) const;
 
+	static void build_tile_draw_commands(LocalVector<TileDrawCommand> &r_commands, uint32_t p_canvas_item_index, const Vector2 &p_position, const Ref<TileSet> &p_tile_set, int p_atlas_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile, int p_frame = -1, Color p_modulation = Color(1.0, 1.0, 1.0, 1.0), const TileData *p_tile_data_override = nullptr, real_t p_normalized_animation_offset = 0.0);
+	static void submit_tile_draw_commands(const LocalVector<TileDrawCommand> &p_commands, const RID *p_canvas_items);
 	static void draw_tile(RID p_canvas_item, const Vector2 &p_position, const Ref<TileSet> p_tile_set, int p_atlas_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile, int p_frame = -1, Color p_modulation = Color(1.0, 1.0, 1.0, 1.0), const TileData *p_tile_data_override = nullptr, real_t p_normalized_animation_offset = 0.0);
 
 	////////////// Exposed functions //////////////
@@ -458,6 +732,8 @@ public:
 	// --- Physics helpers ---
 	bool has_body_rid(RID p_physics_body) const;
 	Vector2i get_coords_for_body_rid(RID p_physics_body) const; // For finding tiles from collision.
+	Vector2i get_coords_for_body_shape(RID p_physics_body, int p_body_shape_index) const;
+	Vector2i get_coords_for_body_shape_at(RID p_physics_body, int p_body_shape_index, const Vector2 &p_position) const;
 
 	// --- Runtime ---
 	void update_internals();
@@ -502,6 +778,8 @@ public:
 	bool is_using_kinematic_bodies() const;
 	void set_collision_visibility_mode(DebugVisibilityMode p_show_collision);
 	DebugVisibilityMode get_collision_visibility_mode() const;
+	void set_physics_quadrant_size(int p_size);
+	int get_physics_quadrant_size() const;
 
 	void set_occlusion_enabled(bool p_enabled);
 	bool is_occlusion_enabled() const;
@@ -512,11 +790,33 @@ public:
 	RID get_navigation_map() const;
 	void set_navigation_visibility_mode(DebugVisibilityMode p_show_navigation);
 	DebugVisibilityMode get_navigation_visibility_mode() const;
+	void set_navigation_quadrant_size(int p_size);
+	int get_navigation_quadrant_size() const;
+
+	void set_cell_streaming_enabled(bool p_enabled);
+	bool is_cell_streaming_enabled() const;
+	void set_cell_streaming_radius(int p_radius);
+	int get_cell_streaming_radius() const;
+	void set_cell_streaming_path(const String &p_path);
+	String get_cell_streaming_path() const;
+	void set_cell_streaming_focus(const Vector2i &p_coords);
+	Vector2i get_cell_streaming_focus() const;
 
 private:
 	static Callable _navmesh_source_geometry_parsing_callback;
 	static RID _navmesh_source_geometry_parser;
 
+	// Outlines parsed from the cells in the local space of the layer, reused by navigation mesh baking until the layer is modified.
+	struct NavmeshSourceGeometryCache {
+		bool dirty = true;
+		int parsed_geometry_type = -1;
+		uint32_t parsed_collision_mask = 0;
+		LocalVector<Vector<Vector2>> traversable_outlines;
+		LocalVector<Vector<Vector2>> obstruction_outlines;
+	} navmesh_source_geometry_cache;
+
+	void _navmesh_update_source_geometry_cache(int p_parsed_geometry_type, uint32_t p_parsed_collision_mask);
+
 public:
 	static void navmesh_parse_init();
 	static void navmesh_parse_source_geometry(const Ref<NavigationPolygon> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData2D> p_source_geometry_data, Node *p_node);
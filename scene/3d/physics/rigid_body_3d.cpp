@@ -141,24 +141,66 @@ struct _RigidBodyInOut {
 	int local_shape = 0;
 };
 
-void RigidBody3D::_sync_body_state(PhysicsDirectBodyState3D *p_state) {
+void RigidBody3D::_apply_body_state(const PhysicsServer3D::BodyStateSync &p_state) {
 	set_ignore_transform_notification(true);
-	set_global_transform(p_state->get_transform());
+	set_global_transform(p_state.transform);
 	set_ignore_transform_notification(false);
 
-	linear_velocity = p_state->get_linear_velocity();
-	angular_velocity = p_state->get_angular_velocity();
+	linear_velocity = p_state.linear_velocity;
+	angular_velocity = p_state.angular_velocity;
 
-	inverse_inertia_tensor = p_state->get_inverse_inertia_tensor();
+	inverse_inertia_tensor = p_state.inverse_inertia_tensor;
 
-	contact_count = p_state->get_contact_count();
+	contact_count = p_state.contact_count;
 
-	if (sleeping != p_state->is_sleeping()) {
-		sleeping = p_state->is_sleeping();
+	if (sleeping != p_state.sleeping) {
+		sleeping = p_state.sleeping;
 		emit_signal(SceneStringName(sleeping_state_changed));
 	}
 }
 
+void RigidBody3D::_sync_body_state(PhysicsDirectBodyState3D *p_state) {
+	PhysicsServer3D::BodyStateSync state;
+	state.transform = p_state->get_transform();
+	state.linear_velocity = p_state->get_linear_velocity();
+	state.angular_velocity = p_state->get_angular_velocity();
+	state.inverse_inertia_tensor = p_state->get_inverse_inertia_tensor();
+	state.contact_count = p_state->get_contact_count();
+	state.sleeping = p_state->is_sleeping();
+	_apply_body_state(state);
+}
+
+void RigidBody3D::_sync_body_state_bulk(const PhysicsServer3D::BodyStateSync &p_state) {
+	lock_callback();
+	_apply_body_state(p_state);
+	_on_transform_changed();
+	unlock_callback();
+}
+
+void RigidBody3D::_body_state_sync_bulk(const PhysicsServer3D::BodyStateSync *p_states, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		RigidBody3D *body = Object::cast_to<RigidBody3D>(ObjectDB::get_instance(p_states[i].instance_id));
+		if (body && body->state_sync_bulk) {
+			body->_sync_body_state_bulk(p_states[i]);
+		}
+	}
+}
+
+bool RigidBody3D::_can_sync_state_in_bulk() const {
+	// The bulk path carries neither contacts nor a direct body state.
+	return !contact_monitor && !GDVIRTUAL_IS_OVERRIDDEN(_integrate_forces);
+}
+
+void RigidBody3D::_update_state_sync_bulk() {
+	bool enable = _can_sync_state_in_bulk();
+	if (enable == state_sync_bulk) {
+		return;
+	}
+
+	state_sync_bulk = enable;
+	PhysicsServer3D::get_singleton()->body_set_state_sync_bulk(get_rid(), state_sync_bulk);
+}
+
 void RigidBody3D::_body_state_changed(PhysicsDirectBodyState3D *p_state) {
 	lock_callback();
 
@@ -259,19 +301,23 @@ void RigidBody3D::_body_state_changed(PhysicsDirectBodyState3D *p_state) {
 }
 
 void RigidBody3D::_notification(int p_what) {
-#ifdef TOOLS_ENABLED
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
+			_update_state_sync_bulk();
+
+#ifdef TOOLS_ENABLED
 			if (Engine::get_singleton()->is_editor_hint()) {
 				set_notify_local_transform(true); // Used for warnings and only in editor.
 			}
+#endif
 		} break;
 
+#ifdef TOOLS_ENABLED
 		case NOTIFICATION_LOCAL_TRANSFORM_CHANGED: {
 			update_configuration_warnings();
 		} break;
-	}
 #endif
+	}
 }
 
 void RigidBody3D::_apply_body_mode() {
@@ -623,6 +669,8 @@ void RigidBody3D::set_contact_monitor(bool p_enabled) {
 		contact_monitor->locked = false;
 	}
 
+	_update_state_sync_bulk();
+
 	notify_property_list_changed();
 }
 
@@ -819,6 +867,8 @@ void RigidBody3D::_validate_property(PropertyInfo &p_property) const {
 RigidBody3D::RigidBody3D() :
 		PhysicsBody3D(PhysicsServer3D::BODY_MODE_RIGID) {
 	PhysicsServer3D::get_singleton()->body_set_state_sync_callback(get_rid(), callable_mp(this, &RigidBody3D::_body_state_changed));
+	// A script overriding _integrate_forces() needs the direct body state.
+	connect(CoreStringName(script_changed), callable_mp(this, &RigidBody3D::_update_state_sync_bulk));
 }
 
 RigidBody3D::~RigidBody3D() {
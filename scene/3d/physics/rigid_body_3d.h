@@ -84,6 +84,7 @@ private:
 	int contact_count = 0;
 
 	bool custom_integrator = false;
+	bool state_sync_bulk = false;
 
 	struct ShapePair {
 		int body_shape = 0;
@@ -128,7 +129,10 @@ private:
 	void _body_inout(int p_status, const RID &p_body, ObjectID p_instance, int p_body_shape, int p_local_shape);
 	static void _body_state_changed_callback(void *p_instance, PhysicsDirectBodyState3D *p_state);
 
+	void _apply_body_state(const PhysicsServer3D::BodyStateSync &p_state);
 	void _sync_body_state(PhysicsDirectBodyState3D *p_state);
+	void _sync_body_state_bulk(const PhysicsServer3D::BodyStateSync &p_state);
+	void _update_state_sync_bulk();
 
 protected:
 	void _notification(int p_what);
@@ -139,10 +143,13 @@ protected:
 	GDVIRTUAL1(_integrate_forces, PhysicsDirectBodyState3D *)
 
 	virtual void _body_state_changed(PhysicsDirectBodyState3D *p_state);
+	virtual bool _can_sync_state_in_bulk() const;
 
 	void _apply_body_mode();
 
 public:
+	static void _body_state_sync_bulk(const PhysicsServer3D::BodyStateSync *p_states, uint32_t p_count);
+
 	void set_lock_rotation_enabled(bool p_lock_rotation);
 	bool is_lock_rotation_enabled() const;
 
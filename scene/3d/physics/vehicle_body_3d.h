@@ -201,6 +201,7 @@ class VehicleBody3D : public RigidBody3D {
 
 	static void _body_state_changed_callback(void *p_instance, PhysicsDirectBodyState3D *p_state);
 	virtual void _body_state_changed(PhysicsDirectBodyState3D *p_state) override;
+	virtual bool _can_sync_state_in_bulk() const override { return false; }
 
 public:
 	void set_engine_force(real_t p_engine_force);
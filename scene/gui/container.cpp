@@ -30,6 +30,8 @@
 
 #include "container.h"
 
+#include "scene/main/viewport.h"
+
 void Container::_child_minsize_changed() {
 	update_minimum_size();
 	queue_sort();
@@ -84,6 +86,8 @@ void Container::_sort_children() {
 		return;
 	}
 
+	get_viewport()->_gui_count_layout(Viewport::LAYOUT_INFO_SORTS);
+
 	notification(NOTIFICATION_PRE_SORT_CHILDREN);
 	emit_signal(SceneStringName(pre_sort_children));
 
@@ -135,9 +139,13 @@ void Container::queue_sort() {
 	if (pending_sort) {
 		return;
 	}
-
-	callable_mp(this, &Container::_sort_children).call_deferred();
 	pending_sort = true;
+
+	if (get_viewport()->is_gui_incremental_layout_enabled()) {
+		get_viewport()->_gui_queue_sort(this);
+	} else {
+		callable_mp(this, &Container::_sort_children).call_deferred();
+	}
 }
 
 Control *Container::as_sortable_control(Node *p_node, SortableVisibilityMode p_visibility_mode) const {
@@ -195,6 +203,11 @@ void Container::_notification(int p_what) {
 				queue_sort();
 			}
 		} break;
+
+		case NOTIFICATION_EXIT_TREE: {
+			// Same as Control::updating_last_minimum_size, the queued sort may never run.
+			pending_sort = false;
+		} break;
 	}
 }
 
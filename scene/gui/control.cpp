@@ -1594,6 +1594,8 @@ void Control::_update_minimum_size() {
 		return;
 	}
 
+	get_viewport()->_gui_count_layout(Viewport::LAYOUT_INFO_MINIMUM_SIZE_UPDATES);
+
 	Size2 minsize = get_combined_minimum_size();
 	data.updating_last_minimum_size = false;
 
@@ -1636,7 +1638,11 @@ void Control::update_minimum_size() {
 	}
 	data.updating_last_minimum_size = true;
 
-	callable_mp(this, &Control::_update_minimum_size).call_deferred();
+	if (get_viewport()->is_gui_incremental_layout_enabled()) {
+		get_viewport()->_gui_queue_minimum_size_update(this);
+	} else {
+		callable_mp(this, &Control::_update_minimum_size).call_deferred();
+	}
 }
 
 void Control::set_block_minimum_size_adjust(bool p_block) {
@@ -3323,6 +3329,9 @@ void Control::_notification(int p_notification) {
 
 			release_focus();
 			get_viewport()->_gui_remove_control(this);
+
+			// A queued update may never run, as the viewport it was queued on can be gone by then.
+			data.updating_last_minimum_size = false;
 		} break;
 
 		case NOTIFICATION_READY: {
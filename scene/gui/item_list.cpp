@@ -34,26 +34,285 @@
 #include "core/os/os.h"
 #include "scene/theme/theme_db.h"
 
+void ItemList::RowHeights::clear() {
+	heights.clear();
+	tree.clear();
+}
+
+void ItemList::RowHeights::fill(int p_count, real_t p_height) {
+	heights.resize(p_count);
+	tree.resize(p_count + 1);
+	tree[0] = 0.0;
+	for (int i = 0; i < p_count; i++) {
+		heights[i] = p_height;
+		tree[i + 1] = p_height;
+	}
+	// Build in linear time by adding each node to its parent.
+	for (int i = 1; i <= p_count; i++) {
+		int parent = i + (i & -i);
+		if (parent <= p_count) {
+			tree[parent] += tree[i];
+		}
+	}
+}
+
+void ItemList::RowHeights::resize(int p_count, real_t p_height) {
+	if (p_count <= size()) {
+		// Nodes only cover rows before them, so truncating keeps the tree valid.
+		heights.resize(p_count);
+		tree.resize(p_count + 1);
+		return;
+	}
+
+	if (tree.is_empty()) {
+		tree.push_back(0.0);
+	}
+	while (size() < p_count) {
+		heights.push_back(p_height);
+		// The new node covers rows (i - lowbit(i), i], all but the last are already stored.
+		int i = heights.size();
+		tree.push_back(p_height + get_offset(i - 1) - get_offset(i - (i & -i)));
+	}
+}
+
+void ItemList::RowHeights::set_height(int p_row, real_t p_height) {
+	double delta = p_height - heights[p_row];
+	heights[p_row] = p_height;
+	for (int i = p_row + 1; i < (int)tree.size(); i += i & -i) {
+		tree[i] += delta;
+	}
+}
+
+double ItemList::RowHeights::get_offset(int p_row) const {
+	double offset = 0.0;
+	for (int i = p_row; i > 0; i -= i & -i) {
+		offset += tree[i];
+	}
+	return offset;
+}
+
+int ItemList::RowHeights::find_row(double p_offset) const {
+	const int count = size();
+	if (count == 0) {
+		return -1;
+	}
+
+	// Descend the tree, skipping every subtree that ends at or above the offset.
+	int row = 0;
+	double remaining = p_offset;
+	for (int step = nearest_power_of_2_templated(count + 1) / 2; step > 0; step >>= 1) {
+		if (row + step <= count && tree[row + step] <= remaining) {
+			row += step;
+			remaining -= tree[row];
+		}
+	}
+	return MIN(row, count - 1);
+}
+
 void ItemList::_shape_text(int p_idx) {
-	Item &item = items.write[p_idx];
+	_shape_item_text(items.write[p_idx]);
+}
 
-	item.text_buf->clear();
-	if (item.text_direction == Control::TEXT_DIRECTION_INHERITED) {
-		item.text_buf->set_direction(is_layout_rtl() ? TextServer::DIRECTION_RTL : TextServer::DIRECTION_LTR);
+void ItemList::_shape_item_text(Item &p_item) const {
+	p_item.text_buf->clear();
+	if (p_item.text_direction == Control::TEXT_DIRECTION_INHERITED) {
+		p_item.text_buf->set_direction(is_layout_rtl() ? TextServer::DIRECTION_RTL : TextServer::DIRECTION_LTR);
 	} else {
-		item.text_buf->set_direction((TextServer::Direction)item.text_direction);
+		p_item.text_buf->set_direction((TextServer::Direction)p_item.text_direction);
 	}
-	item.text_buf->add_string(item.xl_text, theme_cache.font, theme_cache.font_size, item.language);
+	p_item.text_buf->add_string(p_item.xl_text, theme_cache.font, theme_cache.font_size, p_item.language);
 	if (icon_mode == ICON_MODE_TOP && max_text_lines > 0) {
-		item.text_buf->set_break_flags(TextServer::BREAK_MANDATORY | TextServer::BREAK_WORD_BOUND | TextServer::BREAK_GRAPHEME_BOUND | TextServer::BREAK_TRIM_EDGE_SPACES);
+		p_item.text_buf->set_break_flags(TextServer::BREAK_MANDATORY | TextServer::BREAK_WORD_BOUND | TextServer::BREAK_GRAPHEME_BOUND | TextServer::BREAK_TRIM_EDGE_SPACES);
 	} else {
-		item.text_buf->set_break_flags(TextServer::BREAK_NONE);
+		p_item.text_buf->set_break_flags(TextServer::BREAK_NONE);
+	}
+	p_item.text_buf->set_text_overrun_behavior(text_overrun_behavior);
+	p_item.text_buf->set_max_lines_visible(max_text_lines);
+}
+
+Size2 ItemList::_get_item_minimum_size(const Item &p_item) const {
+	Size2 minsize;
+	if (p_item.icon.is_valid()) {
+		if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
+			minsize = fixed_icon_size * icon_scale;
+		} else {
+			minsize = p_item.get_icon_size() * icon_scale;
+		}
+
+		if (!p_item.text.is_empty()) {
+			if (icon_mode == ICON_MODE_TOP) {
+				minsize.y += theme_cache.icon_margin;
+			} else {
+				minsize.x += theme_cache.icon_margin;
+			}
+		}
+	}
+
+	if (!p_item.text.is_empty()) {
+		int max_width = -1;
+		if (fixed_column_width) {
+			max_width = fixed_column_width;
+		}
+		p_item.text_buf->set_width(max_width);
+		Size2 s = p_item.text_buf->get_size();
+
+		if (icon_mode == ICON_MODE_TOP) {
+			minsize.x = MAX(minsize.x, s.width);
+			if (max_text_lines > 0) {
+				minsize.y += s.height + theme_cache.line_separation * max_text_lines;
+			} else {
+				minsize.y += s.height;
+			}
+
+		} else {
+			minsize.y = MAX(minsize.y, s.height);
+			minsize.x += s.width;
+		}
+	}
+
+	if (fixed_column_width > 0) {
+		minsize.x = fixed_column_width;
+	}
+	return minsize;
+}
+
+const ItemList::Item &ItemList::_get_item(int p_idx) const {
+	if (!_is_virtual()) {
+		return items[p_idx];
+	}
+
+	// Getters only need the row data, so rows that aren't visible are neither shaped nor cached.
+	const Item *cached = virtual_items.getptr(p_idx);
+	if (cached) {
+		return *cached;
+	}
+	Item item;
+	_fetch_virtual_item(p_idx, item);
+	virtual_peeked_item = item;
+	return virtual_peeked_item;
+}
+
+void ItemList::_fetch_virtual_item(int p_idx, Item &r_item) const {
+	// The list must not be modified from the provider, as cached rows are referenced while it runs.
+	const bool was_fetching = virtual_fetching;
+	virtual_fetching = true;
+	Variant row = item_provider.call(p_idx);
+	virtual_fetching = was_fetching;
+
+	if (row.get_type() == Variant::DICTIONARY) {
+		const Dictionary row_data = row;
+		String text = row_data.get("text", String());
+		String tooltip = row_data.get("tooltip", String());
+		r_item.text = text;
+		r_item.tooltip = tooltip;
+		r_item.icon = row_data.get("icon", Variant());
+		r_item.icon_modulate = row_data.get("icon_modulate", Color(1, 1, 1, 1));
+		r_item.custom_fg = row_data.get("custom_fg_color", Color());
+		r_item.custom_bg = row_data.get("custom_bg_color", Color(0, 0, 0, 0));
+		r_item.selectable = row_data.get("selectable", true);
+		r_item.disabled = row_data.get("disabled", false);
+		r_item.metadata = row_data.get("metadata", Variant());
+	} else {
+		String text = row;
+		r_item.text = text;
+	}
+}
+
+ItemList::Item &ItemList::_get_virtual_item(int p_idx) const {
+	Item *cached = virtual_items.getptr(p_idx);
+	if (cached) {
+		return *cached;
+	}
+
+	// Inserted once the provider returned, in case it reads other rows.
+	Item fetched;
+	_fetch_virtual_item(p_idx, fetched);
+	Item &item = virtual_items.insert(p_idx, fetched)->value;
+	item.xl_text = atr(item.text);
+	_shape_item_text(item);
+
+	const real_t height = _get_item_minimum_size(item).y + MAX(theme_cache.v_separation, 0);
+	if (p_idx < virtual_row_heights.size() && height != virtual_row_heights.get_height(p_idx)) {
+		virtual_row_heights.set_height(p_idx, height);
+		virtual_heights_changed = true;
+	}
+	return item;
+}
+
+Rect2 ItemList::_get_item_rect_cache(int p_idx) const {
+	if (_is_virtual()) {
+		return Rect2(0, virtual_row_heights.get_offset(p_idx), virtual_content_width, virtual_row_heights.get_height(p_idx));
+	}
+	return items[p_idx].rect_cache;
+}
+
+real_t ItemList::_get_virtual_row_estimate() const {
+	real_t height = theme_cache.font.is_valid() ? theme_cache.font->get_height(theme_cache.font_size) : 0.0;
+	if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
+		real_t icon_height = fixed_icon_size.y * icon_scale;
+		height = icon_mode == ICON_MODE_TOP ? height + icon_height + theme_cache.icon_margin : MAX(height, icon_height);
+	}
+	// Never zero, or every row would be considered visible at once.
+	return MAX(height + MAX(theme_cache.v_separation, 0), 1.0);
+}
+
+void ItemList::_update_virtual_scroll() {
+	virtual_heights_changed = false;
+
+	Size2 size = get_size();
+	double total_height = virtual_row_heights.get_total();
+	double scroll_bar_v_page = MAX(0, size.height - theme_cache.panel_style->get_minimum_size().height);
+	double scroll_bar_v_max = MAX(scroll_bar_v_page, total_height);
+
+	scroll_bar_v->set_max(scroll_bar_v_max);
+	scroll_bar_v->set_page(scroll_bar_v_page);
+	if (scroll_bar_v_max <= scroll_bar_v_page) {
+		scroll_bar_v->set_value(0);
+		scroll_bar_v->hide();
+	} else {
+		scroll_bar_v->show();
+		if (do_autoscroll_to_bottom) {
+			scroll_bar_v->set_value(scroll_bar_v_max);
+		}
+	}
+
+	// Rows always span the full width in virtual mode.
+	scroll_bar_h->set_min(0);
+	scroll_bar_h->set_max(0);
+	scroll_bar_h->set_value(0);
+	scroll_bar_h->hide();
+
+	virtual_content_width = size.width - theme_cache.panel_style->get_minimum_size().width;
+	if (scroll_bar_v->is_visible()) {
+		virtual_content_width -= scroll_bar_v->get_minimum_size().x;
+	}
+
+	if (auto_height) {
+		auto_height_value = total_height + theme_cache.panel_style->get_minimum_size().height;
+	}
+}
+
+void ItemList::_trim_virtual_items(int p_first_visible, int p_last_visible) {
+	const int visible_count = p_last_visible - p_first_visible + 1;
+	if ((int)virtual_items.size() <= MAX(256, visible_count * 4)) {
+		return;
+	}
+
+	// Keep a page above and below, so that scrolling back doesn't call the provider again.
+	LocalVector<int> evicted;
+	for (const KeyValue<int, Item> &E : virtual_items) {
+		if (E.key < p_first_visible - visible_count || E.key > p_last_visible + visible_count) {
+			evicted.push_back(E.key);
+		}
+	}
+	for (int idx : evicted) {
+		virtual_items.erase(idx);
 	}
-	item.text_buf->set_text_overrun_behavior(text_overrun_behavior);
-	item.text_buf->set_max_lines_visible(max_text_lines);
 }
 
 int ItemList::add_item(const String &p_item, const Ref<Texture2D> &p_texture, bool p_selectable) {
+	ERR_FAIL_COND_V_MSG(_is_virtual(), -1, "Items can't be added to an ItemList that uses an item provider.");
+
 	Item item;
 	item.icon = p_texture;
 	item.text = p_item;
@@ -71,6 +330,8 @@ int ItemList::add_item(const String &p_item, const Ref<Texture2D> &p_texture, bo
 }
 
 int ItemList::add_icon_item(const Ref<Texture2D> &p_item, bool p_selectable) {
+	ERR_FAIL_COND_V_MSG(_is_virtual(), -1, "Items can't be added to an ItemList that uses an item provider.");
+
 	Item item;
 	item.icon = p_item;
 	item.selectable = p_selectable;
@@ -101,8 +362,8 @@ void ItemList::set_item_text(int p_idx, const String &p_text) {
 }
 
 String ItemList::get_item_text(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), String());
-	return items[p_idx].text;
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), String());
+	return _get_item(p_idx).text;
 }
 
 void ItemList::set_item_text_direction(int p_idx, Control::TextDirection p_text_direction) {
@@ -187,8 +448,8 @@ void ItemList::set_item_tooltip(int p_idx, const String &p_tooltip) {
 }
 
 String ItemList::get_item_tooltip(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), String());
-	return items[p_idx].tooltip;
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), String());
+	return _get_item(p_idx).tooltip;
 }
 
 void ItemList::set_item_icon(int p_idx, const Ref<Texture2D> &p_icon) {
@@ -207,9 +468,9 @@ void ItemList::set_item_icon(int p_idx, const Ref<Texture2D> &p_icon) {
 }
 
 Ref<Texture2D> ItemList::get_item_icon(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Ref<Texture2D>());
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Ref<Texture2D>());
 
-	return items[p_idx].icon;
+	return _get_item(p_idx).icon;
 }
 
 void ItemList::set_item_icon_transposed(int p_idx, const bool p_transposed) {
@@ -269,9 +530,9 @@ void ItemList::set_item_icon_modulate(int p_idx, const Color &p_modulate) {
 }
 
 Color ItemList::get_item_icon_modulate(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Color());
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Color());
 
-	return items[p_idx].icon_modulate;
+	return _get_item(p_idx).icon_modulate;
 }
 
 void ItemList::set_item_custom_bg_color(int p_idx, const Color &p_custom_bg_color) {
@@ -289,9 +550,9 @@ void ItemList::set_item_custom_bg_color(int p_idx, const Color &p_custom_bg_colo
 }
 
 Color ItemList::get_item_custom_bg_color(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Color());
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Color());
 
-	return items[p_idx].custom_bg;
+	return _get_item(p_idx).custom_bg;
 }
 
 void ItemList::set_item_custom_fg_color(int p_idx, const Color &p_custom_fg_color) {
@@ -309,15 +570,15 @@ void ItemList::set_item_custom_fg_color(int p_idx, const Color &p_custom_fg_colo
 }
 
 Color ItemList::get_item_custom_fg_color(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Color());
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Color());
 
-	return items[p_idx].custom_fg;
+	return _get_item(p_idx).custom_fg;
 }
 
 Rect2 ItemList::get_item_rect(int p_idx, bool p_expand) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Rect2());
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Rect2());
 
-	Rect2 ret = items[p_idx].rect_cache;
+	Rect2 ret = _get_item_rect_cache(p_idx);
 	ret.position += theme_cache.panel_style->get_offset();
 
 	if (p_expand && p_idx % current_columns == current_columns - 1) {
@@ -351,8 +612,8 @@ void ItemList::set_item_selectable(int p_idx, bool p_selectable) {
 }
 
 bool ItemList::is_item_selectable(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), false);
-	return items[p_idx].selectable;
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), false);
+	return _get_item(p_idx).selectable;
 }
 
 void ItemList::set_item_disabled(int p_idx, bool p_disabled) {
@@ -370,8 +631,8 @@ void ItemList::set_item_disabled(int p_idx, bool p_disabled) {
 }
 
 bool ItemList::is_item_disabled(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), false);
-	return items[p_idx].disabled;
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), false);
+	return _get_item(p_idx).disabled;
 }
 
 void ItemList::set_item_metadata(int p_idx, const Variant &p_metadata) {
@@ -390,49 +651,61 @@ void ItemList::set_item_metadata(int p_idx, const Variant &p_metadata) {
 }
 
 Variant ItemList::get_item_metadata(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Variant());
-	return items[p_idx].metadata;
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Variant());
+	return _get_item(p_idx).metadata;
 }
 
 void ItemList::select(int p_idx, bool p_single) {
-	ERR_FAIL_INDEX(p_idx, items.size());
+	ERR_FAIL_INDEX(p_idx, get_item_count());
 
 	if (p_single || select_mode == SELECT_SINGLE) {
-		if (!items[p_idx].selectable || items[p_idx].disabled) {
+		if (!is_item_selectable(p_idx) || is_item_disabled(p_idx)) {
 			return;
 		}
 
-		for (int i = 0; i < items.size(); i++) {
-			items.write[i].selected = p_idx == i;
+		if (_is_virtual()) {
+			virtual_selected.clear();
+			virtual_selected.insert(p_idx);
+		} else {
+			for (int i = 0; i < items.size(); i++) {
+				items.write[i].selected = p_idx == i;
+			}
 		}
 
 		current = p_idx;
 		ensure_selected_visible = false;
 	} else {
-		if (items[p_idx].selectable && !items[p_idx].disabled) {
-			items.write[p_idx].selected = true;
+		if (is_item_selectable(p_idx) && !is_item_disabled(p_idx)) {
+			if (_is_virtual()) {
+				virtual_selected.insert(p_idx);
+			} else {
+				items.write[p_idx].selected = true;
+			}
 		}
 	}
 	queue_redraw();
 }
 
 void ItemList::deselect(int p_idx) {
-	ERR_FAIL_INDEX(p_idx, items.size());
+	ERR_FAIL_INDEX(p_idx, get_item_count());
 
-	if (select_mode == SELECT_SINGLE) {
-		items.write[p_idx].selected = false;
-		current = -1;
+	if (_is_virtual()) {
+		virtual_selected.erase(p_idx);
 	} else {
 		items.write[p_idx].selected = false;
 	}
+	if (select_mode == SELECT_SINGLE) {
+		current = -1;
+	}
 	queue_redraw();
 }
 
 void ItemList::deselect_all() {
-	if (items.size() < 1) {
+	if (get_item_count() < 1) {
 		return;
 	}
 
+	virtual_selected.clear();
 	for (int i = 0; i < items.size(); i++) {
 		items.write[i].selected = false;
 	}
@@ -441,13 +714,16 @@ void ItemList::deselect_all() {
 }
 
 bool ItemList::is_selected(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), false);
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), false);
 
+	if (_is_virtual()) {
+		return virtual_selected.has(p_idx);
+	}
 	return items[p_idx].selected;
 }
 
 void ItemList::set_current(int p_current) {
-	ERR_FAIL_INDEX(p_current, items.size());
+	ERR_FAIL_INDEX(p_current, get_item_count());
 
 	if (current == p_current) {
 		return;
@@ -484,6 +760,50 @@ void ItemList::move_item(int p_from_idx, int p_to_idx) {
 
 void ItemList::set_item_count(int p_count) {
 	ERR_FAIL_COND(p_count < 0);
+	ERR_FAIL_COND_MSG(virtual_fetching, "The items of an ItemList can't be changed from its item provider.");
+
+	if (_is_virtual()) {
+		if (virtual_item_count == p_count) {
+			return;
+		}
+
+		if (p_count < virtual_item_count) {
+			LocalVector<int> removed;
+			for (const KeyValue<int, Item> &E : virtual_items) {
+				if (E.key >= p_count) {
+					removed.push_back(E.key);
+				}
+			}
+			for (int idx : removed) {
+				virtual_items.erase(idx);
+			}
+
+			removed.clear();
+			for (int idx : virtual_selected) {
+				if (idx >= p_count) {
+					removed.push_back(idx);
+				}
+			}
+			for (int idx : removed) {
+				virtual_selected.erase(idx);
+			}
+
+			if (current >= p_count) {
+				current = -1;
+			}
+			if (hovered >= p_count) {
+				hovered = -1;
+			}
+			defer_select_single = -1;
+		}
+
+		// Appending only adds estimated rows, rows already measured are kept.
+		virtual_item_count = p_count;
+		virtual_row_heights.resize(p_count, virtual_row_estimate);
+		virtual_heights_changed = true;
+		queue_redraw();
+		return;
+	}
 
 	if (items.size() == p_count) {
 		return;
@@ -496,7 +816,7 @@ void ItemList::set_item_count(int p_count) {
 }
 
 int ItemList::get_item_count() const {
-	return items.size();
+	return _is_virtual() ? virtual_item_count : items.size();
 }
 
 void ItemList::remove_item(int p_idx) {
@@ -513,8 +833,14 @@ void ItemList::remove_item(int p_idx) {
 }
 
 void ItemList::clear() {
+	ERR_FAIL_COND_MSG(virtual_fetching, "The items of an ItemList can't be changed from its item provider.");
 	items.clear();
+	virtual_item_count = 0;
+	virtual_items.clear();
+	virtual_row_heights.clear();
+	virtual_selected.clear();
 	current = -1;
+	hovered = -1;
 	ensure_selected_visible = false;
 	queue_redraw();
 	shape_changed = true;
@@ -522,6 +848,45 @@ void ItemList::clear() {
 	notify_property_list_changed();
 }
 
+void ItemList::set_item_provider(const Callable &p_provider) {
+	ERR_FAIL_COND_MSG(virtual_fetching, "The items of an ItemList can't be changed from its item provider.");
+	if (item_provider == p_provider) {
+		return;
+	}
+
+	item_provider = p_provider;
+	clear();
+}
+
+Callable ItemList::get_item_provider() const {
+	return item_provider;
+}
+
+void ItemList::invalidate_items(int p_from, int p_to) {
+	ERR_FAIL_COND_MSG(!_is_virtual(), "Only an ItemList that uses an item provider can invalidate its items.");
+	ERR_FAIL_COND_MSG(virtual_fetching, "The items of an ItemList can't be changed from its item provider.");
+	if (p_to < 0) {
+		p_to = virtual_item_count - 1;
+	}
+
+	if (p_to - p_from + 1 >= (int)virtual_items.size()) {
+		LocalVector<int> invalidated;
+		for (const KeyValue<int, Item> &E : virtual_items) {
+			if (E.key >= p_from && E.key <= p_to) {
+				invalidated.push_back(E.key);
+			}
+		}
+		for (int idx : invalidated) {
+			virtual_items.erase(idx);
+		}
+	} else {
+		for (int i = p_from; i <= p_to; i++) {
+			virtual_items.erase(i);
+		}
+	}
+	queue_redraw();
+}
+
 void ItemList::set_fixed_column_width(int p_size) {
 	ERR_FAIL_COND(p_size < 0);
 
@@ -668,7 +1033,7 @@ void ItemList::set_fixed_tag_icon_size(const Size2i &p_size) {
 void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 	ERR_FAIL_COND(p_event.is_null());
 
-#define CAN_SELECT(i) (items[i].selectable && !items[i].disabled)
+#define CAN_SELECT(i) (is_item_selectable(i) && !is_item_disabled(i))
 #define IS_SAME_ROW(i, row) (i / current_columns == row)
 
 	double prev_scroll_v = scroll_bar_v->get_value();
@@ -707,16 +1072,16 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 		if (closest != -1 && (mb->get_button_index() == MouseButton::LEFT || (allow_rmb_select && mb->get_button_index() == MouseButton::RIGHT))) {
 			int i = closest;
 
-			if (items[i].disabled) {
+			if (is_item_disabled(i)) {
 				// Don't emit any signal or do any action with clicked item when disabled.
 				return;
 			}
 
-			if (select_mode == SELECT_MULTI && items[i].selected && mb->is_command_or_control_pressed()) {
+			if (select_mode == SELECT_MULTI && is_selected(i) && mb->is_command_or_control_pressed()) {
 				deselect(i);
 				emit_signal(SNAME("multi_selected"), i, false);
 
-			} else if (select_mode == SELECT_MULTI && mb->is_shift_pressed() && current >= 0 && current < items.size() && current != i) {
+			} else if (select_mode == SELECT_MULTI && mb->is_shift_pressed() && current >= 0 && current < get_item_count() && current != i) {
 				// Range selection.
 
 				int from = current;
@@ -729,7 +1094,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 						// Item is not selectable during a range selection, so skip it.
 						continue;
 					}
-					bool selected = !items[j].selected;
+					bool selected = !is_selected(j);
 					select(j, false);
 					if (selected) {
 						emit_signal(SNAME("multi_selected"), j, true);
@@ -741,16 +1106,16 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 				if (!mb->is_double_click() &&
 						!mb->is_command_or_control_pressed() &&
 						select_mode == SELECT_MULTI &&
-						items[i].selectable &&
-						items[i].selected &&
+						is_item_selectable(i) &&
+						is_selected(i) &&
 						mb->get_button_index() == MouseButton::LEFT) {
 					defer_select_single = i;
 					return;
 				}
 
 				if (select_mode == SELECT_TOGGLE) {
-					if (items[i].selectable) {
-						if (items[i].selected) {
+					if (is_item_selectable(i)) {
+						if (is_selected(i)) {
 							deselect(i);
 							current = i;
 							emit_signal(SNAME("multi_selected"), i, false);
@@ -760,7 +1125,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 							emit_signal(SNAME("multi_selected"), i, true);
 						}
 					}
-				} else if (items[i].selectable && (!items[i].selected || allow_reselect)) {
+				} else if (is_item_selectable(i) && (!is_selected(i) || allow_reselect)) {
 					select(i, select_mode == SELECT_SINGLE || !mb->is_command_or_control_pressed());
 
 					if (select_mode == SELECT_SINGLE) {
@@ -779,7 +1144,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 
 			return;
 		} else if (closest != -1) {
-			if (!items[closest].disabled) {
+			if (!is_item_disabled(closest)) {
 				emit_signal(SNAME("item_clicked"), closest, get_local_mouse_position(), mb->get_button_index());
 			}
 		} else {
@@ -833,7 +1198,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 		}
 	}
 
-	if (p_event->is_pressed() && items.size() > 0) {
+	if (p_event->is_pressed() && get_item_count() > 0) {
 		if (p_event->is_action("ui_up", true)) {
 			if (!search_string.is_empty()) {
 				uint64_t now = OS::get_singleton()->get_ticks_msec();
@@ -841,7 +1206,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 
 				if (diff < uint64_t(GLOBAL_GET("gui/timers/incremental_search_max_interval_msec")) * 2) {
 					for (int i = current - 1; i >= 0; i--) {
-						if (CAN_SELECT(i) && items[i].text.begins_with(search_string)) {
+						if (CAN_SELECT(i) && get_item_text(i).begins_with(search_string)) {
 							set_current(i);
 							ensure_current_is_visible();
 							if (select_mode == SELECT_SINGLE) {
@@ -878,8 +1243,8 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 				uint64_t diff = now - search_time_msec;
 
 				if (diff < uint64_t(GLOBAL_GET("gui/timers/incremental_search_max_interval_msec")) * 2) {
-					for (int i = current + 1; i < items.size(); i++) {
-						if (CAN_SELECT(i) && items[i].text.begins_with(search_string)) {
+					for (int i = current + 1; i < get_item_count(); i++) {
+						if (CAN_SELECT(i) && get_item_text(i).begins_with(search_string)) {
 							set_current(i);
 							ensure_current_is_visible();
 							if (select_mode == SELECT_SINGLE) {
@@ -893,12 +1258,12 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 				}
 			}
 
-			if (current < items.size() - current_columns) {
+			if (current < get_item_count() - current_columns) {
 				int next = current + current_columns;
-				while (next < items.size() && !CAN_SELECT(next)) {
+				while (next < get_item_count() && !CAN_SELECT(next)) {
 					next = next + current_columns;
 				}
-				if (next >= items.size()) {
+				if (next >= get_item_count()) {
 					accept_event();
 					return;
 				}
@@ -914,7 +1279,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 
 			for (int i = 4; i > 0; i--) {
 				int index = current - current_columns * i;
-				if (index >= 0 && index < items.size() && CAN_SELECT(index)) {
+				if (index >= 0 && index < get_item_count() && CAN_SELECT(index)) {
 					set_current(index);
 					ensure_current_is_visible();
 					if (select_mode == SELECT_SINGLE) {
@@ -929,7 +1294,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 
 			for (int i = 4; i > 0; i--) {
 				int index = current + current_columns * i;
-				if (index >= 0 && index < items.size() && CAN_SELECT(index)) {
+				if (index >= 0 && index < get_item_count() && CAN_SELECT(index)) {
 					set_current(index);
 					ensure_current_is_visible();
 					if (select_mode == SELECT_SINGLE) {
@@ -963,13 +1328,13 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 		} else if (p_event->is_action("ui_right", true)) {
 			search_string = ""; //any mousepress cancels
 
-			if (current % current_columns != (current_columns - 1) && current + 1 < items.size()) {
+			if (current % current_columns != (current_columns - 1) && current + 1 < get_item_count()) {
 				int current_row = current / current_columns;
 				int next = current + 1;
-				while (next < items.size() && !CAN_SELECT(next)) {
+				while (next < get_item_count() && !CAN_SELECT(next)) {
 					next = next + 1;
 				}
-				if (items.size() <= next || !IS_SAME_ROW(next, current_row)) {
+				if (get_item_count() <= next || !IS_SAME_ROW(next, current_row)) {
 					accept_event();
 					return;
 				}
@@ -983,11 +1348,11 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 		} else if (p_event->is_action("ui_cancel", true)) {
 			search_string = "";
 		} else if (p_event->is_action("ui_select", true) && (select_mode == SELECT_MULTI || select_mode == SELECT_TOGGLE)) {
-			if (current >= 0 && current < items.size()) {
-				if (CAN_SELECT(current) && !items[current].selected) {
+			if (current >= 0 && current < get_item_count()) {
+				if (CAN_SELECT(current) && !is_selected(current)) {
 					select(current, false);
 					emit_signal(SNAME("multi_selected"), current, true);
-				} else if (items[current].selected) {
+				} else if (is_selected(current)) {
 					deselect(current);
 					emit_signal(SNAME("multi_selected"), current, false);
 				}
@@ -995,13 +1360,14 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 		} else if (p_event->is_action("ui_accept", true)) {
 			search_string = ""; //any mousepress cancels
 
-			if (current >= 0 && current < items.size() && !items[current].disabled) {
+			if (current >= 0 && current < get_item_count() && !is_item_disabled(current)) {
 				emit_signal(SNAME("item_activated"), current);
 			}
 		} else {
 			Ref<InputEventKey> k = p_event;
 
-			if (allow_search && k.is_valid() && k->get_unicode()) {
+			// Searching would request every row from the provider.
+			if (allow_search && !_is_virtual() && k.is_valid() && k->get_unicode()) {
 				uint64_t now = OS::get_singleton()->get_ticks_msec();
 				uint64_t diff = now - search_time_msec;
 				uint64_t max_interval = uint64_t(GLOBAL_GET("gui/timers/incremental_search_max_interval_msec"));
@@ -1015,8 +1381,8 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 					search_string += String::chr(k->get_unicode());
 				}
 
-				for (int i = current + 1; i <= items.size(); i++) {
-					if (i == items.size()) {
+				for (int i = current + 1; i <= get_item_count(); i++) {
+					if (i == get_item_count()) {
 						if (current == 0 || current == -1) {
 							break;
 						} else {
@@ -1028,7 +1394,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 						break;
 					}
 
-					if (items[i].text.findn(search_string) == 0) {
+					if (get_item_text(i).findn(search_string) == 0) {
 						set_current(i);
 						ensure_current_is_visible();
 						if (select_mode == SELECT_SINGLE) {
@@ -1102,6 +1468,9 @@ void ItemList::_notification(int p_what) {
 
 		case NOTIFICATION_DRAW: {
 			force_update_list_size();
+			if (_is_virtual() && virtual_heights_changed) {
+				_update_virtual_scroll();
+			}
 
 			Size2 scroll_bar_h_min = scroll_bar_h->is_visible() ? scroll_bar_h->get_combined_minimum_size() : Size2();
 			Size2 scroll_bar_v_min = scroll_bar_v->is_visible() ? scroll_bar_v->get_combined_minimum_size() : Size2();
@@ -1140,8 +1509,8 @@ void ItemList::_notification(int p_what) {
 			bool rtl = is_layout_rtl();
 
 			// Ensure_selected_visible needs to be checked before we draw the list.
-			if (ensure_selected_visible && current >= 0 && current < items.size()) {
-				Rect2 r = items[current].rect_cache;
+			if (ensure_selected_visible && current >= 0 && current < get_item_count()) {
+				Rect2 r = _get_item_rect_cache(current);
 				int from_v = scroll_bar_v->get_value();
 				int to_v = from_v + scroll_bar_v->get_page();
 
@@ -1210,7 +1579,9 @@ void ItemList::_notification(int p_what) {
 
 			// Do a binary search to find the first item whose rect reaches below clip.position.y.
 			int first_item_visible;
-			{
+			if (_is_virtual()) {
+				first_item_visible = MAX(virtual_row_heights.find_row(clip.position.y), 0);
+			} else {
 				int lo = 0;
 				int hi = items.size();
 				while (lo < hi) {
@@ -1235,12 +1606,20 @@ void ItemList::_notification(int p_what) {
 			Rect2 cursor_rcache; // Place to save the position of the cursor and draw it after everything else.
 
 			// Draw visible items.
-			for (int i = first_item_visible; i < items.size(); i++) {
-				Rect2 rcache = items[i].rect_cache;
+			const int item_count = get_item_count();
+			int last_item_visible = first_item_visible;
+			for (int i = first_item_visible; i < item_count; i++) {
+				Item &item = _is_virtual() ? _get_virtual_item(i) : items.write[i];
+				if (_is_virtual()) {
+					item.rect_cache = _get_item_rect_cache(i);
+					item.selected = virtual_selected.has(i);
+				}
+				Rect2 rcache = item.rect_cache;
 
 				if (rcache.position.y > clip.position.y + clip.size.y) {
 					break; // done
 				}
+				last_item_visible = i;
 
 				if (!clip.intersects(rcache)) {
 					continue;
@@ -1250,10 +1629,10 @@ void ItemList::_notification(int p_what) {
 					rcache.size.width = width - rcache.position.x;
 				}
 
-				bool should_draw_selected_bg = items[i].selected && hovered != i;
-				bool should_draw_hovered_selected_bg = items[i].selected && hovered == i;
-				bool should_draw_hovered_bg = hovered == i && !items[i].selected;
-				bool should_draw_custom_bg = items[i].custom_bg.a > 0.001;
+				bool should_draw_selected_bg = item.selected && hovered != i;
+				bool should_draw_hovered_selected_bg = item.selected && hovered == i;
+				bool should_draw_hovered_bg = hovered == i && !item.selected;
+				bool should_draw_custom_bg = item.custom_bg.a > 0.001;
 
 				if (should_draw_selected_bg || should_draw_hovered_selected_bg || should_draw_hovered_bg || should_draw_custom_bg) {
 					Rect2 r = rcache;
@@ -1277,24 +1656,24 @@ void ItemList::_notification(int p_what) {
 						draw_style_box(theme_cache.hovered_style, r);
 					}
 					if (should_draw_custom_bg) {
-						draw_rect(r, items[i].custom_bg);
+						draw_rect(r, item.custom_bg);
 					}
 				}
 
 				Vector2 text_ofs;
-				if (items[i].icon.is_valid()) {
+				if (item.icon.is_valid()) {
 					Size2 icon_size;
-					//= _adjust_to_max_size(items[i].get_icon_size(),fixed_icon_size) * icon_scale;
+					//= _adjust_to_max_size(item.get_icon_size(),fixed_icon_size) * icon_scale;
 
 					if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
 						icon_size = fixed_icon_size * icon_scale;
 					} else {
-						icon_size = items[i].get_icon_size() * icon_scale;
+						icon_size = item.get_icon_size() * icon_scale;
 					}
 
 					Vector2 icon_ofs;
 
-					Point2 pos = items[i].rect_cache.position + icon_ofs + base_ofs;
+					Point2 pos = item.rect_cache.position + icon_ofs + base_ofs;
 
 					if (icon_mode == ICON_MODE_TOP) {
 						pos.y += MAX(theme_cache.v_separation, 0) / 2;
@@ -1303,151 +1682,151 @@ void ItemList::_notification(int p_what) {
 					}
 
 					if (icon_mode == ICON_MODE_TOP) {
-						pos.x += Math::floor((items[i].rect_cache.size.width - icon_size.width) / 2);
+						pos.x += Math::floor((item.rect_cache.size.width - icon_size.width) / 2);
 						pos.y += theme_cache.icon_margin;
 						text_ofs.y = icon_size.height + theme_cache.icon_margin * 2;
 					} else {
-						pos.y += Math::floor((items[i].rect_cache.size.height - icon_size.height) / 2);
+						pos.y += Math::floor((item.rect_cache.size.height - icon_size.height) / 2);
 						text_ofs.x = icon_size.width + theme_cache.icon_margin;
 					}
 
 					Rect2 draw_rect = Rect2(pos, icon_size);
 
 					if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
-						Rect2 adj = _adjust_to_max_size(items[i].get_icon_size() * icon_scale, icon_size);
+						Rect2 adj = _adjust_to_max_size(item.get_icon_size() * icon_scale, icon_size);
 						draw_rect.position += adj.position;
 						draw_rect.size = adj.size;
 					}
 
-					Color icon_modulate = items[i].icon_modulate;
-					if (items[i].disabled) {
+					Color icon_modulate = item.icon_modulate;
+					if (item.disabled) {
 						icon_modulate.a *= 0.5;
 					}
 
 					// If the icon is transposed, we have to switch the size so that it is drawn correctly
-					if (items[i].icon_transposed) {
+					if (item.icon_transposed) {
 						Size2 size_tmp = draw_rect.size;
 						draw_rect.size.x = size_tmp.y;
 						draw_rect.size.y = size_tmp.x;
 					}
 
-					Rect2 region = (items[i].icon_region.size.x == 0 || items[i].icon_region.size.y == 0) ? Rect2(Vector2(), items[i].icon->get_size()) : Rect2(items[i].icon_region);
+					Rect2 region = (item.icon_region.size.x == 0 || item.icon_region.size.y == 0) ? Rect2(Vector2(), item.icon->get_size()) : Rect2(item.icon_region);
 
 					if (rtl) {
 						draw_rect.position.x = size.width - draw_rect.position.x - draw_rect.size.x;
 					}
-					draw_texture_rect_region(items[i].icon, draw_rect, region, icon_modulate, items[i].icon_transposed);
+					draw_texture_rect_region(item.icon, draw_rect, region, icon_modulate, item.icon_transposed);
 				}
 
-				if (items[i].tag_icon.is_valid()) {
+				if (item.tag_icon.is_valid()) {
 					Size2 tag_icon_size;
 					if (fixed_tag_icon_size.x > 0 && fixed_tag_icon_size.y > 0) {
 						tag_icon_size = fixed_tag_icon_size;
 					} else {
-						tag_icon_size = items[i].tag_icon->get_size();
+						tag_icon_size = item.tag_icon->get_size();
 					}
 
-					Point2 draw_pos = items[i].rect_cache.position;
+					Point2 draw_pos = item.rect_cache.position;
 					draw_pos.x += MAX(theme_cache.h_separation, 0) / 2;
 					draw_pos.y += MAX(theme_cache.v_separation, 0) / 2;
 					if (rtl) {
 						draw_pos.x = size.width - draw_pos.x - tag_icon_size.x;
 					}
 
-					draw_texture_rect(items[i].tag_icon, Rect2(draw_pos + base_ofs, tag_icon_size));
+					draw_texture_rect(item.tag_icon, Rect2(draw_pos + base_ofs, tag_icon_size));
 				}
 
-				if (!items[i].text.is_empty()) {
-					Vector2 size2 = items[i].text_buf->get_size();
+				if (!item.text.is_empty()) {
+					Vector2 size2 = item.text_buf->get_size();
 
 					Color txt_modulate;
-					if (items[i].selected && hovered == i) {
+					if (item.selected && hovered == i) {
 						txt_modulate = theme_cache.font_hovered_selected_color;
-					} else if (items[i].selected) {
+					} else if (item.selected) {
 						txt_modulate = theme_cache.font_selected_color;
 					} else if (hovered == i) {
 						txt_modulate = theme_cache.font_hovered_color;
-					} else if (items[i].custom_fg != Color()) {
-						txt_modulate = items[i].custom_fg;
+					} else if (item.custom_fg != Color()) {
+						txt_modulate = item.custom_fg;
 					} else {
 						txt_modulate = theme_cache.font_color;
 					}
 
-					if (items[i].disabled) {
+					if (item.disabled) {
 						txt_modulate.a *= 0.5;
 					}
 
 					if (icon_mode == ICON_MODE_TOP && max_text_lines > 0) {
 						text_ofs += base_ofs;
-						text_ofs += items[i].rect_cache.position;
+						text_ofs += item.rect_cache.position;
 
 						text_ofs.y += MAX(theme_cache.v_separation, 0) / 2;
 
-						items.write[i].text_buf->set_alignment(HORIZONTAL_ALIGNMENT_CENTER);
+						item.text_buf->set_alignment(HORIZONTAL_ALIGNMENT_CENTER);
 
-						float text_w = items[i].rect_cache.size.width;
-						if (wraparound_items && items[i].rect_cache.size.width > width) {
-							text_w -= items[i].rect_cache.size.width - width;
+						float text_w = item.rect_cache.size.width;
+						if (wraparound_items && item.rect_cache.size.width > width) {
+							text_w -= item.rect_cache.size.width - width;
 						}
-						items.write[i].text_buf->set_width(text_w);
+						item.text_buf->set_width(text_w);
 
 						if (rtl) {
 							text_ofs.x = size.width - text_ofs.x - text_w;
 						}
 
 						if (theme_cache.font_outline_size > 0 && theme_cache.font_outline_color.a > 0) {
-							items[i].text_buf->draw_outline(get_canvas_item(), text_ofs, theme_cache.font_outline_size, theme_cache.font_outline_color);
+							item.text_buf->draw_outline(get_canvas_item(), text_ofs, theme_cache.font_outline_size, theme_cache.font_outline_color);
 						}
 
-						items[i].text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
+						item.text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
 					} else {
 						if (fixed_column_width > 0) {
 							size2.x = MIN(size2.x, fixed_column_width);
 						}
 
 						if (icon_mode == ICON_MODE_TOP) {
-							text_ofs.x += (items[i].rect_cache.size.width - size2.x) / 2;
+							text_ofs.x += (item.rect_cache.size.width - size2.x) / 2;
 							text_ofs.x += MAX(theme_cache.h_separation, 0) / 2;
 							text_ofs.y += MAX(theme_cache.v_separation, 0) / 2;
 						} else {
-							text_ofs.y += (items[i].rect_cache.size.height - size2.y) / 2;
+							text_ofs.y += (item.rect_cache.size.height - size2.y) / 2;
 							text_ofs.x += MAX(theme_cache.h_separation, 0) / 2;
 						}
 
 						text_ofs += base_ofs;
-						text_ofs += items[i].rect_cache.position;
+						text_ofs += item.rect_cache.position;
 
-						float text_w = items[i].rect_cache.size.width - (items[i].get_icon_size().x * icon_scale) - MAX(theme_cache.h_separation, 0);
-						if (wraparound_items && items[i].rect_cache.size.width > width) {
-							text_w -= items[i].rect_cache.size.width - width;
+						float text_w = item.rect_cache.size.width - (item.get_icon_size().x * icon_scale) - MAX(theme_cache.h_separation, 0);
+						if (wraparound_items && item.rect_cache.size.width > width) {
+							text_w -= item.rect_cache.size.width - width;
 						}
-						items.write[i].text_buf->set_width(text_w);
+						item.text_buf->set_width(text_w);
 
 						if (rtl) {
-							text_ofs.x = size.width - items[i].rect_cache.size.width + (items[i].get_icon_size().x * icon_scale) - text_ofs.x + MAX(theme_cache.h_separation, 0);
+							text_ofs.x = size.width - item.rect_cache.size.width + (item.get_icon_size().x * icon_scale) - text_ofs.x + MAX(theme_cache.h_separation, 0);
 							if (wraparound_items) {
-								text_ofs.x += MAX(items[i].rect_cache.size.width - width, 0);
+								text_ofs.x += MAX(item.rect_cache.size.width - width, 0);
 							}
-							items.write[i].text_buf->set_alignment(HORIZONTAL_ALIGNMENT_RIGHT);
+							item.text_buf->set_alignment(HORIZONTAL_ALIGNMENT_RIGHT);
 						} else {
-							items.write[i].text_buf->set_alignment(HORIZONTAL_ALIGNMENT_LEFT);
+							item.text_buf->set_alignment(HORIZONTAL_ALIGNMENT_LEFT);
 						}
 
 						if (theme_cache.font_outline_size > 0 && theme_cache.font_outline_color.a > 0) {
-							items[i].text_buf->draw_outline(get_canvas_item(), text_ofs, theme_cache.font_outline_size, theme_cache.font_outline_color);
+							item.text_buf->draw_outline(get_canvas_item(), text_ofs, theme_cache.font_outline_size, theme_cache.font_outline_color);
 						}
 
 						if (fixed_column_width > 0) {
-							if (items[i].rect_cache.size.width - (items[i].get_icon_size().x * icon_scale) - MAX(theme_cache.h_separation, 0) > 0) {
-								items[i].text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
+							if (item.rect_cache.size.width - (item.get_icon_size().x * icon_scale) - MAX(theme_cache.h_separation, 0) > 0) {
+								item.text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
 							}
 						} else {
 							if (wraparound_items) {
-								if (width - (items[i].get_icon_size().x * icon_scale) - MAX(theme_cache.h_separation, 0) - int(scroll_bar_h->get_value()) > 0) {
-									items[i].text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
+								if (width - (item.get_icon_size().x * icon_scale) - MAX(theme_cache.h_separation, 0) - int(scroll_bar_h->get_value()) > 0) {
+									item.text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
 								}
 							} else {
-								items[i].text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
+								item.text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
 							}
 						}
 					}
@@ -1458,6 +1837,13 @@ void ItemList::_notification(int p_what) {
 				}
 			}
 
+			if (_is_virtual()) {
+				_trim_virtual_items(first_item_visible, last_item_visible);
+				if (virtual_heights_changed) {
+					_update_virtual_scroll();
+				}
+			}
+
 			if (cursor_rcache.size != Size2()) { // Draw cursor last, so border isn't cut off.
 				cursor_rcache.position += base_ofs;
 
@@ -1483,54 +1869,32 @@ void ItemList::force_update_list_size() {
 		return;
 	}
 
+	if (_is_virtual()) {
+		// Rows are reshaped and measured when they become visible again,
+		// rows that were never measured use an estimated height.
+		virtual_items.clear();
+		real_t estimate = _get_virtual_row_estimate();
+		if (estimate != virtual_row_estimate || virtual_row_heights.size() != virtual_item_count) {
+			virtual_row_estimate = estimate;
+			virtual_row_heights.fill(virtual_item_count, estimate);
+		}
+
+		current_columns = 1;
+		separators.clear();
+		_update_virtual_scroll();
+
+		update_minimum_size();
+		shape_changed = false;
+		return;
+	}
+
 	int scroll_bar_v_minwidth = scroll_bar_v->get_minimum_size().x;
 	Size2 size = get_size();
 	float max_column_width = 0.0;
 
 	//1- compute item minimum sizes
 	for (int i = 0; i < items.size(); i++) {
-		Size2 minsize;
-		if (items[i].icon.is_valid()) {
-			if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
-				minsize = fixed_icon_size * icon_scale;
-			} else {
-				minsize = items[i].get_icon_size() * icon_scale;
-			}
-
-			if (!items[i].text.is_empty()) {
-				if (icon_mode == ICON_MODE_TOP) {
-					minsize.y += theme_cache.icon_margin;
-				} else {
-					minsize.x += theme_cache.icon_margin;
-				}
-			}
-		}
-
-		if (!items[i].text.is_empty()) {
-			int max_width = -1;
-			if (fixed_column_width) {
-				max_width = fixed_column_width;
-			}
-			items.write[i].text_buf->set_width(max_width);
-			Size2 s = items[i].text_buf->get_size();
-
-			if (icon_mode == ICON_MODE_TOP) {
-				minsize.x = MAX(minsize.x, s.width);
-				if (max_text_lines > 0) {
-					minsize.y += s.height + theme_cache.line_separation * max_text_lines;
-				} else {
-					minsize.y += s.height;
-				}
-
-			} else {
-				minsize.y = MAX(minsize.y, s.height);
-				minsize.x += s.width;
-			}
-		}
-
-		if (fixed_column_width > 0) {
-			minsize.x = fixed_column_width;
-		}
+		Size2 minsize = _get_item_minimum_size(items[i]);
 		max_column_width = MAX(max_column_width, minsize.x);
 
 		// Elements need to adapt to the selected size.
@@ -1695,6 +2059,17 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 		pos.x = get_size().width - pos.x - scroll_bar_h->get_value() - theme_cache.panel_style->get_margin(SIDE_LEFT) - theme_cache.panel_style->get_margin(SIDE_RIGHT);
 	}
 
+	if (_is_virtual()) {
+		// Rows span the full width, so only the offset matters.
+		if (virtual_item_count == 0) {
+			return -1;
+		}
+		if (p_exact && (pos.y < 0 || pos.y >= virtual_row_heights.get_total())) {
+			return -1;
+		}
+		return virtual_row_heights.find_row(pos.y);
+	}
+
 	int closest = -1;
 	int closest_dist = 0x7FFFFFFF;
 
@@ -1729,7 +2104,7 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 }
 
 bool ItemList::is_pos_at_end_of_items(const Point2 &p_pos) const {
-	if (items.is_empty()) {
+	if (get_item_count() == 0) {
 		return true;
 	}
 
@@ -1741,7 +2116,7 @@ bool ItemList::is_pos_at_end_of_items(const Point2 &p_pos) const {
 		pos.x = get_size().width - pos.x;
 	}
 
-	Rect2 endrect = items[items.size() - 1].rect_cache;
+	Rect2 endrect = _get_item_rect_cache(get_item_count() - 1);
 	return (pos.y > endrect.position.y + endrect.size.y);
 }
 
@@ -1749,14 +2124,15 @@ String ItemList::get_tooltip(const Point2 &p_pos) const {
 	int closest = get_item_at_position(p_pos, true);
 
 	if (closest != -1) {
-		if (!items[closest].tooltip_enabled) {
+		const Item &item = _get_item(closest);
+		if (!item.tooltip_enabled) {
 			return "";
 		}
-		if (!items[closest].tooltip.is_empty()) {
-			return items[closest].tooltip;
+		if (!item.tooltip.is_empty()) {
+			return item.tooltip;
 		}
-		if (!items[closest].text.is_empty()) {
-			return items[closest].text;
+		if (!item.text.is_empty()) {
+			return item.text;
 		}
 	}
 
@@ -1830,6 +2206,14 @@ real_t ItemList::get_icon_scale() const {
 
 Vector<int> ItemList::get_selected_items() {
 	Vector<int> selected;
+	if (_is_virtual()) {
+		for (int idx : virtual_selected) {
+			selected.push_back(idx);
+		}
+		selected.sort();
+		return selected;
+	}
+
 	for (int i = 0; i < items.size(); i++) {
 		if (items[i].selected) {
 			selected.push_back(i);
@@ -1842,6 +2226,10 @@ Vector<int> ItemList::get_selected_items() {
 }
 
 bool ItemList::is_anything_selected() {
+	if (_is_virtual()) {
+		return !virtual_selected.is_empty();
+	}
+
 	for (int i = 0; i < items.size(); i++) {
 		if (items[i].selected) {
 			return true;
@@ -1924,6 +2312,13 @@ bool ItemList::has_wraparound_items() const {
 	return wraparound_items;
 }
 
+void ItemList::_validate_property(PropertyInfo &p_property) const {
+	if (_is_virtual() && p_property.name == "item_count") {
+		// Provider rows are not stored with the scene.
+		p_property.usage = PROPERTY_USAGE_NONE;
+	}
+}
+
 bool ItemList::_set(const StringName &p_name, const Variant &p_value) {
 	if (property_helper.property_set_value(p_name, p_value)) {
 		return true;
@@ -2012,6 +2407,10 @@ void ItemList::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_item_count", "count"), &ItemList::set_item_count);
 	ClassDB::bind_method(D_METHOD("get_item_count"), &ItemList::get_item_count);
+
+	ClassDB::bind_method(D_METHOD("set_item_provider", "provider"), &ItemList::set_item_provider);
+	ClassDB::bind_method(D_METHOD("get_item_provider"), &ItemList::get_item_provider);
+	ClassDB::bind_method(D_METHOD("invalidate_items", "from", "to"), &ItemList::invalidate_items, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("remove_item", "idx"), &ItemList::remove_item);
 
 	ClassDB::bind_method(D_METHOD("clear"), &ItemList::clear);
@@ -2134,7 +2533,7 @@ void ItemList::_bind_methods() {
 	Item defaults(true);
 
 	base_property_helper.set_prefix("item_");
-	base_property_helper.set_array_length_getter(&ItemList::get_item_count);
+	base_property_helper.set_array_length_getter(&ItemList::_get_stored_item_count);
 	base_property_helper.register_property(PropertyInfo(Variant::STRING, "text"), defaults.text, &ItemList::set_item_text, &ItemList::get_item_text);
 	base_property_helper.register_property(PropertyInfo(Variant::OBJECT, "icon", PROPERTY_HINT_RESOURCE_TYPE, "Texture2D"), defaults.icon, &ItemList::set_item_icon, &ItemList::get_item_icon);
 	base_property_helper.register_property(PropertyInfo(Variant::BOOL, "selectable"), defaults.selectable, &ItemList::set_item_selectable, &ItemList::is_item_selectable);
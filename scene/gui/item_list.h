@@ -89,6 +89,24 @@ private:
 		Item(bool p_dummy) {}
 	};
 
+	// Prefix sums of row heights (Fenwick tree), so both the offset of a row
+	// and the row at an offset are found in O(log n).
+	struct RowHeights {
+		LocalVector<real_t> heights;
+		LocalVector<double> tree; // 1-based, tree[0] is unused.
+
+		_FORCE_INLINE_ int size() const { return heights.size(); }
+		_FORCE_INLINE_ real_t get_height(int p_row) const { return heights[p_row]; }
+
+		void clear();
+		void fill(int p_count, real_t p_height);
+		void resize(int p_count, real_t p_height);
+		void set_height(int p_row, real_t p_height);
+		double get_offset(int p_row) const;
+		double get_total() const { return get_offset(heights.size()); }
+		int find_row(double p_offset) const;
+	};
+
 	static inline PropertyListHelper base_property_helper;
 	PropertyListHelper property_helper;
 
@@ -138,6 +156,19 @@ private:
 
 	bool do_autoscroll_to_bottom = false;
 
+	// Virtual mode, see set_item_provider(). Rows are requested from the provider only
+	// when they become visible, and are cached while they stay near the visible range.
+	Callable item_provider;
+	int virtual_item_count = 0;
+	mutable HashMap<int, Item> virtual_items;
+	mutable Item virtual_peeked_item; // Uncached row returned by _get_item().
+	mutable bool virtual_fetching = false;
+	mutable RowHeights virtual_row_heights;
+	mutable bool virtual_heights_changed = false;
+	real_t virtual_row_estimate = 0.0;
+	real_t virtual_content_width = 0.0;
+	HashSet<int> virtual_selected;
+
 	struct ThemeCache {
 		int h_separation = 0;
 		int v_separation = 0;
@@ -168,12 +199,25 @@ private:
 
 	void _scroll_changed(double);
 	void _shape_text(int p_idx);
+	void _shape_item_text(Item &p_item) const;
+	Size2 _get_item_minimum_size(const Item &p_item) const;
 	void _mouse_exited();
 
+	_FORCE_INLINE_ bool _is_virtual() const { return item_provider.is_valid(); }
+	const Item &_get_item(int p_idx) const;
+	void _fetch_virtual_item(int p_idx, Item &r_item) const;
+	Item &_get_virtual_item(int p_idx) const;
+	Rect2 _get_item_rect_cache(int p_idx) const;
+	real_t _get_virtual_row_estimate() const;
+	void _update_virtual_scroll();
+	void _trim_virtual_items(int p_first_visible, int p_last_visible);
+	int _get_stored_item_count() const { return items.size(); }
+
 	String _atr(int p_idx, const String &p_text) const;
 
 protected:
 	void _notification(int p_what);
+	void _validate_property(PropertyInfo &p_property) const;
 	bool _set(const StringName &p_name, const Variant &p_value);
 	bool _get(const StringName &p_name, Variant &r_ret) const { return property_helper.property_get_value(p_name, r_ret); }
 	void _get_property_list(List<PropertyInfo> *p_list) const { property_helper.get_property_list(p_list); }
@@ -255,6 +299,10 @@ public:
 	int get_item_count() const;
 	void remove_item(int p_idx);
 
+	void set_item_provider(const Callable &p_provider);
+	Callable get_item_provider() const;
+	void invalidate_items(int p_from = 0, int p_to = -1);
+
 	void clear();
 
 	void set_fixed_column_width(int p_size);
@@ -43,6 +43,7 @@
 #include "scene/3d/physics/collision_object_3d.h"
 #include "scene/3d/world_environment.h"
 #endif // _3D_DISABLED
+#include "scene/gui/container.h"
 #include "scene/gui/control.h"
 #include "scene/gui/label.h"
 #include "scene/gui/popup.h"
@@ -257,6 +258,133 @@ void Viewport::_process_dirty_canvas_parent_orders() {
 	gui.canvas_parents_with_dirty_order.clear();
 }
 
+struct QueuedLayoutControl {
+	ObjectID id;
+	int depth = 0;
+	uint32_t order = 0;
+};
+
+// Heap comparators: the control to process first is the greatest.
+struct QueuedLayoutControlDeepestFirst {
+	_FORCE_INLINE_ bool operator()(const QueuedLayoutControl &p_a, const QueuedLayoutControl &p_b) const {
+		return p_a.depth < p_b.depth || (p_a.depth == p_b.depth && p_a.order > p_b.order);
+	}
+};
+
+struct QueuedLayoutControlShallowestFirst {
+	_FORCE_INLINE_ bool operator()(const QueuedLayoutControl &p_a, const QueuedLayoutControl &p_b) const {
+		return p_a.depth > p_b.depth || (p_a.depth == p_b.depth && p_a.order > p_b.order);
+	}
+};
+
+template <typename Comparator>
+static void _push_layout_queue(LocalVector<ObjectID> &r_queue, LocalVector<QueuedLayoutControl> &r_heap, uint32_t &r_order) {
+	SortArray<QueuedLayoutControl, Comparator> sorter;
+	for (uint32_t i = 0; i < r_queue.size(); i++) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(r_queue[i]));
+		if (!node) {
+			continue; // May have been deleted.
+		}
+
+		QueuedLayoutControl queued;
+		queued.id = r_queue[i];
+		queued.order = r_order++;
+		for (Node *parent = node->get_parent(); parent; parent = parent->get_parent()) {
+			queued.depth++;
+		}
+		r_heap.push_back(queued);
+		sorter.push_heap(0, r_heap.size() - 1, 0, queued, r_heap.ptr());
+	}
+	r_queue.clear();
+}
+
+template <typename Comparator>
+static bool _pop_layout_queue(LocalVector<QueuedLayoutControl> &r_heap, QueuedLayoutControl &r_queued) {
+	if (r_heap.is_empty()) {
+		return false;
+	}
+
+	SortArray<QueuedLayoutControl, Comparator> sorter;
+	sorter.pop_heap(0, r_heap.size(), r_heap.ptr());
+	r_queued = r_heap[r_heap.size() - 1];
+	r_heap.resize(r_heap.size() - 1);
+	return true;
+}
+
+void Viewport::_gui_queue_minimum_size_update(Control *p_control) {
+	gui.layout_minimum_size_queue.push_back(p_control->get_instance_id());
+	if (!gui.layout_update_queued) {
+		gui.layout_update_queued = true;
+		callable_mp(this, &Viewport::_process_dirty_gui_layout).call_deferred();
+	}
+}
+
+void Viewport::_gui_queue_sort(Container *p_container) {
+	gui.layout_sort_queue.push_back(p_container->get_instance_id());
+	if (!gui.layout_update_queued) {
+		gui.layout_update_queued = true;
+		callable_mp(this, &Viewport::_process_dirty_gui_layout).call_deferred();
+	}
+}
+
+void Viewport::_gui_count_layout(LayoutInfo p_info) {
+	uint64_t frame = Engine::get_singleton()->get_process_frames();
+	if (frame != gui.layout_info_frame) {
+		gui.layout_info_frame = frame;
+		for (int i = 0; i < LAYOUT_INFO_MAX; i++) {
+			gui.layout_info[i] = 0;
+		}
+	}
+	gui.layout_info[p_info]++;
+}
+
+void Viewport::_process_dirty_gui_layout() {
+	// Minimum sizes are resolved deepest first, so every ancestor is recomputed once
+	// and propagation stops at the first control whose combined minimum size is unchanged.
+	// Containers are then sorted parents first, so a child resized by its parent is sorted
+	// only once, after its parent. Sorting can change minimum sizes again (e.g. autowrapped
+	// text), hence the alternating passes.
+	const int max_passes = 8;
+
+	gui.layout_update_queued = false;
+	_gui_count_layout(LAYOUT_INFO_PASSES);
+
+	// Controls queued while processing are pushed to the same heap, so a control is always
+	// processed after every deeper (or, for sorts, shallower) control queued before it.
+	LocalVector<QueuedLayoutControl> heap;
+	QueuedLayoutControl queued;
+	uint32_t order = 0;
+	for (int pass = 0; pass < max_passes; pass++) {
+		if (gui.layout_minimum_size_queue.is_empty() && gui.layout_sort_queue.is_empty()) {
+			return;
+		}
+
+		_push_layout_queue<QueuedLayoutControlDeepestFirst>(gui.layout_minimum_size_queue, heap, order);
+		while (_pop_layout_queue<QueuedLayoutControlDeepestFirst>(heap, queued)) {
+			Control *control = Object::cast_to<Control>(ObjectDB::get_instance(queued.id));
+			if (control) {
+				control->_update_minimum_size();
+			}
+			_push_layout_queue<QueuedLayoutControlDeepestFirst>(gui.layout_minimum_size_queue, heap, order);
+		}
+
+		_push_layout_queue<QueuedLayoutControlShallowestFirst>(gui.layout_sort_queue, heap, order);
+		while (_pop_layout_queue<QueuedLayoutControlShallowestFirst>(heap, queued)) {
+			Container *container = Object::cast_to<Container>(ObjectDB::get_instance(queued.id));
+			if (container) {
+				container->_sort_children();
+			}
+			_push_layout_queue<QueuedLayoutControlShallowestFirst>(gui.layout_sort_queue, heap, order);
+		}
+	}
+
+	// Not settled yet, continue on the next flush rather than spinning here.
+	if (!gui.layout_update_queued && (!gui.layout_minimum_size_queue.is_empty() || !gui.layout_sort_queue.is_empty())) {
+		gui.layout_update_queued = true;
+		callable_mp(this, &Viewport::_process_dirty_gui_layout).call_deferred();
+	}
+}
+
 void Viewport::_sub_window_update_order() {
 	if (gui.sub_windows.size() < 2) {
 		return;
@@ -3602,6 +3730,25 @@ bool Viewport::is_snap_controls_to_pixels_enabled() const {
 	return snap_controls_to_pixels;
 }
 
+void Viewport::set_gui_incremental_layout(bool p_enable) {
+	ERR_MAIN_THREAD_GUARD;
+	gui_incremental_layout = p_enable;
+}
+
+bool Viewport::is_gui_incremental_layout_enabled() const {
+	ERR_READ_THREAD_GUARD_V(false);
+	return gui_incremental_layout;
+}
+
+int Viewport::get_gui_layout_info(LayoutInfo p_info) const {
+	ERR_READ_THREAD_GUARD_V(0);
+	ERR_FAIL_INDEX_V(p_info, LAYOUT_INFO_MAX, 0);
+	if (gui.layout_info_frame != Engine::get_singleton()->get_process_frames()) {
+		return 0;
+	}
+	return gui.layout_info[p_info];
+}
+
 void Viewport::set_snap_2d_transforms_to_pixel(bool p_enable) {
 	ERR_MAIN_THREAD_GUARD;
 	snap_2d_transforms_to_pixel = p_enable;
@@ -4827,6 +4974,10 @@ void Viewport::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_snap_controls_to_pixels", "enabled"), &Viewport::set_snap_controls_to_pixels);
 	ClassDB::bind_method(D_METHOD("is_snap_controls_to_pixels_enabled"), &Viewport::is_snap_controls_to_pixels_enabled);
 
+	ClassDB::bind_method(D_METHOD("set_gui_incremental_layout", "enabled"), &Viewport::set_gui_incremental_layout);
+	ClassDB::bind_method(D_METHOD("is_gui_incremental_layout_enabled"), &Viewport::is_gui_incremental_layout_enabled);
+	ClassDB::bind_method(D_METHOD("get_gui_layout_info", "info"), &Viewport::get_gui_layout_info);
+
 	ClassDB::bind_method(D_METHOD("set_snap_2d_transforms_to_pixel", "enabled"), &Viewport::set_snap_2d_transforms_to_pixel);
 	ClassDB::bind_method(D_METHOD("is_snap_2d_transforms_to_pixel_enabled"), &Viewport::is_snap_2d_transforms_to_pixel_enabled);
 
@@ -4965,6 +5116,7 @@ void Viewport::_bind_methods() {
 	ADD_GROUP("GUI", "gui_");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "gui_disable_input"), "set_disable_input", "is_input_disabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "gui_snap_controls_to_pixels"), "set_snap_controls_to_pixels", "is_snap_controls_to_pixels_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "gui_incremental_layout"), "set_gui_incremental_layout", "is_gui_incremental_layout_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "gui_embed_subwindows"), "set_embedding_subwindows", "is_embedding_subwindows");
 	ADD_GROUP("SDF", "sdf_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "sdf_oversize", PROPERTY_HINT_ENUM, "100%,120%,150%,200%"), "set_sdf_oversize", "get_sdf_oversize");
@@ -5085,6 +5237,11 @@ void Viewport::_bind_methods() {
 	BIND_ENUM_CONSTANT(VRS_UPDATE_ONCE);
 	BIND_ENUM_CONSTANT(VRS_UPDATE_ALWAYS);
 	BIND_ENUM_CONSTANT(VRS_UPDATE_MAX);
+
+	BIND_ENUM_CONSTANT(LAYOUT_INFO_MINIMUM_SIZE_UPDATES);
+	BIND_ENUM_CONSTANT(LAYOUT_INFO_SORTS);
+	BIND_ENUM_CONSTANT(LAYOUT_INFO_PASSES);
+	BIND_ENUM_CONSTANT(LAYOUT_INFO_MAX);
 }
 
 void Viewport::_validate_property(PropertyInfo &p_property) const {
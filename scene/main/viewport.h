@@ -45,6 +45,7 @@ class AudioListener2D;
 class Camera2D;
 class CanvasItem;
 class CanvasLayer;
+class Container;
 class Control;
 class Label;
 class SceneTreeTimer;
@@ -199,6 +200,13 @@ public:
 		DEFAULT_CANVAS_ITEM_TEXTURE_REPEAT_MAX,
 	};
 
+	enum LayoutInfo {
+		LAYOUT_INFO_MINIMUM_SIZE_UPDATES,
+		LAYOUT_INFO_SORTS,
+		LAYOUT_INFO_PASSES,
+		LAYOUT_INFO_MAX
+	};
+
 	enum SDFOversize {
 		SDF_OVERSIZE_100_PERCENT,
 		SDF_OVERSIZE_120_PERCENT,
@@ -266,6 +274,7 @@ private:
 	bool gen_mipmaps = false;
 
 	bool snap_controls_to_pixels = true;
+	bool gui_incremental_layout = false;
 	bool snap_2d_transforms_to_pixel = false;
 	bool snap_2d_vertices_to_pixel = false;
 
@@ -407,6 +416,13 @@ private:
 		Rect2i subwindow_resize_from_rect;
 
 		Vector<SubWindow> sub_windows; // Don't obtain references or pointers to the elements, as their location can change.
+
+		// Incremental layout, see _process_dirty_gui_layout().
+		LocalVector<ObjectID> layout_minimum_size_queue;
+		LocalVector<ObjectID> layout_sort_queue;
+		bool layout_update_queued = false;
+		uint64_t layout_info_frame = 0;
+		int layout_info[LAYOUT_INFO_MAX] = {};
 	} gui;
 
 	DefaultCanvasItemTextureFilter default_canvas_item_texture_filter = DEFAULT_CANVAS_ITEM_TEXTURE_FILTER_LINEAR;
@@ -430,6 +446,7 @@ private:
 	Ref<InputEvent> _make_input_local(const Ref<InputEvent> &ev);
 
 	friend class Control;
+	friend class Container;
 
 	List<Control *>::Element *_gui_add_root_control(Control *p_control);
 
@@ -457,6 +474,11 @@ private:
 
 	bool _gui_drop(Control *p_at_control, Point2 p_at_pos, bool p_just_check);
 
+	void _gui_queue_minimum_size_update(Control *p_control);
+	void _gui_queue_sort(Container *p_container);
+	void _gui_count_layout(LayoutInfo p_info);
+	void _process_dirty_gui_layout();
+
 	friend class CanvasLayer;
 	void _canvas_layer_add(CanvasLayer *p_canvas_layer);
 	void _canvas_layer_remove(CanvasLayer *p_canvas_layer);
@@ -633,6 +655,10 @@ public:
 	void set_snap_controls_to_pixels(bool p_enable);
 	bool is_snap_controls_to_pixels_enabled() const;
 
+	void set_gui_incremental_layout(bool p_enable);
+	bool is_gui_incremental_layout_enabled() const;
+	int get_gui_layout_info(LayoutInfo p_info) const;
+
 	void set_snap_2d_transforms_to_pixel(bool p_enable);
 	bool is_snap_2d_transforms_to_pixel_enabled() const;
 
@@ -893,5 +919,6 @@ VARIANT_ENUM_CAST(Viewport::RenderInfo);
 VARIANT_ENUM_CAST(Viewport::RenderInfoType);
 VARIANT_ENUM_CAST(Viewport::DefaultCanvasItemTextureFilter);
 VARIANT_ENUM_CAST(Viewport::DefaultCanvasItemTextureRepeat);
+VARIANT_ENUM_CAST(Viewport::LayoutInfo);
 
 #endif // VIEWPORT_H
@@ -204,6 +204,7 @@
 #include "scene/2d/remote_transform_2d.h"
 #include "scene/2d/skeleton_2d.h"
 #include "scene/2d/sprite_2d.h"
+#include "scene/2d/sprite_batch_2d.h"
 #include "scene/2d/tile_map.h"
 #include "scene/2d/tile_map_layer.h"
 #include "scene/2d/touch_screen_button.h"
@@ -661,6 +662,8 @@ void register_scene_types() {
 	GDREGISTER_CLASS(NavigationObstacle3D);
 	GDREGISTER_CLASS(NavigationLink3D);
 
+	PhysicsServer3D::set_body_state_sync_bulk_callback(&RigidBody3D::_body_state_sync_bulk);
+
 	OS::get_singleton()->yield(); // may take time to init
 #endif // _3D_DISABLED
 
@@ -807,6 +810,7 @@ void register_scene_types() {
 	GDREGISTER_CLASS(Line2D);
 	GDREGISTER_CLASS(MeshInstance2D);
 	GDREGISTER_CLASS(MultiMeshInstance2D);
+	GDREGISTER_CLASS(SpriteBatch2D);
 	GDREGISTER_ABSTRACT_CLASS(CollisionObject2D);
 	GDREGISTER_ABSTRACT_CLASS(PhysicsBody2D);
 	GDREGISTER_CLASS(StaticBody2D);
@@ -1038,6 +1042,8 @@ void register_scene_types() {
 	GDREGISTER_CLASS(NavigationObstacle2D);
 	GDREGISTER_CLASS(NavigationLink2D);
 
+	PhysicsServer2D::set_body_state_sync_bulk_callback(&RigidBody2D::_body_state_sync_bulk);
+
 	OS::get_singleton()->yield(); // may take time to init
 
 	// 2D nodes that support navmesh baking need to server register their source geometry parsers.
@@ -1312,6 +1318,8 @@ void unregister_scene_types() {
 
 	// StandardMaterial3D is not initialized when 3D is disabled, so it shouldn't be cleaned up either
 #ifndef _3D_DISABLED
+	PhysicsServer3D::set_body_state_sync_bulk_callback(nullptr);
+
 	BaseMaterial3D::finish_shaders();
 	PhysicalSkyMaterial::cleanup_shader();
 	PanoramaSkyMaterial::cleanup_shader();
@@ -1322,6 +1330,7 @@ void unregister_scene_types() {
 	ParticleProcessMaterial::finish_shaders();
 	CanvasItemMaterial::finish_shaders();
 	ColorPicker::finish_shaders();
+	PhysicsServer2D::set_body_state_sync_bulk_callback(nullptr);
 	GraphEdit::finish_shaders();
 	SceneStringNames::free();
 
@@ -435,6 +435,15 @@ real_t NavigationPolygon::get_border_size() const {
 	return border_size;
 }
 
+void NavigationPolygon::set_tile_size(real_t p_value) {
+	ERR_FAIL_COND(p_value < 0.0);
+	tile_size = p_value;
+}
+
+real_t NavigationPolygon::get_tile_size() const {
+	return tile_size;
+}
+
 void NavigationPolygon::set_sample_partition_type(SamplePartitionType p_value) {
 	ERR_FAIL_INDEX(p_value, SAMPLE_PARTITION_MAX);
 	partition_type = p_value;
@@ -558,6 +567,9 @@ void NavigationPolygon::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_border_size", "border_size"), &NavigationPolygon::set_border_size);
 	ClassDB::bind_method(D_METHOD("get_border_size"), &NavigationPolygon::get_border_size);
 
+	ClassDB::bind_method(D_METHOD("set_tile_size", "tile_size"), &NavigationPolygon::set_tile_size);
+	ClassDB::bind_method(D_METHOD("get_tile_size"), &NavigationPolygon::get_tile_size);
+
 	ClassDB::bind_method(D_METHOD("set_sample_partition_type", "sample_partition_type"), &NavigationPolygon::set_sample_partition_type);
 	ClassDB::bind_method(D_METHOD("get_sample_partition_type"), &NavigationPolygon::get_sample_partition_type);
 
@@ -602,6 +614,7 @@ void NavigationPolygon::_bind_methods() {
 	ADD_GROUP("Cells", "");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "cell_size", PROPERTY_HINT_RANGE, "1.0,50.0,1.0,or_greater,suffix:px"), "set_cell_size", "get_cell_size");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "border_size", PROPERTY_HINT_RANGE, "0.0,500.0,1.0,or_greater,suffix:px"), "set_border_size", "get_border_size");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "tile_size", PROPERTY_HINT_RANGE, "0.0,10000.0,1.0,or_greater,suffix:px"), "set_tile_size", "get_tile_size");
 	ADD_GROUP("Agents", "agent_");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "agent_radius", PROPERTY_HINT_RANGE, "0.0,500.0,0.01,or_greater,suffix:px"), "set_agent_radius", "get_agent_radius");
 	ADD_GROUP("Filters", "");
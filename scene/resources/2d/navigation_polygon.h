@@ -53,6 +53,7 @@ class NavigationPolygon : public Resource {
 
 	real_t cell_size = NavigationDefaults2D::navmesh_cell_size;
 	real_t border_size = 0.0f;
+	real_t tile_size = 0.0f;
 
 	Rect2 baking_rect;
 	Vector2 baking_rect_offset;
@@ -156,6 +157,9 @@ public:
 	void set_border_size(real_t p_value);
 	real_t get_border_size() const;
 
+	void set_tile_size(real_t p_value);
+	real_t get_tile_size() const;
+
 	void set_baking_rect(const Rect2 &p_rect);
 	Rect2 get_baking_rect() const;
 
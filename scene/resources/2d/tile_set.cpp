@@ -261,6 +261,17 @@ bool TileSet::TerrainsPattern::operator==(const TerrainsPattern &p_terrains_patt
 	return true;
 }
 
+uint32_t TileSet::TerrainsPattern::hash() const {
+	uint32_t h = hash_murmur3_one_32(uint32_t(terrain));
+	for (int i = 0; i < TileSet::CELL_NEIGHBOR_MAX; i++) {
+		if (is_valid_bit[i]) {
+			h = hash_murmur3_one_32(uint32_t(i), h);
+			h = hash_murmur3_one_32(uint32_t(bits[i]), h);
+		}
+	}
+	return hash_fmix32(h);
+}
+
 void TileSet::TerrainsPattern::set_terrain(int p_terrain) {
 	ERR_FAIL_COND(p_terrain < -1);
 
@@ -459,6 +470,33 @@ void TileSet::_update_terrains_cache() {
 			empty_cell.alternative_tile = TileSetSource::INVALID_TILE_ALTERNATIVE;
 			per_terrain_pattern_tiles[i][empty_pattern].insert(empty_cell);
 		}
+
+		// Build the lookup tables.
+		per_terrain_set_lookups.resize(terrain_sets.size());
+		for (int terrain_set = 0; terrain_set < terrain_sets.size(); terrain_set++) {
+			TerrainsLookup &lookup = per_terrain_set_lookups[terrain_set];
+			lookup.peering_bits.clear();
+			lookup.patterns.clear();
+			lookup.patterns_terrains.clear();
+			lookup.pattern_indices.clear();
+
+			for (int i = 0; i < TileSet::CELL_NEIGHBOR_MAX; i++) {
+				if (is_valid_terrain_peering_bit(terrain_set, CellNeighbor(i))) {
+					lookup.peering_bits.push_back(CellNeighbor(i));
+				}
+			}
+
+			lookup.patterns.reserve(per_terrain_pattern_tiles[terrain_set].size());
+			lookup.patterns_terrains.reserve(per_terrain_pattern_tiles[terrain_set].size() * (1 + lookup.peering_bits.size()));
+			for (const KeyValue<TileSet::TerrainsPattern, RBSet<TileMapCell>> &kv : per_terrain_pattern_tiles[terrain_set]) {
+				lookup.pattern_indices[kv.key] = lookup.patterns.size();
+				lookup.patterns.push_back(kv.key);
+				lookup.patterns_terrains.push_back(kv.key.get_terrain());
+				for (const CellNeighbor &bit : lookup.peering_bits) {
+					lookup.patterns_terrains.push_back(kv.key.get_terrain_peering_bit(bit));
+				}
+			}
+		}
 		terrains_cache_dirty = false;
 	}
 }
@@ -1436,6 +1474,13 @@ RBSet<TileSet::TerrainsPattern> TileSet::get_terrains_pattern_set(int p_terrain_
 	return output;
 }
 
+const TileSet::TerrainsLookup &TileSet::get_terrains_lookup(int p_terrain_set) {
+	static const TerrainsLookup empty_lookup;
+	ERR_FAIL_INDEX_V(p_terrain_set, terrain_sets.size(), empty_lookup);
+	_update_terrains_cache();
+	return per_terrain_set_lookups[p_terrain_set];
+}
+
 RBSet<TileMapCell> TileSet::get_tiles_for_terrains_pattern(int p_terrain_set, TerrainsPattern p_terrain_tile_pattern) {
 	ERR_FAIL_INDEX_V(p_terrain_set, terrain_sets.size(), RBSet<TileMapCell>());
 	_update_terrains_cache();
@@ -3246,6 +3291,7 @@ void TileSet::reset_state() {
 	terrain_meshes.clear();
 	terrain_peering_bits_meshes.clear();
 	per_terrain_pattern_tiles.clear();
+	per_terrain_set_lookups.clear();
 	terrains_cache_dirty = true;
 
 	// Navigation
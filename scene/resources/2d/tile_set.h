@@ -279,6 +279,7 @@ public:
 		bool operator!=(const TerrainsPattern &p_terrains_pattern) const {
 			return !operator==(p_terrains_pattern);
 		}
+		uint32_t hash() const;
 
 		void set_terrain(int p_terrain);
 		int get_terrain() const;
@@ -293,6 +294,18 @@ public:
 		TerrainsPattern() {}
 	};
 
+	struct TerrainsPatternHasher {
+		static _FORCE_INLINE_ uint32_t hash(const TerrainsPattern &p_terrains_pattern) { return p_terrains_pattern.hash(); }
+	};
+
+	// Lookup tables of the patterns of a terrain set, used to solve terrains.
+	struct TerrainsLookup {
+		LocalVector<CellNeighbor> peering_bits; // The valid peering bits of the terrain set.
+		LocalVector<TerrainsPattern> patterns; // In the same order as get_terrains_pattern_set().
+		LocalVector<int> patterns_terrains; // For each pattern, its center terrain followed by the terrain of each of peering_bits.
+		HashMap<TerrainsPattern, int, TerrainsPatternHasher> pattern_indices;
+	};
+
 protected:
 	bool _set(const StringName &p_name, const Variant &p_value);
 	bool _get(const StringName &p_name, Variant &r_ret) const;
@@ -348,6 +361,7 @@ private:
 	bool terrain_bits_meshes_dirty = true;
 
 	LocalVector<RBMap<TileSet::TerrainsPattern, RBSet<TileMapCell>>> per_terrain_pattern_tiles; // Cached data.
+	LocalVector<TerrainsLookup> per_terrain_set_lookups; // Cached data.
 	bool terrains_cache_dirty = true;
 	void _update_terrains_cache();
 
@@ -529,6 +543,7 @@ public:
 
 	// Terrains.
 	RBSet<TerrainsPattern> get_terrains_pattern_set(int p_terrain_set);
+	const TerrainsLookup &get_terrains_lookup(int p_terrain_set);
 	RBSet<TileMapCell> get_tiles_for_terrains_pattern(int p_terrain_set, TerrainsPattern p_terrain_tile_pattern);
 	TileMapCell get_random_tile_from_terrains_pattern(int p_terrain_set, TerrainsPattern p_terrain_tile_pattern);
 
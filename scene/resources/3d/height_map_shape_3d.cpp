@@ -148,6 +148,10 @@ void HeightMapShape3D::_update_shape() {
 	d["heights"] = map_data;
 	d["min_height"] = min_height;
 	d["max_height"] = max_height;
+	if (changed_region.has_area()) {
+		d["region"] = changed_region;
+		changed_region = Rect2i();
+	}
 	PhysicsServer3D::get_singleton()->shape_set_data(get_shape(), d);
 	Shape3D::_update_shape();
 }
@@ -210,8 +214,13 @@ void HeightMapShape3D::set_map_data(Vector<real_t> p_new) {
 	// copy
 	real_t *w = map_data.ptrw();
 	const real_t *r = p_new.ptr();
+	Rect2i region;
 	for (int i = 0; i < size; i++) {
 		real_t val = r[i];
+		if (w[i] != val) {
+			Rect2i cell(i % map_width, i / map_width, 1, 1);
+			region = region.has_area() ? region.merge(cell) : cell;
+		}
 		w[i] = val;
 		if (i == 0) {
 			min_height = val;
@@ -227,6 +236,8 @@ void HeightMapShape3D::set_map_data(Vector<real_t> p_new) {
 		}
 	}
 
+	changed_region = region;
+
 	_update_shape();
 	emit_changed();
 }
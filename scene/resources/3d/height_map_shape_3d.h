@@ -44,6 +44,8 @@ class HeightMapShape3D : public Shape3D {
 	Vector<real_t> map_data;
 	real_t min_height = 0.0;
 	real_t max_height = 0.0;
+	// Heights changed since the last shape update, lets the physics server refresh only that part of the shape.
+	Rect2i changed_region;
 
 protected:
 	static void _bind_methods();
@@ -32,6 +32,7 @@
 #define NAVIGATION_MESH_H
 
 #include "core/os/rw_lock.h"
+#include "core/templates/hash_map.h"
 #include "scene/resources/mesh.h"
 #include "servers/navigation/navigation_globals.h"
 
@@ -97,6 +98,8 @@ protected:
 	ParsedGeometryType parsed_geometry_type = PARSED_GEOMETRY_BOTH;
 	uint32_t collision_mask = 0xFFFFFFFF;
 
+	float tile_size = 0.0f;
+
 	SourceGeometryMode source_geometry_mode = SOURCE_GEOMETRY_ROOT_NODE_CHILDREN;
 	StringName source_group_name = "navigation_mesh_source_group";
 
@@ -106,6 +109,17 @@ protected:
 	AABB filter_baking_aabb;
 	Vector3 filter_baking_aabb_offset;
 
+public:
+	/// Result of the last tiled bake of one tile, reused while its source geometry stays the same.
+	struct BakedTile {
+		uint32_t source_hash = 0;
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+	};
+
+private:
+	HashMap<Vector2i, BakedTile> baked_tiles;
+
 public:
 	// Recast settings
 	void set_sample_partition_type(SamplePartitionType p_value);
@@ -135,6 +149,9 @@ public:
 	void set_border_size(float p_value);
 	float get_border_size() const;
 
+	void set_tile_size(float p_value);
+	float get_tile_size() const;
+
 	void set_agent_height(float p_value);
 	float get_agent_height() const;
 
@@ -197,6 +214,10 @@ public:
 
 	void clear();
 
+	void set_baked_tiles(const HashMap<Vector2i, BakedTile> &p_baked_tiles);
+	HashMap<Vector2i, BakedTile> get_baked_tiles() const;
+	void clear_baked_tiles();
+
 	void set_data(const Vector<Vector3> &p_vertices, const Vector<Vector<int>> &p_polygons);
 	void get_data(Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
 
@@ -238,6 +238,9 @@ public:
 
 	EXBIND1R(PhysicsDirectSpaceState3D *, space_get_direct_state, RID)
 
+	// Not exposed to extensions yet.
+	PhysicsDirectSpaceState3D *space_get_concurrent_direct_state(RID p_space) override { return nullptr; }
+
 	EXBIND2(space_set_debug_contacts, RID, int)
 	EXBIND1RC(Vector<Vector3>, space_get_contacts, RID)
 	EXBIND1RC(int, space_get_contact_count, RID)
@@ -380,6 +383,9 @@ public:
 	EXBIND2(body_set_state_sync_callback, RID, const Callable &)
 	EXBIND3(body_set_force_integration_callback, RID, const Callable &, const Variant &)
 
+	// Extensions keep using the state sync callback.
+	void body_set_state_sync_bulk(RID p_body, bool p_enable) override {}
+
 	EXBIND2(body_set_ray_pickable, RID, bool)
 
 	GDVIRTUAL8RC_REQUIRED(bool, _body_test_motion, RID, const Transform3D &, const Vector3 &, real_t, int, bool, bool, GDExtensionPtr<PhysicsServer3DExtensionMotionResult>)
@@ -301,6 +301,18 @@ public:
 	virtual void obstacle_set_avoidance_layers(RID p_obstacle, uint32_t p_layers) = 0;
 	virtual uint32_t obstacle_get_avoidance_layers(RID p_obstacle) const = 0;
 
+	/// Creates a flow field that guides crowds towards a set of targets on a map.
+	virtual RID flow_field_create() = 0;
+	virtual void flow_field_set_map(RID p_flow_field, RID p_map) = 0;
+	virtual RID flow_field_get_map(RID p_flow_field) const = 0;
+	virtual void flow_field_set_targets(RID p_flow_field, const Vector<Vector2> &p_targets) = 0;
+	virtual Vector<Vector2> flow_field_get_targets(RID p_flow_field) const = 0;
+	virtual void flow_field_set_navigation_layers(RID p_flow_field, uint32_t p_navigation_layers) = 0;
+	virtual uint32_t flow_field_get_navigation_layers(RID p_flow_field) const = 0;
+	virtual Vector2 flow_field_get_direction(RID p_flow_field, const Vector2 &p_position) const = 0;
+	virtual real_t flow_field_get_distance(RID p_flow_field, const Vector2 &p_position) const = 0;
+	virtual uint32_t flow_field_get_iteration_id(RID p_flow_field) const = 0;
+
 	/// Returns a customized navigation path using a query parameters object
 	virtual void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) = 0;
 
@@ -160,6 +160,16 @@ public:
 	Vector<Vector2> obstacle_get_vertices(RID p_agent) const override { return Vector<Vector2>(); }
 	void obstacle_set_avoidance_layers(RID p_obstacle, uint32_t p_layers) override {}
 	uint32_t obstacle_get_avoidance_layers(RID p_agent) const override { return 0; }
+	RID flow_field_create() override { return RID(); }
+	void flow_field_set_map(RID p_flow_field, RID p_map) override {}
+	RID flow_field_get_map(RID p_flow_field) const override { return RID(); }
+	void flow_field_set_targets(RID p_flow_field, const Vector<Vector2> &p_targets) override {}
+	Vector<Vector2> flow_field_get_targets(RID p_flow_field) const override { return Vector<Vector2>(); }
+	void flow_field_set_navigation_layers(RID p_flow_field, uint32_t p_navigation_layers) override {}
+	uint32_t flow_field_get_navigation_layers(RID p_flow_field) const override { return 0; }
+	Vector2 flow_field_get_direction(RID p_flow_field, const Vector2 &p_position) const override { return Vector2(); }
+	real_t flow_field_get_distance(RID p_flow_field, const Vector2 &p_position) const override { return 0.0; }
+	uint32_t flow_field_get_iteration_id(RID p_flow_field) const override { return 0; }
 
 	void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) override {}
 
@@ -337,6 +337,18 @@ public:
 	virtual void obstacle_set_avoidance_layers(RID p_obstacle, uint32_t p_layers) = 0;
 	virtual uint32_t obstacle_get_avoidance_layers(RID p_obstacle) const = 0;
 
+	/// Creates a flow field that guides crowds towards a set of targets on a map.
+	virtual RID flow_field_create() = 0;
+	virtual void flow_field_set_map(RID p_flow_field, RID p_map) = 0;
+	virtual RID flow_field_get_map(RID p_flow_field) const = 0;
+	virtual void flow_field_set_targets(RID p_flow_field, Vector<Vector3> p_targets) = 0;
+	virtual Vector<Vector3> flow_field_get_targets(RID p_flow_field) const = 0;
+	virtual void flow_field_set_navigation_layers(RID p_flow_field, uint32_t p_navigation_layers) = 0;
+	virtual uint32_t flow_field_get_navigation_layers(RID p_flow_field) const = 0;
+	virtual Vector3 flow_field_get_direction(RID p_flow_field, const Vector3 &p_position) const = 0;
+	virtual real_t flow_field_get_distance(RID p_flow_field, const Vector3 &p_position) const = 0;
+	virtual uint32_t flow_field_get_iteration_id(RID p_flow_field) const = 0;
+
 	/// Destroy the `RID`
 	virtual void free(RID p_object) = 0;
 
@@ -355,6 +367,9 @@ public:
 	/// Returns a customized navigation path using a query parameters object
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
 
+	/// Returns many customized navigation paths at once, the queries run in parallel
+	virtual void query_paths(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback = Callable()) = 0;
+
 #ifndef _3D_DISABLED
 	virtual void parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
@@ -387,6 +402,13 @@ public:
 		INFO_EDGE_CONNECTION_COUNT,
 		INFO_EDGE_FREE_COUNT,
 		INFO_OBSTACLE_COUNT,
+		INFO_MAP_SYNC_TIME,
+		INFO_MAP_BUILD_TIME,
+		INFO_AVOIDANCE_TIME,
+		INFO_PATH_QUERY_COUNT,
+		INFO_PATH_QUERY_TIME,
+		INFO_PATH_QUERY_MAX_TIME,
+		INFO_PATH_QUERY_POLYGON_COUNT,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) const = 0;
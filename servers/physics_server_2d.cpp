@@ -34,6 +34,7 @@
 #include "core/variant/typed_array.h"
 
 PhysicsServer2D *PhysicsServer2D::singleton = nullptr;
+PhysicsServer2D::BodyStateSyncBulkCallback PhysicsServer2D::body_state_sync_bulk_callback = nullptr;
 
 void PhysicsDirectBodyState2D::integrate_forces() {
 	real_t step = get_step();
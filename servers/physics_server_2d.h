@@ -477,6 +477,30 @@ public:
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) = 0;
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) = 0;
 
+	// Bulk state synchronization. Bodies with bulk sync enabled report their state
+	// through a single server-wide callback per step instead of their state sync
+	// callable, as long as such a callback is registered. Only bodies that moved
+	// during the step (or just fell asleep) are reported.
+	struct BodyStateSync {
+		ObjectID instance_id;
+		Transform2D transform;
+		Vector2 linear_velocity;
+		real_t angular_velocity = 0.0;
+		int contact_count = 0;
+		bool sleeping = false;
+	};
+
+	typedef void (*BodyStateSyncBulkCallback)(const BodyStateSync *p_states, uint32_t p_count);
+
+private:
+	static BodyStateSyncBulkCallback body_state_sync_bulk_callback;
+
+public:
+	static void set_body_state_sync_bulk_callback(BodyStateSyncBulkCallback p_callback) { body_state_sync_bulk_callback = p_callback; }
+	static BodyStateSyncBulkCallback get_body_state_sync_bulk_callback() { return body_state_sync_bulk_callback; }
+
+	virtual void body_set_state_sync_bulk(RID p_body, bool p_enable) = 0;
+
 	virtual bool body_collide_shape(RID p_body, int p_body_shape, RID p_shape, const Transform2D &p_shape_xform, const Vector2 &p_motion, Vector2 *r_results, int p_result_max, int &r_result_count) = 0;
 
 	virtual void body_set_pickable(RID p_body, bool p_pickable) = 0;
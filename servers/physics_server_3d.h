@@ -294,6 +294,7 @@ public:
 		SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD,
 		SPACE_PARAM_BODY_TIME_TO_SLEEP,
 		SPACE_PARAM_SOLVER_ITERATIONS,
+		SPACE_PARAM_SOLVER_SUBSTEPS,
 	};
 
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) = 0;
@@ -301,6 +302,8 @@ public:
 
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) = 0;
+	// Read-only state reflecting the last completed step, usable from any thread at any time. Returns null if unsupported.
+	virtual PhysicsDirectSpaceState3D *space_get_concurrent_direct_state(RID p_space) = 0;
 
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) = 0;
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const = 0;
@@ -514,6 +517,31 @@ public:
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) = 0;
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) = 0;
 
+	// Bulk state synchronization. Bodies with bulk sync enabled report their state
+	// through a single server-wide callback per step instead of their state sync
+	// callable, as long as such a callback is registered. Only bodies that moved
+	// during the step (or just fell asleep) are reported.
+	struct BodyStateSync {
+		ObjectID instance_id;
+		Transform3D transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		Basis inverse_inertia_tensor;
+		int contact_count = 0;
+		bool sleeping = false;
+	};
+
+	typedef void (*BodyStateSyncBulkCallback)(const BodyStateSync *p_states, uint32_t p_count);
+
+private:
+	static BodyStateSyncBulkCallback body_state_sync_bulk_callback;
+
+public:
+	static void set_body_state_sync_bulk_callback(BodyStateSyncBulkCallback p_callback) { body_state_sync_bulk_callback = p_callback; }
+	static BodyStateSyncBulkCallback get_body_state_sync_bulk_callback() { return body_state_sync_bulk_callback; }
+
+	virtual void body_set_state_sync_bulk(RID p_body, bool p_enable) = 0;
+
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) = 0;
 
 	// this function only works on physics process, errors and returns null otherwise
@@ -805,7 +833,10 @@ public:
 	enum ProcessInfo {
 		INFO_ACTIVE_OBJECTS,
 		INFO_COLLISION_PAIRS,
-		INFO_ISLAND_COUNT
+		INFO_ISLAND_COUNT,
+		INFO_SLEEPING_OBJECTS,
+		INFO_LARGEST_ISLAND,
+		INFO_NARROWPHASE_TESTS,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) = 0;
@@ -162,6 +162,7 @@ public:
 	virtual real_t space_get_param(RID p_space, SpaceParameter p_param) const override { return 0; }
 
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override { return space_state_dummy; }
+	virtual PhysicsDirectSpaceState3D *space_get_concurrent_direct_state(RID p_space) override { return space_state_dummy; }
 
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override {}
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override { return Vector<Vector3>(); }
@@ -296,6 +297,7 @@ public:
 
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) override {}
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) override {}
+	virtual void body_set_state_sync_bulk(RID p_body, bool p_enable) override {}
 
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override {}
 
@@ -117,6 +117,11 @@ public:
 		return physics_server_3d->space_get_direct_state(p_space);
 	}
 
+	// Safe to call from any thread, the returned state handles its own synchronization.
+	PhysicsDirectSpaceState3D *space_get_concurrent_direct_state(RID p_space) override {
+		return physics_server_3d->space_get_concurrent_direct_state(p_space);
+	}
+
 	FUNC2(space_set_debug_contacts, RID, int);
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override {
 		ERR_FAIL_COND_V(!Thread::is_main_thread(), Vector<Vector3>());
@@ -256,6 +261,7 @@ public:
 
 	FUNC2(body_set_state_sync_callback, RID, const Callable &);
 	FUNC3(body_set_force_integration_callback, RID, const Callable &, const Variant &);
+	FUNC2(body_set_state_sync_bulk, RID, bool);
 
 	FUNC2(body_set_ray_pickable, RID, bool);
 
@@ -33,6 +33,8 @@
 #include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
 #include "core/math/transform_interpolator.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 #include "renderer_viewport.h"
 #include "rendering_server_default.h"
 #include "rendering_server_globals.h"
@@ -46,6 +48,21 @@ const static float FEATHER_SIZE = 1.25f;
 
 static RendererCanvasCull *_canvas_cull_singleton = nullptr;
 
+// Set while culling a chunk of subtrees on a worker thread, so nested item lists are culled serially.
+static thread_local bool _culling_in_task = false;
+// Set when an item culled in a worker task needs the next frame drawn. Redraws are requested once after the merge,
+// as RenderingServerDefault::redraw_request() is not thread-safe.
+static thread_local bool _redraw_requested_in_task = false;
+
+// Y-sorted subtrees with at least this many items are sorted with a radix sort.
+static constexpr int YSORT_RADIX_THRESHOLD = 512;
+#ifdef REAL_T_IS_DOUBLE
+typedef uint64_t YSortRadixKey;
+#else
+typedef uint32_t YSortRadixKey;
+#endif
+static_assert(sizeof(YSortRadixKey) == sizeof(real_t));
+
 void RendererCanvasCull::_dependency_changed(Dependency::DependencyChangedNotification p_notification, DependencyTracker *p_tracker) {
 	Item *item = (Item *)p_tracker->userdata;
 
@@ -75,13 +92,25 @@ void RendererCanvasCull::_render_canvas_item_tree(RID p_to_render_target, Canvas
 	// transform is normally concatenated with the item global transform.
 	_current_camera_transform = p_transform;
 
+	uint64_t cull_begin = OS::get_singleton()->get_ticks_usec();
+
 	memset(z_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
 	memset(z_last_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
 
+	canvas_child_items.resize(p_child_item_count);
 	for (int i = 0; i < p_child_item_count; i++) {
-		_cull_canvas_item(p_child_items[i].item, p_transform, p_clip_rect, Color(1, 1, 1, 1), 0, z_list, z_last_list, nullptr, nullptr, false, p_canvas_cull_mask, Point2(), 1, nullptr);
+		canvas_child_items[i] = p_child_items[i].item;
 	}
 
+	CullChildren children;
+	children.items = canvas_child_items.ptr();
+	children.item_count = canvas_child_items.size();
+	children.xform = p_transform;
+	children.clip_rect = p_clip_rect;
+	children.modulate = Color(1, 1, 1, 1);
+	children.canvas_cull_mask = p_canvas_cull_mask;
+	_cull_canvas_item_children_threaded(children, z_list, z_last_list);
+
 	RendererCanvasRender::Item *list = nullptr;
 	RendererCanvasRender::Item *list_end = nullptr;
 
@@ -98,6 +127,9 @@ void RendererCanvasCull::_render_canvas_item_tree(RID p_to_render_target, Canvas
 		}
 	}
 
+	_update_instance_runs(list);
+	cull_stats.cull_usec = OS::get_singleton()->get_ticks_usec() - cull_begin;
+
 	RENDER_TIMESTAMP("Render CanvasItems");
 
 	bool sdf_flag;
@@ -107,6 +139,211 @@ void RendererCanvasCull::_render_canvas_item_tree(RID p_to_render_target, Canvas
 	}
 }
 
+static _FORCE_INLINE_ const RendererCanvasRender::Item::CommandRect *_get_instanceable_rect(const RendererCanvasRender::Item *p_item) {
+	const RendererCanvasRender::Item::Command *c = p_item->commands;
+	if (c == nullptr || c->next != nullptr || c->type != RendererCanvasRender::Item::Command::TYPE_RECT) {
+		return nullptr;
+	}
+	if (p_item->skeleton.is_valid() || p_item->canvas_group || p_item->canvas_group_owner || p_item->copy_back_buffer || p_item->vp_render) {
+		return nullptr;
+	}
+	if (p_item->repeat_source_item && p_item->repeat_size != Vector2()) {
+		return nullptr;
+	}
+#ifdef DEBUG_ENABLED
+	if (p_item->debug_redraw_time > 0.0) {
+		return nullptr;
+	}
+#endif
+
+	const RendererCanvasRender::Item::CommandRect *rect = static_cast<const RendererCanvasRender::Item::CommandRect *>(c);
+	if (rect->flags & (RendererCanvasRender::CANVAS_RECT_IS_GROUP | RendererCanvasRender::CANVAS_RECT_LCD)) {
+		// LCD rects batch by modulate, and group rects are rewritten by the renderer.
+		return nullptr;
+	}
+	return rect;
+}
+
+void RendererCanvasCull::_update_instance_runs(RendererCanvasRender::Item *p_list) {
+	// Find runs of consecutive items in draw order that draw a single rect with the same
+	// texture, material, clip and sampling state, e.g. many Sprite2Ds sharing a texture.
+	// Renderers record the items following the head of a run without re-checking batch state.
+	const uint32_t same_rect_flags = RendererCanvasRender::CANVAS_RECT_TILE | RendererCanvasRender::CANVAS_RECT_MSDF;
+
+	cull_stats.item_count = 0;
+	cull_stats.instance_run_count = 0;
+	cull_stats.instanced_item_count = 0;
+
+	RendererCanvasRender::Item *run_head = nullptr;
+	const RendererCanvasRender::Item::CommandRect *run_rect = nullptr;
+	RID run_material;
+
+	for (RendererCanvasRender::Item *ci = p_list; ci; ci = ci->next) {
+		cull_stats.item_count++;
+		ci->instance_run_length = 1;
+
+		const RendererCanvasRender::Item::CommandRect *rect = _get_instanceable_rect(ci);
+		if (!rect) {
+			run_head = nullptr;
+			continue;
+		}
+
+		RID material = ci->material_owner == nullptr ? ci->material : ci->material_owner->material;
+
+		if (run_head && rect->texture == run_rect->texture && (rect->flags & same_rect_flags) == (run_rect->flags & same_rect_flags) && material == run_material && ci->final_clip_owner == run_head->final_clip_owner && ci->texture_filter == run_head->texture_filter && ci->texture_repeat == run_head->texture_repeat) {
+			if (run_head->instance_run_length == 1) {
+				cull_stats.instance_run_count++;
+				cull_stats.instanced_item_count++;
+			}
+			run_head->instance_run_length++;
+			ci->instance_run_length = 0;
+			cull_stats.instanced_item_count++;
+		} else {
+			run_head = ci;
+			run_rect = rect;
+			run_material = material;
+		}
+	}
+}
+
+void RendererCanvasCull::_cull_canvas_item_children(const CullChildren &p_children, uint32_t p_from, uint32_t p_to, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		Item *child = p_children.items[i];
+		if (p_children.y_sorted) {
+			_cull_canvas_item(child, p_children.xform * child->ysort_xform, p_children.clip_rect, p_children.modulate * child->ysort_modulate, child->ysort_parent_abs_z_index, r_z_list, r_z_last_list, p_children.canvas_clip, (Item *)child->material_owner, true, p_children.canvas_cull_mask, child->repeat_size, child->repeat_times, child->repeat_source_item);
+		} else {
+			if (p_children.filter_behind && child->behind != p_children.behind) {
+				continue;
+			}
+			_cull_canvas_item(child, p_children.xform, p_children.clip_rect, p_children.modulate, p_children.z, r_z_list, r_z_last_list, p_children.canvas_clip, p_children.material_owner, false, p_children.canvas_cull_mask, p_children.repeat_size, p_children.repeat_times, p_children.repeat_source_item);
+		}
+	}
+}
+
+void RendererCanvasCull::_cull_canvas_item_children_task(uint32_t p_chunk, CullChildren *p_children) {
+	uint32_t from = p_chunk * p_children->chunk_size;
+	uint32_t to = MIN(from + p_children->chunk_size, p_children->item_count);
+
+	_culling_in_task = true;
+	_redraw_requested_in_task = false;
+	_cull_canvas_item_children(*p_children, from, to, cull_chunks[p_chunk].z_list, cull_chunks[p_chunk].z_last_list);
+	cull_chunks[p_chunk].redraw_requested = _redraw_requested_in_task;
+	_culling_in_task = false;
+}
+
+void RendererCanvasCull::_cull_canvas_item_children_threaded(CullChildren &p_children, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list) {
+	if (!cull_use_threads || _culling_in_task || p_children.item_count < CULL_THREADED_THRESHOLD) {
+		_cull_canvas_item_children(p_children, 0, p_children.item_count, r_z_list, r_z_last_list);
+		return;
+	}
+
+	// Sibling subtrees are independent, so contiguous chunks of them are culled into separate
+	// z layer lists. Appending those lists in chunk order gives the same draw order as culling serially.
+	uint32_t chunk_count = MIN((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count() * 2, p_children.item_count / CULL_MIN_ITEMS_PER_CHUNK);
+	chunk_count = MAX(chunk_count, 1u);
+	p_children.chunk_size = Math::division_round_up(p_children.item_count, chunk_count);
+	chunk_count = Math::division_round_up(p_children.item_count, p_children.chunk_size);
+
+	while (cull_chunks.size() < chunk_count) {
+		CullChunk chunk;
+		chunk.z_list = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
+		chunk.z_last_list = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
+		memset(chunk.z_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
+		memset(chunk.z_last_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
+		cull_chunks.push_back(chunk);
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererCanvasCull::_cull_canvas_item_children_task, &p_children, chunk_count, -1, true, SNAME("CanvasCullSubtrees"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Merge, leaving the chunk lists empty for the next use.
+	bool redraw_requested = false;
+	for (uint32_t i = 0; i < chunk_count; i++) {
+		CullChunk &chunk = cull_chunks[i];
+		redraw_requested = redraw_requested || chunk.redraw_requested;
+		chunk.redraw_requested = false;
+		for (int z = 0; z < z_range; z++) {
+			if (!chunk.z_list[z]) {
+				continue;
+			}
+			if (r_z_last_list[z]) {
+				r_z_last_list[z]->next = chunk.z_list[z];
+			} else {
+				r_z_list[z] = chunk.z_list[z];
+			}
+			r_z_last_list[z] = chunk.z_last_list[z];
+			chunk.z_list[z] = nullptr;
+			chunk.z_last_list[z] = nullptr;
+		}
+	}
+	if (redraw_requested) {
+		RenderingServerDefault::redraw_request();
+	}
+}
+
+static void _sort_ysort_items(RendererCanvasCull::Item **p_items, int p_count) {
+	SortArray<RendererCanvasCull::Item *, RendererCanvasCull::ItemYSort> sorter;
+	if (p_count < YSORT_RADIX_THRESHOLD) {
+		sorter.sort(p_items, p_count);
+		return;
+	}
+
+	// Stable LSD radix sort on the y coordinate, keyed on all the bits of real_t. Items arrive in
+	// ysort_index order, so equal coordinates keep that order, as ItemYSort requires.
+	LocalVector<YSortRadixKey> keys;
+	keys.resize(p_count * 2);
+	LocalVector<RendererCanvasCull::Item *> scratch;
+	scratch.resize(p_count);
+
+	YSortRadixKey *src_keys = keys.ptr();
+	YSortRadixKey *dst_keys = keys.ptr() + p_count;
+	RendererCanvasCull::Item **src = p_items;
+	RendererCanvasCull::Item **dst = scratch.ptr();
+
+	const YSortRadixKey sign_bit = YSortRadixKey(1) << (sizeof(YSortRadixKey) * 8 - 1);
+	for (int i = 0; i < p_count; i++) {
+		// Map the floating point bits so unsigned ordering matches floating point ordering.
+		real_t y = p_items[i]->ysort_xform.columns[2].y;
+		YSortRadixKey bits;
+		memcpy(&bits, &y, sizeof(YSortRadixKey));
+		src_keys[i] = (bits & sign_bit) ? ~bits : (bits | sign_bit);
+	}
+
+	for (uint32_t shift = 0; shift < sizeof(YSortRadixKey) * 8; shift += 8) {
+		uint32_t offsets[256] = {};
+		for (int i = 0; i < p_count; i++) {
+			offsets[(src_keys[i] >> shift) & 0xFF]++;
+		}
+		if (offsets[(src_keys[0] >> shift) & 0xFF] == (uint32_t)p_count) {
+			continue; // All keys share this digit.
+		}
+
+		uint32_t sum = 0;
+		for (uint32_t &offset : offsets) {
+			uint32_t count = offset;
+			offset = sum;
+			sum += count;
+		}
+
+		for (int i = 0; i < p_count; i++) {
+			uint32_t dst_index = offsets[(src_keys[i] >> shift) & 0xFF]++;
+			dst_keys[dst_index] = src_keys[i];
+			dst[dst_index] = src[i];
+		}
+
+		SWAP(src_keys, dst_keys);
+		SWAP(src, dst);
+	}
+
+	if (src != p_items) {
+		memcpy(p_items, src, p_count * sizeof(RendererCanvasCull::Item *));
+	}
+
+	// ItemYSort treats approximately equal coordinates as equal. The array is already sorted,
+	// so an insertion sort pass applies that rule in linear time.
+	sorter.insertion_sort(0, p_count, p_items);
+}
+
 void RendererCanvasCull::_collect_ysort_children(RendererCanvasCull::Item *p_canvas_item, RendererCanvasCull::Item *p_material_owner, const Color &p_modulate, RendererCanvasCull::Item **r_items, int &r_index, int p_z) {
 	int child_item_count = p_canvas_item->child_items.size();
 	RendererCanvasCull::Item **child_items = p_canvas_item->child_items.ptrw();
@@ -250,7 +487,11 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 		// Something to draw?
 
 		if (ci->update_when_visible) {
-			RenderingServerDefault::redraw_request();
+			if (_culling_in_task) {
+				_redraw_requested_in_task = true;
+			} else {
+				RenderingServerDefault::redraw_request();
+			}
 		}
 
 		if (ci->commands != nullptr || ci->copy_back_buffer) {
@@ -278,6 +519,7 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 
 		if (ci->visibility_notifier) {
 			if (!ci->visibility_notifier->visible_element.in_list()) {
+				MutexLock lock(visibility_notifier_mutex);
 				visibility_notifier_list.add(&ci->visibility_notifier->visible_element);
 				ci->visibility_notifier->just_visible = true;
 			}
@@ -441,12 +683,18 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			int i = 1;
 			_collect_ysort_children(ci, p_material_owner, Color(1, 1, 1, 1), child_items, i, p_z);
 
-			SortArray<Item *, ItemYSort> sorter;
-			sorter.sort(child_items, child_item_count);
-
-			for (i = 0; i < child_item_count; i++) {
-				_cull_canvas_item(child_items[i], final_xform * child_items[i]->ysort_xform, p_clip_rect, modulate * child_items[i]->ysort_modulate, child_items[i]->ysort_parent_abs_z_index, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, (Item *)child_items[i]->material_owner, true, p_canvas_cull_mask, child_items[i]->repeat_size, child_items[i]->repeat_times, child_items[i]->repeat_source_item);
-			}
+			_sort_ysort_items(child_items, child_item_count);
+
+			CullChildren children;
+			children.items = child_items;
+			children.item_count = child_item_count;
+			children.xform = final_xform;
+			children.clip_rect = p_clip_rect;
+			children.modulate = modulate;
+			children.canvas_clip = (Item *)ci->final_clip_owner;
+			children.y_sorted = true;
+			children.canvas_cull_mask = p_canvas_cull_mask;
+			_cull_canvas_item_children_threaded(children, r_z_list, r_z_last_list);
 		} else {
 			RendererCanvasRender::Item *canvas_group_from = nullptr;
 			bool use_canvas_group = ci->canvas_group != nullptr && (ci->canvas_group->fit_empty || ci->commands != nullptr);
@@ -465,18 +713,30 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			canvas_group_from = r_z_last_list[zidx];
 		}
 
-		for (int i = 0; i < child_item_count; i++) {
-			if (!child_items[i]->behind && !use_canvas_group) {
-				continue;
-			}
-			_cull_canvas_item(child_items[i], final_xform, p_clip_rect, modulate, p_z, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, p_material_owner, false, p_canvas_cull_mask, repeat_size, repeat_times, repeat_source_item);
-		}
+		CullChildren children;
+		children.items = child_items;
+		children.item_count = child_item_count;
+		children.xform = final_xform;
+		children.clip_rect = p_clip_rect;
+		children.modulate = modulate;
+		children.z = p_z;
+		children.canvas_clip = (Item *)ci->final_clip_owner;
+		children.material_owner = p_material_owner;
+		children.canvas_cull_mask = p_canvas_cull_mask;
+		children.repeat_size = repeat_size;
+		children.repeat_times = repeat_times;
+		children.repeat_source_item = repeat_source_item;
+
+		// A canvas group draws all of its children before itself.
+		children.filter_behind = !use_canvas_group;
+		children.behind = true;
+		_cull_canvas_item_children_threaded(children, r_z_list, r_z_last_list);
+
 		_attach_canvas_item_for_draw(ci, p_canvas_clip, r_z_list, r_z_last_list, final_xform, p_clip_rect, global_rect, modulate, p_z, p_material_owner, use_canvas_group, canvas_group_from);
-		for (int i = 0; i < child_item_count; i++) {
-			if (child_items[i]->behind || use_canvas_group) {
-				continue;
-			}
-			_cull_canvas_item(child_items[i], final_xform, p_clip_rect, modulate, p_z, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, p_material_owner, false, p_canvas_cull_mask, repeat_size, repeat_times, repeat_source_item);
+
+		if (!use_canvas_group) {
+			children.behind = false;
+			_cull_canvas_item_children_threaded(children, r_z_list, r_z_last_list);
 		}
 	}
 }
@@ -2782,5 +3042,9 @@ RendererCanvasCull::RendererCanvasCull() {
 RendererCanvasCull::~RendererCanvasCull() {
 	memfree(z_list);
 	memfree(z_last_list);
+	for (CullChunk &chunk : cull_chunks) {
+		memfree(chunk.z_list);
+		memfree(chunk.z_last_list);
+	}
 	_canvas_cull_singleton = nullptr;
 }
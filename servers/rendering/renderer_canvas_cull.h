@@ -201,6 +201,7 @@ public:
 
 	PagedAllocator<Item::VisibilityNotifierData> visibility_notifier_allocator;
 	SelfList<Item::VisibilityNotifierData>::List visibility_notifier_list;
+	BinaryMutex visibility_notifier_mutex;
 
 	_FORCE_INLINE_ void _attach_canvas_item_for_draw(Item *ci, Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from);
 
@@ -208,6 +209,46 @@ private:
 	void _render_canvas_item_tree(RID p_to_render_target, Canvas::ChildItem *p_child_items, int p_child_item_count, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, uint32_t p_canvas_cull_mask, RenderingMethod::RenderInfo *r_render_info = nullptr);
 	void _cull_canvas_item(Item *p_canvas_item, const Transform2D &p_parent_xform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, Item *p_canvas_clip, Item *p_material_owner, bool p_is_already_y_sorted, uint32_t p_canvas_cull_mask, const Point2 &p_repeat_size, int p_repeat_times, RendererCanvasRender::Item *p_repeat_source_item);
 
+	void _update_instance_runs(RendererCanvasRender::Item *p_list);
+
+	// Children of an item with at least this many children are culled in parallel chunks.
+	static constexpr uint32_t CULL_THREADED_THRESHOLD = 256;
+	static constexpr uint32_t CULL_MIN_ITEMS_PER_CHUNK = 64;
+
+	struct CullChildren {
+		Item **items = nullptr;
+		uint32_t item_count = 0;
+		uint32_t chunk_size = 0;
+		Transform2D xform;
+		Rect2 clip_rect;
+		Color modulate;
+		int z = 0;
+		Item *canvas_clip = nullptr;
+		Item *material_owner = nullptr;
+		bool y_sorted = false; // Per-item transform, modulate and z come from the y-sort pass.
+		bool filter_behind = false; // Only cull children whose `behind` flag matches `behind`.
+		bool behind = false;
+		uint32_t canvas_cull_mask = 0;
+		Point2 repeat_size;
+		int repeat_times = 1;
+		RendererCanvasRender::Item *repeat_source_item = nullptr;
+	};
+
+	// Z layer lists of a chunk of subtrees culled on a worker thread, merged in chunk order afterwards.
+	struct CullChunk {
+		RendererCanvasRender::Item **z_list = nullptr;
+		RendererCanvasRender::Item **z_last_list = nullptr;
+		bool redraw_requested = false; // An item of the chunk is updated when visible.
+	};
+
+	LocalVector<CullChunk> cull_chunks;
+	LocalVector<Item *> canvas_child_items;
+	bool cull_use_threads = true;
+
+	void _cull_canvas_item_children(const CullChildren &p_children, uint32_t p_from, uint32_t p_to, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list);
+	void _cull_canvas_item_children_task(uint32_t p_chunk, CullChildren *p_children);
+	void _cull_canvas_item_children_threaded(CullChildren &p_children, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list);
+
 	void _collect_ysort_children(RendererCanvasCull::Item *p_canvas_item, RendererCanvasCull::Item *p_material_owner, const Color &p_modulate, RendererCanvasCull::Item **r_items, int &r_index, int p_z);
 	int _count_ysort_children(RendererCanvasCull::Item *p_canvas_item);
 	void _mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner);
@@ -220,6 +261,23 @@ private:
 	Transform2D _current_camera_transform;
 
 public:
+	struct CullStats {
+		uint32_t item_count = 0;
+		uint32_t instance_run_count = 0; // Runs of two or more items.
+		uint32_t instanced_item_count = 0;
+		uint64_t cull_usec = 0;
+	};
+
+private:
+	CullStats cull_stats;
+
+public:
+	// Statistics of the last canvas rendered, used to benchmark batching.
+	const CullStats &get_cull_stats() const { return cull_stats; }
+
+	void set_cull_use_threads(bool p_enable) { cull_use_threads = p_enable; }
+	bool is_cull_using_threads() const { return cull_use_threads; }
+
 	void render_canvas(RID p_render_target, Canvas *p_canvas, const Transform2D &p_transform, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, const Rect2 &p_clip_rect, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_transforms_to_pixel, bool p_snap_2d_vertices_to_pixel, uint32_t p_canvas_cull_mask, RenderingMethod::RenderInfo *r_render_info = nullptr);
 
 	bool was_sdf_used();
@@ -367,6 +367,11 @@ public:
 		int repeat_times = 1;
 		Item *repeat_source_item = nullptr;
 
+		// Number of consecutive items, starting with this one, that draw a single rect with the same texture,
+		// material and clip. Set by the canvas cull so renderers can record the run as one instanced draw.
+		// Zero for items that continue a run.
+		uint32_t instance_run_length = 1;
+
 		Rect2 global_rect_cache;
 
 		const Rect2 &get_rect() const;
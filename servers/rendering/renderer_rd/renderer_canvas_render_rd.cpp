@@ -2179,6 +2179,14 @@ void RendererCanvasRenderRD::_render_batch_items(RenderTarget p_to_render_target
 			if (ci->repeat_source_item == nullptr || ci->repeat_size == Vector2()) {
 				Transform2D base_transform = p_canvas_transform_inverse * ci->final_transform;
 				_record_item_commands(ci, p_to_render_target, base_transform, current_clip, p_lights, instance_index, batch_broken, r_sdf_used, current_batch);
+
+				// Append the rest of the instance run to the batch the head was recorded into.
+				uint32_t run_length = ci->instance_run_length;
+				while (run_length > 1 && i + 1 < p_item_count && items[i + 1] == ci->next) {
+					ci = items[++i];
+					run_length--;
+					_record_instanced_rect(ci, p_to_render_target, p_canvas_transform_inverse * ci->final_transform, p_lights, instance_index, batch_broken, current_batch);
+				}
 			} else {
 				Point2 start_pos = ci->repeat_size * -(ci->repeat_times / 2);
 				Point2 offset;
@@ -2324,6 +2332,141 @@ RendererCanvasRenderRD::InstanceData *RendererCanvasRenderRD::new_instance_data(
 	return instance_data;
 }
 
+uint16_t RendererCanvasRenderRD::_get_item_lights(const Item *p_item, Light *p_lights, uint32_t *r_lights, uint32_t &r_base_flags) const {
+	uint16_t light_count = 0;
+	uint16_t shadow_mask = 0;
+
+	Light *light = p_lights;
+
+	while (light) {
+		if (light->render_index_cache >= 0 && p_item->light_mask & light->item_mask && p_item->z_final >= light->z_min && p_item->z_final <= light->z_max && p_item->global_rect_cache.intersects(light->rect_cache)) {
+			uint32_t light_index = light->render_index_cache;
+			r_lights[light_count >> 2] |= light_index << ((light_count & 3) * 8);
+
+			if (p_item->light_mask & light->item_shadow_mask) {
+				shadow_mask |= 1 << light_count;
+			}
+
+			light_count++;
+
+			if (light_count == MAX_LIGHTS_PER_ITEM - 1) {
+				break;
+			}
+		}
+		light = light->next_ptr;
+	}
+
+	r_base_flags |= light_count << INSTANCE_FLAGS_LIGHT_COUNT_SHIFT;
+	r_base_flags |= shadow_mask << INSTANCE_FLAGS_SHADOW_MASKED_SHIFT;
+
+	return light_count;
+}
+
+void RendererCanvasRenderRD::_fill_rect_instance_data(const Item::CommandRect *p_rect, const TextureInfo *p_info, const Color &p_modulate, InstanceData *r_instance_data) const {
+	Rect2 src_rect;
+	Rect2 dst_rect;
+
+	if (p_rect->texture.is_valid()) {
+		src_rect = (p_rect->flags & CANVAS_RECT_REGION) ? Rect2(p_rect->source.position * p_info->texpixel_size, p_rect->source.size * p_info->texpixel_size) : Rect2(0, 0, 1, 1);
+		dst_rect = Rect2(p_rect->rect.position, p_rect->rect.size);
+
+		if (dst_rect.size.width < 0) {
+			dst_rect.position.x += dst_rect.size.width;
+			dst_rect.size.width *= -1;
+		}
+		if (dst_rect.size.height < 0) {
+			dst_rect.position.y += dst_rect.size.height;
+			dst_rect.size.height *= -1;
+		}
+
+		if (p_rect->flags & CANVAS_RECT_FLIP_H) {
+			src_rect.size.x *= -1;
+		}
+
+		if (p_rect->flags & CANVAS_RECT_FLIP_V) {
+			src_rect.size.y *= -1;
+		}
+
+		if (p_rect->flags & CANVAS_RECT_TRANSPOSE) {
+			r_instance_data->flags |= INSTANCE_FLAGS_TRANSPOSE_RECT;
+		}
+
+		if (p_rect->flags & CANVAS_RECT_CLIP_UV) {
+			r_instance_data->flags |= INSTANCE_FLAGS_CLIP_RECT_UV;
+		}
+
+	} else {
+		dst_rect = Rect2(p_rect->rect.position, p_rect->rect.size);
+
+		if (dst_rect.size.width < 0) {
+			dst_rect.position.x += dst_rect.size.width;
+			dst_rect.size.width *= -1;
+		}
+		if (dst_rect.size.height < 0) {
+			dst_rect.position.y += dst_rect.size.height;
+			dst_rect.size.height *= -1;
+		}
+
+		src_rect = Rect2(0, 0, 1, 1);
+	}
+
+	if (p_rect->flags & CANVAS_RECT_MSDF) {
+		r_instance_data->flags |= INSTANCE_FLAGS_USE_MSDF;
+		r_instance_data->msdf[0] = p_rect->px_range; // Pixel range.
+		r_instance_data->msdf[1] = p_rect->outline; // Outline size.
+		r_instance_data->msdf[2] = 0.f; // Reserved.
+		r_instance_data->msdf[3] = 0.f; // Reserved.
+	} else if (p_rect->flags & CANVAS_RECT_LCD) {
+		r_instance_data->flags |= INSTANCE_FLAGS_USE_LCD;
+	}
+
+	r_instance_data->modulation[0] = p_modulate.r;
+	r_instance_data->modulation[1] = p_modulate.g;
+	r_instance_data->modulation[2] = p_modulate.b;
+	r_instance_data->modulation[3] = p_modulate.a;
+
+	r_instance_data->src_rect[0] = src_rect.position.x;
+	r_instance_data->src_rect[1] = src_rect.position.y;
+	r_instance_data->src_rect[2] = src_rect.size.width;
+	r_instance_data->src_rect[3] = src_rect.size.height;
+
+	r_instance_data->dst_rect[0] = dst_rect.position.x;
+	r_instance_data->dst_rect[1] = dst_rect.position.y;
+	r_instance_data->dst_rect[2] = dst_rect.size.width;
+	r_instance_data->dst_rect[3] = dst_rect.size.height;
+}
+
+void RendererCanvasRenderRD::_record_instanced_rect(const Item *p_item, RenderTarget p_render_target, const Transform2D &p_base_transform, Light *p_lights, uint32_t &r_index, bool &r_batch_broken, Batch *&r_current_batch) {
+	// The item continues an instance run detected by the canvas cull, so it shares texture, material,
+	// clip and rect flags with the previous item and only its per-instance data needs to be written.
+	const Item::CommandRect *rect = static_cast<const Item::CommandRect *>(p_item->commands);
+
+	float world[6];
+	_update_transform_2d_to_mat2x3(p_base_transform, world);
+
+	uint32_t base_flags = 0;
+	uint32_t lights[4] = { 0, 0, 0, 0 };
+	uint16_t light_count = _get_item_lights(p_item, p_lights, lights, base_flags);
+
+	bool use_lighting = (light_count > 0 || using_directional_lights);
+	if (use_lighting != r_current_batch->use_lighting) {
+		r_current_batch = _new_batch(r_batch_broken);
+		r_current_batch->use_lighting = use_lighting;
+	}
+
+	Color modulated = rect->modulate * p_item->final_modulate;
+	if (p_render_target.use_linear_colors) {
+		modulated = modulated.srgb_to_linear();
+	}
+
+	TextureInfo *tex_info = r_current_batch->tex_info;
+	InstanceData *instance_data = new_instance_data(world, lights, base_flags, r_index, static_cast<uint32_t>(p_item->instance_allocated_shader_uniforms_offset), tex_info);
+	_fill_rect_instance_data(rect, tex_info, modulated, instance_data);
+
+	_add_to_batch(r_index, r_batch_broken, r_current_batch);
+	r_batch_broken = false;
+}
+
 void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTarget p_render_target, const Transform2D &p_base_transform, Item *&r_current_clip, Light *p_lights, uint32_t &r_index, bool &r_batch_broken, bool &r_sdf_used, Batch *&r_current_batch) {
 	const RenderingServer::CanvasItemTextureFilter texture_filter = p_item->texture_filter == RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT ? default_filter : p_item->texture_filter;
 	const RenderingServer::CanvasItemTextureRepeat texture_repeat = p_item->texture_repeat == RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT ? default_repeat : p_item->texture_repeat;
@@ -2345,34 +2488,7 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 
 	// TODO: consider making lights a per-batch property and then baking light operations in the shader for better performance.
 	uint32_t lights[4] = { 0, 0, 0, 0 };
-
-	uint16_t light_count = 0;
-	uint16_t shadow_mask = 0;
-
-	{
-		Light *light = p_lights;
-
-		while (light) {
-			if (light->render_index_cache >= 0 && p_item->light_mask & light->item_mask && p_item->z_final >= light->z_min && p_item->z_final <= light->z_max && p_item->global_rect_cache.intersects(light->rect_cache)) {
-				uint32_t light_index = light->render_index_cache;
-				lights[light_count >> 2] |= light_index << ((light_count & 3) * 8);
-
-				if (p_item->light_mask & light->item_shadow_mask) {
-					shadow_mask |= 1 << light_count;
-				}
-
-				light_count++;
-
-				if (light_count == MAX_LIGHTS_PER_ITEM - 1) {
-					break;
-				}
-			}
-			light = light->next_ptr;
-		}
-
-		base_flags |= light_count << INSTANCE_FLAGS_LIGHT_COUNT_SHIFT;
-		base_flags |= shadow_mask << INSTANCE_FLAGS_SHADOW_MASKED_SHIFT;
-	}
+	uint16_t light_count = _get_item_lights(p_item, p_lights, lights, base_flags);
 
 	bool use_lighting = (light_count > 0 || using_directional_lights);
 
@@ -2438,77 +2554,7 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 				}
 
 				InstanceData *instance_data = new_instance_data(world, lights, base_flags, r_index, uniforms_ofs, tex_info);
-				Rect2 src_rect;
-				Rect2 dst_rect;
-
-				if (rect->texture.is_valid()) {
-					src_rect = (rect->flags & CANVAS_RECT_REGION) ? Rect2(rect->source.position * tex_info->texpixel_size, rect->source.size * tex_info->texpixel_size) : Rect2(0, 0, 1, 1);
-					dst_rect = Rect2(rect->rect.position, rect->rect.size);
-
-					if (dst_rect.size.width < 0) {
-						dst_rect.position.x += dst_rect.size.width;
-						dst_rect.size.width *= -1;
-					}
-					if (dst_rect.size.height < 0) {
-						dst_rect.position.y += dst_rect.size.height;
-						dst_rect.size.height *= -1;
-					}
-
-					if (rect->flags & CANVAS_RECT_FLIP_H) {
-						src_rect.size.x *= -1;
-					}
-
-					if (rect->flags & CANVAS_RECT_FLIP_V) {
-						src_rect.size.y *= -1;
-					}
-
-					if (rect->flags & CANVAS_RECT_TRANSPOSE) {
-						instance_data->flags |= INSTANCE_FLAGS_TRANSPOSE_RECT;
-					}
-
-					if (rect->flags & CANVAS_RECT_CLIP_UV) {
-						instance_data->flags |= INSTANCE_FLAGS_CLIP_RECT_UV;
-					}
-
-				} else {
-					dst_rect = Rect2(rect->rect.position, rect->rect.size);
-
-					if (dst_rect.size.width < 0) {
-						dst_rect.position.x += dst_rect.size.width;
-						dst_rect.size.width *= -1;
-					}
-					if (dst_rect.size.height < 0) {
-						dst_rect.position.y += dst_rect.size.height;
-						dst_rect.size.height *= -1;
-					}
-
-					src_rect = Rect2(0, 0, 1, 1);
-				}
-
-				if (has_msdf) {
-					instance_data->flags |= INSTANCE_FLAGS_USE_MSDF;
-					instance_data->msdf[0] = rect->px_range; // Pixel range.
-					instance_data->msdf[1] = rect->outline; // Outline size.
-					instance_data->msdf[2] = 0.f; // Reserved.
-					instance_data->msdf[3] = 0.f; // Reserved.
-				} else if (rect->flags & CANVAS_RECT_LCD) {
-					instance_data->flags |= INSTANCE_FLAGS_USE_LCD;
-				}
-
-				instance_data->modulation[0] = modulated.r;
-				instance_data->modulation[1] = modulated.g;
-				instance_data->modulation[2] = modulated.b;
-				instance_data->modulation[3] = modulated.a;
-
-				instance_data->src_rect[0] = src_rect.position.x;
-				instance_data->src_rect[1] = src_rect.position.y;
-				instance_data->src_rect[2] = src_rect.size.width;
-				instance_data->src_rect[3] = src_rect.size.height;
-
-				instance_data->dst_rect[0] = dst_rect.position.x;
-				instance_data->dst_rect[1] = dst_rect.position.y;
-				instance_data->dst_rect[2] = dst_rect.size.width;
-				instance_data->dst_rect[3] = dst_rect.size.height;
+				_fill_rect_instance_data(rect, tex_info, modulated, instance_data);
 
 				_add_to_batch(r_index, r_batch_broken, r_current_batch);
 			} break;
@@ -462,9 +462,11 @@ public:
 	GDVIRTUAL2R(double, _shaped_text_tab_align, RID, const PackedFloat32Array &);
 
 	virtual bool shaped_text_shape(const RID &p_shaped) override;
+	virtual bool shaped_text_shape_batch(const TypedArray<RID> &p_shaped) override;
 	virtual bool shaped_text_update_breaks(const RID &p_shaped) override;
 	virtual bool shaped_text_update_justification_ops(const RID &p_shaped) override;
 	GDVIRTUAL1R_REQUIRED(bool, _shaped_text_shape, RID);
+	GDVIRTUAL1R(bool, _shaped_text_shape_batch, const TypedArray<RID> &);
 	GDVIRTUAL1R(bool, _shaped_text_update_breaks, RID);
 	GDVIRTUAL1R(bool, _shaped_text_update_justification_ops, RID);
 
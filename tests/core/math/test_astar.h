@@ -32,6 +32,7 @@
 #define TEST_ASTAR_H
 
 #include "core/math/a_star.h"
+#include "core/math/a_star_grid_2d.h"
 
 #include "tests/test_macros.h"
 
@@ -357,6 +358,204 @@ TEST_CASE("[Stress][AStar3D] Find paths") {
 		CHECK_MESSAGE(match, "Found all paths.");
 	}
 }
+
+static real_t get_id_path_length(AStar3D &p_astar, const Vector<int64_t> &p_path) {
+	real_t length = 0;
+	for (int i = 1; i < p_path.size(); i++) {
+		length += p_astar.get_point_position(p_path[i - 1]).distance_to(p_astar.get_point_position(p_path[i])) * p_astar.get_point_weight_scale(p_path[i]);
+	}
+	return length;
+}
+
+TEST_CASE("[AStar3D] Bidirectional paths should be as short as regular paths") {
+	const int N = 40;
+	Math::seed(1);
+
+	bool match = true;
+	for (int test = 0; test < 50 && match; test++) {
+		AStar3D a;
+		for (int u = 0; u < N; u++) {
+			a.add_point(u, Vector3(Math::rand() % 100, Math::rand() % 100, Math::rand() % 100), 1 + Math::rand() % 3);
+		}
+		for (int i = 0; i < N * 3; i++) {
+			int u = Math::rand() % N;
+			int v = Math::rand() % N;
+			if (u != v) {
+				a.connect_points(u, v, Math::rand() % 2);
+			}
+		}
+		a.set_point_disabled(Math::rand() % N);
+
+		for (int u = 0; u < N && match; u++) {
+			for (int v = 0; v < N; v++) {
+				a.set_bidirectional_search_enabled(false);
+				Vector<int64_t> regular_path = a.get_id_path(u, v);
+				a.set_bidirectional_search_enabled(true);
+				Vector<int64_t> bidirectional_path = a.get_id_path(u, v);
+
+				if (regular_path.is_empty() != bidirectional_path.is_empty() || !Math::is_equal_approx(get_id_path_length(a, regular_path), get_id_path_length(a, bidirectional_path))) {
+					match = false;
+					break;
+				}
+				for (int i = 1; i < bidirectional_path.size(); i++) {
+					if (!a.are_points_connected(bidirectional_path[i - 1], bidirectional_path[i], false)) {
+						match = false;
+						break;
+					}
+				}
+			}
+		}
+	}
+	CHECK_MESSAGE(match, "Bidirectional searches should find the lowest-cost paths.");
+}
+
+TEST_CASE("[AStar3D] Max search cost") {
+	AStar3D a;
+	for (int i = 0; i < 5; i++) {
+		a.add_point(i, Vector3(i, 0, 0));
+		if (i > 0) {
+			a.connect_points(i - 1, i);
+		}
+	}
+	CHECK(Math::is_inf(a.get_max_search_cost()));
+
+	a.set_max_search_cost(4);
+	CHECK(a.get_id_path(0, 4).size() == 5);
+
+	a.set_max_search_cost(2.5);
+	CHECK(a.get_id_path(0, 4).is_empty());
+	CHECK(a.get_id_path(0, 4, true) == Vector<int64_t>{ 0, 1, 2 });
+
+	a.set_bidirectional_search_enabled(true);
+	CHECK(a.get_id_path(0, 4).is_empty());
+	CHECK(a.get_id_path(0, 4, true) == Vector<int64_t>{ 0, 1, 2 });
+	CHECK(a.get_id_path(0, 2) == Vector<int64_t>{ 0, 1, 2 });
+}
+
+TEST_CASE("[AStar3D] Batch solves should match single solves") {
+	const int N = 30;
+	Math::seed(2);
+
+	AStar3D a;
+	for (int u = 0; u < N; u++) {
+		a.add_point(u, Vector3(Math::rand() % 100, Math::rand() % 100, 0));
+	}
+	for (int i = 0; i < N * 2; i++) {
+		int u = Math::rand() % N;
+		int v = Math::rand() % N;
+		if (u != v) {
+			a.connect_points(u, v, Math::rand() % 2);
+		}
+	}
+
+	PackedInt64Array from_ids;
+	PackedInt64Array to_ids;
+	for (int i = 0; i < 100; i++) {
+		from_ids.push_back(Math::rand() % N);
+		to_ids.push_back(Math::rand() % N);
+	}
+
+	TypedArray<PackedInt64Array> paths = a.get_id_paths(from_ids, to_ids, true);
+	REQUIRE(paths.size() == from_ids.size());
+	for (int i = 0; i < from_ids.size(); i++) {
+		CHECK(PackedInt64Array(paths[i]) == PackedInt64Array(a.get_id_path(from_ids[i], to_ids[i], true)));
+	}
+
+	ERR_PRINT_OFF;
+	CHECK(a.get_id_paths(from_ids, PackedInt64Array()).is_empty());
+	ERR_PRINT_ON;
+}
+
+static real_t get_path_length(const Vector<Vector2> &p_path) {
+	real_t length = 0.0;
+	for (int i = 1; i < p_path.size(); i++) {
+		length += p_path[i - 1].distance_to(p_path[i]);
+	}
+	return length;
+}
+
+TEST_CASE("[AStarGrid2D] Jumping paths should be as short as regular paths") {
+	const int size = 48;
+	Math::seed(0);
+
+	Ref<AStarGrid2D> regular;
+	regular.instantiate();
+	regular->set_region(Rect2i(0, 0, size, size));
+	regular->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES);
+	regular->update();
+
+	Ref<AStarGrid2D> jumping;
+	jumping.instantiate();
+	jumping->set_region(Rect2i(0, 0, size, size));
+	jumping->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES);
+	jumping->set_jumping_enabled(true);
+	jumping->update();
+
+	for (int y = 0; y < size; y++) {
+		for (int x = 0; x < size; x++) {
+			const bool solid = Math::rand() % 100 < 25;
+			regular->set_point_solid(Vector2i(x, y), solid);
+			jumping->set_point_solid(Vector2i(x, y), solid);
+		}
+	}
+
+	for (int round = 0; round < 10; round++) {
+		// Solid changes after the first search only update the jump distances around them.
+		if (round > 0) {
+			for (int i = 0; i < 20; i++) {
+				const Vector2i id = Vector2i(Math::rand() % size, Math::rand() % size);
+				const bool solid = Math::rand() % 2;
+				regular->set_point_solid(id, solid);
+				jumping->set_point_solid(id, solid);
+			}
+		}
+
+		int mismatches = 0;
+		for (int i = 0; i < 50; i++) {
+			const Vector2i from = Vector2i(Math::rand() % size, Math::rand() % size);
+			const Vector2i to = Vector2i(Math::rand() % size, Math::rand() % size);
+			if (regular->is_point_solid(from) || regular->is_point_solid(to)) {
+				continue;
+			}
+			const Vector<Vector2> regular_path = regular->get_point_path(from, to);
+			const Vector<Vector2> jumping_path = jumping->get_point_path(from, to);
+			if (regular_path.is_empty() != jumping_path.is_empty() || !Math::is_equal_approx(get_path_length(regular_path), get_path_length(jumping_path))) {
+				mismatches++;
+			}
+		}
+		CHECK_MESSAGE(mismatches == 0, vformat("Round %d has paths of a different length.", round));
+	}
+}
+
+TEST_CASE("[AStarGrid2D] Batch solves should match single solves") {
+	const int size = 32;
+	Math::seed(1);
+
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_region(Rect2i(0, 0, size, size));
+	grid->update();
+	for (int i = 0; i < size * size / 4; i++) {
+		grid->set_point_solid(Vector2i(Math::rand() % size, Math::rand() % size));
+	}
+
+	TypedArray<Vector2i> from_ids;
+	TypedArray<Vector2i> to_ids;
+	for (int i = 0; i < 64; i++) {
+		from_ids.push_back(Vector2i(Math::rand() % size, Math::rand() % size));
+		to_ids.push_back(Vector2i(Math::rand() % size, Math::rand() % size));
+	}
+
+	const TypedArray<PackedVector2Array> paths = grid->get_point_paths(from_ids, to_ids, true);
+	REQUIRE(paths.size() == from_ids.size());
+	for (int i = 0; i < paths.size(); i++) {
+		CHECK(PackedVector2Array(paths[i]) == grid->get_point_path(from_ids[i], to_ids[i], true));
+	}
+
+	ERR_PRINT_OFF;
+	CHECK(grid->get_point_paths(from_ids, TypedArray<Vector2i>()).is_empty());
+	ERR_PRINT_ON;
+}
 } // namespace TestAStar
 
 #endif // TEST_ASTAR_H
@@ -31,6 +31,7 @@
 #ifndef TEST_CONTROL_H
 #define TEST_CONTROL_H
 
+#include "scene/gui/box_container.h"
 #include "scene/gui/control.h"
 
 #include "tests/test_macros.h"
@@ -112,6 +113,102 @@ TEST_CASE("[SceneTree][Control] Focus") {
 	memdelete(ctrl);
 }
 
+struct NestedBoxes {
+	VBoxContainer *root = nullptr;
+	Control *leaf = nullptr;
+};
+
+static NestedBoxes create_nested_boxes(int p_depth) {
+	NestedBoxes boxes;
+	Control *parent = nullptr;
+	for (int i = 0; i < p_depth; i++) {
+		VBoxContainer *box = memnew(VBoxContainer);
+		Control *sibling = memnew(Control);
+		sibling->set_custom_minimum_size(Size2(20, 10));
+		box->add_child(sibling);
+		if (parent) {
+			parent->add_child(box);
+		} else {
+			boxes.root = box;
+		}
+		parent = box;
+	}
+	boxes.leaf = memnew(Control);
+	boxes.leaf->set_custom_minimum_size(Size2(10, 10));
+	parent->add_child(boxes.leaf);
+	return boxes;
+}
+
+TEST_CASE("[SceneTree][Control] Incremental layout") {
+	const int depth = 8;
+	Window *root = SceneTree::get_singleton()->get_root();
+
+	int sorts[2] = {};
+	int minimum_size_updates[2] = {};
+	Rect2 leaf_rects[2];
+	Size2 root_sizes[2];
+
+	for (int incremental = 0; incremental < 2; incremental++) {
+		root->set_gui_incremental_layout(incremental);
+		NestedBoxes boxes = create_nested_boxes(depth);
+		root->add_child(boxes.root);
+		MessageQueue::get_singleton()->flush();
+
+		int sorts_before = root->get_gui_layout_info(Viewport::LAYOUT_INFO_SORTS);
+		int minimum_size_updates_before = root->get_gui_layout_info(Viewport::LAYOUT_INFO_MINIMUM_SIZE_UPDATES);
+		boxes.leaf->set_custom_minimum_size(Size2(10, 50));
+		MessageQueue::get_singleton()->flush();
+		sorts[incremental] = root->get_gui_layout_info(Viewport::LAYOUT_INFO_SORTS) - sorts_before;
+		minimum_size_updates[incremental] = root->get_gui_layout_info(Viewport::LAYOUT_INFO_MINIMUM_SIZE_UPDATES) - minimum_size_updates_before;
+		leaf_rects[incremental] = boxes.leaf->get_global_rect();
+		root_sizes[incremental] = boxes.root->get_size();
+
+		CHECK(boxes.root->get_size() == boxes.root->get_combined_minimum_size());
+
+		if (incremental) {
+			// The sibling is wider, so the parent's combined minimum size doesn't change
+			// and neither does anything above it.
+			sorts_before = root->get_gui_layout_info(Viewport::LAYOUT_INFO_SORTS);
+			minimum_size_updates_before = root->get_gui_layout_info(Viewport::LAYOUT_INFO_MINIMUM_SIZE_UPDATES);
+			boxes.leaf->set_custom_minimum_size(Size2(5, 50));
+			MessageQueue::get_singleton()->flush();
+			CHECK(root->get_gui_layout_info(Viewport::LAYOUT_INFO_SORTS) - sorts_before == 1);
+			CHECK(root->get_gui_layout_info(Viewport::LAYOUT_INFO_MINIMUM_SIZE_UPDATES) - minimum_size_updates_before == 2);
+
+			// Controls queued at different depths still update every ancestor once.
+			Control *shallow_sibling = Object::cast_to<Control>(boxes.root->get_child(1)->get_child(0));
+			REQUIRE(shallow_sibling);
+			minimum_size_updates_before = root->get_gui_layout_info(Viewport::LAYOUT_INFO_MINIMUM_SIZE_UPDATES);
+			shallow_sibling->set_custom_minimum_size(Size2(20, 30));
+			boxes.leaf->set_custom_minimum_size(Size2(5, 60));
+			MessageQueue::get_singleton()->flush();
+			CHECK(root->get_gui_layout_info(Viewport::LAYOUT_INFO_MINIMUM_SIZE_UPDATES) - minimum_size_updates_before == depth + 2);
+			CHECK(boxes.root->get_size() == boxes.root->get_combined_minimum_size());
+
+			// Leaving the tree with queued updates doesn't block later ones.
+			boxes.leaf->set_custom_minimum_size(Size2(5, 70));
+			root->remove_child(boxes.root);
+			root->add_child(boxes.root);
+			boxes.leaf->set_custom_minimum_size(Size2(5, 80));
+			MessageQueue::get_singleton()->flush();
+			CHECK(boxes.leaf->get_size().y == 80);
+			CHECK(boxes.root->get_size() == boxes.root->get_combined_minimum_size());
+		}
+
+		memdelete(boxes.root);
+	}
+	root->set_gui_incremental_layout(false);
+
+	// Each container is sorted exactly once, parents first.
+	CHECK(sorts[1] == depth);
+	CHECK(minimum_size_updates[1] == depth + 1);
+	CHECK(sorts[0] > sorts[1]);
+	CHECK(minimum_size_updates[0] == minimum_size_updates[1]);
+
+	CHECK(root_sizes[0] == root_sizes[1]);
+	CHECK(leaf_rects[0] == leaf_rects[1]);
+}
+
 } // namespace TestControl
 
 #endif // TEST_CONTROL_H
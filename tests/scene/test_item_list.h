@@ -0,0 +1,218 @@
+/**************************************************************************/
+/*  test_item_list.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ITEM_LIST_H
+#define TEST_ITEM_LIST_H
+
+#include "scene/gui/item_list.h"
+#include "scene/main/window.h"
+#include "scene/resources/image_texture.h"
+
+#include "tests/test_macros.h"
+
+namespace TestItemList {
+
+static int provider_calls = 0;
+static Ref<ImageTexture> provider_icon;
+
+static Variant provide_text_row(int p_idx) {
+	provider_calls++;
+	return vformat("Row %d", p_idx);
+}
+
+static Variant provide_icon_row(int p_idx) {
+	provider_calls++;
+	Dictionary row;
+	row["text"] = vformat("Row %d", p_idx);
+	if (p_idx % 2 == 0) {
+		row["icon"] = provider_icon;
+	}
+	row["disabled"] = p_idx % 3 == 0;
+	return row;
+}
+
+static ItemList *reentrant_item_list = nullptr;
+
+static Variant provide_reentrant_row(int p_idx) {
+	provider_calls++;
+	reentrant_item_list->set_item_count(0);
+	reentrant_item_list->invalidate_items();
+	return vformat("Row %d", p_idx);
+}
+
+static void draw_item_list() {
+	// Redraws are deferred.
+	MessageQueue::get_singleton()->flush();
+}
+
+TEST_CASE("[SceneTree][ItemList] Item provider") {
+	ItemList *item_list = memnew(ItemList);
+	item_list->set_size(Size2(200, 300));
+	SceneTree::get_singleton()->get_root()->add_child(item_list);
+
+	const int row_count = 1000000;
+	provider_calls = 0;
+	item_list->set_item_provider(callable_mp_static(&provide_text_row));
+	item_list->set_item_count(row_count);
+	draw_item_list();
+
+	CHECK(item_list->get_item_count() == row_count);
+
+	SUBCASE("Only visible rows are requested") {
+		CHECK(provider_calls > 0);
+		CHECK(provider_calls < 100);
+		CHECK(item_list->get_v_scroll_bar()->get_max() > row_count);
+
+		int calls_before = provider_calls;
+		item_list->get_v_scroll_bar()->set_value(item_list->get_v_scroll_bar()->get_max() / 2);
+		draw_item_list();
+		CHECK(provider_calls - calls_before < 100);
+
+		// Scrolling back reuses the cached rows.
+		calls_before = provider_calls;
+		item_list->get_v_scroll_bar()->set_value(0);
+		draw_item_list();
+		CHECK(provider_calls == calls_before);
+	}
+
+	SUBCASE("Rows are found from positions") {
+		item_list->get_v_scroll_bar()->set_value(item_list->get_v_scroll_bar()->get_max() / 2);
+		draw_item_list();
+
+		int row = item_list->get_item_at_position(Point2(20, 20), true);
+		CHECK(row > row_count / 4);
+		CHECK(row < row_count);
+		CHECK(item_list->get_item_text(row) == vformat("Row %d", row));
+
+		Rect2 rect = item_list->get_item_rect(row);
+		real_t scroll = item_list->get_v_scroll_bar()->get_value();
+		CHECK(rect.position.y - scroll <= 20);
+		CHECK(rect.position.y + rect.size.y - scroll > 20);
+	}
+
+	SUBCASE("Selection") {
+		item_list->set_select_mode(ItemList::SELECT_MULTI);
+		item_list->select(500000);
+		item_list->select(10, false);
+		CHECK(item_list->is_selected(500000));
+		CHECK(item_list->is_selected(10));
+		CHECK_FALSE(item_list->is_selected(11));
+
+		Vector<int> selected = item_list->get_selected_items();
+		REQUIRE(selected.size() == 2);
+		CHECK(selected[0] == 10);
+		CHECK(selected[1] == 500000);
+
+		item_list->set_item_count(1000);
+		CHECK(item_list->get_selected_items().size() == 1);
+
+		item_list->deselect_all();
+		CHECK_FALSE(item_list->is_anything_selected());
+	}
+
+	SUBCASE("Getters don't cache rows") {
+		int calls_before = provider_calls;
+		CHECK(item_list->get_item_text(500000) == "Row 500000");
+		CHECK(item_list->is_item_selectable(500000));
+		CHECK(provider_calls - calls_before == 2);
+
+		// Visible rows are cached by drawing.
+		calls_before = provider_calls;
+		CHECK(item_list->get_item_text(0) == "Row 0");
+		CHECK(provider_calls == calls_before);
+	}
+
+	SUBCASE("The provider can't modify the list") {
+		reentrant_item_list = item_list;
+		item_list->set_item_provider(callable_mp_static(&provide_reentrant_row));
+		item_list->set_item_count(100);
+		ERR_PRINT_OFF;
+		draw_item_list();
+		CHECK(item_list->get_item_text(50) == "Row 50");
+		ERR_PRINT_ON;
+		CHECK(item_list->get_item_count() == 100);
+		reentrant_item_list = nullptr;
+	}
+
+	SUBCASE("Invalidated rows are requested again") {
+		int calls_before = provider_calls;
+		item_list->invalidate_items(0, 4);
+		draw_item_list();
+		CHECK(provider_calls - calls_before == 5);
+	}
+
+	SUBCASE("Items can't be added") {
+		ERR_PRINT_OFF;
+		CHECK(item_list->add_item("Stored") == -1);
+		ERR_PRINT_ON;
+		CHECK(item_list->get_item_count() == row_count);
+	}
+
+	SUBCASE("Removing the provider clears the list") {
+		item_list->set_item_provider(Callable());
+		CHECK(item_list->get_item_count() == 0);
+		CHECK(item_list->add_item("Stored") == 0);
+	}
+
+	memdelete(item_list);
+}
+
+TEST_CASE("[SceneTree][ItemList] Item provider row heights") {
+	ItemList *item_list = memnew(ItemList);
+	item_list->set_size(Size2(200, 2000));
+	SceneTree::get_singleton()->get_root()->add_child(item_list);
+
+	provider_icon = ImageTexture::create_from_image(Image::create_empty(48, 48, false, Image::FORMAT_RGBA8));
+	item_list->set_item_provider(callable_mp_static(&provide_icon_row));
+	item_list->set_item_count(20);
+	draw_item_list();
+
+	CHECK(item_list->is_item_disabled(3));
+	CHECK_FALSE(item_list->is_item_disabled(4));
+	CHECK(item_list->get_item_icon(2) == provider_icon);
+
+	// Rows with an icon are taller, and the offsets follow the measured heights.
+	for (int i = 0; i < 19; i++) {
+		Rect2 rect = item_list->get_item_rect(i);
+		Rect2 next_rect = item_list->get_item_rect(i + 1);
+		CHECK(next_rect.position.y == doctest::Approx(rect.position.y + rect.size.y));
+		if (i % 2 == 0) {
+			CHECK(rect.size.y >= 48);
+			CHECK(rect.size.y > next_rect.size.y);
+		}
+	}
+
+	provider_icon.unref();
+	memdelete(item_list);
+}
+
+} // namespace TestItemList
+
+#endif // TEST_ITEM_LIST_H
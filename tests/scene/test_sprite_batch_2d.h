@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*  test_sprite_batch_2d.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SPRITE_BATCH_2D_H
+#define TEST_SPRITE_BATCH_2D_H
+
+#include "scene/2d/sprite_batch_2d.h"
+#include "scene/main/window.h"
+#include "scene/resources/image_texture.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSpriteBatch2D {
+
+Ref<ImageTexture> create_sprite_sheet() {
+	// 4x4 frames of 16x16 pixels.
+	return ImageTexture::create_from_image(Image::create_empty(64, 64, false, Image::FORMAT_RGBA8));
+}
+
+TEST_CASE("[SceneTree][SpriteBatch2D] Instance buffer") {
+	SpriteBatch2D *batch = memnew(SpriteBatch2D);
+	SceneTree::get_singleton()->get_root()->add_child(batch);
+	batch->set_texture(create_sprite_sheet());
+	batch->set_hframes(4);
+	batch->set_vframes(4);
+
+	PackedVector2Array positions;
+	positions.push_back(Vector2(0, 0));
+	positions.push_back(Vector2(100, 0));
+	positions.push_back(Vector2(0, 100));
+
+	PackedInt32Array frames;
+	frames.push_back(0);
+	frames.push_back(5);
+
+	PackedColorArray modulates;
+	modulates.push_back(Color(1, 0, 0));
+
+	PackedInt32Array z_offsets;
+	z_offsets.push_back(1);
+
+	batch->set_instances(positions, frames, modulates, z_offsets);
+	MessageQueue::get_singleton()->flush();
+
+	CHECK(batch->get_instance_count() == 3);
+	CHECK(batch->get_rect().is_equal_approx(Rect2(-8, -8, 116, 116)));
+
+	Vector<float> buffer = RS::get_singleton()->multimesh_get_buffer(batch->get_multimesh());
+	REQUIRE(buffer.size() == 3 * 16);
+
+	SUBCASE("Z offsets order instances, stable for equal offsets") {
+		// Instance 1 is drawn first, the instance with z offset 1 last.
+		CHECK(buffer[3] == doctest::Approx(92));
+		CHECK(buffer[7] == doctest::Approx(-8));
+		CHECK(buffer[16 + 3] == doctest::Approx(-8));
+		CHECK(buffer[16 + 7] == doctest::Approx(92));
+		CHECK(buffer[32 + 3] == doctest::Approx(-8));
+		CHECK(buffer[32 + 7] == doctest::Approx(-8));
+	}
+
+	SUBCASE("Frames and modulates") {
+		// Frame 5 is the second column of the second row.
+		CHECK(Color(buffer[12], buffer[13], buffer[14], buffer[15]).is_equal_approx(Color(0.25, 0.25, 0.25, 0.25)));
+		CHECK(Color(buffer[8], buffer[9], buffer[10], buffer[11]).is_equal_approx(Color(1, 1, 1, 1)));
+		CHECK(Color(buffer[32 + 8], buffer[32 + 9], buffer[32 + 10], buffer[32 + 11]).is_equal_approx(Color(1, 0, 0)));
+	}
+
+	SUBCASE("Regions and flipping") {
+		PackedVector4Array regions;
+		regions.push_back(Vector4(32, 0, -32, 16));
+		batch->set_regions(regions);
+		batch->set_flip_v(true);
+		MessageQueue::get_singleton()->flush();
+
+		buffer = RS::get_singleton()->multimesh_get_buffer(batch->get_multimesh());
+		REQUIRE(buffer.size() == 3 * 16);
+		// Instance 0 is drawn last, with a 32x16 quad covering the first 32x16 pixels, flipped on both axes.
+		CHECK(buffer[32 + 0] == doctest::Approx(32));
+		CHECK(buffer[32 + 5] == doctest::Approx(16));
+		CHECK(Color(buffer[32 + 12], buffer[32 + 13], buffer[32 + 14], buffer[32 + 15]).is_equal_approx(Color(0.5, 0.25, -0.5, -0.25)));
+	}
+
+	memdelete(batch);
+}
+
+} // namespace TestSpriteBatch2D
+
+#endif // TEST_SPRITE_BATCH_2D_H
@@ -0,0 +1,614 @@
+/**************************************************************************/
+/*  test_tile_map_layer.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TILE_MAP_LAYER_H
+#define TEST_TILE_MAP_LAYER_H
+
+#include "core/io/dir_access.h"
+#include "core/math/random_pcg.h"
+#include "scene/2d/tile_map_layer.h"
+#include "scene/main/window.h"
+#include "scene/resources/2d/navigation_polygon.h"
+#include "scene/resources/image_texture.h"
+#include "scene/resources/packed_scene.h"
+#include "scene/resources/world_2d.h"
+#include "servers/navigation_server_2d.h"
+#include "servers/physics_server_2d.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestTileMapLayer {
+
+static Ref<TileSet> create_tile_set() {
+	Ref<Image> image = Image::create_empty(64, 64, false, Image::FORMAT_RGBA8);
+	Ref<TileSetAtlasSource> atlas_source;
+	atlas_source.instantiate();
+	atlas_source->set_texture(ImageTexture::create_from_image(image));
+	atlas_source->set_texture_region_size(Vector2i(16, 16));
+	// The padded texture is generated deferred, use the texture as is.
+	atlas_source->set_use_texture_padding(false);
+
+	// An animated tile with two frames, using (0, 0) and (1, 0).
+	atlas_source->create_tile(Vector2i(0, 0));
+	atlas_source->set_tile_animation_frames_count(Vector2i(0, 0), 2);
+	// Static tiles.
+	for (int y = 1; y < 4; y++) {
+		for (int x = 0; x < 4; x++) {
+			atlas_source->create_tile(Vector2i(x, y));
+		}
+	}
+
+	Ref<TileSet> tile_set;
+	tile_set.instantiate();
+	tile_set->set_tile_size(Vector2i(16, 16));
+	tile_set->add_source(atlas_source, 0);
+	return tile_set;
+}
+
+TEST_CASE("[SceneTree][TileMapLayer] Tile draw commands") {
+	Ref<TileSet> tile_set = create_tile_set();
+	LocalVector<TileDrawCommand> commands;
+
+	SUBCASE("A static tile should be drawn with a single texture rect") {
+		TileMapLayer::build_tile_draw_commands(commands, 3, Vector2(8, 8), tile_set, 0, Vector2i(1, 1), 0);
+		REQUIRE(commands.size() == 1);
+		CHECK(commands[0].type == TileDrawCommand::TYPE_TEXTURE_RECT_REGION);
+		CHECK(commands[0].canvas_item_index == 3);
+		CHECK(commands[0].source_rect == Rect2(16, 16, 16, 16));
+		CHECK(commands[0].rect.position.is_equal_approx(Vector2(0, 0)));
+	}
+
+	SUBCASE("An animated tile should be drawn once per frame, in animation slices") {
+		TileMapLayer::build_tile_draw_commands(commands, 0, Vector2(), tile_set, 0, Vector2i(0, 0), 0);
+		REQUIRE(commands.size() == 5);
+		CHECK(commands[0].type == TileDrawCommand::TYPE_ANIMATION_SLICE);
+		CHECK(commands[1].type == TileDrawCommand::TYPE_TEXTURE_RECT_REGION);
+		CHECK(commands[1].source_rect == Rect2(0, 0, 16, 16));
+		CHECK(commands[2].type == TileDrawCommand::TYPE_ANIMATION_SLICE);
+		CHECK(commands[3].type == TileDrawCommand::TYPE_TEXTURE_RECT_REGION);
+		CHECK(commands[3].source_rect == Rect2(16, 0, 16, 16));
+		// The last slice resets the animation.
+		CHECK(commands[4].type == TileDrawCommand::TYPE_ANIMATION_SLICE);
+		CHECK(commands[4].animation_length == doctest::Approx(1.0));
+		CHECK(commands[4].slice_end == doctest::Approx(1.0));
+	}
+
+	SUBCASE("A specific frame should be drawn without animation slices") {
+		TileMapLayer::build_tile_draw_commands(commands, 0, Vector2(), tile_set, 0, Vector2i(0, 0), 0, 1);
+		REQUIRE(commands.size() == 1);
+		CHECK(commands[0].source_rect == Rect2(16, 0, 16, 16));
+	}
+}
+
+TEST_CASE("[SceneTree][TileMapLayer] Terrains") {
+	Ref<TileSet> tile_set = create_tile_set();
+	tile_set->add_terrain_set();
+	tile_set->set_terrain_set_mode(0, TileSet::TERRAIN_MODE_MATCH_SIDES);
+	tile_set->add_terrain(0);
+
+	const TileSet::CellNeighbor sides[] = { TileSet::CELL_NEIGHBOR_RIGHT_SIDE, TileSet::CELL_NEIGHBOR_BOTTOM_SIDE, TileSet::CELL_NEIGHBOR_LEFT_SIDE, TileSet::CELL_NEIGHBOR_TOP_SIDE };
+	Ref<TileSetAtlasSource> atlas_source = tile_set->get_source(0);
+	// A tile connected on all sides.
+	TileData *full_tile_data = atlas_source->get_tile_data(Vector2i(0, 1), 0);
+	full_tile_data->set_terrain_set(0);
+	full_tile_data->set_terrain(0);
+	for (const TileSet::CellNeighbor &side : sides) {
+		full_tile_data->set_terrain_peering_bit(side, 0);
+	}
+	// An isolated tile.
+	TileData *isolated_tile_data = atlas_source->get_tile_data(Vector2i(1, 1), 0);
+	isolated_tile_data->set_terrain_set(0);
+	isolated_tile_data->set_terrain(0);
+
+	SUBCASE("The lookup tables should list the patterns of the terrain set") {
+		const TileSet::TerrainsLookup &lookup = tile_set->get_terrains_lookup(0);
+		CHECK(lookup.peering_bits.size() == 4);
+		// The empty pattern is always available.
+		REQUIRE(lookup.patterns.size() == 3);
+		CHECK(lookup.patterns_terrains.size() == 3 * 5);
+		REQUIRE(lookup.pattern_indices.has(full_tile_data->get_terrains_pattern()));
+		int full_index = lookup.pattern_indices[full_tile_data->get_terrains_pattern()];
+		CHECK(lookup.patterns[full_index] == full_tile_data->get_terrains_pattern());
+		for (int i = 0; i < 5; i++) {
+			CHECK(lookup.patterns_terrains[full_index * 5 + i] == 0);
+		}
+	}
+
+	SUBCASE("Painting should pick the tiles matching the neighbors") {
+		TileMapLayer *layer = memnew(TileMapLayer);
+		layer->set_tile_set(tile_set);
+
+		TypedArray<Vector2i> cells;
+		cells.push_back(Vector2i(0, 0));
+		layer->set_cells_terrain_connect(cells, 0, 0);
+		CHECK(layer->get_cell_atlas_coords(Vector2i(0, 0)) == Vector2i(1, 1));
+		CHECK(layer->get_used_cells().size() == 1);
+
+		// Surrounding a cell connects it on all sides.
+		cells.clear();
+		for (const TileSet::CellNeighbor &side : sides) {
+			cells.push_back(tile_set->get_neighbor_cell(Vector2i(4, 4), side));
+		}
+		layer->set_cells_terrain_connect(cells, 0, 0);
+		cells.clear();
+		cells.push_back(Vector2i(4, 4));
+		layer->set_cells_terrain_connect(cells, 0, 0);
+		CHECK(layer->get_cell_atlas_coords(Vector2i(4, 4)) == Vector2i(0, 1));
+		CHECK(layer->get_cell_atlas_coords(Vector2i(5, 4)) == Vector2i(1, 1));
+
+		memdelete(layer);
+	}
+}
+
+// The terrain solver without lookup tables, scoring every pattern of the terrain set against the constraints.
+static HashMap<Vector2i, TileSet::TerrainsPattern> terrain_fill_constraints_full_scan(const TileMapLayer *p_layer, const Vector<Vector2i> &p_to_replace, int p_terrain_set, RBSet<TerrainConstraint> p_constraints) {
+	Ref<TileSet> tile_set = p_layer->get_tile_set();
+	RBSet<TileSet::TerrainsPattern> pattern_set = tile_set->get_terrains_pattern_set(p_terrain_set);
+
+	// The constraint on the center bit (-1) or a peering bit of a cell, for a given terrain.
+	auto make_constraint = [&](const Vector2i &p_coords, int p_bit, int p_terrain) {
+		return p_bit < 0 ? TerrainConstraint(tile_set, p_coords, p_terrain) : TerrainConstraint(tile_set, p_coords, TileSet::CellNeighbor(p_bit), p_terrain);
+	};
+	auto get_pattern_terrain = [](const TileSet::TerrainsPattern &p_pattern, int p_bit) {
+		return p_bit < 0 ? p_pattern.get_terrain() : p_pattern.get_terrain_peering_bit(TileSet::CellNeighbor(p_bit));
+	};
+
+	HashMap<Vector2i, TileSet::TerrainsPattern> output;
+	for (const Vector2i &coords : p_to_replace) {
+		TileSet::TerrainsPattern current_pattern(*tile_set, p_terrain_set);
+		TileData *tile_data = p_layer->get_cell_tile_data(coords);
+		if (tile_data && tile_data->get_terrain_set() == p_terrain_set) {
+			current_pattern = tile_data->get_terrains_pattern();
+		}
+
+		TileSet::TerrainsPattern best_pattern = current_pattern;
+		int best_score = INT32_MAX;
+		for (const TileSet::TerrainsPattern &pattern : pattern_set) {
+			int score = 0;
+			bool invalid_pattern = false;
+			for (int bit = -1; bit < TileSet::CELL_NEIGHBOR_MAX && !invalid_pattern; bit++) {
+				if (bit >= 0 && !tile_set->is_valid_terrain_peering_bit(p_terrain_set, TileSet::CellNeighbor(bit))) {
+					continue;
+				}
+				const RBSet<TerrainConstraint>::Element *E = p_constraints.find(make_constraint(coords, bit, get_pattern_terrain(pattern, bit)));
+				if (E) {
+					if (E->get().get_terrain() != get_pattern_terrain(pattern, bit)) {
+						score += E->get().get_priority();
+					}
+				} else if (get_pattern_terrain(current_pattern, bit) != get_pattern_terrain(pattern, bit)) {
+					invalid_pattern = true;
+				}
+			}
+			if (!invalid_pattern && score < best_score) {
+				best_score = score;
+				best_pattern = pattern;
+			}
+		}
+
+		// The chosen pattern constrains the next cells.
+		for (int bit = -1; bit < TileSet::CELL_NEIGHBOR_MAX; bit++) {
+			if (bit >= 0 && !tile_set->is_valid_terrain_peering_bit(p_terrain_set, TileSet::CellNeighbor(bit))) {
+				continue;
+			}
+			TerrainConstraint constraint = make_constraint(coords, bit, get_pattern_terrain(best_pattern, bit));
+			constraint.set_priority(5);
+			p_constraints.erase(constraint);
+			p_constraints.insert(constraint);
+		}
+		output[coords] = best_pattern;
+	}
+	return output;
+}
+
+TEST_CASE("[SceneTree][TileMapLayer] Terrains solver should match a full scan of the patterns") {
+	Ref<TileSet> tile_set = create_tile_set();
+	tile_set->add_terrain_set();
+	tile_set->set_terrain_set_mode(0, TileSet::TERRAIN_MODE_MATCH_CORNERS_AND_SIDES);
+	tile_set->add_terrain(0);
+	tile_set->add_terrain(0);
+
+	// Random terrains on the static tiles.
+	RandomPCG rng(42);
+	Ref<TileSetAtlasSource> atlas_source = tile_set->get_source(0);
+	for (int y = 1; y < 4; y++) {
+		for (int x = 0; x < 4; x++) {
+			TileData *tile_data = atlas_source->get_tile_data(Vector2i(x, y), 0);
+			tile_data->set_terrain_set(0);
+			tile_data->set_terrain(rng.random(0, 1));
+			for (int bit = 0; bit < TileSet::CELL_NEIGHBOR_MAX; bit++) {
+				if (tile_set->is_valid_terrain_peering_bit(0, TileSet::CellNeighbor(bit))) {
+					tile_data->set_terrain_peering_bit(TileSet::CellNeighbor(bit), rng.random(-1, 1));
+				}
+			}
+		}
+	}
+
+	TileMapLayer *layer = memnew(TileMapLayer);
+	layer->set_tile_set(tile_set);
+
+	for (int iteration = 0; iteration < 20; iteration++) {
+		// Random existing tiles.
+		layer->clear();
+		for (int y = 0; y < 8; y++) {
+			for (int x = 0; x < 8; x++) {
+				if (rng.random(0, 2) > 0) {
+					layer->set_cell(Vector2i(x, y), 0, Vector2i(rng.random(0, 3), rng.random(1, 3)));
+				}
+			}
+		}
+
+		// Random cells to replace, in a random order.
+		Vector<Vector2i> to_replace;
+		for (int y = 1; y < 7; y++) {
+			for (int x = 1; x < 7; x++) {
+				to_replace.push_back(Vector2i(x, y));
+			}
+		}
+		for (int i = to_replace.size() - 1; i > 0; i--) {
+			SWAP(to_replace.write[i], to_replace.write[rng.random(0, i)]);
+		}
+
+		// Random constraints, with null priorities to go through both the lookup and the scan of the patterns.
+		RBSet<TerrainConstraint> constraints;
+		for (int i = 0; i < 30; i++) {
+			Vector2i coords(rng.random(0, 7), rng.random(0, 7));
+			int bit = rng.random(-1, TileSet::CELL_NEIGHBOR_MAX - 1);
+			TerrainConstraint constraint;
+			if (bit < 0) {
+				constraint = TerrainConstraint(tile_set, coords, rng.random(-1, 1));
+			} else if (tile_set->is_valid_terrain_peering_bit(0, TileSet::CellNeighbor(bit))) {
+				constraint = TerrainConstraint(tile_set, coords, TileSet::CellNeighbor(bit), rng.random(-1, 1));
+			} else {
+				continue;
+			}
+			constraint.set_priority(iteration % 2 == 0 ? rng.random(1, 5) : rng.random(0, 5));
+			constraints.insert(constraint);
+		}
+
+		HashMap<Vector2i, TileSet::TerrainsPattern> output = layer->terrain_fill_constraints(to_replace, 0, constraints);
+		HashMap<Vector2i, TileSet::TerrainsPattern> expected = terrain_fill_constraints_full_scan(layer, to_replace, 0, constraints);
+		REQUIRE(output.size() == expected.size());
+		for (const KeyValue<Vector2i, TileSet::TerrainsPattern> &kv : expected) {
+			REQUIRE(output.has(kv.key));
+			CHECK(output[kv.key] == kv.value);
+		}
+	}
+
+	memdelete(layer);
+}
+
+TEST_CASE("[SceneTree][TileMapLayer] Physics and navigation quadrants") {
+	Ref<TileSet> tile_set = create_tile_set();
+	tile_set->add_physics_layer();
+	tile_set->add_navigation_layer();
+	Ref<TileSetAtlasSource> atlas_source = tile_set->get_source(0);
+
+	// A tile with a collision and a navigation polygon covering the whole tile.
+	TileData *full_tile_data = atlas_source->get_tile_data(Vector2i(0, 1), 0);
+	full_tile_data->add_collision_polygon(0);
+	full_tile_data->set_collision_polygon_points(0, 0, { Vector2(-8, -8), Vector2(8, -8), Vector2(8, 8), Vector2(-8, 8) });
+	Ref<NavigationPolygon> navigation_polygon;
+	navigation_polygon.instantiate();
+	navigation_polygon->set_vertices({ Vector2(-8, -8), Vector2(8, -8), Vector2(8, 8), Vector2(-8, 8) });
+	navigation_polygon->add_polygon({ 0, 1, 2, 3 });
+	full_tile_data->set_navigation_polygon(0, navigation_polygon);
+	// A tile with a smaller collision, which can't be merged.
+	TileData *small_tile_data = atlas_source->get_tile_data(Vector2i(1, 1), 0);
+	small_tile_data->add_collision_polygon(0);
+	small_tile_data->set_collision_polygon_points(0, 0, { Vector2(-4, -4), Vector2(4, -4), Vector2(4, 4), Vector2(-4, 4) });
+
+	TileMapLayer *layer = memnew(TileMapLayer);
+	layer->set_tile_set(tile_set);
+	CHECK(layer->get_physics_quadrant_size() == 1);
+	layer->set_physics_quadrant_size(4);
+	layer->set_navigation_quadrant_size(4);
+	SceneTree::get_singleton()->get_root()->add_child(layer);
+
+	// Two full rows and two small tiles in the quadrant (0, 0), and two full tiles in the quadrant (1, 0).
+	for (int y = 0; y < 2; y++) {
+		for (int x = 0; x < 4; x++) {
+			layer->set_cell(Vector2i(x, y), 0, Vector2i(0, 1));
+		}
+	}
+	layer->set_cell(Vector2i(1, 3), 0, Vector2i(1, 1));
+	layer->set_cell(Vector2i(2, 3), 0, Vector2i(1, 1));
+	layer->set_cell(Vector2i(4, 0), 0, Vector2i(0, 1));
+	layer->set_cell(Vector2i(5, 0), 0, Vector2i(0, 1));
+	layer->update_internals();
+
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	PhysicsDirectSpaceState2D *space_state = ps->space_get_direct_state(layer->get_world_2d()->get_space());
+	const auto get_shape_at = [&](const Vector2i &p_coords) {
+		PhysicsDirectSpaceState2D::PointParameters parameters;
+		parameters.position = layer->map_to_local(p_coords);
+		PhysicsDirectSpaceState2D::ShapeResult result;
+		if (space_state->intersect_point(parameters, &result, 1) == 0) {
+			return PhysicsDirectSpaceState2D::ShapeResult();
+		}
+		return result;
+	};
+
+	const PhysicsDirectSpaceState2D::ShapeResult quadrant_a_shape = get_shape_at(Vector2i(0, 0));
+	const PhysicsDirectSpaceState2D::ShapeResult quadrant_b_shape = get_shape_at(Vector2i(4, 0));
+	REQUIRE(quadrant_a_shape.rid.is_valid());
+	REQUIRE(quadrant_b_shape.rid.is_valid());
+	CHECK(quadrant_a_shape.rid != quadrant_b_shape.rid);
+
+	SUBCASE("Adjacent full tiles should be merged into rectangles") {
+		const PhysicsDirectSpaceState2D::ShapeResult corner_shape = get_shape_at(Vector2i(3, 1));
+		CHECK(corner_shape.rid == quadrant_a_shape.rid);
+		CHECK(corner_shape.shape == quadrant_a_shape.shape);
+		// One rectangle and the two small tiles.
+		CHECK(ps->body_get_shape_count(quadrant_a_shape.rid) == 3);
+		CHECK(ps->body_get_shape_count(quadrant_b_shape.rid) == 1);
+	}
+
+	SUBCASE("Body shapes should map to their cell") {
+		CHECK(layer->get_coords_for_body_shape(quadrant_a_shape.rid, quadrant_a_shape.shape) == Vector2i(0, 0));
+		CHECK(layer->get_coords_for_body_shape(quadrant_b_shape.rid, quadrant_b_shape.shape) == Vector2i(4, 0));
+		for (const Vector2i &coords : { Vector2i(1, 3), Vector2i(2, 3) }) {
+			const PhysicsDirectSpaceState2D::ShapeResult small_shape = get_shape_at(coords);
+			CHECK(small_shape.rid == quadrant_a_shape.rid);
+			CHECK(layer->get_coords_for_body_shape(small_shape.rid, small_shape.shape) == coords);
+		}
+		// Merged shapes resolve the exact cell from a position, even on the edge of the shape.
+		const PhysicsDirectSpaceState2D::ShapeResult corner_shape = get_shape_at(Vector2i(3, 1));
+		CHECK(layer->get_coords_for_body_shape_at(corner_shape.rid, corner_shape.shape, layer->to_global(layer->map_to_local(Vector2i(3, 1)))) == Vector2i(3, 1));
+		CHECK(layer->get_coords_for_body_shape_at(corner_shape.rid, corner_shape.shape, layer->to_global(layer->map_to_local(Vector2i(2, 1)) + Vector2(0, 8))) == Vector2i(2, 1));
+	}
+
+	SUBCASE("Bodies holding several cells can't be mapped from their RID alone") {
+		ERR_PRINT_OFF;
+		CHECK(layer->get_coords_for_body_rid(quadrant_a_shape.rid) == Vector2i());
+		ERR_PRINT_ON;
+	}
+
+	SUBCASE("Quadrants of a single cell should keep one body per cell") {
+		layer->set_physics_quadrant_size(1);
+		layer->update_internals();
+		for (const Vector2i &coords : { Vector2i(0, 0), Vector2i(3, 1), Vector2i(1, 3), Vector2i(5, 0) }) {
+			const PhysicsDirectSpaceState2D::ShapeResult shape = get_shape_at(coords);
+			REQUIRE(shape.rid.is_valid());
+			CHECK(ps->body_get_shape_count(shape.rid) == 1);
+			CHECK(layer->get_coords_for_body_rid(shape.rid) == coords);
+		}
+	}
+
+	SUBCASE("Changing a cell should only rebuild its quadrant") {
+		// Merged shapes are created again when their quadrant is rebuilt.
+		const RID quadrant_a_shape_rid = ps->body_get_shape(quadrant_a_shape.rid, quadrant_a_shape.shape);
+		const RID quadrant_b_shape_rid = ps->body_get_shape(quadrant_b_shape.rid, quadrant_b_shape.shape);
+
+		layer->set_cell(Vector2i(0, 2), 0, Vector2i(0, 1));
+		layer->update_internals();
+		CHECK(ps->body_get_shape_count(quadrant_a_shape.rid) == 4);
+		CHECK(ps->body_get_shape(quadrant_a_shape.rid, get_shape_at(Vector2i(0, 0)).shape) != quadrant_a_shape_rid);
+		CHECK(ps->body_get_shape(quadrant_b_shape.rid, 0) == quadrant_b_shape_rid);
+
+		const RID rebuilt_quadrant_a_shape_rid = ps->body_get_shape(quadrant_a_shape.rid, get_shape_at(Vector2i(0, 0)).shape);
+		layer->erase_cell(Vector2i(4, 0));
+		layer->update_internals();
+		CHECK(ps->body_get_shape(quadrant_b_shape.rid, 0) != quadrant_b_shape_rid);
+		CHECK(ps->body_get_shape(quadrant_a_shape.rid, get_shape_at(Vector2i(0, 0)).shape) == rebuilt_quadrant_a_shape_rid);
+		CHECK(layer->get_coords_for_body_shape(quadrant_b_shape.rid, 0) == Vector2i(5, 0));
+	}
+
+	SUBCASE("The navigation regions of the quadrants should cover the painted cells") {
+		NavigationServer2D *ns = NavigationServer2D::get_singleton();
+		const RID map = layer->get_navigation_map();
+		ns->map_force_update(map);
+		const TypedArray<RID> regions = ns->map_get_regions(map);
+		CHECK(regions.size() == 2);
+
+		const auto is_covered = [&](const Vector2i &p_coords) {
+			const Vector2 point = layer->map_to_local(p_coords);
+			for (int i = 0; i < regions.size(); i++) {
+				if (ns->region_get_closest_point(regions[i], point).is_equal_approx(point)) {
+					return true;
+				}
+			}
+			return false;
+		};
+		for (int y = 0; y < 2; y++) {
+			for (int x = 0; x < 4; x++) {
+				CHECK(is_covered(Vector2i(x, y)));
+			}
+		}
+		CHECK(is_covered(Vector2i(4, 0)));
+		CHECK(is_covered(Vector2i(5, 0)));
+		// The small tiles have no navigation polygon.
+		CHECK_FALSE(is_covered(Vector2i(1, 3)));
+	}
+
+	memdelete(layer);
+}
+
+TEST_CASE("[SceneTree][TileMapLayer] Cell streaming") {
+	Ref<TileSet> tile_set = create_tile_set();
+	const String streaming_path = TestUtils::get_temp_path("tile_map_layer_streaming");
+
+	TileMapLayer *layer = memnew(TileMapLayer);
+	layer->set_tile_set(tile_set);
+	SceneTree::get_singleton()->get_root()->add_child(layer);
+
+	// A chunk with many cells, and two chunks with a few cells.
+	HashMap<Vector2i, Vector2i> painted;
+	for (int y = 0; y < 15; y++) {
+		for (int x = 0; x < 20; x++) {
+			painted[Vector2i(x, y)] = Vector2i(x % 4, 1 + y % 3);
+		}
+	}
+	painted[Vector2i(130, 3)] = Vector2i(1, 1);
+	painted[Vector2i(140, 20)] = Vector2i(2, 2);
+	painted[Vector2i(-90, 70)] = Vector2i(3, 3);
+	for (const KeyValue<Vector2i, Vector2i> &kv : painted) {
+		layer->set_cell(kv.key, 0, kv.value);
+	}
+
+	auto check_painted = [&](TileMapLayer *p_layer) {
+		CHECK(p_layer->get_used_cells().size() == painted.size());
+		for (const KeyValue<Vector2i, Vector2i> &kv : painted) {
+			CHECK(p_layer->get_cell_atlas_coords(kv.key) == kv.value);
+		}
+	};
+
+	layer->set_cell_streaming_path(streaming_path);
+	layer->set_cell_streaming_radius(4);
+	layer->set_cell_streaming_enabled(true);
+	check_painted(layer);
+
+	SUBCASE("Cells should be the same after erasing and painting them back") {
+		for (int y = 0; y < 15; y++) {
+			for (int x = 0; x < 20; x++) {
+				layer->erase_cell(Vector2i(x, y));
+			}
+		}
+		CHECK(layer->get_used_cells().size() == 3);
+		for (int y = 14; y >= 0; y--) {
+			for (int x = 19; x >= 0; x--) {
+				layer->set_cell(Vector2i(x, y), 0, painted[Vector2i(x, y)]);
+			}
+		}
+		check_painted(layer);
+	}
+
+	SUBCASE("Cells should survive being streamed out to disk") {
+		// Move the focus away from every painted chunk.
+		layer->set_cell_streaming_focus(Vector2i(500, 500));
+		CHECK(layer->get_used_cells().is_empty());
+
+		// Moving back loads the chunk around the focus only.
+		layer->set_cell_streaming_radius(0);
+		layer->set_cell_streaming_focus(Vector2i(0, 0));
+		CHECK(layer->get_used_cells().size() == 300);
+		CHECK(layer->get_cell_atlas_coords(Vector2i(130, 3)) == Vector2i(-1, -1));
+
+		// Modifying a cell loads its chunk back.
+		layer->erase_cell(Vector2i(130, 3));
+		painted.erase(Vector2i(130, 3));
+		CHECK(layer->get_cell_atlas_coords(Vector2i(140, 20)) == Vector2i(2, 2));
+
+		layer->set_cell_streaming_focus(Vector2i(500, 500));
+		layer->set_cell_streaming_enabled(false);
+		check_painted(layer);
+		CHECK(DirAccess::get_directories_at(streaming_path).is_empty());
+	}
+
+	SUBCASE("Changing the streaming path should keep the streamed out cells") {
+		layer->set_cell_streaming_focus(Vector2i(500, 500));
+		layer->set_cell_streaming_path(TestUtils::get_temp_path("tile_map_layer_streaming_other"));
+		CHECK(layer->get_used_cells().is_empty());
+		layer->set_cell_streaming_path(String());
+		check_painted(layer);
+	}
+
+	SUBCASE("Layers streaming to the same directory should not mix their cells") {
+		TileMapLayer *other_layer = memnew(TileMapLayer);
+		other_layer->set_tile_set(tile_set);
+		SceneTree::get_singleton()->get_root()->add_child(other_layer);
+		other_layer->set_cell(Vector2i(5, 5), 0, Vector2i(3, 1));
+		other_layer->set_cell_streaming_path(streaming_path);
+		other_layer->set_cell_streaming_radius(0);
+		other_layer->set_cell_streaming_enabled(true);
+
+		layer->set_cell_streaming_focus(Vector2i(500, 500));
+		other_layer->set_cell_streaming_focus(Vector2i(500, 500));
+		layer->set_cell_streaming_enabled(false);
+		other_layer->set_cell_streaming_enabled(false);
+		check_painted(layer);
+		CHECK(other_layer->get_used_cells().size() == 1);
+		CHECK(other_layer->get_cell_atlas_coords(Vector2i(5, 5)) == Vector2i(3, 1));
+
+		memdelete(other_layer);
+	}
+
+	SUBCASE("Saving the scene should include the streamed out cells") {
+		layer->set_cell_streaming_focus(Vector2i(500, 500));
+		Ref<PackedScene> packed_scene;
+		packed_scene.instantiate();
+		REQUIRE(packed_scene->pack(layer) == OK);
+
+		TileMapLayer *loaded_layer = Object::cast_to<TileMapLayer>(packed_scene->instantiate());
+		REQUIRE(loaded_layer);
+		loaded_layer->set_cell_streaming_enabled(false);
+		check_painted(loaded_layer);
+		memdelete(loaded_layer);
+	}
+
+	SUBCASE("Clearing should remove the streamed out cells") {
+		layer->set_cell_streaming_focus(Vector2i(500, 500));
+		layer->clear();
+		CHECK(layer->get_tile_map_data_as_array().is_empty());
+		layer->set_cell_streaming_enabled(false);
+		CHECK(layer->get_used_cells().is_empty());
+		CHECK(DirAccess::get_directories_at(streaming_path).is_empty());
+	}
+
+	memdelete(layer);
+}
+
+TEST_CASE("[SceneTree][TileMapLayer] Rendering quadrants") {
+	Ref<TileSet> tile_set = create_tile_set();
+
+	TileMapLayer *layer = memnew(TileMapLayer);
+	layer->set_tile_set(tile_set);
+	SceneTree::get_singleton()->get_root()->add_child(layer);
+
+	// Enough quadrants to be built on worker threads.
+	for (int y = 0; y < 64; y++) {
+		for (int x = 0; x < 64; x++) {
+			layer->set_cell(Vector2i(x, y), 0, Vector2i((x + y) % 4, 1 + y % 3));
+		}
+	}
+	layer->update_internals();
+
+	// Changing the quadrant size rebuilds every quadrant.
+	layer->set_rendering_quadrant_size(32);
+	layer->update_internals();
+
+	// Paint over a few quadrants, with an animated tile.
+	for (int y = 0; y < 40; y++) {
+		for (int x = 0; x < 40; x++) {
+			layer->set_cell(Vector2i(x, y), 0, Vector2i(0, 0));
+		}
+	}
+	layer->update_internals();
+
+	CHECK(layer->get_used_cells().size() == 64 * 64);
+	CHECK(layer->get_cell_atlas_coords(Vector2i(39, 39)) == Vector2i(0, 0));
+	CHECK(layer->get_cell_atlas_coords(Vector2i(40, 40)) == Vector2i(0, 1 + 40 % 3));
+
+	memdelete(layer);
+}
+
+} // namespace TestTileMapLayer
+
+#endif // TEST_TILE_MAP_LAYER_H
@@ -0,0 +1,213 @@
+/**************************************************************************/
+/*  test_renderer_canvas_cull.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RENDERER_CANVAS_CULL_H
+#define TEST_RENDERER_CANVAS_CULL_H
+
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRendererCanvasCull {
+
+RID create_texture() {
+	return RS::get_singleton()->texture_2d_create(Image::create_empty(4, 4, false, Image::FORMAT_RGBA8));
+}
+
+// Adds one sprite-like item per texture in `p_textures` to the canvas, in order.
+void add_sprites(RID p_canvas, const LocalVector<RID> &p_textures, LocalVector<RID> &r_items) {
+	RenderingServer *rs = RS::get_singleton();
+	for (uint32_t i = 0; i < p_textures.size(); i++) {
+		RID item = rs->canvas_item_create();
+		rs->canvas_item_set_parent(item, p_canvas);
+		rs->canvas_item_set_draw_index(item, i);
+		rs->canvas_item_set_transform(item, Transform2D(0.0, Vector2(i % 256, i / 256) * 4.0));
+		rs->canvas_item_add_texture_rect(item, Rect2(0, 0, 16, 16), p_textures[i]);
+		r_items.push_back(item);
+	}
+}
+
+void render_canvas(RID p_canvas) {
+	RendererCanvasCull::Canvas *canvas = RSG::canvas->canvas_owner.get_or_null(p_canvas);
+	RSG::canvas->render_canvas(RID(), canvas, Transform2D(), nullptr, nullptr, Rect2(0, 0, 4096, 4096), RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED, false, false, 0xFFFFFFFF);
+}
+
+void free_rids(const LocalVector<RID> &p_rids) {
+	for (const RID &rid : p_rids) {
+		RS::get_singleton()->free(rid);
+	}
+}
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Instance runs of identical sprites") {
+	RenderingServer *rs = RS::get_singleton();
+	RID canvas = rs->canvas_create();
+	RID texture_a = create_texture();
+	RID texture_b = create_texture();
+
+	LocalVector<RID> textures;
+	LocalVector<RID> items;
+
+	SUBCASE("Items sharing a texture form a single run") {
+		for (int i = 0; i < 100; i++) {
+			textures.push_back(texture_a);
+		}
+		add_sprites(canvas, textures, items);
+		render_canvas(canvas);
+
+		const RendererCanvasCull::CullStats &stats = RSG::canvas->get_cull_stats();
+		CHECK(stats.item_count == 100);
+		CHECK(stats.instance_run_count == 1);
+		CHECK(stats.instanced_item_count == 100);
+		CHECK(RSG::canvas->canvas_item_owner.get_or_null(items[0])->instance_run_length == 100);
+		CHECK(RSG::canvas->canvas_item_owner.get_or_null(items[1])->instance_run_length == 0);
+	}
+
+	SUBCASE("Texture changes break runs") {
+		for (int i = 0; i < 100; i++) {
+			textures.push_back((i / 10) % 2 ? texture_b : texture_a);
+		}
+		add_sprites(canvas, textures, items);
+		render_canvas(canvas);
+
+		const RendererCanvasCull::CullStats &stats = RSG::canvas->get_cull_stats();
+		CHECK(stats.instance_run_count == 10);
+		CHECK(stats.instanced_item_count == 100);
+
+		textures.clear();
+		free_rids(items);
+		items.clear();
+		for (int i = 0; i < 100; i++) {
+			textures.push_back(i % 2 ? texture_b : texture_a);
+		}
+		add_sprites(canvas, textures, items);
+		render_canvas(canvas);
+
+		CHECK(stats.item_count == 100);
+		CHECK(stats.instance_run_count == 0);
+		CHECK(stats.instanced_item_count == 0);
+	}
+
+	SUBCASE("Items with more than one command are not instanced") {
+		for (int i = 0; i < 10; i++) {
+			textures.push_back(texture_a);
+		}
+		add_sprites(canvas, textures, items);
+		rs->canvas_item_add_rect(items[4], Rect2(0, 0, 8, 8), Color(1, 0, 0));
+		render_canvas(canvas);
+
+		const RendererCanvasCull::CullStats &stats = RSG::canvas->get_cull_stats();
+		CHECK(stats.instance_run_count == 2);
+		CHECK(stats.instanced_item_count == 9);
+		CHECK(RSG::canvas->canvas_item_owner.get_or_null(items[0])->instance_run_length == 4);
+		CHECK(RSG::canvas->canvas_item_owner.get_or_null(items[5])->instance_run_length == 5);
+	}
+
+	free_rids(items);
+	rs->free(texture_a);
+	rs->free(texture_b);
+	rs->free(canvas);
+}
+
+// Creates `p_count` items with a rect each under a new item parented to the canvas.
+RID create_item_tree(RID p_canvas, uint32_t p_count, bool p_y_sort, LocalVector<RID> &r_items) {
+	RenderingServer *rs = RS::get_singleton();
+	RID root = rs->canvas_item_create();
+	rs->canvas_item_set_parent(root, p_canvas);
+	rs->canvas_item_set_sort_children_by_y(root, p_y_sort);
+	rs->canvas_item_add_rect(root, Rect2(0, 0, 16, 16), Color(1, 1, 1));
+	r_items.push_back(root);
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		RID item = rs->canvas_item_create();
+		rs->canvas_item_set_parent(item, root);
+		rs->canvas_item_set_draw_index(item, i);
+		// Scatter y so y-sorting has work to do, and mix z indices and draw behind parent.
+		uint32_t y = (i * 7919) % 1024 + 1;
+		rs->canvas_item_set_transform(item, Transform2D(0.0, Vector2(i % 1024, y)));
+		if (!p_y_sort) {
+			rs->canvas_item_set_z_index(item, int(i % 3) - 1);
+			rs->canvas_item_set_draw_behind_parent(item, i % 5 == 0);
+		}
+		rs->canvas_item_add_rect(item, Rect2(0, 0, 8, 8), Color(1, 1, 1));
+		r_items.push_back(item);
+	}
+	return root;
+}
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Threaded cull keeps the draw order") {
+	RenderingServer *rs = RS::get_singleton();
+	RID canvas = rs->canvas_create();
+	LocalVector<RID> items;
+
+	bool y_sort = false;
+	SUBCASE("Z layers and draw behind parent") {
+		y_sort = false;
+	}
+	SUBCASE("Y-sorted children") {
+		y_sort = true;
+	}
+	create_item_tree(canvas, 2000, y_sort, items);
+
+	RSG::canvas->set_cull_use_threads(false);
+	render_canvas(canvas);
+	LocalVector<RendererCanvasRender::Item *> serial_next;
+	for (const RID &rid : items) {
+		serial_next.push_back(RSG::canvas->canvas_item_owner.get_or_null(rid)->next);
+	}
+
+	RSG::canvas->set_cull_use_threads(true);
+	render_canvas(canvas);
+	bool same_order = true;
+	for (uint32_t i = 0; i < items.size(); i++) {
+		same_order = same_order && serial_next[i] == RSG::canvas->canvas_item_owner.get_or_null(items[i])->next;
+	}
+	CHECK(same_order);
+	CHECK(RSG::canvas->get_cull_stats().item_count == items.size());
+
+	if (y_sort) {
+		// The root sorts first, followed by its children in increasing y.
+		bool sorted = true;
+		const RendererCanvasRender::Item *ci = RSG::canvas->canvas_item_owner.get_or_null(items[0]);
+		for (uint32_t i = 1; i < items.size(); i++) {
+			const RendererCanvasRender::Item *next = ci->next;
+			sorted = sorted && next && next->final_transform.get_origin().y >= ci->final_transform.get_origin().y;
+			ci = next;
+		}
+		CHECK(sorted);
+	}
+
+	free_rids(items);
+	rs->free(canvas);
+}
+
+} // namespace TestRendererCanvasCull
+
+#endif // TEST_RENDERER_CANVAS_CULL_H
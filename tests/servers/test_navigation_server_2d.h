@@ -31,6 +31,8 @@
 #ifndef TEST_NAVIGATION_SERVER_2D_H
 #define TEST_NAVIGATION_SERVER_2D_H
 
+#include "scene/resources/2d/navigation_mesh_source_geometry_data_2d.h"
+#include "scene/resources/2d/navigation_polygon.h"
 #include "servers/navigation_server_2d.h"
 
 #include "tests/test_macros.h"
@@ -41,6 +43,67 @@ TEST_SUITE("[Navigation]") {
 		NavigationServer2D *navigation_server = NavigationServer2D::get_singleton();
 		CHECK_EQ(navigation_server->get_maps().size(), 0);
 	}
+
+	TEST_CASE("[NavigationServer2D] Server should bake tiled navigation polygons like a single bake") {
+		NavigationServer2D *navigation_server = NavigationServer2D::get_singleton();
+
+		Ref<NavigationMeshSourceGeometryData2D> source_geometry;
+		source_geometry.instantiate();
+		source_geometry->add_traversable_outline(PackedVector2Array({ Vector2(0, 0), Vector2(1000, 0), Vector2(1000, 1000), Vector2(0, 1000) }));
+		source_geometry->add_obstruction_outline(PackedVector2Array({ Vector2(400, 400), Vector2(600, 400), Vector2(600, 600), Vector2(400, 600) }));
+
+		auto get_area = [](const Ref<NavigationPolygon> &p_navigation_polygon) {
+			const Vector<Vector2> vertices = p_navigation_polygon->get_vertices();
+			real_t area = 0.0;
+			for (int i = 0; i < p_navigation_polygon->get_polygon_count(); i++) {
+				const Vector<int> polygon = p_navigation_polygon->get_polygon(i);
+				for (int j = 0; j < polygon.size(); j++) {
+					area += vertices[polygon[j]].cross(vertices[polygon[(j + 1) % polygon.size()]]);
+				}
+			}
+			return Math::abs(area) * 0.5;
+		};
+
+		Ref<NavigationPolygon> single_navigation_polygon;
+		single_navigation_polygon.instantiate();
+		navigation_server->bake_from_source_geometry_data(single_navigation_polygon, source_geometry, Callable());
+		CHECK_GT(single_navigation_polygon->get_polygon_count(), 0);
+
+		Ref<NavigationPolygon> tiled_navigation_polygon;
+		tiled_navigation_polygon.instantiate();
+		tiled_navigation_polygon->set_tile_size(256.0);
+		navigation_server->bake_from_source_geometry_data(tiled_navigation_polygon, source_geometry, Callable());
+		CHECK_GT(tiled_navigation_polygon->get_polygon_count(), single_navigation_polygon->get_polygon_count());
+
+		CHECK(get_area(tiled_navigation_polygon) == doctest::Approx(get_area(single_navigation_polygon)).epsilon(0.001));
+
+		// Edges used by a single polygon are on the outlines, never on the tile borders.
+		HashMap<Vector2i, int> edge_uses;
+		for (int i = 0; i < tiled_navigation_polygon->get_polygon_count(); i++) {
+			const Vector<int> polygon = tiled_navigation_polygon->get_polygon(i);
+			for (int j = 0; j < polygon.size(); j++) {
+				const int a = polygon[j];
+				const int b = polygon[(j + 1) % polygon.size()];
+				edge_uses[Vector2i(MIN(a, b), MAX(a, b))] += 1;
+			}
+		}
+		const Vector<Vector2> vertices = tiled_navigation_polygon->get_vertices();
+		int border_edges = 0;
+		for (const KeyValue<Vector2i, int> &E : edge_uses) {
+			CHECK_LE(E.value, 2);
+			if (E.value > 1) {
+				continue;
+			}
+			const Vector2 &a = vertices[E.key.x];
+			const Vector2 &b = vertices[E.key.y];
+			for (int line = 1; line < 4; line++) {
+				if ((a.x == line * 256.0 && b.x == a.x) || (a.y == line * 256.0 && b.y == a.y)) {
+					border_edges++;
+				}
+			}
+		}
+		CHECK_EQ(border_edges, 0);
+	}
 }
 } //namespace TestNavigationServer2D
 
@@ -31,6 +31,7 @@
 #ifndef TEST_NAVIGATION_SERVER_3D_H
 #define TEST_NAVIGATION_SERVER_3D_H
 
+#include "core/config/project_settings.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "servers/navigation_server_3d.h"
@@ -63,6 +64,75 @@ static inline Array build_array(Variant item, Targs... Fargs) {
 	return a;
 }
 
+// Builds a square grid of unit quads with a wall at `p_wall_x` that is open only near the far edge.
+static inline Ref<NavigationMesh> build_walled_grid_navigation_mesh(int p_size, int p_wall_x) {
+	Ref<NavigationMesh> navigation_mesh;
+	navigation_mesh.instantiate();
+
+	Vector<Vector3> vertices;
+	for (int z = 0; z <= p_size; z++) {
+		for (int x = 0; x <= p_size; x++) {
+			vertices.push_back(Vector3(x, 0, z));
+		}
+	}
+	navigation_mesh->set_vertices(vertices);
+
+	for (int z = 0; z < p_size; z++) {
+		for (int x = 0; x < p_size; x++) {
+			if (x == p_wall_x && z < p_size - 4) {
+				continue;
+			}
+			Vector<int> polygon;
+			polygon.push_back(z * (p_size + 1) + x);
+			polygon.push_back(z * (p_size + 1) + x + 1);
+			polygon.push_back((z + 1) * (p_size + 1) + x + 1);
+			polygon.push_back((z + 1) * (p_size + 1) + x);
+			navigation_mesh->add_polygon(polygon);
+		}
+	}
+	return navigation_mesh;
+}
+
+static inline real_t path_length(const Vector<Vector3> &p_path) {
+	real_t length = 0.0;
+	for (int i = 1; i < p_path.size(); i++) {
+		length += p_path[i - 1].distance_to(p_path[i]);
+	}
+	return length;
+}
+
+static inline RID create_linked_regions_map(const Ref<NavigationMesh> &p_navigation_mesh, const LocalVector<Vector3> &p_region_offsets, const Vector3 &p_link_start, const Vector3 &p_link_end, LocalVector<RID> &r_rids) {
+	NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+	RID map = navigation_server->map_create();
+	navigation_server->map_set_active(map, true);
+	navigation_server->map_set_use_async_iterations(map, false);
+	r_rids.push_back(map);
+
+	for (const Vector3 &region_offset : p_region_offsets) {
+		RID region = navigation_server->region_create();
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_transform(region, Transform3D(Basis(), region_offset));
+		navigation_server->region_set_navigation_mesh(region, p_navigation_mesh);
+		r_rids.push_back(region);
+	}
+
+	RID link = navigation_server->link_create();
+	navigation_server->link_set_map(link, map);
+	navigation_server->link_set_start_position(link, p_link_start);
+	navigation_server->link_set_end_position(link, p_link_end);
+	r_rids.push_back(link);
+	return map;
+}
+
+static inline Vector4i get_edge_counts() {
+	NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+	return Vector4i(
+			navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_COUNT),
+			navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_MERGE_COUNT),
+			navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT),
+			navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT));
+}
+
 struct GreaterThan {
 	bool operator()(int p_a, int p_b) const { return p_a > p_b; }
 };
@@ -554,6 +624,59 @@ TEST_SUITE("[Navigation]") {
 		navigation_server->process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should keep head-on agents apart when avoidance enabled") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const real_t time_step = 1.0 / 60.0;
+		const real_t radius = 0.5;
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+
+		// The agents walk towards each other's start position, slightly off the same line so that the solver picks a side.
+		Vector3 positions[2] = { Vector3(0, 0, 0), Vector3(6, 0, 0.1) };
+		const Vector3 targets[2] = { positions[1], positions[0] };
+		RID agents[2];
+		CallableMock avoidance_callback_mocks[2];
+		for (int i = 0; i < 2; i++) {
+			agents[i] = navigation_server->agent_create();
+			navigation_server->agent_set_map(agents[i], map);
+			navigation_server->agent_set_avoidance_enabled(agents[i], true);
+			navigation_server->agent_set_position(agents[i], positions[i]);
+			navigation_server->agent_set_radius(agents[i], radius);
+			navigation_server->agent_set_max_speed(agents[i], 2.0);
+			navigation_server->agent_set_neighbor_distance(agents[i], 10.0);
+			navigation_server->agent_set_time_horizon_agents(agents[i], 2.0);
+			navigation_server->agent_set_velocity(agents[i], (targets[i] - positions[i]).limit_length(2.0));
+			navigation_server->agent_set_avoidance_callback(agents[i], callable_mp(&avoidance_callback_mocks[i], &CallableMock::function1));
+		}
+
+		real_t min_distance = positions[0].distance_to(positions[1]);
+		real_t max_deflection[2] = { 0.0, 0.0 };
+		for (int frame = 0; frame < 240; frame++) {
+			navigation_server->process(time_step);
+			for (int i = 0; i < 2; i++) {
+				const Vector3 safe_velocity = avoidance_callback_mocks[i].function1_latest_arg0;
+				positions[i] += safe_velocity * time_step;
+				max_deflection[i] = MAX(max_deflection[i], Math::abs(positions[i].z - targets[1 - i].z));
+				navigation_server->agent_set_position(agents[i], positions[i]);
+				navigation_server->agent_set_velocity(agents[i], (targets[i] - positions[i]).limit_length(2.0));
+			}
+			min_distance = MIN(min_distance, positions[0].distance_to(positions[1]));
+		}
+
+		CHECK_EQ(avoidance_callback_mocks[0].function1_calls, 240);
+		CHECK_EQ(avoidance_callback_mocks[1].function1_calls, 240);
+		CHECK_MESSAGE(max_deflection[0] > radius * 0.5, "Agent 1 should move to the side to avoid agent 2.");
+		CHECK_MESSAGE(max_deflection[1] > radius * 0.5, "Agent 2 should move to the side to avoid agent 1.");
+		CHECK_MESSAGE(min_distance >= radius * 2.0 - 0.05, "The agents should not overlap while passing each other.");
+		CHECK_MESSAGE(positions[0].x > positions[1].x, "The agents should pass each other.");
+
+		navigation_server->free(agents[1]);
+		navigation_server->free(agents[0]);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
 #ifndef DISABLE_DEPRECATED
 	// This test case uses only public APIs on purpose - other test cases use simplified baking.
 	// FIXME: Remove once deprecated `region_bake_navigation_mesh()` is removed.
@@ -820,6 +943,86 @@ TEST_SUITE("[Navigation]") {
 	}
 	*/
 
+	TEST_CASE("[NavigationServer3D] Server should rebake only the dirty tiles of a tiled navigation mesh") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(5.0);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+		PackedVector3Array faces = { Vector3(-10, 0, -10), Vector3(10, 0, -10), Vector3(10, 0, 10), Vector3(-10, 0, -10), Vector3(10, 0, 10), Vector3(-10, 0, 10) };
+		source_geometry->add_faces(faces, Transform3D());
+
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_GT(navigation_mesh->get_polygon_count(), 0);
+		const HashMap<Vector2i, NavigationMesh::BakedTile> baked_tiles = navigation_mesh->get_baked_tiles();
+		CHECK_EQ(baked_tiles.size(), 16);
+
+		SUBCASE("Tiles should be stitched together") {
+			RID map = navigation_server->map_create();
+			RID region = navigation_server->region_create();
+			navigation_server->map_set_use_async_iterations(map, false);
+			navigation_server->map_set_active(map, true);
+			navigation_server->region_set_map(region, map);
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			const Vector3 start = Vector3(-8, 0, -8);
+			const Vector3 end = Vector3(8, 0, 8);
+			Vector<Vector3> path = navigation_server->map_get_path(map, start, end, true);
+			REQUIRE_GE(path.size(), 2);
+			CHECK(path[path.size() - 1].is_equal_approx(end));
+			CHECK_LT(path_length(path), start.distance_to(end) * 1.1);
+
+			navigation_server->free(region);
+			navigation_server->free(map);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+		}
+
+		SUBCASE("Unchanged tiles should not be rebaked") {
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			const HashMap<Vector2i, NavigationMesh::BakedTile> rebaked_tiles = navigation_mesh->get_baked_tiles();
+			for (const KeyValue<Vector2i, NavigationMesh::BakedTile> &E : baked_tiles) {
+				REQUIRE(rebaked_tiles.has(E.key));
+				CHECK_EQ(rebaked_tiles[E.key].vertices.ptr(), E.value.vertices.ptr());
+			}
+		}
+
+		SUBCASE("Only tiles overlapping changed geometry should be rebaked") {
+			source_geometry->add_projected_obstruction({ Vector3(7, 0, 7), Vector3(8, 0, 7), Vector3(8, 0, 8), Vector3(7, 0, 8) }, 0.0, 2.0, false);
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			const HashMap<Vector2i, NavigationMesh::BakedTile> rebaked_tiles = navigation_mesh->get_baked_tiles();
+			CHECK_NE(rebaked_tiles[Vector2i(1, 1)].source_hash, baked_tiles[Vector2i(1, 1)].source_hash);
+			CHECK_EQ(rebaked_tiles[Vector2i(-2, -2)].vertices.ptr(), baked_tiles[Vector2i(-2, -2)].vertices.ptr());
+			CHECK_EQ(rebaked_tiles[Vector2i(0, 0)].vertices.ptr(), baked_tiles[Vector2i(0, 0)].vertices.ptr());
+		}
+
+		SUBCASE("Tiles should be clipped to the filter baking AABB") {
+			const AABB baking_aabb = AABB(Vector3(-3, -1, -7), Vector3(9, 2, 6));
+			navigation_mesh->set_filter_baking_aabb(baking_aabb);
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_GT(navigation_mesh->get_polygon_count(), 0);
+			for (const Vector3 &vertex : navigation_mesh->get_vertices()) {
+				CHECK_GE(vertex.x, baking_aabb.position.x - 0.01);
+				CHECK_LE(vertex.x, baking_aabb.get_end().x + 0.01);
+				CHECK_GE(vertex.z, baking_aabb.position.z - 0.01);
+				CHECK_LE(vertex.z, baking_aabb.get_end().z + 0.01);
+			}
+
+			// The AABB is part of the tile hash, so moving it rebakes the tiles it overlaps.
+			const HashMap<Vector2i, NavigationMesh::BakedTile> clipped_tiles = navigation_mesh->get_baked_tiles();
+			navigation_mesh->set_filter_baking_aabb(AABB(Vector3(-3, -1, -7), Vector3(8.5, 2, 6)));
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			const HashMap<Vector2i, NavigationMesh::BakedTile> rebaked_tiles = navigation_mesh->get_baked_tiles();
+			REQUIRE(rebaked_tiles.has(Vector2i(1, -2)));
+			CHECK_NE(rebaked_tiles[Vector2i(1, -2)].source_hash, clipped_tiles[Vector2i(1, -2)].source_hash);
+		}
+
+		SUBCASE("Changing the tile size should discard the baked tiles") {
+			navigation_mesh->set_tile_size(10.0);
+			CHECK(navigation_mesh->get_baked_tiles().is_empty());
+		}
+	}
+
 	TEST_CASE("[NavigationServer3D] Server should simplify path properly") {
 		real_t simplify_epsilon = 0.2;
 		Vector<Vector3> source_path;
@@ -835,6 +1038,323 @@ TEST_SUITE("[Navigation]") {
 		CHECK_EQ(simplified_path.size(), 4);
 	}
 
+	TEST_CASE("[NavigationServer3D] Hierarchical path queries should match flat path queries") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const int grid_size = 96;
+		Ref<NavigationMesh> navigation_mesh = build_walled_grid_navigation_mesh(grid_size, grid_size / 2);
+
+		const Variant cluster_size_setting = ProjectSettings::get_singleton()->get_setting("navigation/pathfinding/cluster_size");
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+
+		const Vector3 start = Vector3(2.5, 0, 2.5);
+		const int query_count = 16;
+		LocalVector<Vector3> targets;
+		for (int i = 0; i < query_count; i++) {
+			targets.push_back(Vector3(grid_size - 2.5, 0, 2.5 + i * (grid_size - 5) / (query_count - 1)));
+		}
+
+		// The cluster size is read again on each map sync.
+		const auto get_paths = [&](real_t p_cluster_size) {
+			ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/cluster_size", p_cluster_size);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+			LocalVector<Vector<Vector3>> paths;
+			for (const Vector3 &target : targets) {
+				paths.push_back(navigation_server->map_get_path(map, start, target, true));
+			}
+			return paths;
+		};
+
+		SUBCASE("Paths around the wall should have the same length") {
+			const LocalVector<Vector<Vector3>> flat_paths = get_paths(0.0);
+			const LocalVector<Vector<Vector3>> hierarchical_paths = get_paths(8.0);
+			for (int i = 0; i < query_count; i++) {
+				REQUIRE_GT(flat_paths[i].size(), 2);
+				REQUIRE_GT(hierarchical_paths[i].size(), 2);
+				CHECK(hierarchical_paths[i][hierarchical_paths[i].size() - 1].is_equal_approx(flat_paths[i][flat_paths[i].size() - 1]));
+				const real_t flat_length = path_length(flat_paths[i]);
+				CHECK(Math::is_equal_approx(path_length(hierarchical_paths[i]), flat_length, real_t(flat_length * 0.01)));
+			}
+		}
+
+		SUBCASE("Changing the region should update the cluster graph") {
+			get_paths(8.0);
+			Ref<NavigationMesh> open_navigation_mesh = build_walled_grid_navigation_mesh(grid_size, -1);
+			navigation_server->region_set_navigation_mesh(region, open_navigation_mesh);
+
+			const LocalVector<Vector<Vector3>> hierarchical_paths = get_paths(8.0);
+			for (int i = 0; i < query_count; i++) {
+				CHECK(Math::is_equal_approx(path_length(hierarchical_paths[i]), targets[i].distance_to(start)));
+			}
+		}
+
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/cluster_size", cluster_size_setting);
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Batched and cached path queries should match single path queries") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const int grid_size = 32;
+		Ref<NavigationMesh> navigation_mesh = build_walled_grid_navigation_mesh(grid_size, grid_size / 2);
+
+		const Variant path_cache_size_setting = ProjectSettings::get_singleton()->get_setting("navigation/pathfinding/path_cache_size");
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/path_cache_size", 16);
+		RID map = navigation_server->map_create();
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/path_cache_size", path_cache_size_setting);
+
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		SUBCASE("Repeated queries should reuse the cached corridor for new positions") {
+			Vector<Vector3> first_path = navigation_server->map_get_path(map, Vector3(2.5, 0, 2.5), Vector3(grid_size - 2.5, 0, 2.5), true);
+			Vector<Vector3> second_path = navigation_server->map_get_path(map, Vector3(2.5, 0, 2.5), Vector3(grid_size - 2.5, 0, 2.5), true);
+			CHECK_EQ(first_path, second_path);
+
+			// Same polygons, but different positions inside of them.
+			Vector<Vector3> shifted_path = navigation_server->map_get_path(map, Vector3(2.25, 0, 2.75), Vector3(grid_size - 2.75, 0, 2.25), true);
+			REQUIRE_GT(shifted_path.size(), 2);
+			CHECK(shifted_path[0].is_equal_approx(Vector3(2.25, 0, 2.75)));
+			CHECK(shifted_path[shifted_path.size() - 1].is_equal_approx(Vector3(grid_size - 2.75, 0, 2.25)));
+		}
+
+		SUBCASE("Batched queries should yield the same paths as single queries") {
+			TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+			TypedArray<NavigationPathQueryResult3D> batch_results;
+			for (int i = 0; i < 16; i++) {
+				Ref<NavigationPathQueryParameters3D> query_parameters;
+				query_parameters.instantiate();
+				query_parameters->set_map(map);
+				query_parameters->set_start_position(Vector3(2.5, 0, 2.5 + i));
+				query_parameters->set_target_position(Vector3(grid_size - 2.5, 0, 2.5 + i));
+				batch_parameters.push_back(query_parameters);
+
+				Ref<NavigationPathQueryResult3D> query_result;
+				query_result.instantiate();
+				batch_results.push_back(query_result);
+			}
+
+			CallableMock callback_mock;
+			navigation_server->query_paths(batch_parameters, batch_results, callable_mp(&callback_mock, &CallableMock::function1).bind(true));
+			CHECK_EQ(callback_mock.function1_calls, 1);
+
+			for (int i = 0; i < batch_parameters.size(); i++) {
+				Ref<NavigationPathQueryParameters3D> query_parameters = batch_parameters[i];
+				Ref<NavigationPathQueryResult3D> batch_result = batch_results[i];
+				Ref<NavigationPathQueryResult3D> single_result;
+				single_result.instantiate();
+				navigation_server->query_path(query_parameters, single_result);
+				CHECK_GT(batch_result->get_path().size(), 0);
+				CHECK_EQ(batch_result->get_path(), single_result->get_path());
+			}
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should integrate flow fields towards their targets") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const int grid_size = 16;
+		const int wall_x = grid_size / 2;
+		Ref<NavigationMesh> navigation_mesh = build_walled_grid_navigation_mesh(grid_size, wall_x);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+
+		const Vector3 target = Vector3(grid_size - 2.5, 0, 2.5);
+		const Vector3 start = Vector3(2.5, 0, 2.5);
+
+		RID flow_field = navigation_server->flow_field_create();
+		CHECK(flow_field.is_valid());
+		CHECK_EQ(navigation_server->flow_field_get_iteration_id(flow_field), 0);
+		navigation_server->flow_field_set_map(flow_field, map);
+		navigation_server->flow_field_set_targets(flow_field, { target });
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		CHECK_EQ(navigation_server->flow_field_get_map(flow_field), map);
+		CHECK_EQ(navigation_server->flow_field_get_targets(flow_field).size(), 1);
+		const uint32_t iteration_id = navigation_server->flow_field_get_iteration_id(flow_field);
+		CHECK_GT(iteration_id, 0);
+
+		SUBCASE("The field should lead around the wall") {
+			CHECK(navigation_server->flow_field_get_direction(flow_field, start).is_normalized());
+
+			const real_t distance = navigation_server->flow_field_get_distance(flow_field, start);
+			const real_t shortest_path_length = path_length(navigation_server->map_get_path(map, start, target, true));
+			CHECK_GT(distance, start.distance_to(target));
+			CHECK_GE(distance, shortest_path_length - 0.01);
+			CHECK_LT(distance, shortest_path_length * 1.5);
+
+			CHECK_EQ(navigation_server->flow_field_get_direction(flow_field, Vector3(-100, 0, -100)), Vector3());
+			CHECK_EQ(navigation_server->flow_field_get_distance(flow_field, target), doctest::Approx(0.0));
+
+			// Following the field should pass through the opening at the far end of the wall.
+			Vector3 position = start;
+			real_t max_z = position.z;
+			for (int step = 0; step < 400 && position.distance_to(target) > 0.25; step++) {
+				position += navigation_server->flow_field_get_direction(flow_field, position) * 0.2;
+				max_z = MAX(max_z, position.z);
+			}
+			CHECK_LE(position.distance_to(target), 0.25);
+			CHECK_GE(max_z, grid_size - 4);
+
+			// Nothing changed, so there should be no new iteration.
+			navigation_server->process(0.0);
+			CHECK_EQ(navigation_server->flow_field_get_iteration_id(flow_field), iteration_id);
+		}
+
+		SUBCASE("Static obstacles should close the field") {
+			RID obstacle = navigation_server->obstacle_create();
+			navigation_server->obstacle_set_map(obstacle, map);
+			navigation_server->obstacle_set_position(obstacle, Vector3(wall_x, 0, grid_size - 4));
+			navigation_server->obstacle_set_vertices(obstacle, { Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(1, 0, 4), Vector3(0, 0, 4) });
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			CHECK_GT(navigation_server->flow_field_get_iteration_id(flow_field), iteration_id);
+			CHECK_EQ(navigation_server->flow_field_get_direction(flow_field, start), Vector3());
+			CHECK_FALSE(Math::is_finite(navigation_server->flow_field_get_distance(flow_field, start)));
+
+			navigation_server->free(obstacle);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			CHECK(Math::is_finite(navigation_server->flow_field_get_distance(flow_field, start)));
+		}
+
+		navigation_server->free(flow_field);
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Incremental map rebuilds should match full map rebuilds") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const int grid_size = 8;
+		Ref<NavigationMesh> navigation_mesh = build_walled_grid_navigation_mesh(grid_size, -1);
+
+		// Two regions share a border, a third one is within the edge connection margin and a fourth one is only reachable by the link.
+		LocalVector<Vector3> region_offsets;
+		region_offsets.push_back(Vector3(0, 0, 0));
+		region_offsets.push_back(Vector3(grid_size, 0, 0));
+		region_offsets.push_back(Vector3(2 * grid_size - 0.1, 0, 0));
+		region_offsets.push_back(Vector3(0, 0, grid_size + 4));
+		Vector3 link_start = Vector3(2.5, 0, grid_size - 0.5);
+		Vector3 link_end = Vector3(2.5, 0, grid_size + 4.5);
+
+		LocalVector<RID> rids;
+		RID map = create_linked_regions_map(navigation_mesh, region_offsets, link_start, link_end, rids);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		const Vector3 start = Vector3(2.5, 0, 2.5);
+		const Vector3 target = Vector3(2.5, 0, grid_size + 6.5);
+		const Vector4i initial_edge_counts = get_edge_counts();
+		const real_t initial_path_length = path_length(navigation_server->map_get_path(map, start, target, true));
+		CHECK_GT(initial_edge_counts.z, 0);
+		CHECK(Math::is_equal_approx(initial_path_length, target.distance_to(start)));
+
+		SUBCASE("Moving a link should keep the region connections") {
+			link_start = Vector3(5.5, 0, grid_size - 0.5);
+			link_end = Vector3(5.5, 0, grid_size + 4.5);
+			navigation_server->link_set_start_position(rids[rids.size() - 1], link_start);
+			navigation_server->link_set_end_position(rids[rids.size() - 1], link_end);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			CHECK_EQ(get_edge_counts(), initial_edge_counts);
+			CHECK_GT(path_length(navigation_server->map_get_path(map, start, target, true)), initial_path_length + 1.0);
+		}
+
+		SUBCASE("Moving a region should reconnect its edges") {
+			region_offsets[2] = Vector3(2 * grid_size, 0, 0);
+			navigation_server->region_set_transform(rids[3], Transform3D(Basis(), region_offsets[2]));
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			CHECK_EQ(get_edge_counts().y, initial_edge_counts.y + grid_size);
+			CHECK_LT(get_edge_counts().z, initial_edge_counts.z);
+		}
+
+		SUBCASE("Removing a region should drop its connections") {
+			region_offsets.remove_at(1);
+			navigation_server->free(rids[2]);
+			rids.remove_at(2);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			CHECK_LT(get_edge_counts().x, initial_edge_counts.x);
+			const Vector3 unreachable_target = Vector3(2 * grid_size + 2.5, 0, 2.5);
+			const Vector<Vector3> unreachable_path = navigation_server->map_get_path(map, start, unreachable_target, true);
+			REQUIRE_GT(unreachable_path.size(), 0);
+			CHECK_GT(unreachable_path[unreachable_path.size() - 1].distance_to(unreachable_target), 1.0);
+		}
+
+		// The incremental build should yield the same map as a full build of the final state.
+		const Vector4i edge_counts = get_edge_counts();
+		const Vector<Vector3> path = navigation_server->map_get_path(map, start, target, true);
+		navigation_server->map_set_active(map, false);
+
+		LocalVector<RID> reference_rids;
+		RID reference_map = create_linked_regions_map(navigation_mesh, region_offsets, link_start, link_end, reference_rids);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		CHECK_EQ(get_edge_counts(), edge_counts);
+		const Vector<Vector3> reference_path = navigation_server->map_get_path(reference_map, start, target, true);
+		CHECK(Math::is_equal_approx(path_length(path), path_length(reference_path)));
+
+		// Free the regions and links before their maps.
+		for (int i = rids.size() - 1; i >= 0; i--) {
+			navigation_server->free(rids[i]);
+		}
+		for (int i = reference_rids.size() - 1; i >= 0; i--) {
+			navigation_server->free(reference_rids[i]);
+		}
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] 'ProcessInfo' should report path query statistics") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		const int grid_size = 16;
+		Ref<NavigationMesh> navigation_mesh = build_walled_grid_navigation_mesh(grid_size, grid_size / 2);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_COUNT), 0);
+
+		navigation_server->map_get_path(map, Vector3(2.5, 0, 2.5), Vector3(grid_size - 2.5, 0, 2.5), true);
+		navigation_server->map_get_path(map, Vector3(2.5, 0, 4.5), Vector3(grid_size - 2.5, 0, 4.5), true);
+		navigation_server->process(0.0); // Statistics are collected during the sync.
+
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_COUNT), 2);
+		CHECK_GT(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_POLYGON_COUNT), 0);
+		CHECK_GE(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_TIME), navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_MAX_TIME));
+
+		navigation_server->process(0.0); // Statistics only cover the last frame.
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_COUNT), 0);
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_POLYGON_COUNT), 0);
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_MAP_BUILD_TIME), 0);
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
 	TEST_CASE("[Heap] size") {
 		gd::Heap<int> heap;
 
@@ -0,0 +1,449 @@
+/**************************************************************************/
+/*  test_physics_server_3d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PHYSICS_SERVER_3D_H
+#define TEST_PHYSICS_SERVER_3D_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/safe_refcount.h"
+#include "scene/3d/physics/collision_shape_3d.h"
+#include "scene/3d/physics/rigid_body_3d.h"
+#include "scene/main/window.h"
+#include "scene/resources/3d/box_shape_3d.h"
+#include "servers/physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer3D {
+
+struct ConcurrentQueryData {
+	PhysicsDirectSpaceState3D *state = nullptr;
+	int column_count = 0;
+	SafeNumeric<uint32_t> hits;
+	SafeNumeric<uint32_t> misses;
+};
+
+static void concurrent_query_task(void *p_userdata, uint32_t p_index) {
+	ConcurrentQueryData *data = static_cast<ConcurrentQueryData *>(p_userdata);
+
+	for (int i = 0; i < 200; i++) {
+		int column = (p_index + i) % data->column_count;
+
+		PhysicsDirectSpaceState3D::RayParameters parameters;
+		parameters.from = Vector3(column * 4.0, 10.0, 0.0);
+		parameters.to = Vector3(column * 4.0, -10.0, 0.0);
+
+		PhysicsDirectSpaceState3D::RayResult result;
+		if (data->state->intersect_ray(parameters, result) && Math::is_equal_approx(result.position.y, (real_t)1.0)) {
+			data->hits.increment();
+		} else {
+			data->misses.increment();
+		}
+	}
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Concurrent space state queries while stepping") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+
+	ERR_PRINT_OFF;
+	PhysicsDirectSpaceState3D *state = physics_server->space_get_concurrent_direct_state(space);
+	ERR_PRINT_ON;
+	if (state == nullptr) {
+		// Not supported by this physics server.
+		physics_server->free(space);
+		return;
+	}
+
+	RID box = physics_server->box_shape_create();
+	physics_server->shape_set_data(box, Vector3(1.0, 1.0, 1.0));
+
+	const int column_count = 32;
+	LocalVector<RID> bodies;
+
+	// Static columns that the queries aim at.
+	for (int i = 0; i < column_count; i++) {
+		RID body = physics_server->body_create();
+		physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+		physics_server->body_add_shape(body, box);
+		physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 4.0, 0.0, 0.0)));
+		physics_server->body_set_space(body, space);
+		bodies.push_back(body);
+	}
+
+	// Falling bodies away from the columns, so the step has work to do.
+	for (int i = 0; i < 256; i++) {
+		RID body = physics_server->body_create();
+		physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+		physics_server->body_add_shape(body, box);
+		physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3((i % 16) * 3.0, 5.0 + (i / 16) * 3.0, 50.0)));
+		physics_server->body_set_space(body, space);
+		bodies.push_back(body);
+	}
+
+	physics_server->set_active(true);
+
+	// The snapshot is built at the end of the first step after the state was requested.
+	physics_server->step(1.0 / 60.0);
+
+	ConcurrentQueryData data;
+	data.state = state;
+	data.column_count = column_count;
+
+	const int task_count = 64;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&concurrent_query_task, &data, task_count, -1, true, SNAME("Concurrent physics queries"));
+
+	int steps = 0;
+	while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group) || steps < 10) {
+		physics_server->step(1.0 / 60.0);
+		physics_server->sync();
+		physics_server->flush_queries();
+		physics_server->end_sync();
+		steps++;
+	}
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK_MESSAGE(data.hits.get() == task_count * 200, "All rays should hit the top of their column.");
+	CHECK(data.misses.get() == 0);
+
+	// Freeing an unrelated shape keeps the rest of the snapshot.
+	RID unused_shape = physics_server->sphere_shape_create();
+	physics_server->free(unused_shape);
+	data.hits.set(0);
+	concurrent_query_task(&data, 0);
+	CHECK(data.hits.get() == 200);
+
+	for (const RID &body : bodies) {
+		physics_server->free(body);
+	}
+	physics_server->free(box);
+	physics_server->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Continuous collision detection with sub-steps") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+	physics_server->space_set_param(space, PhysicsServer3D::SPACE_PARAM_SOLVER_SUBSTEPS, 2);
+	CHECK(physics_server->space_get_param(space, PhysicsServer3D::SPACE_PARAM_SOLVER_SUBSTEPS) == 2);
+
+	// A thin wall, much thinner than the distance the projectile covers in one sub-step.
+	RID wall_shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(wall_shape, Vector3(0.05, 4.0, 4.0));
+	RID wall = physics_server->body_create();
+	physics_server->body_set_mode(wall, PhysicsServer3D::BODY_MODE_STATIC);
+	physics_server->body_add_shape(wall, wall_shape);
+	physics_server->body_set_state(wall, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(10.0, 0.0, 0.0)));
+	physics_server->body_set_space(wall, space);
+
+	RID sphere_shape = physics_server->sphere_shape_create();
+	physics_server->shape_set_data(sphere_shape, 0.25);
+	RID projectile = physics_server->body_create();
+	physics_server->body_set_mode(projectile, PhysicsServer3D::BODY_MODE_RIGID);
+	physics_server->body_add_shape(projectile, sphere_shape);
+	physics_server->body_set_param(projectile, PhysicsServer3D::BODY_PARAM_GRAVITY_SCALE, 0.0);
+	physics_server->body_set_enable_continuous_collision_detection(projectile, true);
+	physics_server->body_set_state(projectile, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D());
+	physics_server->body_set_state(projectile, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(300.0, 0.0, 0.0));
+	physics_server->body_set_space(projectile, space);
+
+	physics_server->set_active(true);
+
+	for (int i = 0; i < 30; i++) {
+		physics_server->step(1.0 / 30.0);
+	}
+
+	Transform3D xform = physics_server->body_get_state(projectile, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	CHECK_MESSAGE(xform.origin.x < 10.0, "The projectile should not tunnel through the wall.");
+
+	physics_server->free(projectile);
+	physics_server->free(wall);
+	physics_server->free(sphere_shape);
+	physics_server->free(wall_shape);
+	physics_server->free(space);
+}
+
+static bool cast_down(PhysicsDirectSpaceState3D *p_state, const Vector3 &p_position, Vector3 &r_hit) {
+	PhysicsDirectSpaceState3D::RayParameters parameters;
+	parameters.from = p_position + Vector3(0.0, 50.0, 0.0);
+	parameters.to = p_position - Vector3(0.0, 50.0, 0.0);
+
+	PhysicsDirectSpaceState3D::RayResult result;
+	if (!p_state->intersect_ray(parameters, result)) {
+		return false;
+	}
+	r_hit = result.position;
+	return true;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Concave polygon shape queries") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+
+	// A 64x64 grid of quads, with a raised block in one corner.
+	PackedVector3Array faces;
+	for (int z = 0; z < 64; z++) {
+		for (int x = 0; x < 64; x++) {
+			real_t height = (x >= 48 && z >= 48) ? 3.0 : 0.0;
+			Vector3 a(x, height, z);
+			Vector3 b(x + 1, height, z);
+			Vector3 c(x, height, z + 1);
+			Vector3 d(x + 1, height, z + 1);
+			faces.push_back(a);
+			faces.push_back(b);
+			faces.push_back(c);
+			faces.push_back(b);
+			faces.push_back(d);
+			faces.push_back(c);
+		}
+	}
+
+	RID trimesh = physics_server->concave_polygon_shape_create();
+	Dictionary data;
+	data["faces"] = faces;
+	data["backface_collision"] = true;
+	physics_server->shape_set_data(trimesh, data);
+
+	RID body = physics_server->body_create();
+	physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+	physics_server->body_add_shape(body, trimesh);
+	physics_server->body_set_space(body, space);
+
+	physics_server->set_active(true);
+	physics_server->step(1.0 / 60.0);
+
+	PhysicsDirectSpaceState3D *state = physics_server->space_get_direct_state(space);
+
+	Vector3 hit;
+	CHECK(cast_down(state, Vector3(10.3, 0.0, 20.7), hit));
+	CHECK(hit.is_equal_approx(Vector3(10.3, 0.0, 20.7)));
+	CHECK(cast_down(state, Vector3(50.5, 0.0, 60.25), hit));
+	CHECK(hit.is_equal_approx(Vector3(50.5, 3.0, 60.25)));
+	CHECK_FALSE(cast_down(state, Vector3(70.0, 0.0, 10.0), hit));
+
+	RID sphere = physics_server->sphere_shape_create();
+	physics_server->shape_set_data(sphere, 0.5);
+
+	PhysicsDirectSpaceState3D::ShapeParameters parameters;
+	parameters.shape_rid = sphere;
+	parameters.transform.origin = Vector3(20.0, 0.25, 20.0);
+	PhysicsDirectSpaceState3D::ShapeResult results[1];
+	CHECK(state->intersect_shape(parameters, results, 1) == 1);
+
+	parameters.transform.origin = Vector3(20.0, 1.5, 20.0);
+	CHECK(state->intersect_shape(parameters, results, 1) == 0);
+
+	physics_server->free(body);
+	physics_server->free(sphere);
+	physics_server->free(trimesh);
+	physics_server->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Height map shape region updates") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+
+	const int size = 129;
+	Vector<real_t> heights;
+	heights.resize(size * size);
+	heights.fill(0.0);
+
+	RID heightmap = physics_server->heightmap_shape_create();
+	Dictionary data;
+	data["width"] = size;
+	data["depth"] = size;
+	data["heights"] = heights;
+	data["min_height"] = 0.0;
+	data["max_height"] = 4.0;
+	physics_server->shape_set_data(heightmap, data);
+
+	RID body = physics_server->body_create();
+	physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+	physics_server->body_add_shape(body, heightmap);
+	physics_server->body_set_space(body, space);
+
+	physics_server->set_active(true);
+	physics_server->step(1.0 / 60.0);
+
+	PhysicsDirectSpaceState3D *state = physics_server->space_get_direct_state(space);
+
+	// The shape is centered on the origin, vertex (100, 100) is at (36, y, 36).
+	Vector3 hit;
+	CHECK(cast_down(state, Vector3(36.0, 0.0, 36.0), hit));
+	CHECK(Math::is_zero_approx(hit.y));
+
+	// Raise a patch of the terrain and only report that region as changed.
+	for (int z = 96; z < 104; z++) {
+		for (int x = 96; x < 104; x++) {
+			heights.write[z * size + x] = 4.0;
+		}
+	}
+	data["heights"] = heights;
+	data["region"] = Rect2i(96, 96, 8, 8);
+	physics_server->shape_set_data(heightmap, data);
+
+	CHECK(cast_down(state, Vector3(36.0, 0.0, 36.0), hit));
+	CHECK(Math::is_equal_approx(hit.y, (real_t)4.0));
+
+	// A long, low ray crossing the grid at chunk level.
+	PhysicsDirectSpaceState3D::RayParameters parameters;
+	parameters.from = Vector3(-60.0, 3.0, 36.0);
+	parameters.to = Vector3(60.0, 3.0, 36.0);
+	PhysicsDirectSpaceState3D::RayResult result;
+	CHECK(state->intersect_ray(parameters, result));
+	CHECK(result.position.x > 30.0);
+	CHECK(result.position.x < 33.0);
+
+	RID sphere = physics_server->sphere_shape_create();
+	physics_server->shape_set_data(sphere, 0.5);
+
+	PhysicsDirectSpaceState3D::ShapeParameters shape_parameters;
+	shape_parameters.shape_rid = sphere;
+	shape_parameters.transform.origin = Vector3(36.0, 3.8, 36.0);
+	PhysicsDirectSpaceState3D::ShapeResult results[1];
+	CHECK(state->intersect_shape(shape_parameters, results, 1) == 1);
+
+	shape_parameters.transform.origin = Vector3(-36.0, 3.0, -36.0);
+	CHECK(state->intersect_shape(shape_parameters, results, 1) == 0);
+
+	physics_server->free(body);
+	physics_server->free(sphere);
+	physics_server->free(heightmap);
+	physics_server->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Step statistics") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+
+	RID floor_shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(floor_shape, Vector3(20.0, 0.5, 20.0));
+	RID floor = physics_server->body_create();
+	physics_server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	physics_server->body_add_shape(floor, floor_shape);
+	physics_server->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0.0, -0.5, 0.0)));
+	physics_server->body_set_space(floor, space);
+
+	RID sphere = physics_server->sphere_shape_create();
+	physics_server->shape_set_data(sphere, 0.5);
+
+	LocalVector<RID> bodies;
+	for (int i = 0; i < 4; i++) {
+		RID body = physics_server->body_create();
+		physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+		physics_server->body_add_shape(body, sphere);
+		physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 3.0, 0.45, 0.0)));
+		physics_server->body_set_space(body, space);
+		bodies.push_back(body);
+	}
+
+	physics_server->set_active(true);
+	physics_server->step(1.0 / 60.0);
+
+	CHECK(physics_server->get_process_info(PhysicsServer3D::INFO_ACTIVE_OBJECTS) == 4);
+	CHECK(physics_server->get_process_info(PhysicsServer3D::INFO_COLLISION_PAIRS) > 0);
+	if (physics_server->is_class("GodotPhysicsServer3D")) {
+		CHECK(physics_server->get_process_info(PhysicsServer3D::INFO_NARROWPHASE_TESTS) == 4);
+		CHECK(physics_server->get_process_info(PhysicsServer3D::INFO_LARGEST_ISLAND) == 1);
+	}
+	CHECK(physics_server->get_process_info(PhysicsServer3D::INFO_SLEEPING_OBJECTS) == 0);
+
+	// Resting bodies fall asleep after a while.
+	for (int i = 0; i < 120; i++) {
+		physics_server->step(1.0 / 60.0);
+	}
+	CHECK(physics_server->get_process_info(PhysicsServer3D::INFO_SLEEPING_OBJECTS) == 4);
+
+	// Static bodies and bodies outside of the space are not counted.
+	physics_server->body_set_mode(bodies[0], PhysicsServer3D::BODY_MODE_STATIC);
+	physics_server->body_set_space(bodies[1], RID());
+	CHECK(physics_server->get_process_info(PhysicsServer3D::INFO_SLEEPING_OBJECTS) == 2);
+
+	for (const RID &body : bodies) {
+		physics_server->free(body);
+	}
+	physics_server->free(floor);
+	physics_server->free(sphere);
+	physics_server->free(floor_shape);
+	physics_server->free(space);
+}
+
+TEST_CASE("[SceneTree][RigidBody3D] Bulk state sync matches per-body callbacks") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	Ref<BoxShape3D> box;
+	box.instantiate();
+
+	// The contact monitor keeps the second body on the per-body callback path.
+	RigidBody3D *bodies[2];
+	for (int i = 0; i < 2; i++) {
+		bodies[i] = memnew(RigidBody3D);
+		CollisionShape3D *shape = memnew(CollisionShape3D);
+		shape->set_shape(box);
+		bodies[i]->add_child(shape);
+		bodies[i]->set_position(Vector3(i * 10.0, 5.0, 0.0));
+		bodies[i]->set_linear_velocity(Vector3(1.0, 2.0, 0.0));
+		bodies[i]->set_angular_velocity(Vector3(0.0, 1.0, 0.0));
+		SceneTree::get_singleton()->get_root()->add_child(bodies[i]);
+	}
+	bodies[1]->set_contact_monitor(true);
+	bodies[1]->set_max_contacts_reported(1);
+
+	physics_server->set_active(true);
+	for (int i = 0; i < 30; i++) {
+		physics_server->step(1.0 / 60.0);
+		physics_server->sync();
+		physics_server->flush_queries();
+		physics_server->end_sync();
+	}
+
+	CHECK(bodies[0]->get_position().y < 5.0);
+	CHECK((bodies[0]->get_position() + Vector3(10.0, 0.0, 0.0)).is_equal_approx(bodies[1]->get_position()));
+	CHECK(bodies[0]->get_basis().is_equal_approx(bodies[1]->get_basis()));
+	CHECK(bodies[0]->get_linear_velocity().is_equal_approx(bodies[1]->get_linear_velocity()));
+	CHECK(bodies[0]->get_angular_velocity().is_equal_approx(bodies[1]->get_angular_velocity()));
+	CHECK(bodies[0]->is_sleeping() == bodies[1]->is_sleeping());
+
+	memdelete(bodies[0]);
+	memdelete(bodies[1]);
+}
+
+} // namespace TestPhysicsServer3D
+
+#endif // TEST_PHYSICS_SERVER_3D_H
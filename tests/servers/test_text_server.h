@@ -959,6 +959,71 @@ TEST_SUITE("[TextServer]") {
 				font.clear();
 			}
 		}
+
+		SUBCASE("[TextServer] Batch shaping and shaping cache") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || !ts->has_feature(TextServer::FEATURE_SIMPLE_LAYOUT)) {
+					continue;
+				}
+
+				RID font1 = ts->create_font();
+				ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_set_allow_system_fallback(font1, false);
+
+				Array font;
+				font.push_back(font1);
+
+				// Paragraphs repeat, so that both cached and newly shaped paragraphs are compared.
+				Vector<RID> expected;
+				TypedArray<RID> batch;
+				for (int j = 0; j < 64; j++) {
+					String text = vformat("Paragraph %d: The quick brown fox jumps over the lazy dog.", j % 16);
+
+					RID ctx = ts->create_shaped_text();
+					ts->shaped_text_add_string(ctx, text, font, 16);
+					CHECK_MESSAGE(ts->shaped_text_shape(ctx), "Shaping failed.");
+					expected.push_back(ctx);
+
+					ctx = ts->create_shaped_text();
+					ts->shaped_text_add_string(ctx, text, font, 16);
+					batch.push_back(ctx);
+				}
+
+				CHECK_MESSAGE(ts->shaped_text_shape_batch(batch), "Batch shaping failed.");
+				for (int j = 0; j < batch.size(); j++) {
+					CHECK(ts->shaped_text_is_ready(batch[j]));
+					CHECK(ts->shaped_text_get_size(batch[j]) == ts->shaped_text_get_size(expected[j]));
+
+					int gl_size = ts->shaped_text_get_glyph_count(batch[j]);
+					REQUIRE(gl_size == ts->shaped_text_get_glyph_count(expected[j]));
+					const Glyph *glyphs = ts->shaped_text_get_glyphs(batch[j]);
+					const Glyph *expected_glyphs = ts->shaped_text_get_glyphs(expected[j]);
+					for (int k = 0; k < gl_size; k++) {
+						CHECK(glyphs[k].index == expected_glyphs[k].index);
+						CHECK(glyphs[k].start == expected_glyphs[k].start);
+						CHECK(glyphs[k].end == expected_glyphs[k].end);
+						CHECK(glyphs[k].advance == expected_glyphs[k].advance);
+					}
+				}
+
+				// Changing a font must not reuse paragraphs shaped with the old settings.
+				double width = ts->shaped_text_get_width(expected[0]);
+				ts->font_set_spacing(font1, TextServer::SPACING_GLYPH, 4);
+				RID ctx = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx, "Paragraph 0: The quick brown fox jumps over the lazy dog.", font, 16);
+				CHECK(ts->shaped_text_get_width(ctx) > width);
+				ts->free_rid(ctx);
+
+				for (int j = 0; j < batch.size(); j++) {
+					ts->free_rid(batch[j]);
+					ts->free_rid(expected[j]);
+				}
+				ts->free_rid(font1);
+			}
+		}
 	}
 }
 }; // namespace TestTextServer